@@ -41,6 +41,7 @@ file=${2##*/}
 name=${file%.*}
 
 class=${name#Abstract}
+class=${class#Striped}
 
 # Now we rip off the types.
 rem=${class##[A-Z]+([a-z])}
@@ -555,22 +556,44 @@ $(if [[ "${CLASS[$k]}" != "" && "${CLASS[$v]}" != "" ]]; then\
 "#define OPEN_HASH_BIG_SET ${TYPE_CAP[$k]}${Linked}Open${Custom}HashBigSet\n"\
 "#define OPEN_DOUBLE_HASH_SET ${TYPE_CAP[$k]}${Linked}Open${Custom}DoubleHashSet\n"\
 "#define OPEN_HASH_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}${Linked}Open${Custom}HashMap\n"\
+"#define COMPACT_OPEN_HASH_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}CompactOpenHashMap\n"\
+"#define LINKED_OPEN_HASH_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}LinkedOpenHashMap\n"\
 "#define OPEN_HASH_BIG_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}${Linked}Open${Custom}HashBigMap\n"\
 "#define STRIPED_OPEN_HASH_MAP Striped${TYPE_CAP[$k]}2${TYPE_CAP[$v]}Open${Custom}HashMap\n"\
+"#define STRIPED_OPEN_HASH_BIG_SET Striped${TYPE_CAP[$k]}Open${Custom}HashBigSet\n"\
 "#define OPEN_DOUBLE_HASH_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}${Linked}Open${Custom}DoubleHashMap\n"\
 "#define ARRAY_SET ${TYPE_CAP[$k]}ArraySet\n"\
 "#define ARRAY_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}ArrayMap\n"\
 "#define LINKED_OPEN_HASH_SET ${TYPE_CAP[$k]}LinkedOpenHashSet\n"\
 "#define AVL_TREE_SET ${TYPE_CAP[$k]}AVLTreeSet\n"\
 "#define RB_TREE_SET ${TYPE_CAP[$k]}RBTreeSet\n"\
+"#define BTREE_SET ${TYPE_CAP[$k]}BTreeSet\n"\
+"#define PERSISTENT_TREE_SET ${TYPE_CAP[$k]}PersistentTreeSet\n"\
+"#define CONCURRENT_SKIP_LIST_SET ${TYPE_CAP[$k]}ConcurrentSkipListSet\n"\
+"#define SORTED_ARRAY_SET ${TYPE_CAP[$k]}SortedArraySet\n"\
 "#define AVL_TREE_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}AVLTreeMap\n"\
+"#define ARENA_TREE_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}ArenaTreeMap\n"\
 "#define RB_TREE_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}RBTreeMap\n"\
+"#define BTREE_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}BTreeMap\n"\
+"#define PERSISTENT_TREE_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}PersistentTreeMap\n"\
+"#define CONCURRENT_SKIP_LIST_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}ConcurrentSkipListMap\n"\
+"#define SORTED_ARRAY_MAP ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}SortedArrayMap\n"\
+"#define CACHE ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}Cache\n"\
+"#define STATIC_FUNCTION ${TYPE_CAP[$k]}2${TYPE_CAP[$v]}StaticFunction\n"\
+"#define BLOOM_FILTER ${TYPE_CAP[$k]}BloomFilter\n"\
 "#define ARRAY_LIST ${TYPE_CAP[$k]}ArrayList\n"\
 "#define IMMUTABLE_LIST ${TYPE_CAP[$k]}ImmutableList\n"\
+"#define COPY_ON_WRITE_ARRAY_LIST ${TYPE_CAP[$k]}CopyOnWriteArrayList\n"\
+"#define CHUNKED_LIST ${TYPE_CAP[$k]}ChunkedList\n"\
 "#define BIG_ARRAY_BIG_LIST ${TYPE_CAP[$k]}BigArrayBigList\n"\
 "#define MAPPED_BIG_LIST ${TYPE_CAP[$k]}MappedBigList\n"\
+"#define APPENDABLE_MAPPED_BIG_LIST ${TYPE_CAP[$k]}AppendableMappedBigList\n"\
 "#define ARRAY_FRONT_CODED_LIST ${TYPE_CAP[$k]}ArrayFrontCodedList\n"\
 "#define ARRAY_FRONT_CODED_BIG_LIST ${TYPE_CAP[$k]}ArrayFrontCodedBigList\n"\
+"#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST ${TYPE_CAP[$k]}MappedArrayFrontCodedBigList\n"\
+"#define ELIAS_FANO_BIG_LIST ${TYPE_CAP[$k]}EliasFanoBigList\n"\
+"#define ELIAS_FANO_SORTED_SET ${TYPE_CAP[$k]}EliasFanoSortedSet\n"\
+"#define PACKED_BIG_LIST ${TYPE_CAP[$k]}PackedBigList\n"\
 "#define HEAP_PRIORITY_QUEUE ${TYPE_CAP2[$k]}HeapPriorityQueue\n"\
 "#define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ${TYPE_CAP2[$k]}HeapSemiIndirectPriorityQueue\n"\
 "#define HEAP_INDIRECT_PRIORITY_QUEUE ${TYPE_CAP2[$k]}HeapIndirectPriorityQueue\n"\
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil;
+
+/** A policy deciding how much a growable backing array should be enlarged.
+ *
+ * <p>Array-based lists (e.g., {@link it.unimi.dsi.fastutil.ints.IntArrayList} or
+ * {@link it.unimi.dsi.fastutil.ints.IntBigArrayBigList}) call {@link #grow(long, long)} when
+ * their backing array is full. The value returned is just a suggestion: the caller
+ * will never allocate less than the required capacity, nor more than the maximum
+ * capacity of its backing array.
+ *
+ * <p>Policies are stored in the lists using them, so they must be serializable
+ * if the lists are going to be serialized; all policies provided by this interface are.
+ *
+ * @see it.unimi.dsi.fastutil.ints.IntArrayList#growthPolicy(GrowthPolicy)
+ */
+@FunctionalInterface
+public interface GrowthPolicy extends java.io.Serializable {
+
+	/** Returns the new capacity of a backing array.
+	 *
+	 * @param capacity the current capacity of the backing array.
+	 * @param required the minimum capacity needed by the caller (always greater than {@code capacity}).
+	 * @return the suggested new capacity.
+	 */
+	long grow(long capacity, long required);
+
+	/** The default policy: the capacity is increased by 50%. */
+	static final GrowthPolicy ONE_AND_A_HALF = (capacity, required) -> capacity + (capacity >> 1);
+
+	/** A policy doubling the capacity. */
+	static final GrowthPolicy DOUBLING = (capacity, required) -> 2 * capacity;
+
+	/** Returns a policy increasing the capacity by a fixed amount.
+	 *
+	 * <p>This policy is useful when memory is tight and the final size is known approximately:
+	 * the waste is bounded by {@code increment}, at the price of a linear (rather than
+	 * constant) amortized cost per insertion.
+	 *
+	 * @param increment the fixed increment.
+	 * @return a policy increasing the capacity by {@code increment}.
+	 */
+	static GrowthPolicy increment(final long increment) {
+		if (increment <= 0) throw new IllegalArgumentException("Nonpositive increment: " + increment);
+		return (capacity, required) -> capacity + increment;
+	}
+
+	/** Returns a policy following a given policy, but never increasing the capacity by more than a given amount.
+	 *
+	 * <p>For example, {@code capped(DOUBLING, 1 << 24)} doubles the capacity of small arrays,
+	 * but grows large arrays by 16Mi elements at a time.
+	 *
+	 * @param policy a policy.
+	 * @param maxIncrement the maximum increment.
+	 * @return a policy following {@code policy}, but never increasing the capacity by more than {@code maxIncrement}.
+	 */
+	static GrowthPolicy capped(final GrowthPolicy policy, final long maxIncrement) {
+		if (maxIncrement <= 0) throw new IllegalArgumentException("Nonpositive maximum increment: " + maxIncrement);
+		return (capacity, required) -> Math.min(policy.grow(capacity, required), capacity + maxIncrement);
+	}
+
+	/** Computes the new capacity of a backing array using a given policy, clamping it between the required and the maximum capacity.
+	 *
+	 * @param policy a policy.
+	 * @param capacity the current capacity of the backing array.
+	 * @param required the minimum capacity needed.
+	 * @param max the maximum capacity of the backing array.
+	 * @return the new capacity.
+	 */
+	static long grow(final GrowthPolicy policy, final long capacity, final long required, final long max) {
+		final long c = policy.grow(capacity, required);
+		// Overflowing policies are treated as asking for the maximum capacity
+		return Math.max(c < 0 ? max : Math.min(c, max), required);
+	}
+}
@@ -312,22 +312,44 @@
 #define OPEN_HASH_BIG_SET BooleanOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET BooleanOpenDoubleHashSet
 #define OPEN_HASH_MAP Boolean2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Boolean2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Boolean2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Boolean2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedBoolean2ObjectOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedBooleanOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Boolean2ObjectOpenDoubleHashMap
 #define ARRAY_SET BooleanArraySet
 #define ARRAY_MAP Boolean2ObjectArrayMap
 #define LINKED_OPEN_HASH_SET BooleanLinkedOpenHashSet
 #define AVL_TREE_SET BooleanAVLTreeSet
 #define RB_TREE_SET BooleanRBTreeSet
+#define BTREE_SET BooleanBTreeSet
+#define PERSISTENT_TREE_SET BooleanPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET BooleanConcurrentSkipListSet
+#define SORTED_ARRAY_SET BooleanSortedArraySet
 #define AVL_TREE_MAP Boolean2ObjectAVLTreeMap
+#define ARENA_TREE_MAP Boolean2ObjectArenaTreeMap
 #define RB_TREE_MAP Boolean2ObjectRBTreeMap
+#define BTREE_MAP Boolean2ObjectBTreeMap
+#define PERSISTENT_TREE_MAP Boolean2ObjectPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Boolean2ObjectConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Boolean2ObjectSortedArrayMap
+#define CACHE Boolean2ObjectCache
+#define STATIC_FUNCTION Boolean2ObjectStaticFunction
+#define BLOOM_FILTER BooleanBloomFilter
 #define ARRAY_LIST BooleanArrayList
 #define IMMUTABLE_LIST BooleanImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST BooleanCopyOnWriteArrayList
+#define CHUNKED_LIST BooleanChunkedList
 #define BIG_ARRAY_BIG_LIST BooleanBigArrayBigList
 #define MAPPED_BIG_LIST BooleanMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST BooleanAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST BooleanArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST BooleanArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST BooleanMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST BooleanEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET BooleanEliasFanoSortedSet
+#define PACKED_BIG_LIST BooleanPackedBigList
 #define HEAP_PRIORITY_QUEUE BooleanHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE BooleanHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE BooleanHeapIndirectPriorityQueue
@@ -21,13 +21,15 @@ import java.util.NoSuchElementException;
 import it.unimi.dsi.fastutil.BigArrays;
 import static it.unimi.dsi.fastutil.BigArrays.length;
 import it.unimi.dsi.fastutil.BigList;
+import it.unimi.dsi.fastutil.GrowthPolicy;
 import it.unimi.dsi.fastutil.Size64;
 /** A type-specific big list based on a big array; provides some additional methods that use polymorphism to avoid (un)boxing.
 	*
 	* <p>This class implements a lightweight, fast, open, optimized,
 	* reuse-oriented version of big-array-based big lists. Instances of this class
 	* represent a big list with a big array that is enlarged as needed when new entries
-	* are created (by increasing its current length by 50%), but is
+	* are created (by increasing its current length by 50%, unless a different
+	* {@linkplain #growthPolicy(GrowthPolicy) growth policy} is set), but is
 	* <em>never</em> made smaller (even on a {@link #clear()}). A family of
 	* {@linkplain #trim() trimming methods} lets you control the size of the
 	* backing big array; this is particularly useful if you reuse instances of this class.
@@ -51,6 +53,8 @@ public class BooleanBigArrayBigList extends AbstractBooleanBigList implements Ra
 	protected transient boolean a[][];
 	/** The current actual size of the big list (never greater than the backing-array length). */
 	protected long size;
+	/** The policy used to enlarge the backing big array, or {@code null} for the default 50% increase. */
+	protected GrowthPolicy growthPolicy;
 	/** Creates a new big-array big list using a given array.
 	 *
 	 * <p>This constructor is only meant to be used by the wrapping methods.
@@ -185,8 +189,32 @@ public class BooleanBigArrayBigList extends AbstractBooleanBigList implements Ra
 	 a = BigArrays.forceCapacity(a, capacity, size);
 	 assert size <= length(a);
 	}
+	/** Sets the growth policy of this big-array big list.
+	 *
+	 * <p>The policy decides how much the backing big array is enlarged when it is full;
+	 * by default, the capacity is increased by 50%. For very large lists, a
+	 * {@linkplain GrowthPolicy#capped(GrowthPolicy, long) capped} or
+	 * {@linkplain GrowthPolicy#increment(long) fixed-increment} policy
+	 * bounds the amount of memory allocated but not used.
+	 * Explicit requests (e.g., {@link #ensureCapacity(long)}) are not affected.
+	 *
+	 * @param growthPolicy the new growth policy, or {@code null} to restore the default policy.
+	 * @return this big-array big list.
+	 * @see GrowthPolicy
+	 */
+	public BooleanBigArrayBigList growthPolicy(final GrowthPolicy growthPolicy) {
+	 this.growthPolicy = growthPolicy;
+	 return this;
+	}
+	/** Returns the growth policy of this big-array big list.
+	 *
+	 * @return the growth policy of this big-array big list ({@link GrowthPolicy#ONE_AND_A_HALF} if no policy has been set).
+	 */
+	public GrowthPolicy growthPolicy() {
+	 return growthPolicy == null ? GrowthPolicy.ONE_AND_A_HALF : growthPolicy;
+	}
 	/** Grows this big-array big list, ensuring that it can contain the given number of entries without resizing,
-	 * and in case increasing current capacity at least by a factor of 50%.
+	 * and in case increasing current capacity as prescribed by the {@linkplain #growthPolicy() growth policy}.
 	 *
 	 * @param capacity the new minimum capacity for this big-array big list.
 	 */
@@ -194,7 +222,10 @@ public class BooleanBigArrayBigList extends AbstractBooleanBigList implements Ra
 	private void grow(long capacity) {
 	 final long oldLength = length(a);
 	 if (capacity <= oldLength) return;
-	 if (a != BooleanBigArrays.DEFAULT_EMPTY_BIG_ARRAY) capacity = Math.max(oldLength + (oldLength >> 1), capacity);
+	 if (a != BooleanBigArrays.DEFAULT_EMPTY_BIG_ARRAY) {
+	  if (growthPolicy == null) capacity = Math.max(oldLength + (oldLength >> 1), capacity);
+	  else capacity = GrowthPolicy.grow(growthPolicy, oldLength, capacity, Long.MAX_VALUE);
+	 }
 	 else if (capacity < DEFAULT_INITIAL_CAPACITY) capacity = DEFAULT_INITIAL_CAPACITY;
 	 a = BigArrays.forceCapacity(a, capacity, size);
 	 assert size <= length(a);
@@ -772,6 +803,7 @@ public class BooleanBigArrayBigList extends AbstractBooleanBigList implements Ra
 	 if (getClass() == BooleanBigArrayBigList.class) {
 	  c = new BooleanBigArrayBigList (size);
 	  c.size = size;
+	  c.growthPolicy = growthPolicy;
 	 } else {
 	  try {
 	   c = (BooleanBigArrayBigList )super.clone();
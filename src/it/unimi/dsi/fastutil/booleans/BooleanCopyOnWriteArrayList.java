@@ -0,0 +1,417 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.booleans;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.RandomAccess;
+import java.util.function.Consumer;
+/** A type-specific thread-safe array-based list in which all mutative operations make a fresh copy of the backing array.
+	*
+	* <p>This class is the type-specific analogue of {@link java.util.concurrent.CopyOnWriteArrayList}, and it is
+	* meant for lists that are read much more often than they are modified, and that are shared by several threads.
+	* The backing array is never modified after it has been published, and it is read through a volatile field:
+	* thus, reads never block, and they are as fast as reads from a plain array. Writers are serialized
+	* by an internal lock, and every mutative operation copies the backing array once.
+	*
+	* <p>To amortize the cost of copying over several modifications, use {@link #update(Consumer)}, which
+	* applies an arbitrary sequence of modifications to a private array-based list and then publishes
+	* the result atomically. Bulk operations such as {@code addAll()}, {@code removeIf()} or
+	* {@code sort()} perform a single copy.
+	*
+	* <p>Iterators and spliterators traverse the snapshot of the list at the time they were created:
+	* they never throw {@link java.util.ConcurrentModificationException}, and they do not support
+	* modifications. The method {@link #snapshot()} returns the current content of the list as an immutable list, without copying.
+	* Note that views returned by {@link #subList(int, int) subList()} are not snapshots.
+	*/
+public class BooleanCopyOnWriteArrayList extends AbstractBooleanList implements RandomAccess, Cloneable, java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The lock serializing mutative operations. */
+	private transient Object lock = new Object();
+	/** The backing array; all elements are part of this list, and it is never modified after publication. */
+	private transient volatile boolean[] a;
+	/** Creates a new empty copy-on-write list. */
+	public BooleanCopyOnWriteArrayList() {
+	 a = BooleanArrays.EMPTY_ARRAY;
+	}
+	/** Creates a new copy-on-write list and fills it with a given type-specific collection.
+	 *
+	 * @param c a type-specific collection that will be used to fill the list.
+	 */
+	public BooleanCopyOnWriteArrayList(final BooleanCollection c) {
+	 a = c.toBooleanArray();
+	}
+	/** Creates a new copy-on-write list and fills it with a given collection.
+	 *
+	 * @param c a collection that will be used to fill the list.
+	 */
+	public BooleanCopyOnWriteArrayList(final Collection<? extends Boolean> c) {
+	 a = unwrap(c);
+	}
+	/** Creates a new copy-on-write list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public BooleanCopyOnWriteArrayList(final boolean a[], final int offset, final int length) {
+	 BooleanArrays.ensureOffsetLength(a, offset, length);
+	 this.a = Arrays.copyOfRange(a, offset, offset + length);
+	}
+	/** Creates a new copy-on-write list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 */
+	public BooleanCopyOnWriteArrayList(final boolean a[]) {
+	 this(a, 0, a.length);
+	}
+	/** Returns the elements of a collection as an array.
+	 *
+	 * @param c a collection.
+	 * @return an array containing the elements of {@code c}.
+	 */
+	private static boolean[] unwrap(final Collection<? extends Boolean> c) {
+	 if (c instanceof BooleanCollection) return ((BooleanCollection)c).toBooleanArray();
+	 return BooleanIterators.unwrap(BooleanIterators.asBooleanIterator(c.iterator()));
+	}
+	/** Returns an immutable snapshot of the current content of this list.
+	 *
+	 * <p>This method requires constant time, as the backing array is shared with the snapshot.
+	 *
+	 * @return an immutable list containing the current elements of this list.
+	 */
+	public BooleanImmutableList snapshot() {
+	 return new BooleanImmutableList(a);
+	}
+	/** Applies a sequence of modifications atomically, copying the backing array just once.
+	 *
+	 * <p>The updater receives a private array-based list containing the current elements
+	 * of this list; when the updater returns, the content of the array-based list becomes
+	 * the content of this list. Other mutative operations on this list wait until the
+	 * updater returns, whereas readers keep seeing the previous content. The updater must
+	 * not modify this list, and it must not keep a reference to its argument.
+	 *
+	 * @param updater a consumer modifying the array-based list it receives.
+	 */
+	public void update(final Consumer<? super BooleanArrayList> updater) {
+	 synchronized (lock) {
+	  final BooleanArrayList l = BooleanArrayList.wrap(a.clone());
+	  updater.accept(l);
+	  final boolean[] t = l.elements();
+	  a = t.length == l.size() ? t : Arrays.copyOf(t, l.size());
+	 }
+	}
+	@Override
+	public boolean getBoolean(final int index) {
+	 final boolean[] a = this.a;
+	 if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	 return a[index];
+	}
+	@Override
+	public int size() {
+	 return a.length;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return a.length == 0;
+	}
+	@Override
+	public int indexOf(final boolean k) {
+	 final boolean[] a = this.a;
+	 for(int i = 0; i < a.length; i++) if (( (k) == (a[i]) )) return i;
+	 return -1;
+	}
+	@Override
+	public int lastIndexOf(final boolean k) {
+	 final boolean[] a = this.a;
+	 for(int i = a.length; i-- != 0;) if (( (k) == (a[i]) )) return i;
+	 return -1;
+	}
+	@Override
+	public boolean contains(final boolean k) {
+	 return indexOf(k) >= 0;
+	}
+	@Override
+	public void getElements(final int from, final boolean[] a, final int offset, final int length) {
+	 final boolean[] t = this.a;
+	 BooleanArrays.ensureOffsetLength(a, offset, length);
+	 if (from < 0 || from + length > t.length) throw new IndexOutOfBoundsException("Range [" + from + ".." + (from + length) + ") is out of bounds for list size " + t.length);
+	 System.arraycopy(t, from, a, offset, length);
+	}
+	@Override
+	public void forEach(final BooleanConsumer action) {
+	 for (final boolean k : a) action.accept(k);
+	}
+	@Override
+	public boolean[] toBooleanArray() {
+	 final boolean[] a = this.a;
+	 return a.length == 0 ? BooleanArrays.EMPTY_ARRAY : a.clone();
+	}
+	@Override
+	public boolean[] toArray(boolean a[]) {
+	 final boolean[] t = this.a;
+	 if (a == null || a.length < t.length) a = new boolean[t.length];
+	 System.arraycopy(t, 0, a, 0, t.length);
+	 return a;
+	}
+	/** Inserts elements in the backing array; the caller must hold {@link #lock}.
+	 *
+	 * @param index the index at which the elements will be inserted.
+	 * @param t an array containing the elements to insert.
+	 * @param offset the offset of the first element to insert.
+	 * @param length the number of elements to insert.
+	 */
+	private void insert(final int index, final boolean[] t, final int offset, final int length) {
+	 final boolean[] a = this.a;
+	 if (index < 0) throw new IndexOutOfBoundsException("Index (" + index + ") is negative");
+	 if (index > a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than list size (" + a.length + ")");
+	 final boolean[] b = new boolean[a.length + length];
+	 System.arraycopy(a, 0, b, 0, index);
+	 System.arraycopy(t, offset, b, index, length);
+	 System.arraycopy(a, index, b, index + length, a.length - index);
+	 this.a = b;
+	}
+	@Override
+	public boolean add(final boolean k) {
+	 synchronized (lock) {
+	  final boolean[] a = this.a;
+	  final boolean[] b = Arrays.copyOf(a, a.length + 1);
+	  b[a.length] = k;
+	  this.a = b;
+	 }
+	 return true;
+	}
+	@Override
+	public void add(final int index, final boolean k) {
+	 synchronized (lock) {
+	  insert(index, new boolean[] { k }, 0, 1);
+	 }
+	}
+	@Override
+	public boolean addAll(final int index, final BooleanCollection c) {
+	 final boolean[] t = c.toBooleanArray();
+	 synchronized (lock) {
+	  insert(index, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final BooleanCollection c) {
+	 final boolean[] t = c.toBooleanArray();
+	 synchronized (lock) {
+	  insert(a.length, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final int index, final BooleanList l) {
+	 return addAll(index, (BooleanCollection)l);
+	}
+	@Override
+	public boolean addAll(final BooleanList l) {
+	 return addAll((BooleanCollection)l);
+	}
+	@Override
+	public boolean addAll(final int index, final Collection<? extends Boolean> c) {
+	 final boolean[] t = unwrap(c);
+	 synchronized (lock) {
+	  insert(index, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final Collection<? extends Boolean> c) {
+	 final boolean[] t = unwrap(c);
+	 synchronized (lock) {
+	  insert(a.length, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public void addElements(final int index, final boolean a[], final int offset, final int length) {
+	 BooleanArrays.ensureOffsetLength(a, offset, length);
+	 synchronized (lock) {
+	  insert(index, a, offset, length);
+	 }
+	}
+	@Override
+	public boolean set(final int index, final boolean k) {
+	 synchronized (lock) {
+	  final boolean[] a = this.a;
+	  if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	  final boolean old = a[index];
+	  final boolean[] b = a.clone();
+	  b[index] = k;
+	  this.a = b;
+	  return old;
+	 }
+	}
+	@Override
+	public void setElements(final int index, final boolean a[], final int offset, final int length) {
+	 BooleanArrays.ensureOffsetLength(a, offset, length);
+	 synchronized (lock) {
+	  final boolean[] t = this.a;
+	  if (index < 0 || index + length > t.length) throw new IndexOutOfBoundsException("Range [" + index + ".." + (index + length) + ") is out of bounds for list size " + t.length);
+	  final boolean[] b = t.clone();
+	  System.arraycopy(a, offset, b, index, length);
+	  this.a = b;
+	 }
+	}
+	@Override
+	public boolean removeBoolean(final int index) {
+	 synchronized (lock) {
+	  final boolean[] a = this.a;
+	  if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	  final boolean old = a[index];
+	  removeRange(index, index + 1);
+	  return old;
+	 }
+	}
+	@Override
+	public boolean rem(final boolean k) {
+	 synchronized (lock) {
+	  final int index = indexOf(k);
+	  if (index == -1) return false;
+	  removeRange(index, index + 1);
+	  return true;
+	 }
+	}
+	/** Removes a range of elements from the backing array; the caller must hold {@link #lock}.
+	 *
+	 * @param from the start index (inclusive).
+	 * @param to the end index (exclusive).
+	 */
+	private void removeRange(final int from, final int to) {
+	 final boolean[] a = this.a;
+	 it.unimi.dsi.fastutil.Arrays.ensureFromTo(a.length, from, to);
+	 final boolean[] b = new boolean[a.length - (to - from)];
+	 System.arraycopy(a, 0, b, 0, from);
+	 System.arraycopy(a, to, b, from, a.length - to);
+	 this.a = b;
+	}
+	@Override
+	public void removeElements(final int from, final int to) {
+	 synchronized (lock) {
+	  removeRange(from, to);
+	 }
+	}
+	@Override
+	public boolean removeIf(final BooleanPredicate filter) {
+	 java.util.Objects.requireNonNull(filter);
+	 synchronized (lock) {
+	  final boolean[] a = this.a;
+	  final boolean[] b = new boolean[a.length];
+	  int j = 0;
+	  for (final boolean k : a) if (! filter.test(k)) b[j++] = k;
+	  if (j == a.length) return false;
+	  this.a = Arrays.copyOf(b, j);
+	  return true;
+	 }
+	}
+	@Override
+	public boolean removeAll(final BooleanCollection c) {
+	 return removeIf((BooleanPredicate ) k -> c.contains(k));
+	}
+	@Override
+	public boolean removeAll(final Collection<?> c) {
+	 return removeIf((BooleanPredicate ) k -> c.contains(Boolean.valueOf(k)));
+	}
+	@Override
+	public boolean retainAll(final BooleanCollection c) {
+	 return removeIf((BooleanPredicate ) k -> ! c.contains(k));
+	}
+	@Override
+	public boolean retainAll(final Collection<?> c) {
+	 return removeIf((BooleanPredicate ) k -> ! c.contains(Boolean.valueOf(k)));
+	}
+	@Override
+	public void replaceAll(final BooleanUnaryOperator operator) {
+	 synchronized (lock) {
+	  final boolean[] b = a.clone();
+	  for (int i = 0; i < b.length; i++) b[i] = operator.apply(b[i]);
+	  a = b;
+	 }
+	}
+	@Override
+	public void sort(final BooleanComparator comp) {
+	 synchronized (lock) {
+	  final boolean[] b = a.clone();
+	  if (comp == null) BooleanArrays.stableSort(b);
+	  else BooleanArrays.stableSort(b, comp);
+	  a = b;
+	 }
+	}
+	@Override
+	public void unstableSort(final BooleanComparator comp) {
+	 synchronized (lock) {
+	  final boolean[] b = a.clone();
+	  if (comp == null) BooleanArrays.unstableSort(b);
+	  else BooleanArrays.unstableSort(b, comp);
+	  a = b;
+	 }
+	}
+	@Override
+	public void size(final int size) {
+	 if (size < 0) throw new IllegalArgumentException("Negative size: " + size);
+	 synchronized (lock) {
+	  a = Arrays.copyOf(a, size);
+	 }
+	}
+	@Override
+	public void clear() {
+	 synchronized (lock) {
+	  a = BooleanArrays.EMPTY_ARRAY;
+	 }
+	}
+	/** Returns a list iterator over a snapshot of this list.
+	 *
+	 * <p>The iterator does not support modifications.
+	 */
+	@Override
+	public BooleanListIterator listIterator(final int index) {
+	 return snapshot().listIterator(index);
+	}
+	/** Returns a spliterator over a snapshot of this list. */
+	@Override
+	public BooleanSpliterator spliterator() {
+	 return snapshot().spliterator();
+	}
+	@Override
+	public BooleanCopyOnWriteArrayList clone() {
+	 final BooleanCopyOnWriteArrayList c;
+	 try {
+	  c = (BooleanCopyOnWriteArrayList)super.clone();
+	 }
+	 catch(final CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 // The backing array is immutable, so it can be shared
+	 c.lock = new Object();
+	 return c;
+	}
+	private void writeObject(final java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 final boolean[] a = this.a;
+	 s.writeInt(a.length);
+	 for(int i = 0; i < a.length; i++) s.writeBoolean(a[i]);
+	}
+	private void readObject(final java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 final boolean[] a = new boolean[s.readInt()];
+	 for(int i = 0; i < a.length; i++) a[i] = s.readBoolean();
+	 lock = new Object();
+	 this.a = a;
+	}
+}
@@ -18,21 +18,31 @@ import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
 import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
 import it.unimi.dsi.fastutil.objects.ObjectListIterator;
 import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
 import it.unimi.dsi.fastutil.booleans.BooleanCollection;
 import it.unimi.dsi.fastutil.booleans.AbstractBooleanCollection;
 import it.unimi.dsi.fastutil.booleans.BooleanIterator;
 import it.unimi.dsi.fastutil.booleans.BooleanListIterator;
+import it.unimi.dsi.fastutil.booleans.BooleanSpliterator;
+import it.unimi.dsi.fastutil.booleans.BooleanSpliterators;
 import java.util.Comparator;
 import java.util.Iterator;
 import java.util.Map;
 import java.util.SortedMap;
 import java.util.NoSuchElementException;
+import java.util.function.Consumer;
 /** A type-specific AVL tree map with a fast, small-footprint implementation.
 	*
 	* <p>The iterators provided by the views of this class are type-specific {@linkplain
 	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
 	* Moreover, the iterator returned by {@code iterator()} can be safely cast
 	* to a type-specific {@linkplain java.util.ListIterator list iterator}.
+	*
+	* <p>This class does not keep subtree sizes: there are no order statistics, and the size of
+	* a submap is computed by enumerating its entries. If you need rank and select operations, or
+	* fast submap sizes, use the B+-tree map of the same type (e.g.,
+	* {@link it.unimi.dsi.fastutil.ints.Int2IntBTreeMap}), which provides them in logarithmic time.
 	*/
 public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implements java.io.Serializable, Cloneable {
 	/** A reference to the root entry. */
@@ -126,10 +136,19 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	 * @param c a (possibly type-specific) comparator.
 	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
 	 */
+
 	public Byte2BooleanAVLTreeMap(final byte[] k, final boolean v[], final Comparator<? super Byte> c) {
 	 this(c);
 	 if (k.length != v.length) throw new IllegalArgumentException("The key array and the value array have different lengths (" + k.length + " and " + v.length + ")");
-	 for(int i = 0; i < k.length; i++) this.put(k[i], v[i]);
+	 if (isStrictlySorted(k, 0, k.length)) {
+	  final Entry [] e = new Entry[k.length];
+	  for(int i = 0; i < k.length; i++) {
+	  
+	   e[i] = new Entry (k[i], v[i]);
+	  }
+	  setTree(e, k.length);
+	 }
+	 else for(int i = 0; i < k.length; i++) this.put(k[i], v[i]);
 	}
 	/** Creates a new tree map using the elements of two parallel arrays.
 	 *
@@ -970,6 +989,128 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	 @Override
 	 public void add(Byte2BooleanMap.Entry ok) { throw new UnsupportedOperationException(); }
 	}
+	/** An abstract spliterator on the whole range.
+	 *
+	 * <p>Splitting happens at the tree level: the first split hands out the entries preceding the root,
+	 * and further splits use the right subtree of the current entry or the left subtree of the fence,
+	 * so that the returned prefix roughly halves the remaining entries. Enumeration follows
+	 * the threaded successor links and requires no stack.
+	 */
+	private abstract class TreeSpliterator<ConsumerType, SplitType extends TreeSpliterator<ConsumerType, SplitType>> {
+	 /** The next entry to be returned, or {@code null} if we reached the end of the tree. */
+	 Entry current;
+	 /** The first entry that must not be returned, or {@code null} if we must reach the end of the tree. */
+	 final Entry fence;
+	 /** Zero if this spliterator has never been split (so we split at the root), positive if we split at the right subtree
+		 * of {@link #current}, negative if we split at the left subtree of {@link #fence}. */
+	 int side;
+	 /** The number of remaining entries (exact only if {@link #side} is zero). */
+	 int est;
+	 TreeSpliterator() {
+	  this(firstEntry, null, 0, count);
+	 }
+	 TreeSpliterator(final Entry current, final Entry fence, final int side, final int est) {
+	  this.current = current;
+	  this.fence = fence;
+	  this.side = side;
+	  this.est = est;
+	 }
+	 abstract void acceptOnEntry(final ConsumerType action, final Entry e);
+	 abstract SplitType makeForSplit(Entry current, Entry fence, int est);
+	 public boolean tryAdvance(final ConsumerType action) {
+	  final Entry e = current;
+	  if (e == null || e == fence) return false;
+	  current = e.next();
+	  if (est > 0) est--;
+	  acceptOnEntry(action, e);
+	  return true;
+	 }
+	 public void forEachRemaining(final ConsumerType action) {
+	  final Entry f = fence;
+	  Entry e = current;
+	  current = f;
+	  est = 0;
+	  while(e != f) {
+	   acceptOnEntry(action, e);
+	   e = e.next();
+	  }
+	 }
+	 public long estimateSize() {
+	  return est;
+	 }
+	 public SplitType trySplit() {
+	  final Entry e = current, f = fence;
+	  final Entry s = e == null || e == f ? null : side == 0 ? tree : side > 0 ? e.right() : f != null ? f.left() : null;
+	  if (s == null || s == e || s == f || compare(e.key, s.key) >= 0) return null;
+	  final SplitType split = makeForSplit(e, s, est >>>= 1);
+	  current = s;
+	  side = 1;
+	  return split;
+	 }
+	}
+	private final class EntrySpliterator extends TreeSpliterator<Consumer<? super Byte2BooleanMap.Entry >, EntrySpliterator> implements ObjectSpliterator<Byte2BooleanMap.Entry > {
+	 private static final int CHARACTERISTICS = ObjectSpliterators.SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED;
+	 private static final int POST_SPLIT_CHARACTERISTICS = CHARACTERISTICS & ~java.util.Spliterator.SIZED;
+	 EntrySpliterator() {}
+	 EntrySpliterator(final Entry current, final Entry fence, final int est) {
+	  super(current, fence, -1, est);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return side == 0 ? CHARACTERISTICS : POST_SPLIT_CHARACTERISTICS;
+	 }
+	 @Override
+	 final void acceptOnEntry(final Consumer<? super Byte2BooleanMap.Entry > action, final Entry e) {
+	  action.accept(e);
+	 }
+	 @Override
+	 final EntrySpliterator makeForSplit(final Entry current, final Entry fence, final int est) {
+	  return new EntrySpliterator(current, fence, est);
+	 }
+	}
+	private final class KeySpliterator extends TreeSpliterator<ByteConsumer , KeySpliterator> implements ByteSpliterator {
+	 private static final int POST_SPLIT_CHARACTERISTICS = ByteSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS & ~java.util.Spliterator.SIZED;
+	 KeySpliterator() {}
+	 KeySpliterator(final Entry current, final Entry fence, final int est) {
+	  super(current, fence, -1, est);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return side == 0 ? ByteSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS : POST_SPLIT_CHARACTERISTICS;
+	 }
+	 @Override
+	 public ByteComparator getComparator() {
+	  return actualComparator;
+	 }
+	 @Override
+	 final void acceptOnEntry(final ByteConsumer action, final Entry e) {
+	  action.accept(e.key);
+	 }
+	 @Override
+	 final KeySpliterator makeForSplit(final Entry current, final Entry fence, final int est) {
+	  return new KeySpliterator(current, fence, est);
+	 }
+	}
+	private final class ValueSpliterator extends TreeSpliterator<BooleanConsumer , ValueSpliterator> implements BooleanSpliterator {
+	 private static final int CHARACTERISTICS = BooleanSpliterators.COLLECTION_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED;
+	 private static final int POST_SPLIT_CHARACTERISTICS = CHARACTERISTICS & ~java.util.Spliterator.SIZED;
+	 ValueSpliterator() {}
+	 ValueSpliterator(final Entry current, final Entry fence, final int est) {
+	  super(current, fence, -1, est);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return side == 0 ? CHARACTERISTICS : POST_SPLIT_CHARACTERISTICS;
+	 }
+	 @Override
+	 final void acceptOnEntry(final BooleanConsumer action, final Entry e) {
+	  action.accept(e.value);
+	 }
+	 @Override
+	 final ValueSpliterator makeForSplit(final Entry current, final Entry fence, final int est) {
+	  return new ValueSpliterator(current, fence, est);
+	 }
+	}
 	@Override
 
 	public ObjectSortedSet<Byte2BooleanMap.Entry > byte2BooleanEntrySet() {
@@ -985,6 +1126,8 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	   @Override
 	   public ObjectBidirectionalIterator<Byte2BooleanMap.Entry > iterator(final Byte2BooleanMap.Entry from) { return new EntryIterator(from.getByteKey()); }
 	   @Override
+	   public ObjectSpliterator<Byte2BooleanMap.Entry > spliterator() { return new EntrySpliterator(); }
+	   @Override
 	  
 	   public boolean contains(final Object o) {
 	    if (o == null || !(o instanceof Map.Entry)) return false;
@@ -1045,6 +1188,28 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	 public ByteBidirectionalIterator iterator() { return new KeyIterator(); }
 	 @Override
 	 public ByteBidirectionalIterator iterator(final byte from) { return new KeyIterator(from); }
+	 @Override
+	 public ByteSpliterator spliterator() { return new KeySpliterator(); }
+	 /** {@inheritDoc}
+		 *
+		 * <p>If the argument is a type-specific sorted set using the same order as this map and it is not
+		 * too large, this method merges the keys of this map with the set in linear time.
+		 */
+	 @Override
+	 public boolean retainAll(final ByteCollection c) {
+	  if (c instanceof ByteSortedSet && c.size() >>> 4 <= count && sameOrder(((ByteSortedSet)c).comparator())) return mergeKeys((ByteSortedSet)c, INTERSECTION);
+	  return super.retainAll(c);
+	 }
+	 /** {@inheritDoc}
+		 *
+		 * <p>If the argument is a type-specific sorted set using the same order as this map and it is not
+		 * too small, this method merges the keys of this map with the set in linear time.
+		 */
+	 @Override
+	 public boolean removeAll(final ByteCollection c) {
+	  if (c instanceof ByteSortedSet && c.size() >= count >>> 4 && sameOrder(((ByteSortedSet)c).comparator())) return mergeKeys((ByteSortedSet)c, DIFFERENCE);
+	  return super.removeAll(c);
+	 }
 	}
 	/** Returns a type-specific sorted set view of the keys contained in this map.
 	 *
@@ -1085,6 +1250,8 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	   @Override
 	   public BooleanIterator iterator() { return new ValueIterator(); }
 	   @Override
+	   public BooleanSpliterator spliterator() { return new ValueSpliterator(); }
+	   @Override
 	   public boolean contains(final boolean k) { return containsValue(k); }
 	   @Override
 	   public int size() { return count; }
@@ -1427,6 +1594,77 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	  public boolean previousBoolean() { return previousEntry().value; }
 	 };
 	}
+	/** The intersection operation for {@link #mergeKeys mergeKeys()}. */
+	private static final int INTERSECTION = 1;
+	/** The difference operation for {@link #mergeKeys mergeKeys()}. */
+	private static final int DIFFERENCE = 2;
+	/** Merges in linear time the keys of this map with a sorted set using the same order, and rebuilds the tree with the result.
+	 *
+	 * <p>Entries of this map that survive the operation are reused. Union is not supported, as
+	 * there would be no values for the new keys; {@link #putAll putAll()} merges maps instead.
+	 *
+	 * @param s a sorted set using the same order as this map.
+	 * @param op the operation ({@link #INTERSECTION} or {@link #DIFFERENCE}).
+	 * @return true if this map changed.
+	 */
+
+	private boolean mergeKeys(final ByteSortedSet s, final int op) {
+	 final Entry [] e = new Entry[count];
+	 final ByteIterator i = s.iterator();
+	 Entry p = firstEntry;
+	 boolean hasNext = i.hasNext();
+	 byte k = hasNext ? i.nextByte() : ((byte)0);
+	 int n = 0;
+	 while(p != null && hasNext) {
+	  final int cmp = compare(p.key, k);
+	  if (cmp <= 0) {
+	   if (cmp < 0 ? op == DIFFERENCE : op == INTERSECTION) e[n++] = p;
+	   p = p.next();
+	  }
+	  if (cmp >= 0 && (hasNext = i.hasNext())) k = i.nextByte();
+	 }
+	 if (op == DIFFERENCE) for(; p != null; p = p.next()) e[n++] = p;
+	 // Maps with the same number of keys contain the same keys
+	 if (n == count) return false;
+	 setTree(e, n);
+	 return true;
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a type-specific sorted map using the same order as this map and it is not
+	 * too small, this method merges the two maps in linear time, and rebuilds the tree with the result.
+	 */
+	@Override
+
+	public void putAll(final Map<? extends Byte, ? extends Boolean> m) {
+	 if (! (m instanceof Byte2BooleanSortedMap) || m.size() < count >>> 4) {
+	  super.putAll(m);
+	  return;
+	 }
+	 final Byte2BooleanSortedMap s = (Byte2BooleanSortedMap )m;
+	 if (! sameOrder(s.comparator())) {
+	  super.putAll(m);
+	  return;
+	 }
+	 final Entry [] e = new Entry[count + s.size()];
+	 final Iterator<? extends Byte2BooleanMap.Entry > i = s.byte2BooleanEntrySet().iterator();
+	 Entry p = firstEntry;
+	 Byte2BooleanMap.Entry q = i.hasNext() ? i.next() : null;
+	 int n = 0;
+	 while(p != null && q != null) {
+	  final int cmp = compare(p.key, q.getByteKey());
+	  if (cmp <= 0) {
+	   if (cmp == 0) p.value = q.getBooleanValue();
+	   e[n++] = p;
+	   p = p.next();
+	  }
+	  else e[n++] = new Entry (q.getByteKey(), q.getBooleanValue());
+	  if (cmp >= 0) q = i.hasNext() ? i.next() : null;
+	 }
+	 for(; p != null; p = p.next()) e[n++] = p;
+	 for(; q != null; q = i.hasNext() ? i.next() : null) e[n++] = new Entry (q.getByteKey(), q.getBooleanValue());
+	 if (n != count) setTree(e, n);
+	}
 	/** Returns a deep copy of this tree map.
 	 *
 	 * <p>This method performs a deep copy of this tree map; the data stored in the
@@ -1538,6 +1776,79 @@ public class Byte2BooleanAVLTreeMap extends AbstractByte2BooleanSortedMap implem
 	 if (n == (n & -n)) top.balance(1); // Quick test for determining whether n is a power of 2.
 	 return top;
 	}
+	/** Links a sorted array of entries into a balanced tree, with the same shape as the one built by {@link #readTree readTree()}.
+	 *
+	 * <p>Entries are reused as they are, except for their links and their {@link Entry#info} field, which are rewritten.
+	 *
+	 * @param e an array of entries with distinct keys, sorted by key.
+	 * @param offset the index in {@code e} of the first entry of the tree.
+	 * @param n the (positive) number of entries of the tree.
+	 * @param pred the entry containing the key that preceeds the first key in the tree.
+	 * @param succ the entry containing the key that follows the last key in the tree.
+	 * @return the root of the tree.
+	 */
+	private static Entry buildTree(final Entry [] e, final int offset, final int n, final Entry pred, final Entry succ) {
+	 if (n == 1) {
+	  final Entry top = e[offset];
+	  top.info = 0;
+	  top.pred(pred);
+	  top.succ(succ);
+	  return top;
+	 }
+	 if (n == 2) {
+	  /* We handle separately this case so that recursion will
+			 *always* be on nonempty subtrees. */
+	  final Entry top = e[offset], right = e[offset + 1];
+	  top.info = right.info = 0;
+	  top.right(right);
+	  right.pred(top);
+	  top.balance(1);
+	  top.pred(pred);
+	  right.succ(succ);
+	  return top;
+	 }
+	 // The right subtree is the largest one.
+	 final int rightN = n / 2, leftN = n - rightN - 1;
+	 final Entry top = e[offset + leftN];
+	 top.info = 0;
+	 top.left(buildTree(e, offset, leftN, pred, top));
+	 top.right(buildTree(e, offset + leftN + 1, rightN, top, succ));
+	 if (n == (n & -n)) top.balance(1); // Quick test for determining whether n is a power of 2.
+	 return top;
+	}
+	/** Replaces the content of this map with a sorted array of entries.
+	 *
+	 * @param e an array of entries with distinct keys, sorted by key.
+	 * @param n the number of entries to use, starting from the first one.
+	 */
+	private void setTree(final Entry [] e, final int n) {
+	 count = n;
+	 if (n == 0) tree = firstEntry = lastEntry = null;
+	 else {
+	  tree = buildTree(e, 0, n, null, null);
+	  firstEntry = e[0];
+	  lastEntry = e[n - 1];
+	 }
+	}
+	/** Returns whether a sorted array fragment is strictly increasing in the order of this map.
+	 *
+	 * @param a an array.
+	 * @param offset the first element to check.
+	 * @param length the number of elements to check.
+	 * @return true if the elements of the fragment are strictly increasing.
+	 */
+	private boolean isStrictlySorted(final byte[] a, final int offset, final int length) {
+	 for(int i = 1; i < length; i++) if (compare(a[offset + i - 1], a[offset + i]) >= 0) return false;
+	 return true;
+	}
+	/** Returns whether a comparator specifies the same order as the one of this map.
+	 *
+	 * @param c a comparator, or {@code null} for the natural order.
+	 * @return true if {@code c} is known to specify the same order as this map.
+	 */
+	private boolean sameOrder(final Comparator<?> c) {
+	 return actualComparator == null ? c == null : actualComparator.equals(c);
+	}
 	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
 	 s.defaultReadObject();
 	 /* The storedComparator is now correctly set, but we must restore
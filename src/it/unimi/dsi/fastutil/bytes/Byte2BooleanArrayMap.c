@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET ByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Byte2BooleanOpenDoubleHashMap
 #define ARRAY_SET ByteArraySet
 #define ARRAY_MAP Byte2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET ByteLinkedOpenHashSet
 #define AVL_TREE_SET ByteAVLTreeSet
 #define RB_TREE_SET ByteRBTreeSet
+#define BTREE_SET ByteBTreeSet
+#define PERSISTENT_TREE_SET BytePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ByteConcurrentSkipListSet
+#define SORTED_ARRAY_SET ByteSortedArraySet
 #define AVL_TREE_MAP Byte2BooleanAVLTreeMap
 #define RB_TREE_MAP Byte2BooleanRBTreeMap
+#define BTREE_MAP Byte2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Byte2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Byte2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Byte2BooleanSortedArrayMap
+#define CACHE Byte2BooleanCache
+#define STATIC_FUNCTION Byte2BooleanStaticFunction
+#define BLOOM_FILTER ByteBloomFilter
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
 #define MAPPED_BIG_LIST ByteMappedBigList
 #define ARRAY_FRONT_CODED_LIST ByteArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ByteArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ByteEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ByteEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ByteHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ByteHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ByteHeapIndirectPriorityQueue
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2BooleanLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2BooleanAVLTreeMap
 #define RB_TREE_MAP Byte2BooleanRBTreeMap
+#define CACHE Byte2BooleanCache
+#define STATIC_FUNCTION Byte2BooleanStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2BooleanOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2BooleanOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2BooleanOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2BooleanAVLTreeMap
 #define RB_TREE_MAP Byte2BooleanRBTreeMap
+#define CACHE Byte2BooleanCache
+#define STATIC_FUNCTION Byte2BooleanStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET ByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ByteOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Byte2ByteOpenDoubleHashMap
 #define ARRAY_SET ByteArraySet
 #define ARRAY_MAP Byte2ByteArrayMap
 #define LINKED_OPEN_HASH_SET ByteLinkedOpenHashSet
 #define AVL_TREE_SET ByteAVLTreeSet
 #define RB_TREE_SET ByteRBTreeSet
+#define BTREE_SET ByteBTreeSet
+#define PERSISTENT_TREE_SET BytePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ByteConcurrentSkipListSet
+#define SORTED_ARRAY_SET ByteSortedArraySet
 #define AVL_TREE_MAP Byte2ByteAVLTreeMap
 #define RB_TREE_MAP Byte2ByteRBTreeMap
+#define BTREE_MAP Byte2ByteBTreeMap
+#define PERSISTENT_TREE_MAP Byte2BytePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Byte2ByteConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Byte2ByteSortedArrayMap
+#define CACHE Byte2ByteCache
+#define STATIC_FUNCTION Byte2ByteStaticFunction
+#define BLOOM_FILTER ByteBloomFilter
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
 #define MAPPED_BIG_LIST ByteMappedBigList
 #define ARRAY_FRONT_CODED_LIST ByteArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ByteArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ByteEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ByteEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ByteHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ByteHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ByteHeapIndirectPriorityQueue
@@ -0,0 +1,1194 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.SortedMap;
+import java.util.NoSuchElementException;
+/** A type-specific B+-tree map with a fast, small-footprint implementation.
+	*
+	* <p>Entries are stored in the <em>leaves</em> of the tree, in parallel arrays of keys and values
+	* containing up to {@link #NODE_CAPACITY} entries; the leaves are linked in a list.
+	* <em>Inner nodes</em> contain arrays of separator keys and children. All nodes but the root
+	* are at least half full. In this way, a primitive key costs little more than its size
+	* (there is no per-entry object), and a search touches a few
+	* contiguous arrays rather than a path of individually allocated entries:
+	* the height of a tree with <var>n</var> entries is less than log<sub>32</sub>&nbsp;<var>n</var>&nbsp;+&nbsp;1.
+	* Conversely, insertions and deletions move on average a few dozen entries.
+	*
+	* <p>Inner nodes record the number of entries in the subtree of each child. As a result,
+	* this class provides logarithmic-time order statistics: {@link #rank rank()} returns the
+	* number of keys smaller than a given key, {@link #select select()} returns the key of given rank,
+	* and the {@code size()} method of submaps (and of the views of submaps) is logarithmic, too.
+	*
+	* <p>The iterators provided by the views of this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}. Entries returned
+	* by iterators over the entry set are snapshots: their {@code setValue()} method writes through to the map,
+	* but they do not reflect subsequent modifications.
+	*/
+public class Byte2ByteBTreeMap extends AbstractByte2ByteSortedMap implements java.io.Serializable, Cloneable {
+	private static final long serialVersionUID = 0L;
+	private static final boolean ASSERTS = false;
+	/** The maximum number of entries in a leaf, and of children in an inner node. */
+	public static final int NODE_CAPACITY = 64;
+	/** The minimum number of entries in a leaf, and of children in an inner node, except for the root. */
+	private static final int MIN_SIZE = NODE_CAPACITY / 2;
+	/** A node of the tree. Leaves have {@link #child} equal to {@code null}. */
+	protected static final class Node {
+	 /** The keys (in a leaf) or the separators (in an inner node): separator <var>i</var> is larger than the keys in child <var>i</var> and
+		 * smaller than or equal to the keys in child <var>i</var> + 1. Arrays have one additional slot, so that
+		 * a node can overflow temporarily before being split. */
+	 byte[] key;
+	 /** The values (in a leaf of a map that stores values), or {@code null}. */
+	 byte[] value;
+	 /** The children (in an inner node), or {@code null}. */
+	 Node [] child;
+	 /** The number of entries in the subtree of each child (in an inner node), or {@code null}. */
+	 int[] weight;
+	 /** The number of entries (in a leaf) or of children (in an inner node). */
+	 int size;
+	 /** The previous and next leaf, or {@code null}. */
+	 Node prev, next;
+	}
+	/** The root of the tree, or {@code null} if the map is empty. */
+	protected transient Node root;
+	/** The first leaf. */
+	protected transient Node firstLeaf;
+	/** The last leaf. */
+	protected transient Node lastLeaf;
+	/** Number of entries in this map. */
+	protected int count;
+	/** Whether this map stores no values (as the backing map of a type-specific B+-tree set). */
+	protected final boolean keysOnly;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Byte2ByteMap.Entry > entries;
+	/** Cached set of keys. */
+	protected transient ByteSortedSet keys;
+	/** Cached collection of values. */
+	protected transient ByteCollection values;
+	/** The value of this variable remembers, after a {@code put()}
+	 * or a {@code remove()}, whether the <em>domain</em> of the map
+	 * has been modified. */
+	protected transient boolean modified;
+	/** This map's comparator, as provided in the constructor. */
+	protected Comparator<? super Byte> storedComparator;
+	/** This map's actual comparator; it may differ from {@link #storedComparator} because it is
+		always a type-specific comparator, so it could be derived from the former by wrapping. */
+	protected transient ByteComparator actualComparator;
+	/** The node created by the last split, to be inserted in the parent, or {@code null}. */
+	private transient Node splitNode;
+	/** The separator for {@link #splitNode}. */
+	private transient byte splitKey;
+	/** Creates a new empty tree map.
+	 */
+	public Byte2ByteBTreeMap() {
+	 keysOnly = false;
+	}
+	/** Creates a new empty tree map with the given comparator.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 */
+	public Byte2ByteBTreeMap(final Comparator<? super Byte> c) {
+	 this(c, false);
+	}
+	/** Creates a new empty tree map with the given comparator, possibly storing no values.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 * @param keysOnly if true, the map will not store values (and will always return {@code null} as a value);
+	 * this is the backing map of a type-specific B+-tree set.
+	 */
+	Byte2ByteBTreeMap(final Comparator<? super Byte> c, final boolean keysOnly) {
+	 this.keysOnly = keysOnly;
+	 storedComparator = c;
+	 setActualComparator();
+	}
+	/** Creates a new tree map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new tree map.
+	 */
+	public Byte2ByteBTreeMap(final Map<? extends Byte, ? extends Byte> m) {
+	 this();
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new tree map.
+	 */
+	public Byte2ByteBTreeMap(final SortedMap<Byte,Byte> m) {
+	 this(m.comparator());
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given map.
+	 *
+	 * @param m a type-specific map to be copied into the new tree map.
+	 */
+	public Byte2ByteBTreeMap(final Byte2ByteMap m) {
+	 this();
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new tree map.
+	 */
+	public Byte2ByteBTreeMap(final Byte2ByteSortedMap m) {
+	 this(m.comparator());
+	 putAll(m);
+	}
+	/** Creates a new tree map using the elements of two parallel arrays and the given comparator.
+	 *
+	 * @param k the array of keys of the new tree map.
+	 * @param v the array of corresponding values in the new tree map.
+	 * @param c a (possibly type-specific) comparator.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2ByteBTreeMap(final byte[] k, final byte v[], final Comparator<? super Byte> c) {
+	 this(c);
+	 if (k.length != v.length) throw new IllegalArgumentException("The key array and the value array have different lengths (" + k.length + " and " + v.length + ")");
+	 for(int i = 0; i < k.length; i++) this.put(k[i], v[i]);
+	}
+	/** Creates a new tree map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new tree map.
+	 * @param v the array of corresponding values in the new tree map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2ByteBTreeMap(final byte[] k, final byte v[]) {
+	 this(k, v, null);
+	}
+	/** Generates the comparator that will be actually used.
+	 *
+	 * <p>When a given {@link Comparator} is specified and stored in {@link
+	 * #storedComparator}, we must check whether it is type-specific.  If it is
+	 * so, we can used directly, and we store it in {@link #actualComparator}. Otherwise,
+	 * we adapt it using a helper static method.
+	 */
+	private void setActualComparator() {
+	 actualComparator = ByteComparators.asByteComparator(storedComparator);
+	}
+	/** Compares two keys in the right way.
+	 *
+	 * <p>This method uses the {@link #actualComparator} if it is non-{@code null}.
+	 * Otherwise, it resorts to primitive type comparisons or to {@link Comparable#compareTo(Object) compareTo()}.
+	 *
+	 * @param k1 the first key.
+	 * @param k2 the second key.
+	 * @return a number smaller than, equal to or greater than 0, as usual
+	 * (i.e., when k1 &lt; k2, k1 = k2 or k1 &gt; k2, respectively).
+	 */
+
+	final int compare(final byte k1, final byte k2) {
+	 return actualComparator == null ? ( Byte.compare((k1),(k2)) ) : actualComparator.compare(k1, k2);
+	}
+	/** Searches for a key among the keys of a leaf.
+	 *
+	 * @param leaf a leaf.
+	 * @param k a key.
+	 * @return the position of {@code k} in {@code leaf}, if present; otherwise, &minus;(<var>insertion point</var>) &minus; 1.
+	 */
+	private int search(final Node leaf, final byte k) {
+	 final byte[] key = leaf.key;
+	 int from = 0, to = leaf.size - 1;
+	 while (from <= to) {
+	  final int mid = (from + to) >>> 1;
+	  final int cmp = compare(key[mid], k);
+	  if (cmp < 0) from = mid + 1;
+	  else if (cmp > 0) to = mid - 1;
+	  else return mid;
+	 }
+	 return -(from + 1);
+	}
+	/** Returns the index of the child of an inner node that might contain a key.
+	 *
+	 * @param node an inner node.
+	 * @param k a key.
+	 * @return the number of separators of {@code node} that are smaller than or equal to {@code k}.
+	 */
+	private int childIndex(final Node node, final byte k) {
+	 final byte[] key = node.key;
+	 int from = 0, to = node.size - 1;
+	 while (from < to) {
+	  final int mid = (from + to) >>> 1;
+	  if (compare(key[mid], k) <= 0) from = mid + 1;
+	  else to = mid;
+	 }
+	 return from;
+	}
+	/** Returns the leaf that might contain a key.
+	 *
+	 * @param k a key.
+	 * @return the leaf that might contain {@code k}, or {@code null} if the map is empty.
+	 */
+	private Node leaf(final byte k) {
+	 Node node = root;
+	 if (node == null) return null;
+	 while (node.child != null) node = node.child[childIndex(node, k)];
+	 return node;
+	}
+
+	private Node newLeaf() {
+	 final Node leaf = new Node ();
+	 leaf.key = new byte[NODE_CAPACITY + 1];
+	 if (! keysOnly) leaf.value = new byte[NODE_CAPACITY + 1];
+	 return leaf;
+	}
+
+	private static Node newInner() {
+	 final Node node = new Node ();
+	 node.key = new byte[NODE_CAPACITY];
+	 node.child = new Node[NODE_CAPACITY + 1];
+	 node.weight = new int[NODE_CAPACITY + 1];
+	 return node;
+	}
+	/** Moves entries (or separators and children) between nodes, or within a node.
+	 *
+	 * <p>Keys and values are moved together for leaves; for inner nodes, this method
+	 * moves children and their weights, and the caller must move separators.
+	 */
+	private static void moveEntries(final Node from, final int fromPos, final Node to, final int toPos, final int length) {
+	 if (from.child == null) {
+	  System.arraycopy(from.key, fromPos, to.key, toPos, length);
+	  if (from.value != null) System.arraycopy(from.value, fromPos, to.value, toPos, length);
+	 }
+	 else {
+	  System.arraycopy(from.child, fromPos, to.child, toPos, length);
+	  System.arraycopy(from.weight, fromPos, to.weight, toPos, length);
+	 }
+	}
+	/** Returns the number of entries in a subtree.
+	 *
+	 * @param node the root of a subtree.
+	 * @return the number of entries in the subtree rooted at {@code node}.
+	 */
+	private static int weight(final Node node) {
+	 if (node.child == null) return node.size;
+	 int w = 0;
+	 for (int i = node.size; i-- != 0;) w += node.weight[i];
+	 return w;
+	}
+	/** Clears the references in a range of a node, so that they can be garbage collected. */
+	private static void clearEntries(final Node node, final int from, final int to) {
+	 if (node.child != null) java.util.Arrays.fill(node.child, from, to, null);
+	}
+	@Override
+	public byte put(final byte k, final byte v) {
+	 modified = false;
+	 if (root == null) {
+	  // Check that the key is comparable (or nonnull) before inserting it
+	  compare(k, k);
+	  root = firstLeaf = lastLeaf = newLeaf();
+	 }
+	 final byte oldValue = insert(root, k, v);
+	 if (splitNode != null) {
+	  final Node newRoot = newInner();
+	  newRoot.child[0] = root;
+	  newRoot.child[1] = splitNode;
+	  newRoot.weight[1] = weight(splitNode);
+	  newRoot.weight[0] = count - newRoot.weight[1];
+	  newRoot.key[0] = splitKey;
+	  newRoot.size = 2;
+	  root = newRoot;
+	  splitNode = null;
+	  splitKey = ((byte)0);
+	 }
+	 if (ASSERTS) checkTree();
+	 return oldValue;
+	}
+	/** Inserts a key in a subtree; if the root of the subtree is split, sets {@link #splitNode} and {@link #splitKey}. */
+	private byte insert(final Node node, final byte k, final byte v) {
+	 if (node.child == null) {
+	  int pos = search(node, k);
+	  if (pos >= 0) {
+	   if (node.value == null) return ((byte)0);
+	   final byte oldValue = node.value[pos];
+	   node.value[pos] = v;
+	   return oldValue;
+	  }
+	  pos = -pos - 1;
+	  moveEntries(node, pos, node, pos + 1, node.size - pos);
+	  node.key[pos] = k;
+	  if (node.value != null) node.value[pos] = v;
+	  if (++node.size > NODE_CAPACITY) splitLeaf(node);
+	  count++;
+	  modified = true;
+	  return defRetValue;
+	 }
+	 final int i = childIndex(node, k);
+	 final byte oldValue = insert(node.child[i], k, v);
+	 if (modified) node.weight[i]++;
+	 if (splitNode != null) {
+	  final Node newChild = splitNode;
+	  final byte separator = splitKey;
+	  splitNode = null;
+	  System.arraycopy(node.key, i, node.key, i + 1, node.size - 1 - i);
+	  moveEntries(node, i + 1, node, i + 2, node.size - 1 - i);
+	  node.key[i] = separator;
+	  node.child[i + 1] = newChild;
+	  node.weight[i + 1] = weight(newChild);
+	  node.weight[i] -= node.weight[i + 1];
+	  if (++node.size > NODE_CAPACITY) splitInner(node);
+	 }
+	 return oldValue;
+	}
+	/** Splits an overflowing leaf, linking the new leaf after it. */
+	private void splitLeaf(final Node leaf) {
+	 final Node right = newLeaf();
+	 final int h = leaf.size / 2;
+	 moveEntries(leaf, h, right, 0, leaf.size - h);
+	 right.size = leaf.size - h;
+	 clearEntries(leaf, h, leaf.size);
+	 leaf.size = h;
+	 right.prev = leaf;
+	 right.next = leaf.next;
+	 if (leaf.next != null) leaf.next.prev = right;
+	 else lastLeaf = right;
+	 leaf.next = right;
+	 splitNode = right;
+	 splitKey = right.key[0];
+	}
+	/** Splits an overflowing inner node. */
+	private void splitInner(final Node node) {
+	 final Node right = newInner();
+	 final int h = node.size / 2;
+	 moveEntries(node, h, right, 0, node.size - h);
+	 System.arraycopy(node.key, h, right.key, 0, node.size - h - 1);
+	 right.size = node.size - h;
+	 splitKey = node.key[h - 1];
+	 clearEntries(node, h, node.size);
+	 node.size = h;
+	 splitNode = right;
+	}
+
+	@Override
+	public byte remove(final byte k) {
+	 modified = false;
+	 if (root == null) return defRetValue;
+	 final byte oldValue = delete(root, k);
+	 if (root.child != null && root.size == 1) root = root.child[0];
+	 else if (root.child == null && root.size == 0) root = firstLeaf = lastLeaf = null;
+	 if (ASSERTS) checkTree();
+	 return oldValue;
+	}
+	/** Deletes a key from a subtree, rebalancing the children of its root if necessary. */
+	private byte delete(final Node node, final byte k) {
+	 if (node.child == null) {
+	  final int pos = search(node, k);
+	  if (pos < 0) return defRetValue;
+	  final byte oldValue = node.value == null ? ((byte)0) : node.value[pos];
+	  moveEntries(node, pos + 1, node, pos, node.size - pos - 1);
+	  clearEntries(node, node.size - 1, node.size);
+	  node.size--;
+	  count--;
+	  modified = true;
+	  return oldValue;
+	 }
+	 final int i = childIndex(node, k);
+	 final byte oldValue = delete(node.child[i], k);
+	 if (modified) {
+	  node.weight[i]--;
+	  if (node.child[i].size < MIN_SIZE) rebalance(node, i);
+	 }
+	 return oldValue;
+	}
+	/** Fixes an underflowing child of an inner node by borrowing from a sibling or by merging it with a sibling.
+	 *
+	 * @param parent an inner node.
+	 * @param i the index of an underflowing child of {@code parent}.
+	 */
+	private void rebalance(final Node parent, final int i) {
+	 final Node c = parent.child[i];
+	 final boolean leaf = c.child == null;
+	 if (i > 0 && parent.child[i - 1].size > MIN_SIZE) {
+	  // Borrow the last entry (or child) of the left sibling
+	  final Node left = parent.child[i - 1];
+	  moveEntries(c, 0, c, 1, c.size);
+	  moveEntries(left, left.size - 1, c, 0, 1);
+	  final int w = leaf ? 1 : c.weight[0];
+	  parent.weight[i - 1] -= w;
+	  parent.weight[i] += w;
+	  if (leaf) parent.key[i - 1] = c.key[0];
+	  else {
+	   System.arraycopy(c.key, 0, c.key, 1, c.size - 1);
+	   c.key[0] = parent.key[i - 1];
+	   parent.key[i - 1] = left.key[left.size - 2];
+	  }
+	  clearEntries(left, left.size - 1, left.size);
+	  left.size--;
+	  c.size++;
+	 }
+	 else if (i < parent.size - 1 && parent.child[i + 1].size > MIN_SIZE) {
+	  // Borrow the first entry (or child) of the right sibling
+	  final Node right = parent.child[i + 1];
+	  moveEntries(right, 0, c, c.size, 1);
+	  final int w = leaf ? 1 : c.weight[c.size];
+	  parent.weight[i + 1] -= w;
+	  parent.weight[i] += w;
+	  if (leaf) {
+	   moveEntries(right, 1, right, 0, right.size - 1);
+	   parent.key[i] = right.key[0];
+	  }
+	  else {
+	   c.key[c.size - 1] = parent.key[i];
+	   parent.key[i] = right.key[0];
+	   System.arraycopy(right.key, 1, right.key, 0, right.size - 2);
+	   moveEntries(right, 1, right, 0, right.size - 1);
+	  }
+	  clearEntries(right, right.size - 1, right.size);
+	  right.size--;
+	  c.size++;
+	 }
+	 else if (i > 0) merge(parent, i - 1);
+	 else merge(parent, i);
+	}
+	/** Merges two adjacent children of an inner node.
+	 *
+	 * @param parent an inner node.
+	 * @param j the index of the left child; the right child, at index {@code j} + 1, will be removed.
+	 */
+	private void merge(final Node parent, final int j) {
+	 final Node left = parent.child[j], right = parent.child[j + 1];
+	 if (left.child == null) {
+	  moveEntries(right, 0, left, left.size, right.size);
+	  left.next = right.next;
+	  if (right.next != null) right.next.prev = left;
+	  else lastLeaf = left;
+	 }
+	 else {
+	  left.key[left.size - 1] = parent.key[j];
+	  System.arraycopy(right.key, 0, left.key, left.size, right.size - 1);
+	  moveEntries(right, 0, left, left.size, right.size);
+	 }
+	 left.size += right.size;
+	 parent.weight[j] += parent.weight[j + 1];
+	 System.arraycopy(parent.key, j + 1, parent.key, j, parent.size - j - 2);
+	 moveEntries(parent, j + 2, parent, j + 1, parent.size - j - 2);
+	 parent.child[parent.size - 1] = null;
+	 parent.size--;
+	}
+
+	@Override
+	public boolean containsKey(final byte k) {
+	
+	 final Node leaf = leaf( k);
+	 return leaf != null && search(leaf, k) >= 0;
+	}
+
+	@Override
+	public byte get(final byte k) {
+	 final Node leaf = leaf( k);
+	 if (leaf == null) return defRetValue;
+	 final int pos = search(leaf, k);
+	 return pos < 0 ? defRetValue : leaf.value == null ? ((byte)0) : leaf.value[pos];
+	}
+	@Override
+	public boolean containsValue(final byte v) {
+	 if (keysOnly) return count != 0 && ( (((byte)0)) == (v) );
+	 for (Node leaf = firstLeaf; leaf != null; leaf = leaf.next)
+	  for (int i = leaf.size; i-- != 0;) if (( (leaf.value[i]) == (v) )) return true;
+	 return false;
+	}
+	@Override
+	public void clear() {
+	 count = 0;
+	 root = firstLeaf = lastLeaf = null;
+	 entries = null;
+	 values = null;
+	 keys = null;
+	}
+	@Override
+	public int size() {
+	 return count;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return count == 0;
+	}
+	@Override
+	public byte firstByteKey() {
+	 if (root == null) throw new NoSuchElementException();
+	 return firstLeaf.key[0];
+	}
+	@Override
+	public byte lastByteKey() {
+	 if (root == null) throw new NoSuchElementException();
+	 return lastLeaf.key[lastLeaf.size - 1];
+	}
+	/** Returns the rank of a key, that is, the number of keys in this map smaller than the given key.
+	 *
+	 * <p>The key need not be in the map; if it is, its rank is its position in the key set (starting from zero).
+	 *
+	 * @param k a key.
+	 * @return the number of keys in this map that are smaller than {@code k}.
+	 */
+	public int rank(final byte k) {
+	 Node node = root;
+	 if (node == null) return 0;
+	 int rank = 0;
+	 while (node.child != null) {
+	  final int i = childIndex(node, k);
+	  for (int j = i; j-- != 0;) rank += node.weight[j];
+	  node = node.child[i];
+	 }
+	 final int pos = search(node, k);
+	 return rank + (pos >= 0 ? pos : -pos - 1);
+	}
+	/** Returns the key of given rank, that is, the key in given position in the key set.
+	 *
+	 * @param rank a rank, between 0 (inclusive) and the size of this map (exclusive).
+	 * @return the key of rank {@code rank}.
+	 * @throws IndexOutOfBoundsException if {@code rank} is negative or not smaller than the size of this map.
+	 */
+	public byte select(int rank) {
+	 if (rank < 0 || rank >= count) throw new IndexOutOfBoundsException("Rank (" + rank + ") is not in [0.." + count + ")");
+	 Node node = root;
+	 while (node.child != null) {
+	  int i = 0;
+	  while (rank >= node.weight[i]) rank -= node.weight[i++];
+	  node = node.child[i];
+	 }
+	 return node.key[rank];
+	}
+	/** A snapshot of an entry whose {@link #setValue setValue()} method writes through to the map. */
+	private final class MapEntry extends AbstractByte2ByteMap.BasicEntry {
+	 MapEntry(final Node leaf, final int pos) {
+	  super(leaf.key[pos], leaf.value == null ? ((byte)0) : leaf.value[pos]);
+	 }
+	 @Override
+	 public byte setValue(final byte value) {
+	  final byte oldValue = this.value;
+	  Byte2ByteBTreeMap.this.put(key, value);
+	  this.value = value;
+	  return oldValue;
+	 }
+	}
+	/** An abstract iterator on a range of the tree.
+	 *
+	 * <p>The iterator is positioned between two entries, using a leaf and a position in the leaf.
+	 * Removal looks up again the position of the removed key, as the structure of the tree might change.
+	 */
+	private class TreeIterator {
+	 /** The leaf containing the entry that will be returned by the next call to {@link java.util.ListIterator#next()},
+		 * or the last leaf if there is no such entry; {@code null} if the map is empty. */
+	 Node leaf;
+	 /** The position of the next entry in {@link #leaf}. */
+	 int pos;
+	 /** The leaf of the last returned entry. */
+	 Node currLeaf;
+	 /** The position of the last returned entry, or -1 if we did not iterate or used {@link #remove()}. */
+	 int currPos = -1;
+	 /** Whether the last returned entry was returned by {@link #nextEntry()}. */
+	 boolean forward;
+	 TreeIterator() {
+	  leaf = firstLeaf;
+	 }
+	 TreeIterator(final byte k) {
+	  seek(k, true);
+	 }
+	 /** Positions this iterator on a key.
+		 *
+		 * @param k a key.
+		 * @param strict if true, the next entry will be the first whose key is greater than {@code k}; otherwise,
+		 * greater than or equal to {@code k}.
+		 */
+	 final void seek(final byte k, final boolean strict) {
+	  leaf = Byte2ByteBTreeMap.this.leaf(k);
+	  if (leaf == null) return;
+	  int p = search(leaf, k);
+	  pos = p >= 0 ? (strict ? p + 1 : p) : -p - 1;
+	  normalize();
+	 }
+	 /** Moves to the next leaf if the position is past the end of a leaf. */
+	 final void normalize() {
+	  if (pos == leaf.size && leaf.next != null) {
+	   leaf = leaf.next;
+	   pos = 0;
+	  }
+	 }
+	 boolean hasNextEntry() { return leaf != null && pos < leaf.size; }
+	 boolean hasPreviousEntry() { return leaf != null && (pos > 0 || leaf.prev != null); }
+	 public boolean hasNext() { return hasNextEntry(); }
+	 public boolean hasPrevious() { return hasPreviousEntry(); }
+	 /** Returns the key of the next entry, assuming there is one. */
+	 final byte nextKey() {
+	  return leaf.key[pos];
+	 }
+	 /** Returns the key of the previous entry, assuming there is one. */
+	 final byte previousKey() {
+	  return pos > 0 ? leaf.key[pos - 1] : leaf.prev.key[leaf.prev.size - 1];
+	 }
+	 /** Moves past the next entry, and returns its position (in {@link #currLeaf} and {@link #currPos}). */
+	 final void nextEntry() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  currLeaf = leaf;
+	  currPos = pos++;
+	  forward = true;
+	  normalize();
+	 }
+	 /** Moves before the previous entry, and returns its position (in {@link #currLeaf} and {@link #currPos}). */
+	 final void previousEntry() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  if (pos == 0) {
+	   leaf = leaf.prev;
+	   pos = leaf.size;
+	  }
+	  currLeaf = leaf;
+	  currPos = --pos;
+	  forward = false;
+	 }
+	 public void remove() {
+	  if (currPos == -1) throw new IllegalStateException();
+	  final byte k = currLeaf.key[currPos];
+	  Byte2ByteBTreeMap.this.remove(k);
+	  seek(k, true);
+	  currLeaf = null;
+	  currPos = -1;
+	 }
+	 public int skip(final int n) {
+	  int i = n;
+	  while(i-- != 0 && hasNext()) nextEntry();
+	  return n - i - 1;
+	 }
+	 public int back(final int n) {
+	  int i = n;
+	  while(i-- != 0 && hasPrevious()) previousEntry();
+	  return n - i - 1;
+	 }
+	}
+	/** An iterator on the entries of the whole range. */
+	private class EntryIterator extends TreeIterator implements ObjectBidirectionalIterator<Byte2ByteMap.Entry > {
+	 EntryIterator() {}
+	 EntryIterator(final byte k) {
+	  super(k);
+	 }
+	 @Override
+	 public Byte2ByteMap.Entry next() { nextEntry(); return new MapEntry(currLeaf, currPos); }
+	 @Override
+	 public Byte2ByteMap.Entry previous() { previousEntry(); return new MapEntry(currLeaf, currPos); }
+	}
+	@Override
+
+	public ObjectSortedSet<Byte2ByteMap.Entry > byte2ByteEntrySet() {
+	 if (entries == null) entries = new AbstractObjectSortedSet<Byte2ByteMap.Entry >() {
+	   final Comparator<? super Byte2ByteMap.Entry > comparator = (Byte2ByteBTreeMap.this.actualComparator == null ?
+	     (Comparator<Byte2ByteMap.Entry >) (x, y) -> ( Byte.compare((x.getByteKey()),(y.getByteKey())) ) :
+	     (Comparator<Byte2ByteMap.Entry >) (x, y) -> Byte2ByteBTreeMap.this.actualComparator.compare(x.getByteKey(), y.getByteKey())
+	   );
+	   @Override
+	   public Comparator<? super Byte2ByteMap.Entry > comparator() { return comparator; }
+	   @Override
+	   public ObjectBidirectionalIterator<Byte2ByteMap.Entry > iterator() { return new EntryIterator(); }
+	   @Override
+	   public ObjectBidirectionalIterator<Byte2ByteMap.Entry > iterator(final Byte2ByteMap.Entry from) { return new EntryIterator(from.getByteKey()); }
+	   @Override
+	  
+	   public boolean contains(final Object o) {
+	    if (o == null || !(o instanceof Map.Entry)) return false;
+	    final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	    if (e.getKey() == null) return false;
+	    if (! (e.getKey() instanceof Byte)) return false;
+	    if (e.getValue() == null || ! (e.getValue() instanceof Byte)) return false;
+	    final byte k = ((Byte)( e.getKey())).byteValue();
+	    return containsKey(k) && ( (get(k)) == (((Byte)(e.getValue())).byteValue()) );
+	   }
+	   @Override
+	  
+	   public boolean remove(final Object o) {
+	    if (! contains(o)) return false;
+	    Byte2ByteBTreeMap.this.remove(((Byte)( ((Map.Entry<?,?>)o).getKey())).byteValue());
+	    return true;
+	   }
+	   @Override
+	   public int size() { return count; }
+	   @Override
+	   public void clear() { Byte2ByteBTreeMap.this.clear(); }
+	   @Override
+	   public Byte2ByteMap.Entry first() {
+	    if (root == null) throw new NoSuchElementException();
+	    return new MapEntry(firstLeaf, 0);
+	   }
+	   @Override
+	   public Byte2ByteMap.Entry last() {
+	    if (root == null) throw new NoSuchElementException();
+	    return new MapEntry(lastLeaf, lastLeaf.size - 1);
+	   }
+	   @Override
+	   public ObjectSortedSet<Byte2ByteMap.Entry > subSet(Byte2ByteMap.Entry from, Byte2ByteMap.Entry to) { return subMap(from.getByteKey(), to.getByteKey()).byte2ByteEntrySet(); }
+	   @Override
+	   public ObjectSortedSet<Byte2ByteMap.Entry > headSet(Byte2ByteMap.Entry to) { return headMap(to.getByteKey()).byte2ByteEntrySet(); }
+	   @Override
+	   public ObjectSortedSet<Byte2ByteMap.Entry > tailSet(Byte2ByteMap.Entry from) { return tailMap(from.getByteKey()).byte2ByteEntrySet(); }
+	  };
+	 return entries;
+	}
+	/** An iterator on the keys of the whole range. */
+	private final class KeyIterator extends TreeIterator implements ByteBidirectionalIterator {
+	 public KeyIterator() {}
+	 public KeyIterator(final byte k) { super(k); }
+	 @Override
+	 public byte nextByte() { nextEntry(); return currLeaf.key[currPos]; }
+	 @Override
+	 public byte previousByte() { previousEntry(); return currLeaf.key[currPos]; }
+	};
+	/** A keyset implementation using a more direct implementation for iterators. */
+	private class KeySet extends AbstractByte2ByteSortedMap .KeySet {
+	 @Override
+	 public ByteBidirectionalIterator iterator() { return new KeyIterator(); }
+	 @Override
+	 public ByteBidirectionalIterator iterator(final byte from) { return new KeyIterator(from); }
+	}
+	/** Returns a type-specific sorted set view of the keys contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#keySet()}, you can
+	 * safely cast the set returned by this call to a type-specific sorted
+	 * set interface.
+	 *
+	 * @return a type-specific sorted set view of the keys contained in this map.
+	 */
+	@Override
+	public ByteSortedSet keySet() {
+	 if (keys == null) keys = new KeySet();
+	 return keys;
+	}
+	/** An iterator on the values of the whole range. */
+	private final class ValueIterator extends TreeIterator implements ByteIterator {
+	 @Override
+	 public byte nextByte() { nextEntry(); return currLeaf.value == null ? ((byte)0) : currLeaf.value[currPos]; }
+	};
+	/** Returns a type-specific collection view of the values contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#values()}, you can
+	 * safely cast the collection returned by this call to a type-specific collection
+	 * interface.
+	 *
+	 * @return a type-specific collection view of the values contained in this map.
+	 */
+	@Override
+	public ByteCollection values() {
+	 if (values == null) values = new AbstractByteCollection () {
+	   @Override
+	   public ByteIterator iterator() { return new ValueIterator(); }
+	   @Override
+	   public boolean contains(final byte k) { return containsValue(k); }
+	   @Override
+	   public int size() { return count; }
+	   @Override
+	   public void clear() { Byte2ByteBTreeMap.this.clear(); }
+	  };
+	 return values;
+	}
+	@Override
+	public ByteComparator comparator() { return actualComparator; }
+	@Override
+	public Byte2ByteSortedMap headMap(byte to) { return new Submap(((byte)0), true, to, false); }
+	@Override
+	public Byte2ByteSortedMap tailMap(byte from) { return new Submap(from, false, ((byte)0), true); }
+	@Override
+	public Byte2ByteSortedMap subMap(byte from, byte to) { return new Submap(from, false, to, false); }
+	/** A submap with given range.
+	 *
+	 * <p>This class represents a submap. One has to specify the left/right
+	 * limits (which can be set to -&infin; or &infin;). Since the submap is a
+	 * view on the map, at a given moment it could happen that the limits of
+	 * the range are not any longer in the main map. Thus, things such as
+	 * {@link java.util.SortedMap#firstKey()} or {@link java.util.Collection#size()} must be always computed
+	 * on-the-fly.
+	 */
+	private final class Submap extends AbstractByte2ByteSortedMap implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 /** The start of the submap range, unless {@link #bottom} is true. */
+	 byte from;
+	 /** The end of the submap range, unless {@link #top} is true. */
+	 byte to;
+	 /** If true, the submap range starts from -&infin;. */
+	 boolean bottom;
+	 /** If true, the submap range goes to &infin;. */
+	 boolean top;
+	 /** Cached set of entries. */
+	 protected transient ObjectSortedSet<Byte2ByteMap.Entry > entries;
+	 /** Cached set of keys. */
+	 protected transient ByteSortedSet keys;
+	 /** Cached collection of values. */
+	 protected transient ByteCollection values;
+	 /** Creates a new submap with given key range.
+		 *
+		 * @param from the start of the submap range.
+		 * @param bottom if true, the first parameter is ignored and the range starts from -&infin;.
+		 * @param to the end of the submap range.
+		 * @param top if true, the third parameter is ignored and the range goes to &infin;.
+		 */
+	 public Submap(final byte from, final boolean bottom, final byte to, final boolean top) {
+	  if (! bottom && ! top && Byte2ByteBTreeMap.this.compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	  this.from = from;
+	  this.bottom = bottom;
+	  this.to = to;
+	  this.top = top;
+	  this.defRetValue = Byte2ByteBTreeMap.this.defRetValue;
+	 }
+	 @Override
+	 public void clear() {
+	  final SubmapIterator i = new SubmapIterator();
+	  while(i.hasNext()) {
+	   i.nextEntry();
+	   i.remove();
+	  }
+	 }
+	 /** Checks whether a key is in the submap range.
+		 * @param k a key.
+		 * @return true if is the key is in the submap range.
+		 */
+	 final boolean in(final byte k) {
+	  return (bottom || Byte2ByteBTreeMap.this.compare(k, from) >= 0) &&
+	   (top || Byte2ByteBTreeMap.this.compare(k, to) < 0);
+	 }
+	 @Override
+	 public ObjectSortedSet<Byte2ByteMap.Entry > byte2ByteEntrySet() {
+	  if (entries == null) entries = new AbstractObjectSortedSet<Byte2ByteMap.Entry >() {
+	    @Override
+	    public ObjectBidirectionalIterator<Byte2ByteMap.Entry > iterator() {
+	     return new SubmapEntryIterator();
+	    }
+	    @Override
+	    public ObjectBidirectionalIterator<Byte2ByteMap.Entry > iterator(final Byte2ByteMap.Entry from) {
+	     return new SubmapEntryIterator(from.getByteKey());
+	    }
+	    @Override
+	    public Comparator<? super Byte2ByteMap.Entry > comparator() { return Byte2ByteBTreeMap.this.byte2ByteEntrySet().comparator(); }
+	    @Override
+	   
+	    public boolean contains(final Object o) {
+	     if (!(o instanceof Map.Entry)) return false;
+	     final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	     if (e.getKey() == null) return false;
+	     if (! (e.getKey() instanceof Byte)) return false;
+	     if (e.getValue() == null || ! (e.getValue() instanceof Byte)) return false;
+	     final byte k = ((Byte)( e.getKey())).byteValue();
+	     return in(k) && Byte2ByteBTreeMap.this.containsKey(k) && ( (Byte2ByteBTreeMap.this.get(k)) == (((Byte)(e.getValue())).byteValue()) );
+	    }
+	    @Override
+	   
+	    public boolean remove(final Object o) {
+	     if (! contains(o)) return false;
+	     Byte2ByteBTreeMap.this.remove(((Byte)( ((Map.Entry<?,?>)o).getKey())).byteValue());
+	     return true;
+	    }
+	    @Override
+	    public int size() { return Submap.this.size(); }
+	    @Override
+	    public boolean isEmpty() { return ! new SubmapIterator().hasNext(); }
+	    @Override
+	    public void clear() { Submap.this.clear(); }
+	    @Override
+	    public Byte2ByteMap.Entry first() {
+	     final SubmapIterator i = new SubmapIterator();
+	     i.nextEntry();
+	     return new MapEntry(i.currLeaf, i.currPos);
+	    }
+	    @Override
+	    public Byte2ByteMap.Entry last() {
+	     final SubmapIterator i = new SubmapIterator(true);
+	     i.previousEntry();
+	     return new MapEntry(i.currLeaf, i.currPos);
+	    }
+	    @Override
+	    public ObjectSortedSet<Byte2ByteMap.Entry > subSet(Byte2ByteMap.Entry from, Byte2ByteMap.Entry to) { return subMap(from.getByteKey(), to.getByteKey()).byte2ByteEntrySet(); }
+	    @Override
+	    public ObjectSortedSet<Byte2ByteMap.Entry > headSet(Byte2ByteMap.Entry to) { return headMap(to.getByteKey()).byte2ByteEntrySet(); }
+	    @Override
+	    public ObjectSortedSet<Byte2ByteMap.Entry > tailSet(Byte2ByteMap.Entry from) { return tailMap(from.getByteKey()).byte2ByteEntrySet(); }
+	   };
+	  return entries;
+	 }
+	 private class KeySet extends AbstractByte2ByteSortedMap .KeySet {
+	  @Override
+	  public ByteBidirectionalIterator iterator() { return new SubmapKeyIterator(); }
+	  @Override
+	  public ByteBidirectionalIterator iterator(final byte from) { return new SubmapKeyIterator(from); }
+	 }
+	 @Override
+	 public ByteSortedSet keySet() {
+	  if (keys == null) keys = new KeySet();
+	  return keys;
+	 }
+	 @Override
+	 public ByteCollection values() {
+	  if (values == null) values = new AbstractByteCollection () {
+	    @Override
+	    public ByteIterator iterator() { return new SubmapValueIterator(); }
+	    @Override
+	    public boolean contains(final byte k) { return containsValue(k); }
+	    @Override
+	    public int size() { return Submap.this.size(); }
+	    @Override
+	    public void clear() { Submap.this.clear(); }
+	   };
+	  return values;
+	 }
+	 @Override
+	
+	 public boolean containsKey(final byte k) {
+	 
+	  return in( k) && Byte2ByteBTreeMap.this.containsKey(k);
+	 }
+	 @Override
+	 public boolean containsValue(final byte v) {
+	  final SubmapValueIterator i = new SubmapValueIterator();
+	  while(i.hasNext()) if (( (i.nextByte()) == (v) )) return true;
+	  return false;
+	 }
+	 @Override
+	
+	 public byte get(final byte k) {
+	  final byte kk = k;
+	  return in(kk) && Byte2ByteBTreeMap.this.containsKey(kk) ? Byte2ByteBTreeMap.this.get(kk) : this.defRetValue;
+	 }
+	 @Override
+	 public byte put(final byte k, final byte v) {
+	  modified = false;
+	  if (! in(k)) throw new IllegalArgumentException("Key (" + k + ") out of range [" + (bottom ? "-" : String.valueOf(from)) + ", " + (top ? "-" : String.valueOf(to)) + ")");
+	  final byte oldValue = Byte2ByteBTreeMap.this.put(k, v);
+	  return modified ? this.defRetValue : oldValue;
+	 }
+	 @Override
+	
+	 public byte remove(final byte k) {
+	  modified = false;
+	  if (! in( k)) return this.defRetValue;
+	  final byte oldValue = Byte2ByteBTreeMap.this.remove(k);
+	  return modified ? oldValue : this.defRetValue;
+	 }
+	 @Override
+	 public int size() {
+	  return (top ? count : rank(to)) - (bottom ? 0 : rank(from));
+	 }
+	 @Override
+	 public boolean isEmpty() { return ! new SubmapIterator().hasNext(); }
+	 @Override
+	 public ByteComparator comparator() { return actualComparator; }
+	 @Override
+	 public Byte2ByteSortedMap headMap(final byte to) {
+	  if (top) return new Submap(from, bottom, to, false);
+	  return compare(to, this.to) < 0 ? new Submap(from, bottom, to, false) : this;
+	 }
+	 @Override
+	 public Byte2ByteSortedMap tailMap(final byte from) {
+	  if (bottom) return new Submap(from, false, to, top);
+	  return compare(from, this.from) > 0 ? new Submap(from, false, to, top) : this;
+	 }
+	 @Override
+	 public Byte2ByteSortedMap subMap(byte from, byte to) {
+	  if (top && bottom) return new Submap(from, false, to, false);
+	  if (! top) to = compare(to, this.to) < 0 ? to : this.to;
+	  if (! bottom) from = compare(from, this.from) > 0 ? from : this.from;
+	  if (! top && ! bottom && from == this.from && to == this.to) return this;
+	  return new Submap(from, false, to, false);
+	 }
+	 @Override
+	 public byte firstByteKey() {
+	  final SubmapIterator i = new SubmapIterator();
+	  if (! i.hasNext()) throw new NoSuchElementException();
+	  return i.nextKey();
+	 }
+	 @Override
+	 public byte lastByteKey() {
+	  final SubmapIterator i = new SubmapIterator(true);
+	  if (! i.hasPrevious()) throw new NoSuchElementException();
+	  return i.previousKey();
+	 }
+	 /** An iterator for subranges.
+		 *
+		 * <p>This class inherits from {@link TreeIterator}, but checks that the next and previous entry are within the range.
+		 */
+	 private class SubmapIterator extends TreeIterator {
+	  /** Creates a new iterator positioned at the start of the range. */
+	  SubmapIterator() {
+	   if (bottom) leaf = firstLeaf;
+	   else seek(from, false);
+	  }
+	  /** Creates a new iterator positioned at the end of the range.
+			 *
+			 * @param end ignored.
+			 */
+	  SubmapIterator(final boolean end) {
+	   if (top) {
+	    leaf = lastLeaf;
+	    if (leaf != null) pos = leaf.size;
+	   }
+	   else seek(to, false);
+	  }
+	  SubmapIterator(final byte k) {
+	   if (! bottom && compare(k, from) < 0) seek(from, false);
+	   else if (! top && compare(k, to) >= 0) seek(to, false);
+	   else seek(k, true);
+	  }
+	  @Override
+	  public boolean hasNext() {
+	   return hasNextEntry() && (top || compare(nextKey(), to) < 0);
+	  }
+	  @Override
+	  public boolean hasPrevious() {
+	   return hasPreviousEntry() && (bottom || compare(previousKey(), from) >= 0);
+	  }
+	 }
+	 private class SubmapEntryIterator extends SubmapIterator implements ObjectBidirectionalIterator<Byte2ByteMap.Entry > {
+	  SubmapEntryIterator() {}
+	  SubmapEntryIterator(final byte k) {
+	   super(k);
+	  }
+	  @Override
+	  public Byte2ByteMap.Entry next() { nextEntry(); return new MapEntry(currLeaf, currPos); }
+	  @Override
+	  public Byte2ByteMap.Entry previous() { previousEntry(); return new MapEntry(currLeaf, currPos); }
+	 }
+	 /** An iterator on a subrange of keys. */
+	 private final class SubmapKeyIterator extends SubmapIterator implements ByteBidirectionalIterator {
+	  public SubmapKeyIterator() { super(); }
+	  public SubmapKeyIterator(byte from) { super(from); }
+	  @Override
+	  public byte nextByte() { nextEntry(); return currLeaf.key[currPos]; }
+	  @Override
+	  public byte previousByte() { previousEntry(); return currLeaf.key[currPos]; }
+	 };
+	 /** An iterator on a subrange of values. */
+	 private final class SubmapValueIterator extends SubmapIterator implements ByteIterator {
+	  @Override
+	  public byte nextByte() { nextEntry(); return currLeaf.value == null ? ((byte)0) : currLeaf.value[currPos]; }
+	 };
+	}
+	/** Builds the leaves of a tree with a given number of entries, distributing entries evenly.
+	 *
+	 * <p>The leaves are linked, and their size is set, but they are empty: the caller
+	 * must fill them in order, and then call {@link #buildIndex(Node[])}.
+	 *
+	 * @param n the number of entries.
+	 * @return the leaves.
+	 */
+
+	private Node [] buildLeaves(final int n) {
+	 final int l = (n + NODE_CAPACITY - 1) / NODE_CAPACITY;
+	 final Node [] leaves = new Node[l];
+	 for (int i = 0; i < l; i++) {
+	  leaves[i] = newLeaf();
+	  leaves[i].size = (int)(((long)n * (i + 1)) / l - ((long)n * i) / l);
+	  if (i != 0) {
+	   leaves[i].prev = leaves[i - 1];
+	   leaves[i - 1].next = leaves[i];
+	  }
+	 }
+	 return leaves;
+	}
+	/** Builds the inner nodes of a tree whose leaves have been filled, distributing children evenly.
+	 *
+	 * @param leaves the leaves, as returned by {@link #buildLeaves(int)}, filled with keys in increasing order.
+	 */
+
+	private void buildIndex(final Node [] leaves) {
+	 count = 0;
+	 for (final Node leaf : leaves) count += leaf.size;
+	 if (leaves.length == 0) {
+	  root = firstLeaf = lastLeaf = null;
+	  return;
+	 }
+	 firstLeaf = leaves[0];
+	 lastLeaf = leaves[leaves.length - 1];
+	 Node [] level = leaves;
+	 // The smallest key in the subtree of each node of the current level
+	 byte[] min = new byte[leaves.length];
+	 for (int i = 0; i < leaves.length; i++) min[i] = leaves[i].key[0];
+	 while (level.length > 1) {
+	  final int n = level.length, l = (n + NODE_CAPACITY - 1) / NODE_CAPACITY;
+	  final Node [] parents = new Node[l];
+	  final byte[] parentMin = new byte[l];
+	  for (int i = 0, c = 0; i < l; i++) {
+	   final Node p = parents[i] = newInner();
+	   p.size = (int)(((long)n * (i + 1)) / l - ((long)n * i) / l);
+	   parentMin[i] = min[c];
+	   for (int j = 0; j < p.size; j++, c++) {
+	    p.child[j] = level[c];
+	    p.weight[j] = weight(level[c]);
+	    if (j != 0) p.key[j - 1] = min[c];
+	   }
+	  }
+	  level = parents;
+	  min = parentMin;
+	 }
+	 root = level[0];
+	}
+	/** Returns a deep copy of this tree map.
+	 *
+	 * <p>This method performs a deep copy of this tree map; the data stored in the
+	 * set, however, is not cloned. Note that this makes a difference only for object keys.
+	 *
+	 * @return a deep copy of this tree map.
+	 */
+	@Override
+
+	public Byte2ByteBTreeMap clone() {
+	 Byte2ByteBTreeMap c;
+	 try {
+	  c = (Byte2ByteBTreeMap )super.clone();
+	 }
+	 catch(CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.keys = null;
+	 c.values = null;
+	 c.entries = null;
+	 c.splitNode = null;
+	 final Node [] leaves = c.buildLeaves(count);
+	 Node source = firstLeaf;
+	 int pos = 0;
+	 for (final Node leaf : leaves) {
+	  for (int i = 0; i < leaf.size; i++) {
+	   if (pos == source.size) {
+	    source = source.next;
+	    pos = 0;
+	   }
+	   leaf.key[i] = source.key[pos];
+	   if (leaf.value != null) leaf.value[i] = source.value[pos];
+	   pos++;
+	  }
+	 }
+	 c.buildIndex(leaves);
+	 return c;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 for (Node leaf = firstLeaf; leaf != null; leaf = leaf.next) {
+	  for (int i = 0; i < leaf.size; i++) {
+	   s.writeByte(leaf.key[i]);
+	   if (! keysOnly) s.writeByte(leaf.value[i]);
+	  }
+	 }
+	}
+
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 /* The storedComparator is now correctly set, but we must restore
+		   on-the-fly the actualComparator. */
+	 setActualComparator();
+	 final Node [] leaves = buildLeaves(count);
+	 for (final Node leaf : leaves) {
+	  for (int i = 0; i < leaf.size; i++) {
+	   leaf.key[i] = s.readByte();
+	   if (! keysOnly) leaf.value[i] = s.readByte();
+	  }
+	 }
+	 buildIndex(leaves);
+	}
+	private void checkTree() {}
+}
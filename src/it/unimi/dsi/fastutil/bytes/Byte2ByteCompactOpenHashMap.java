@@ -0,0 +1,919 @@
+/*
+	* Copyright (C) 2002-2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.Hash;
+import it.unimi.dsi.fastutil.HashCommon;
+import static it.unimi.dsi.fastutil.HashCommon.arraySize;
+import static it.unimi.dsi.fastutil.HashCommon.maxFill;
+import java.util.Map;
+import java.util.Arrays;
+import java.util.NoSuchElementException;
+import java.util.function.Consumer;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSet;
+import it.unimi.dsi.fastutil.objects.ObjectIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+/**  A type-specific insertion-ordered hash map with a compact layout.
+	*
+	* <p>Instances of this class keep their entries in two dense parallel arrays of keys and values,
+	* in insertion order, and use a separate hash table of integers (the <em>index</em>) whose
+	* nonempty slots point into the entry arrays. This is the layout used by the dictionaries
+	* of recent CPython versions: with respect to a linked hash map, there are no links at all,
+	* and the only per-slot cost of the hash table is an integer, whereas keys and values are
+	* allocated just for the entries that can actually be stored. Iteration is a sequential
+	* scan of the entry arrays.
+	*
+	* <p>Removing an entry leaves a hole in the entry arrays (holes at the end of the
+	* arrays are given back immediately). When a new entry must be appended but the
+	* entry arrays are full, they are either compacted in place, if at least one fourth of their
+	* positions are holes, or enlarged. Compaction does not change the iteration order.
+	*
+	* <p>The hash table is filled up to a specified <em>load factor</em>, and then doubled in size to
+	* accommodate new entries. If the table is emptied below <em>one fourth</em>
+	* of the load factor, it is halved in size; however, the table is never reduced to a
+	* size smaller than that at creation time. Halving is
+	* not performed when deleting entries from an iterator, as it would interfere
+	* with the iteration process.
+	*
+	* <p>Iterators generated by this map will enumerate pairs in the same order in which they
+	* have been added to the map (addition of pairs whose key is already present
+	* in the map does not change the iteration order). Methods such as {@code getAndMoveToLast()}
+	* and {@code removeFirst()} make it easy to use instances of this class as a cache with LRU policy;
+	* note, however, that there is no way to move an entry to the <em>first</em> position, as
+	* entries can only be appended.
+	*
+	* <p>Note that {@link #clear()} does not modify the hash table size.
+	* Rather, a family of {@linkplain #trim() trimming
+	* methods} lets you control the size of the table.
+	*
+	* <p>Entries returned by the type-specific {@link #entrySet()} method implement
+	* the suitable type-specific {@link it.unimi.dsi.fastutil.Pair Pair} interface;
+	* only values are mutable.
+	*
+	* @see Hash
+	* @see HashCommon
+	*/
+public class Byte2ByteCompactOpenHashMap extends AbstractByte2ByteMap implements java.io.Serializable, Cloneable, Hash {
+	private static final long serialVersionUID = 0L;
+	private static final boolean ASSERTS = false;
+	/** The hash table: a nonzero slot contains one plus the position of an entry in {@link #key} and {@link #value}. */
+	protected transient int[] index;
+	/** The array of keys, in insertion order (valid from {@link #first}, included, to {@link #end}, excluded, except for holes). */
+	protected transient byte[] key;
+	/** The array of values (parallel to {@link #key}). */
+	protected transient byte[] value;
+	/** A bit vector marking the positions of {@link #key} and {@link #value} that are holes left by removals. */
+	protected transient long[] removed;
+	/** The position of the first entry in iteration order, or {@link #end} if the map is empty. */
+	protected transient int first;
+	/** The position following the last entry in iteration order. */
+	protected transient int end;
+	/** The mask for wrapping a position counter. */
+	protected transient int mask;
+	/** The current table size. */
+	protected transient int n;
+	/** Threshold after which we rehash. It must be the table size times {@link #f}. */
+	protected transient int maxFill;
+	/** We never resize below this threshold, which is the construction-time {#n}. */
+	protected final transient int minN;
+	/** Number of entries in the map. */
+	protected int size;
+	/** The acceptable load factor. */
+	protected final float f;
+	/** Cached set of entries. */
+	protected transient FastEntrySet entries;
+	/** Cached set of keys. */
+	protected transient ByteSet keys;
+	/** Cached collection of values. */
+	protected transient ByteCollection values;
+	/** Creates a new hash map.
+	 *
+	 * <p>The actual table size will be the least power of two greater than {@code expected}/{@code f}.
+	 *
+	 * @param expected the expected number of elements in the hash map.
+	 * @param f the load factor.
+	 */
+
+	public Byte2ByteCompactOpenHashMap(final int expected, final float f) {
+	 if (f <= 0 || f >= 1) throw new IllegalArgumentException("Load factor must be greater than 0 and smaller than 1");
+	 if (expected < 0) throw new IllegalArgumentException("The expected number of elements must be nonnegative");
+	 this.f = f;
+	 minN = n = arraySize(expected, f);
+	 mask = n - 1;
+	 maxFill = maxFill(n, f);
+	 index = new int[n];
+	 key = new byte[maxFill + 1];
+	 value = new byte[maxFill + 1];
+	 removed = new long[bits(maxFill + 1)];
+	}
+	/** Creates a new hash map with {@link Hash#DEFAULT_LOAD_FACTOR} as load factor.
+	 *
+	 * @param expected the expected number of elements in the hash map.
+	 */
+	public Byte2ByteCompactOpenHashMap(final int expected) {
+	 this(expected, DEFAULT_LOAD_FACTOR);
+	}
+	/** Creates a new hash map with initial expected {@link Hash#DEFAULT_INITIAL_SIZE} entries
+	 * and {@link Hash#DEFAULT_LOAD_FACTOR} as load factor.
+	 */
+	public Byte2ByteCompactOpenHashMap() {
+	 this(DEFAULT_INITIAL_SIZE, DEFAULT_LOAD_FACTOR);
+	}
+	/** Creates a new hash map copying a given one.
+	 *
+	 * @param m a {@link Map} to be copied into the new hash map.
+	 * @param f the load factor.
+	 */
+	public Byte2ByteCompactOpenHashMap(final Map<? extends Byte, ? extends Byte> m, final float f) {
+	 this(m.size(), f);
+	 putAll(m);
+	}
+	/** Creates a new hash map with {@link Hash#DEFAULT_LOAD_FACTOR} as load factor copying a given one.
+	 *
+	 * @param m a {@link Map} to be copied into the new hash map.
+	 */
+	public Byte2ByteCompactOpenHashMap(final Map<? extends Byte, ? extends Byte> m) {
+	 this(m, DEFAULT_LOAD_FACTOR);
+	}
+	/** Creates a new hash map copying a given type-specific one.
+	 *
+	 * @param m a type-specific map to be copied into the new hash map.
+	 * @param f the load factor.
+	 */
+	public Byte2ByteCompactOpenHashMap(final Byte2ByteMap m, final float f) {
+	 this(m.size(), f);
+	 putAll(m);
+	}
+	/** Creates a new hash map with {@link Hash#DEFAULT_LOAD_FACTOR} as load factor copying a given type-specific one.
+	 *
+	 * @param m a type-specific map to be copied into the new hash map.
+	 */
+	public Byte2ByteCompactOpenHashMap(final Byte2ByteMap m) {
+	 this(m, DEFAULT_LOAD_FACTOR);
+	}
+	/** Creates a new hash map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new hash map.
+	 * @param v the array of corresponding values in the new hash map.
+	 * @param f the load factor.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2ByteCompactOpenHashMap(final byte[] k, final byte[] v, final float f) {
+	 this(k.length, f);
+	 if (k.length != v.length) throw new IllegalArgumentException("The key array and the value array have different lengths (" + k.length + " and " + v.length + ")");
+	 for(int i = 0; i < k.length; i++) this.put(k[i], v[i]);
+	}
+	/** Creates a new hash map with {@link Hash#DEFAULT_LOAD_FACTOR} as load factor using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new hash map.
+	 * @param v the array of corresponding values in the new hash map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2ByteCompactOpenHashMap(final byte[] k, final byte[] v) {
+	 this(k, v, DEFAULT_LOAD_FACTOR);
+	}
+	/** Returns the number of longs necessary to store a bit vector of given length. */
+	private static int bits(final int length) {
+	 return (length + Long.SIZE - 1) >>> 6;
+	}
+	private boolean isRemoved(final int pos) {
+	 return (removed[pos >>> 6] & 1L << pos) != 0;
+	}
+	private void ensureCapacity(final int capacity) {
+	 final int needed = arraySize(capacity, f);
+	 if (needed > n) rehash(needed);
+	}
+	private void tryCapacity(final long capacity) {
+	 final int needed = (int)Math.min(1 << 30, Math.max(2, HashCommon.nextPowerOfTwo((long)Math.ceil(capacity / f))));
+	 if (needed > n) rehash(needed);
+	}
+	@Override
+	public void putAll(Map<? extends Byte,? extends Byte> m) {
+	 if (f <= .5) ensureCapacity(m.size()); // The resulting map will be sized for m.size() elements
+	 else tryCapacity(size() + m.size()); // The resulting map will be tentatively sized for size() + m.size() elements
+	 super.putAll(m);
+	}
+	/** Looks for a key in the hash table.
+	 *
+	 * @param k a key.
+	 * @return the slot of the hash table pointing at the entry with key {@code k}, or
+	 * {@code -(s + 1)}, where {@code s} is the free slot at which {@code k} should be inserted.
+	 */
+	private int find(final byte k) {
+	 final int[] index = this.index;
+	 final byte[] key = this.key;
+	 int slot = ( it.unimi.dsi.fastutil.HashCommon.mix( (k) ) ) & mask, e;
+	 // There's always an unused slot.
+	 while((e = index[slot]) != 0) {
+	  if (( (k) == (key[e - 1]) )) return slot;
+	  slot = (slot + 1) & mask;
+	 }
+	 return -(slot + 1);
+	}
+	/** Makes room for a new entry at the end of the entry arrays.
+	 *
+	 * <p>If at least one fourth of the entry arrays are holes, the entry
+	 * arrays are compacted (and the hash table is rebuilt); otherwise, they are enlarged.
+	 *
+	 * @return true if entries have been moved (and thus slots of the hash table are no longer valid).
+	 */
+	private boolean makeRoom() {
+	 final int length = key.length;
+	 if (end - size >= length / 4) {
+	  rehash(n);
+	  return true;
+	 }
+	 final int newLength = (int)Math.min(it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE, length + (length >> 1) + 1L);
+	 if (newLength == length) throw new IllegalStateException("Too many entries in the compact map");
+	 key = Arrays.copyOf(key, newLength);
+	 value = Arrays.copyOf(value, newLength);
+	 removed = Arrays.copyOf(removed, bits(newLength));
+	 return false;
+	}
+	private void insert(int slot, final byte k, final byte v) {
+	 if (end == key.length && makeRoom()) slot = -find(k) - 1;
+	 key[end] = k;
+	 value[end] = v;
+	 index[slot] = ++end;
+	 if (size++ >= maxFill) rehash(arraySize(size + 1, f));
+	 if (ASSERTS) checkTable();
+	}
+	/** Shifts back the slots of the hash table following a given one,
+	 * and empties the resulting free slot.
+	 *
+	 * @param slot a starting slot.
+	 */
+	protected final void shiftSlots(int slot) {
+	 int last, ideal, e;
+	 final int[] index = this.index;
+	 final byte[] key = this.key;
+	 for(;;) {
+	  slot = ((last = slot) + 1) & mask;
+	  for(;;) {
+	   if ((e = index[slot]) == 0) {
+	    index[last] = 0;
+	    return;
+	   }
+	   ideal = ( it.unimi.dsi.fastutil.HashCommon.mix( (key[e - 1]) ) ) & mask;
+	   if (last <= slot ? last >= ideal || ideal > slot : last >= ideal && ideal > slot) break;
+	   slot = (slot + 1) & mask;
+	  }
+	  index[last] = e;
+	 }
+	}
+	/** Turns a position of the entry arrays into a hole, updating {@link #first} and {@link #end}.
+	 *
+	 * <p>Holes at the end of the entry arrays are given back immediately.
+	 *
+	 * @param pos a position of the entry arrays that is no longer pointed by the hash table.
+	 */
+	private void clearPosition(final int pos) {
+	 final long[] removed = this.removed;
+	 if (pos == end - 1) {
+	  int end = pos;
+	  while(end != 0 && (removed[end - 1 >>> 6] & 1L << end - 1) != 0) {
+	   end--;
+	   removed[end >>> 6] &= ~(1L << end);
+	  }
+	  this.end = end;
+	  if (first > end) first = end;
+	 }
+	 else {
+	  removed[pos >>> 6] |= 1L << pos;
+	  if (pos == first) while(isRemoved(++first));
+	 }
+	}
+	private byte removeEntry(final int slot) {
+	 final int pos = index[slot] - 1;
+	 final byte oldValue = value[pos];
+	 shiftSlots(slot);
+	 clearPosition(pos);
+	 size--;
+	 if (n > minN && size < maxFill / 4 && n > DEFAULT_INITIAL_SIZE) rehash(n / 2);
+	 if (ASSERTS) checkTable();
+	 return oldValue;
+	}
+	/** Moves the entry pointed by a slot of the hash table to the end of the entry arrays.
+	 *
+	 * @param slot a slot of the hash table.
+	 * @return the new position of the entry.
+	 */
+	private int moveToLast(int slot) {
+	 int pos = index[slot] - 1;
+	 if (pos == end - 1) return pos;
+	 if (end == key.length) {
+	  final byte k = key[pos];
+	  if (makeRoom()) {
+	   // Note that compaction cannot make our entry the last one.
+	   slot = find(k);
+	   pos = index[slot] - 1;
+	  }
+	 }
+	 key[end] = key[pos];
+	 value[end] = value[pos];
+	 index[slot] = ++end;
+	 clearPosition(pos);
+	 return end - 1;
+	}
+	@Override
+	public byte put(final byte k, final byte v) {
+	 final int slot = find(k);
+	 if (slot < 0) {
+	  insert(-slot - 1, k, v);
+	  return defRetValue;
+	 }
+	 final int pos = index[slot] - 1;
+	 final byte oldValue = value[pos];
+	 value[pos] = v;
+	 return oldValue;
+	}
+	@Override
+
+	public byte remove(final byte k) {
+	 final int slot = find( k);
+	 if (slot < 0) return defRetValue;
+	 return removeEntry(slot);
+	}
+	@Override
+
+	public byte get(final byte k) {
+	 final int slot = find( k);
+	 return slot < 0 ? defRetValue : value[index[slot] - 1];
+	}
+	@Override
+
+	public boolean containsKey(final byte k) {
+	 return find( k) >= 0;
+	}
+	@Override
+	public boolean containsValue(final byte v) {
+	 final byte value[] = this.value;
+	 for(int pos = first; pos < end; pos++) if (! isRemoved(pos) && ( (value[pos]) == (v) )) return true;
+	 return false;
+	}
+	/** {@inheritDoc} */
+	@Override
+
+	public byte getOrDefault(final byte k, final byte defaultValue) {
+	 final int slot = find( k);
+	 return slot < 0 ? defaultValue : value[index[slot] - 1];
+	}
+	/** {@inheritDoc} */
+	@Override
+	public byte putIfAbsent(final byte k, final byte v) {
+	 final int slot = find(k);
+	 if (slot >= 0) return value[index[slot] - 1];
+	 insert(-slot - 1, k, v);
+	 return defRetValue;
+	}
+	/** Returns the value to which the given key is mapped; if the key is present, it is moved to the last position of the iteration order.
+	 *
+	 * @param k the key.
+	 * @return the corresponding value, or the {@linkplain #defaultReturnValue() default return value} if no value was present for the given key.
+	 */
+	public byte getAndMoveToLast(final byte k) {
+	 final int slot = find(k);
+	 if (slot < 0) return defRetValue;
+	 return value[moveToLast(slot)];
+	}
+	/** Adds a pair to the map; if the key is already present, it is moved to the last position of the iteration order.
+	 *
+	 * @param k the key.
+	 * @param v the value.
+	 * @return the old value, or the {@linkplain #defaultReturnValue() default return value} if no value was present for the given key.
+	 */
+	public byte putAndMoveToLast(final byte k, final byte v) {
+	 final int slot = find(k);
+	 if (slot < 0) {
+	  insert(-slot - 1, k, v);
+	  return defRetValue;
+	 }
+	 final int pos = moveToLast(slot);
+	 final byte oldValue = value[pos];
+	 value[pos] = v;
+	 return oldValue;
+	}
+	/** Returns the first key of this map in iteration order.
+	 * @return the first key in iteration order.
+	 * @throws NoSuchElementException is this map is empty.
+	 */
+	public byte firstByteKey() {
+	 if (size == 0) throw new NoSuchElementException();
+	 return key[first];
+	}
+	/** Returns the last key of this map in iteration order.
+	 * @return the last key in iteration order.
+	 * @throws NoSuchElementException is this map is empty.
+	 */
+	public byte lastByteKey() {
+	 if (size == 0) throw new NoSuchElementException();
+	 return key[end - 1];
+	}
+	/** Removes the mapping associated with the first key in iteration order.
+	 * @return the value previously associated with the first key in iteration order.
+	 * @throws NoSuchElementException is this map is empty.
+	 */
+	public byte removeFirstByte() {
+	 if (size == 0) throw new NoSuchElementException();
+	 return removeEntry(find(key[first]));
+	}
+	/** Removes the mapping associated with the last key in iteration order.
+	 * @return the value previously associated with the last key in iteration order.
+	 * @throws NoSuchElementException is this map is empty.
+	 */
+	public byte removeLastByte() {
+	 if (size == 0) throw new NoSuchElementException();
+	 return removeEntry(find(key[end - 1]));
+	}
+	/* Removes all elements from this map.
+	 *
+	 * <p>To increase object reuse, this method does not change the table size.
+	 * If you want to reduce the table size, you must use {@link #trim()}.
+	 *
+	 */
+	@Override
+	public void clear() {
+	 if (size == 0) return;
+	 size = 0;
+	 Arrays.fill(index, 0);
+	 Arrays.fill(removed, 0);
+	 first = end = 0;
+	}
+	@Override
+	public int size() {
+	 return size;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return size == 0;
+	}
+	/** The entry class for a compact hash map does not record key and value, but
+	 * rather the position in the entry arrays of the corresponding entry. This
+	 * is necessary so that calls to {@link java.util.Map.Entry#setValue(Object)} are reflected in
+	 * the map */
+	final class MapEntry implements Byte2ByteMap.Entry , Map.Entry<Byte, Byte>, ByteBytePair {
+	 // The position this entry refers to, or -1 if this entry has been deleted.
+	 int index;
+	 MapEntry(final int index) {
+	  this.index = index;
+	 }
+	 MapEntry() {}
+	 @Override
+	 public byte getByteKey() {
+	  return key[index];
+	 }
+	 @Override
+	 public byte leftByte() {
+	  return key[index];
+	 }
+	 @Override
+	 public byte getByteValue() {
+	  return value[index];
+	 }
+	 @Override
+	 public byte rightByte() {
+	  return value[index];
+	 }
+	 @Override
+	 public byte setValue(final byte v) {
+	  final byte oldValue = value[index];
+	  value[index] = v;
+	  return oldValue;
+	 }
+	 @Override
+	 public ByteBytePair right(final byte v) {
+	  value[index] = v;
+	  return this;
+	 }
+	 /** {@inheritDoc}
+		 * @deprecated Please use the corresponding type-specific method instead. */
+	 @Deprecated
+	 @Override
+	 public Byte getKey() {
+	  return Byte.valueOf(key[index]);
+	 }
+	 /** {@inheritDoc}
+		 * @deprecated Please use the corresponding type-specific method instead. */
+	 @Deprecated
+	 @Override
+	 public Byte getValue() {
+	  return Byte.valueOf(value[index]);
+	 }
+	 /** {@inheritDoc}
+		 * @deprecated Please use the corresponding type-specific method instead. */
+	 @Deprecated
+	 @Override
+	 public Byte setValue(final Byte v) {
+	  return Byte.valueOf(setValue((v).byteValue()));
+	 }
+	 @SuppressWarnings("unchecked")
+	 @Override
+	 public boolean equals(final Object o) {
+	  if (!(o instanceof Map.Entry)) return false;
+	  Map.Entry<Byte, Byte> e = (Map.Entry<Byte, Byte>)o;
+	  return ( (key[index]) == ((e.getKey()).byteValue()) ) && ( (value[index]) == ((e.getValue()).byteValue()) );
+	 }
+	 @Override
+	 public int hashCode() {
+	  return (key[index]) ^ (value[index]);
+	 }
+	 @Override
+	 public String toString() {
+	  return key[index] + "=>" + value[index];
+	 }
+	}
+	/** An iterator over the entry arrays.
+	 *
+	 * <p>Removals performed through this iterator never cause compaction or rehashing,
+	 * so positions in the entry arrays remain valid during the iteration.
+	 */
+	private abstract class MapIterator<ConsumerType> {
+	 /** The position of the next entry to be returned. */
+	 int next = first;
+	 /** The position of the last entry returned, or -1 if there is no such entry (or it has been removed). */
+	 int curr = -1;
+	 @SuppressWarnings("unused")
+	 abstract void acceptOnIndex(final ConsumerType action, final int index);
+	 public boolean hasNext() {
+	  return next < end;
+	 }
+	 public int nextEntry() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  curr = next;
+	  while(++next < end && isRemoved(next));
+	  return curr;
+	 }
+	 public void forEachRemaining(final ConsumerType action) {
+	  while(next < end) acceptOnIndex(action, nextEntry());
+	 }
+	 public void remove() {
+	  if (curr == -1) throw new IllegalStateException();
+	  shiftSlots(find(key[curr]));
+	  clearPosition(curr);
+	  size--;
+	  curr = -1; // You can no longer remove this entry.
+	  if (ASSERTS) checkTable();
+	 }
+	 public int skip(final int n) {
+	  int i = n;
+	  while(i-- != 0 && hasNext()) nextEntry();
+	  return n - i - 1;
+	 }
+	}
+	private final class EntryIterator extends MapIterator<Consumer<? super Byte2ByteMap.Entry >> implements ObjectIterator<Byte2ByteMap.Entry > {
+	 private MapEntry entry;
+	 @Override
+	 public MapEntry next() {
+	  return entry = new MapEntry(nextEntry());
+	 }
+	 // forEachRemaining inherited from MapIterator superclass.
+	 @Override
+	 final void acceptOnIndex(final Consumer<? super Byte2ByteMap.Entry > action, final int index) {
+	  action.accept(entry = new MapEntry(index));
+	 }
+	 @Override
+	 public void remove() {
+	  super.remove();
+	  entry.index = -1; // You cannot use a deleted entry.
+	 }
+	}
+	private final class FastEntryIterator extends MapIterator<Consumer<? super Byte2ByteMap.Entry >> implements ObjectIterator<Byte2ByteMap.Entry > {
+	 private final MapEntry entry = new MapEntry();
+	 @Override
+	 public MapEntry next() {
+	  entry.index = nextEntry();
+	  return entry;
+	 }
+	 // forEachRemaining inherited from MapIterator superclass.
+	 @Override
+	 final void acceptOnIndex(final Consumer<? super Byte2ByteMap.Entry > action, final int index) {
+	  entry.index = index;
+	  action.accept(entry);
+	 }
+	}
+	private final class MapEntrySet extends AbstractObjectSet<Byte2ByteMap.Entry > implements FastEntrySet {
+	 private static final int SPLITERATOR_CHARACTERISTICS = ObjectSpliterators.SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED;
+	 @Override
+	 public ObjectIterator<Byte2ByteMap.Entry > iterator() { return new EntryIterator(); }
+	 @Override
+	 public ObjectIterator<Byte2ByteMap.Entry > fastIterator() { return new FastEntryIterator(); }
+	 @Override
+	 public ObjectSpliterator<Byte2ByteMap.Entry > spliterator() {
+	  return ObjectSpliterators.asSpliterator(iterator(), it.unimi.dsi.fastutil.Size64.sizeOf(Byte2ByteCompactOpenHashMap.this), SPLITERATOR_CHARACTERISTICS);
+	 }
+	 @Override
+	
+	 public boolean contains(final Object o) {
+	  if (!(o instanceof Map.Entry)) return false;
+	  final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	  if (e.getKey() == null || ! (e.getKey() instanceof Byte)) return false;
+	  if (e.getValue() == null || ! (e.getValue() instanceof Byte)) return false;
+	  final byte k = ((Byte)( e.getKey())).byteValue();
+	  final byte v = ((Byte)( e.getValue())).byteValue();
+	  final int slot = find(k);
+	  return slot >= 0 && ( (value[index[slot] - 1]) == (v) );
+	 }
+	 @Override
+	
+	 public boolean remove(final Object o) {
+	  if (!(o instanceof Map.Entry)) return false;
+	  final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	  if (e.getKey() == null || ! (e.getKey() instanceof Byte)) return false;
+	  if (e.getValue() == null || ! (e.getValue() instanceof Byte)) return false;
+	  final byte k = ((Byte)( e.getKey())).byteValue();
+	  final byte v = ((Byte)( e.getValue())).byteValue();
+	  final int slot = find(k);
+	  if (slot < 0 || ! ( (value[index[slot] - 1]) == (v) )) return false;
+	  removeEntry(slot);
+	  return true;
+	 }
+	 @Override
+	 public int size() {
+	  return size;
+	 }
+	 @Override
+	 public void clear() {
+	  Byte2ByteCompactOpenHashMap.this.clear();
+	 }
+	 /** {@inheritDoc} */
+	 @Override
+	 public void forEach(final Consumer<? super Byte2ByteMap.Entry > consumer) {
+	  for(int pos = first; pos < end; pos++)
+	   if (! isRemoved(pos)) consumer.accept(new AbstractByte2ByteMap.BasicEntry (key[pos], value[pos]));
+	 }
+	 /** {@inheritDoc} */
+	 @Override
+	 public void fastForEach(final Consumer<? super Byte2ByteMap.Entry > consumer) {
+	  final AbstractByte2ByteMap.BasicEntry entry = new AbstractByte2ByteMap.BasicEntry ();
+	  for(int pos = first; pos < end; pos++)
+	   if (! isRemoved(pos)) {
+	    entry.key = key[pos];
+	    entry.value = value[pos];
+	    consumer.accept(entry);
+	   }
+	 }
+	}
+	@Override
+	public FastEntrySet byte2ByteEntrySet() {
+	 if (entries == null) entries = new MapEntrySet();
+	 return entries;
+	}
+	/** An iterator on keys.
+	 *
+	 * <p>We simply override the {@link java.util.Iterator#next()} method
+	 * (and possibly its type-specific counterpart) so that it returns keys
+	 * instead of entries.
+	 */
+	private final class KeyIterator extends MapIterator<ByteConsumer > implements ByteIterator {
+	 public KeyIterator() { super(); }
+	 // forEachRemaining inherited from MapIterator superclass.
+	 // Despite the superclass declared with generics, the way Java inherits and generates bridge methods avoids the boxing/unboxing
+	 @Override
+	 final void acceptOnIndex(final ByteConsumer action, final int index) {
+	  action.accept(key[index]);
+	 }
+	 @Override
+	 public byte nextByte() { return key[nextEntry()]; }
+	}
+	private final class KeySet extends AbstractByteSet {
+	 private static final int SPLITERATOR_CHARACTERISTICS = ByteSpliterators.SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED;
+	 @Override
+	 public ByteIterator iterator() { return new KeyIterator(); }
+	 @Override
+	 public ByteSpliterator spliterator() {
+	  return ByteSpliterators.asSpliterator(iterator(), it.unimi.dsi.fastutil.Size64.sizeOf(Byte2ByteCompactOpenHashMap.this), SPLITERATOR_CHARACTERISTICS);
+	 }
+	 /** {@inheritDoc} */
+	 @Override
+	 public void forEach(final ByteConsumer consumer) {
+	  for(int pos = first; pos < end; pos++) if (! isRemoved(pos)) consumer.accept(key[pos]);
+	 }
+	 @Override
+	 public int size() { return size; }
+	 @Override
+	 public boolean contains(byte k) { return containsKey(k); }
+	 @Override
+	 public boolean remove(byte k) {
+	  final int oldSize = size;
+	  Byte2ByteCompactOpenHashMap.this.remove(k);
+	  return size != oldSize;
+	 }
+	 @Override
+	 public void clear() { Byte2ByteCompactOpenHashMap.this.clear(); }
+	}
+	@Override
+	public ByteSet keySet() {
+	 if (keys == null) keys = new KeySet();
+	 return keys;
+	}
+	/** An iterator on values.
+	 *
+	 * <p>We simply override the {@link java.util.Iterator#next()} method
+	 * (and possibly its type-specific counterpart) so that it returns values
+	 * instead of entries.
+	 */
+	private final class ValueIterator extends MapIterator<ByteConsumer > implements ByteIterator {
+	 public ValueIterator() { super(); }
+	 // forEachRemaining inherited from MapIterator superclass.
+	 // Despite the superclass declared with generics, the way Java inherits and generates bridge methods avoids the boxing/unboxing
+	 @Override
+	 final void acceptOnIndex(final ByteConsumer action, final int index) {
+	  action.accept(value[index]);
+	 }
+	 @Override
+	 public byte nextByte() { return value[nextEntry()]; }
+	}
+	@Override
+	public ByteCollection values() {
+	 if (values == null) values = new AbstractByteCollection () {
+	   private static final int SPLITERATOR_CHARACTERISTICS = ByteSpliterators.COLLECTION_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED;
+	   @Override
+	   public ByteIterator iterator() { return new ValueIterator(); }
+	   @Override
+	   public ByteSpliterator spliterator() {
+	    return ByteSpliterators.asSpliterator(iterator(), it.unimi.dsi.fastutil.Size64.sizeOf(Byte2ByteCompactOpenHashMap.this), SPLITERATOR_CHARACTERISTICS);
+	   }
+	   /** {@inheritDoc} */
+	   @Override
+	   public void forEach(final ByteConsumer consumer) {
+	    for(int pos = first; pos < end; pos++) if (! isRemoved(pos)) consumer.accept(value[pos]);
+	   }
+	   @Override
+	   public int size() { return size; }
+	   @Override
+	   public boolean contains(byte v) { return containsValue(v); }
+	   @Override
+	   public void clear() { Byte2ByteCompactOpenHashMap.this.clear(); }
+	  };
+	 return values;
+	}
+	/** Rehashes the map, making the table as small as possible.
+	 *
+	 * <p>This method rehashes the table to the smallest size satisfying the
+	 * load factor. It can be used when the map will not be changed anymore, so
+	 * to optimize access speed and size.
+	 *
+	 * <p>If the table size is already the minimum possible, this method
+	 * does nothing.
+	 *
+	 * @return true if there was enough memory to trim the map.
+	 * @see #trim(int)
+	 */
+	public boolean trim() {
+	 return trim(size);
+	}
+	/** Rehashes this map if the table is too large.
+	 *
+	 * <p>Let <var>N</var> be the smallest table size that can hold
+	 * <code>max(n,{@link #size()})</code> entries, still satisfying the load factor. If the current
+	 * table size is smaller than or equal to <var>N</var>, this method does
+	 * nothing. Otherwise, it rehashes this map in a table of size
+	 * <var>N</var>, compacting and shrinking the entry arrays accordingly.
+	 *
+	 * @param n the threshold for the trimming.
+	 * @return true if there was enough memory to trim the map.
+	 * @see #trim()
+	 */
+	public boolean trim(final int n) {
+	 final int l = HashCommon.nextPowerOfTwo((int)Math.ceil(n / f));
+	 if (l >= this.n || size > maxFill(l, f)) return true;
+	 try {
+	  rehash(l);
+	 }
+	 catch(OutOfMemoryError cantDoIt) { return false; }
+	 return true;
+	}
+	/** Rehashes the map, compacting the entry arrays.
+	 *
+	 * <p>If the table size does not change, the entry arrays are compacted
+	 * in place; otherwise, they are reallocated so to contain as many entries as
+	 * allowed by the new table size and load factor.
+	 *
+	 * @param newN the new size
+	 */
+
+	protected void rehash(final int newN) {
+	 final byte key[] = this.key;
+	 final byte value[] = this.value;
+	 final long removed[] = this.removed;
+	 final int mask = newN - 1; // Note that this is used by the hashing macro
+	 final int capacity = newN == n ? key.length : maxFill(newN, f) + 1;
+	 final int newIndex[] = new int[newN];
+	 final byte newKey[] = capacity == key.length ? key : new byte[capacity];
+	 final byte newValue[] = capacity == key.length ? value : new byte[capacity];
+	 int j = 0;
+	 for(int i = first, slot; i < end; i++) {
+	  if ((removed[i >>> 6] & 1L << i) != 0) continue;
+	  slot = ( it.unimi.dsi.fastutil.HashCommon.mix( (key[i]) ) ) & mask;
+	  while (newIndex[slot] != 0) slot = (slot + 1) & mask;
+	  newKey[j] = key[i];
+	  newValue[j] = value[i];
+	  newIndex[slot] = ++j;
+	 }
+	 if (newKey == key) {
+	  Arrays.fill(removed, 0);
+	 }
+	 else this.removed = new long[bits(capacity)];
+	 first = 0;
+	 end = j;
+	 n = newN;
+	 this.mask = mask;
+	 maxFill = maxFill(n, f);
+	 this.index = newIndex;
+	 this.key = newKey;
+	 this.value = newValue;
+	}
+	/** Returns a deep copy of this map.
+	 *
+	 * <p>This method performs a deep copy of this hash map; the data stored in the
+	 * map, however, is not cloned. Note that this makes a difference only for object keys.
+	 *
+	 *  @return a deep copy of this map.
+	 */
+	@Override
+
+	public Byte2ByteCompactOpenHashMap clone() {
+	 Byte2ByteCompactOpenHashMap c;
+	 try {
+	  c = (Byte2ByteCompactOpenHashMap )super.clone();
+	 }
+	 catch(CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.keys = null;
+	 c.values = null;
+	 c.entries = null;
+	 c.index = index.clone();
+	 c.key = key.clone();
+	 c.value = value.clone();
+	 c.removed = removed.clone();
+	 return c;
+	}
+	/** Returns a hash code for this map.
+	 *
+	 * This method overrides the generic method provided by the superclass.
+	 * Since {@code equals()} is not overriden, it is important
+	 * that the value returned by this method is the same value as
+	 * the one returned by the overriden method.
+	 *
+	 * @return a hash code for this map.
+	 */
+	@Override
+	public int hashCode() {
+	 int h = 0;
+	 for(int pos = first, t = 0; pos < end; pos++) {
+	  if (isRemoved(pos)) continue;
+	   t = (key[pos]);
+	   t ^= (value[pos]);
+	  h += t;
+	 }
+	 return h;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 final byte key[] = this.key;
+	 final byte value[] = this.value;
+	 s.defaultWriteObject();
+	 for(int pos = first; pos < end; pos++) {
+	  if (isRemoved(pos)) continue;
+	  s.writeByte(key[pos]);
+	  s.writeByte(value[pos]);
+	 }
+	}
+
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 n = arraySize(size, f);
+	 maxFill = maxFill(n, f);
+	 mask = n - 1;
+	 final int index[] = this.index = new int[n];
+	 final byte key[] = this.key = new byte[maxFill + 1];
+	 final byte value[] = this.value = new byte[maxFill + 1];
+	 removed = new long[bits(maxFill + 1)];
+	 byte k;
+	 for(int i = 0, slot; i < size; i++) {
+	  k = s.readByte();
+	  slot = ( it.unimi.dsi.fastutil.HashCommon.mix( (k) ) ) & mask;
+	  while (index[slot] != 0) slot = (slot + 1) & mask;
+	  key[i] = k;
+	  value[i] = s.readByte();
+	  index[slot] = i + 1;
+	 }
+	 first = 0;
+	 end = size;
+	 if (ASSERTS) checkTable();
+	}
+	private void checkTable() {}
+}
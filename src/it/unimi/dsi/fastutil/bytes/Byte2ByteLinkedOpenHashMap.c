@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ByteLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ByteAVLTreeMap
 #define RB_TREE_MAP Byte2ByteRBTreeMap
+#define CACHE Byte2ByteCache
+#define STATIC_FUNCTION Byte2ByteStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
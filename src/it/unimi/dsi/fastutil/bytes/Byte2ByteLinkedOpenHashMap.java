@@ -454,6 +454,20 @@ public class Byte2ByteLinkedOpenHashMap extends AbstractByte2ByteSortedMap imple
 	 link[i] = ( ( last & 0xFFFFFFFFL ) << 32 ) | ( -1 & 0xFFFFFFFFL );
 	 last = i;
 	}
+	/** Looks up a key and, if it is present, moves it to the last position of the iteration order.
+	 *
+	 * <p>This method makes it possible for the caches of this package to tell hits from misses
+	 * with a single lookup.
+	 *
+	 * @param k the key.
+	 * @return the index of the entry with key {@code k}, or -1 if {@code k} is not in this map.
+	 */
+	int moveToLastIndex(final byte k) {
+	 final int pos = find(k);
+	 if (pos < 0) return -1;
+	 moveIndexToLast(pos);
+	 return pos;
+	}
 	/** Returns the value to which the given key is mapped; if the key is present, it is moved to the first position of the iteration order.
 	 *
 	 * @param k the key.
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2ByteOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ByteOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ByteOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ByteAVLTreeMap
 #define RB_TREE_MAP Byte2ByteRBTreeMap
+#define CACHE Byte2ByteCache
+#define STATIC_FUNCTION Byte2ByteStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
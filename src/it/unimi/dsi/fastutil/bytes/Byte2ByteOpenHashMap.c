@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ByteOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ByteAVLTreeMap
 #define RB_TREE_MAP Byte2ByteRBTreeMap
+#define CACHE Byte2ByteCache
+#define STATIC_FUNCTION Byte2ByteStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
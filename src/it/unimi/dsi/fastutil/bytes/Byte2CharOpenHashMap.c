@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2CharOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2CharAVLTreeMap
 #define RB_TREE_MAP Byte2CharRBTreeMap
+#define CACHE Byte2CharCache
+#define STATIC_FUNCTION Byte2CharStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -0,0 +1,884 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.doubles.DoubleArrays;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.SortedMap;
+/** A type-specific AVL tree map whose nodes are stored in parallel arrays.
+	*
+	* <p>This class provides the same functionality of an AVL tree map, but nodes are not objects:
+	* a node is an index into parallel arrays containing keys, values, children, parents and heights. Slots
+	* freed by removals are kept in a free list and reused by subsequent insertions, and the arrays are never
+	* shrunk, so once the map has reached its working size {@link #put put()} and {@link #remove remove()}
+	* do not allocate any memory. This makes the class suitable for maps undergoing heavy churn, such as order books,
+	* in which the allocation rate of a standard tree map would dominate the garbage-collection load.
+	*
+	* <p>Entries returned by the iterators of the entry set read and write
+	* through the arrays, so they are valid only until the next structural modification.
+	* The entry set is a fast entry set, whose fast iterators
+	* return always the same mutable entry and do not allocate during iteration.
+	* Iterators and submaps otherwise behave exactly as in an AVL tree map.
+	*/
+public class Byte2DoubleArenaTreeMap extends AbstractByte2DoubleSortedMap implements java.io.Serializable, Cloneable {
+	private static final long serialVersionUID = 0L;
+	/** The index used to represent a missing node. */
+	private static final int NIL = -1;
+	/** The keys, indexed by node. */
+	protected transient byte[] key;
+	/** The values, indexed by node. */
+	protected transient double[] value;
+	/** The left child of each node, or {@link #NIL}. */
+	protected transient int[] left;
+	/** The right child of each node, or {@link #NIL}; for free nodes, the next free node. */
+	protected transient int[] right;
+	/** The parent of each node, or {@link #NIL} for the root. */
+	protected transient int[] parent;
+	/** The height of the subtree rooted at each node. */
+	protected transient byte[] height;
+	/** The root of the tree, or {@link #NIL}. */
+	protected transient int root;
+	/** The head of the list of free nodes, or {@link #NIL}. */
+	protected transient int free;
+	/** The number of nodes that have ever been allocated; nodes from this index on have never been used. */
+	protected transient int used;
+	/** Number of entries in this map. */
+	protected int count;
+	/** This map's comparator, as provided in the constructor. */
+	protected Comparator<? super Byte> storedComparator;
+	/** This map's actual comparator; it may differ from {@link #storedComparator} because it is
+		always a type-specific comparator, so it could be derived from the former by wrapping. */
+	protected transient ByteComparator actualComparator;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Byte2DoubleMap.Entry > entries;
+	/** Creates a new empty tree map with a given initial capacity and comparator.
+	 *
+	 * @param expected the expected number of entries.
+	 * @param c a (possibly type-specific) comparator, or {@code null} for the natural order.
+	 */
+	public Byte2DoubleArenaTreeMap(final int expected, final Comparator<? super Byte> c) {
+	 if (expected < 0) throw new IllegalArgumentException("The expected number of entries must be nonnegative");
+	 allocate(expected);
+	 storedComparator = c;
+	 setActualComparator();
+	}
+	/** Creates a new empty tree map with a given initial capacity.
+	 *
+	 * @param expected the expected number of entries.
+	 */
+	public Byte2DoubleArenaTreeMap(final int expected) {
+	 this(expected, null);
+	}
+	/** Creates a new empty tree map.
+	 */
+	public Byte2DoubleArenaTreeMap() {
+	 this(0, null);
+	}
+	/** Creates a new empty tree map with the given comparator.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 */
+	public Byte2DoubleArenaTreeMap(final Comparator<? super Byte> c) {
+	 this(0, c);
+	}
+	/** Creates a new tree map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new tree map.
+	 */
+	public Byte2DoubleArenaTreeMap(final Map<? extends Byte, ? extends Double> m) {
+	 this(m.size(), null);
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new tree map.
+	 */
+	public Byte2DoubleArenaTreeMap(final SortedMap<Byte,Double> m) {
+	 this(m.size(), m.comparator());
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given map.
+	 *
+	 * @param m a type-specific map to be copied into the new tree map.
+	 */
+	public Byte2DoubleArenaTreeMap(final Byte2DoubleMap m) {
+	 this(m.size(), null);
+	 putAll(m);
+	}
+	/** Creates a new tree map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new tree map.
+	 */
+	public Byte2DoubleArenaTreeMap(final Byte2DoubleSortedMap m) {
+	 this(m.size(), m.comparator());
+	 putAll(m);
+	}
+	/** Creates a new tree map using the elements of two parallel arrays and the given comparator.
+	 *
+	 * @param k the array of keys of the new tree map.
+	 * @param v the array of corresponding values in the new tree map.
+	 * @param c a (possibly type-specific) comparator.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2DoubleArenaTreeMap(final byte[] k, final double v[], final Comparator<? super Byte> c) {
+	 this(k.length, c);
+	 if (k.length != v.length) throw new IllegalArgumentException("The key array and the value array have different lengths (" + k.length + " and " + v.length + ")");
+	 for(int i = 0; i < k.length; i++) this.put(k[i], v[i]);
+	}
+	/** Creates a new tree map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new tree map.
+	 * @param v the array of corresponding values in the new tree map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2DoubleArenaTreeMap(final byte[] k, final double v[]) {
+	 this(k, v, null);
+	}
+	/** Generates the comparator that will be actually used. */
+	private void setActualComparator() {
+	 actualComparator = ByteComparators.asByteComparator(storedComparator);
+	}
+	/** Allocates empty backing arrays of given length. */
+	private void allocate(final int capacity) {
+	 key = new byte[capacity];
+	 value = new double[capacity];
+	 left = new int[capacity];
+	 right = new int[capacity];
+	 parent = new int[capacity];
+	 height = new byte[capacity];
+	 root = free = NIL;
+	 used = 0;
+	}
+	/* Compares two keys in the right way.
+	 *
+	 * <p>This method uses the {@link #actualComparator} if it is non-{@code null}.
+	 * Otherwise, it resorts to primitive type comparisons or to {@link Comparable#compareTo(Object) compareTo()}.
+	 */
+
+	final int compare(final byte k1, final byte k2) {
+	 return actualComparator == null ? ( Byte.compare((k1),(k2)) ) : actualComparator.compare(k1, k2);
+	}
+	/** Returns a node for a new entry, reusing a free node if possible.
+	 *
+	 * @param k the key of the new entry.
+	 * @param v the value of the new entry.
+	 * @param p the parent of the new node.
+	 * @return the new node.
+	 */
+	private int newNode(final byte k, final double v, final int p) {
+	 final int n;
+	 if (free != NIL) {
+	  n = free;
+	  free = right[n];
+	 }
+	 else {
+	  if (used == key.length) {
+	   final int length = (int)Math.max(Math.min((long)used + (used >> 1), it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE), Math.max(used + 1, 16));
+	   key = ByteArrays.forceCapacity(key, length, used);
+	   value = DoubleArrays.forceCapacity(value, length, used);
+	   left = it.unimi.dsi.fastutil.ints.IntArrays.forceCapacity(left, length, used);
+	   right = it.unimi.dsi.fastutil.ints.IntArrays.forceCapacity(right, length, used);
+	   parent = it.unimi.dsi.fastutil.ints.IntArrays.forceCapacity(parent, length, used);
+	   height = it.unimi.dsi.fastutil.bytes.ByteArrays.forceCapacity(height, length, used);
+	  }
+	  n = used++;
+	 }
+	 key[n] = k;
+	 value[n] = v;
+	 left[n] = right[n] = NIL;
+	 parent[n] = p;
+	 height[n] = 1;
+	 return n;
+	}
+	/** Adds a node to the free list. */
+	private void freeNode(final int n) {
+	 right[n] = free;
+	 free = n;
+	}
+	private int height(final int n) {
+	 return n == NIL ? 0 : height[n];
+	}
+	private void updateHeight(final int n) {
+	 height[n] = (byte)(1 + Math.max(height(left[n]), height(right[n])));
+	}
+	/** Replaces a child of a node (or the root, if the node is {@link #NIL}). */
+	private void replaceChild(final int p, final int oldChild, final int newChild) {
+	 if (p == NIL) root = newChild;
+	 else if (left[p] == oldChild) left[p] = newChild;
+	 else right[p] = newChild;
+	}
+	private int rotateLeft(final int x) {
+	 final int y = right[x];
+	 right[x] = left[y];
+	 if (left[y] != NIL) parent[left[y]] = x;
+	 parent[y] = parent[x];
+	 replaceChild(parent[x], x, y);
+	 left[y] = x;
+	 parent[x] = y;
+	 updateHeight(x);
+	 updateHeight(y);
+	 return y;
+	}
+	private int rotateRight(final int x) {
+	 final int y = left[x];
+	 left[x] = right[y];
+	 if (right[y] != NIL) parent[right[y]] = x;
+	 parent[y] = parent[x];
+	 replaceChild(parent[x], x, y);
+	 right[y] = x;
+	 parent[x] = y;
+	 updateHeight(x);
+	 updateHeight(y);
+	 return y;
+	}
+	/** Restores the AVL invariant on the path from a given node to the root. */
+	private void rebalance(int n) {
+	 while (n != NIL) {
+	  updateHeight(n);
+	  final int balance = height(left[n]) - height(right[n]);
+	  if (balance > 1) {
+	   if (height(left[left[n]]) < height(right[left[n]])) rotateLeft(left[n]);
+	   n = rotateRight(n);
+	  }
+	  else if (balance < -1) {
+	   if (height(right[right[n]]) < height(left[right[n]])) rotateRight(right[n]);
+	   n = rotateLeft(n);
+	  }
+	  n = parent[n];
+	 }
+	}
+	/** Removes a node from the tree.
+	 *
+	 * <p>If the node has two children, the entry of its successor is moved into the node,
+	 * and the node of the successor is removed instead.
+	 *
+	 * @param z a node.
+	 */
+	private void removeNode(int z) {
+	 if (left[z] != NIL && right[z] != NIL) {
+	  int s = right[z];
+	  while (left[s] != NIL) s = left[s];
+	  key[z] = key[s];
+	  value[z] = value[s];
+	  z = s;
+	 }
+	 final int child = left[z] != NIL ? left[z] : right[z];
+	 final int p = parent[z];
+	 if (child != NIL) parent[child] = p;
+	 replaceChild(p, z, child);
+	 freeNode(z);
+	 count--;
+	 rebalance(p);
+	}
+	/** Returns the node containing a given key.
+	 *
+	 * @param k the key to look for.
+	 * @return the node containing {@code k}, or {@link #NIL}.
+	 */
+	final int findKey(final byte k) {
+	 int n = root, cmp;
+	 while (n != NIL && (cmp = compare(k, key[n])) != 0) n = cmp < 0 ? left[n] : right[n];
+	 return n;
+	}
+	/** Returns the last node whose key is smaller than or equal to a given key (if {@code strict} is false), or smaller than the given key (if {@code strict} is true).
+	 *
+	 * @param k a key.
+	 * @param strict whether the key of the node must be strictly smaller.
+	 * @return the node, or {@link #NIL}.
+	 */
+	final int floorNode(final byte k, final boolean strict) {
+	 int n = root, last = NIL;
+	 while (n != NIL) {
+	  final int cmp = compare( key[n], k);
+	  if (cmp < 0 || cmp == 0 && ! strict) {
+	   last = n;
+	   n = right[n];
+	  }
+	  else n = left[n];
+	 }
+	 return last;
+	}
+	/** Returns the first node whose key is greater than or equal to a given key.
+	 *
+	 * @param k a key.
+	 * @return the node, or {@link #NIL}.
+	 */
+	final int ceilingNode(final byte k) {
+	 int n = root, last = NIL;
+	 while (n != NIL) {
+	  if (compare( key[n], k) >= 0) {
+	   last = n;
+	   n = left[n];
+	  }
+	  else n = right[n];
+	 }
+	 return last;
+	}
+	final int firstNode() {
+	 int n = root;
+	 if (n != NIL) while (left[n] != NIL) n = left[n];
+	 return n;
+	}
+	final int lastNode() {
+	 int n = root;
+	 if (n != NIL) while (right[n] != NIL) n = right[n];
+	 return n;
+	}
+	/** Returns the first node in the range of a given submap.
+	 *
+	 * @param range a submap, or {@code null} for the whole map.
+	 * @return the first node of {@code range}, or {@link #NIL}.
+	 */
+
+	final int firstNode(final Submap range) {
+	 final int n = range == null || range.bottom ? firstNode() : ceilingNode(range.from);
+	 return n != NIL && (range == null || range.top || compare( key[n], range.to) < 0) ? n : NIL;
+	}
+	/** Returns the last node in the range of a given submap.
+	 *
+	 * @param range a submap, or {@code null} for the whole map.
+	 * @return the last node of {@code range}, or {@link #NIL}.
+	 */
+
+	final int lastNode(final Submap range) {
+	 final int n = range == null || range.top ? lastNode() : floorNode(range.to, true);
+	 return n != NIL && (range == null || range.bottom || compare( key[n], range.from) >= 0) ? n : NIL;
+	}
+	final int successor(int n) {
+	 if (right[n] != NIL) {
+	  n = right[n];
+	  while (left[n] != NIL) n = left[n];
+	  return n;
+	 }
+	 int p = parent[n];
+	 while (p != NIL && right[p] == n) {
+	  n = p;
+	  p = parent[p];
+	 }
+	 return p;
+	}
+	final int predecessor(int n) {
+	 if (left[n] != NIL) {
+	  n = left[n];
+	  while (right[n] != NIL) n = right[n];
+	  return n;
+	 }
+	 int p = parent[n];
+	 while (p != NIL && left[p] == n) {
+	  n = p;
+	  p = parent[p];
+	 }
+	 return p;
+	}
+	@Override
+	public double put(final byte k, final double v) {
+	 if (root == NIL) {
+	  root = newNode(k, v, NIL);
+	  count++;
+	  return defRetValue;
+	 }
+	 int p = root, cmp;
+	 for(;;) {
+	  cmp = compare(k, key[p]);
+	  if (cmp == 0) {
+	   final double oldValue = value[p];
+	   value[p] = v;
+	   return oldValue;
+	  }
+	  final int next = cmp < 0 ? left[p] : right[p];
+	  if (next == NIL) break;
+	  p = next;
+	 }
+	 final int n = newNode(k, v, p);
+	 if (cmp < 0) left[p] = n;
+	 else right[p] = n;
+	 count++;
+	 rebalance(p);
+	 return defRetValue;
+	}
+	@Override
+
+	public double remove(final byte k) {
+	 final int n = findKey( k);
+	 if (n == NIL) return defRetValue;
+	 final double oldValue = value[n];
+	 removeNode(n);
+	 return oldValue;
+	}
+	@Override
+
+	public double get(final byte k) {
+	 final int n = findKey( k);
+	 return n == NIL ? defRetValue : value[n];
+	}
+	@Override
+
+	public boolean containsKey(final byte k) {
+	 return findKey( k) != NIL;
+	}
+	@Override
+	public boolean containsValue(final double v) {
+	 for(int n = firstNode(); n != NIL; n = successor(n)) if (( Double.doubleToLongBits(value[n]) == Double.doubleToLongBits(v) )) return true;
+	 return false;
+	}
+	@Override
+	public int size() {
+	 return count;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return count == 0;
+	}
+	/** Removes all entries from this map.
+	 *
+	 * <p>The backing arrays are retained, so that they can be reused by subsequent insertions.
+	 */
+	@Override
+	public void clear() {
+	 root = free = NIL;
+	 used = count = 0;
+	}
+	@Override
+
+	public byte firstByteKey() {
+	 if (root == NIL) throw new NoSuchElementException();
+	 return key[firstNode()];
+	}
+	@Override
+
+	public byte lastByteKey() {
+	 if (root == NIL) throw new NoSuchElementException();
+	 return key[lastNode()];
+	}
+	@Override
+	public ByteComparator comparator() {
+	 return actualComparator;
+	}
+	@Override
+	public Byte2DoubleSortedMap headMap(final byte to) {
+	 return new Submap(((byte)0), true, to, false);
+	}
+	@Override
+	public Byte2DoubleSortedMap tailMap(final byte from) {
+	 return new Submap(from, false, ((byte)0), true);
+	}
+	@Override
+	public Byte2DoubleSortedMap subMap(final byte from, final byte to) {
+	 return new Submap(from, false, to, false);
+	}
+	@Override
+	public ObjectSortedSet<Byte2DoubleMap.Entry > byte2DoubleEntrySet() {
+	 if (entries == null) entries = new EntrySet(null);
+	 return entries;
+	}
+	/** An entry reading and writing through the backing arrays. */
+	private final class NodeEntry implements Byte2DoubleMap.Entry {
+	 /** The node of this entry. */
+	 int node;
+	 NodeEntry(final int node) {
+	  this.node = node;
+	 }
+	 @Override
+	
+	 public byte getByteKey() {
+	  return key[node];
+	 }
+	 @Override
+	
+	 public double getDoubleValue() {
+	  return value[node];
+	 }
+	 @Override
+	
+	 public double setValue(final double v) {
+	  final double oldValue = value[node];
+	  value[node] = v;
+	  return oldValue;
+	 }
+	 @Override
+	 public boolean equals(final Object o) {
+	  return new AbstractByte2DoubleMap.BasicEntry (getByteKey(), getDoubleValue()).equals(o);
+	 }
+	 @Override
+	 public int hashCode() {
+	  return (key[node]) ^ it.unimi.dsi.fastutil.HashCommon.double2int(value[node]);
+	 }
+	 @Override
+	 public String toString() {
+	  return key[node] + "=>" + value[node];
+	 }
+	}
+	/** A bidirectional iterator on the entries of this map or of a submap.
+	 *
+	 * <p>The iterator keeps track of the nodes that will be returned by the next calls to
+	 * {@link #next()} and {@link #previous()}. When the last returned node is removed and it had two children,
+	 * the entry of its successor is moved into it, so the node of the successor becomes the removed node.
+	 */
+	private final class EntryIterator implements ObjectBidirectionalIterator<Byte2DoubleMap.Entry > {
+	 /** The submap bounding this iterator, or {@code null}. */
+	 private final Submap range;
+	 /** The entry returned by this iterator, if it is a fast iterator, or {@code null}. */
+	 private final NodeEntry entry;
+	 /** The node that will be returned by the next call to {@link #previous()}, or {@link #NIL}. */
+	 int prev;
+	 /** The node that will be returned by the next call to {@link #next()}, or {@link #NIL}. */
+	 int next;
+	 /** The last node returned by {@link #next()} or {@link #previous()}, or {@link #NIL} if it has been removed. */
+	 int curr = NIL;
+	 /** Creates a new iterator positioned at the start of a given range.
+		 *
+		 * @param range a submap, or {@code null}.
+		 * @param fast whether the iterator should return always the same entry.
+		 */
+	 EntryIterator(final Submap range, final boolean fast) {
+	  this.range = range;
+	  this.entry = fast ? new NodeEntry(NIL) : null;
+	  next = range == null || range.bottom ? firstNode() : ceilingNode(range.from);
+	  prev = next == NIL ? lastNode() : predecessor(next);
+	 }
+	 /** Creates a new iterator positioned after a given key, clamped to a given range.
+		 *
+		 * @param range a submap, or {@code null}.
+		 * @param fast whether the iterator should return always the same entry.
+		 * @param k a key.
+		 */
+	 EntryIterator(final Submap range, final boolean fast, final byte k) {
+	  this.range = range;
+	  this.entry = fast ? new NodeEntry(NIL) : null;
+	  if (range != null && ! range.bottom && compare(k, range.from) < 0) prev = floorNode(range.from, true);
+	  else if (range != null && ! range.top && compare(k, range.to) >= 0) prev = floorNode(range.to, true);
+	  else prev = floorNode(k, false);
+	  next = prev == NIL ? firstNode() : successor(prev);
+	 }
+	 @Override
+	
+	 public boolean hasNext() {
+	  return next != NIL && (range == null || range.top || compare( key[next], range.to) < 0);
+	 }
+	 @Override
+	
+	 public boolean hasPrevious() {
+	  return prev != NIL && (range == null || range.bottom || compare( key[prev], range.from) >= 0);
+	 }
+	 private Byte2DoubleMap.Entry entryFor(final int node) {
+	  if (entry == null) return new NodeEntry(node);
+	  entry.node = node;
+	  return entry;
+	 }
+	 @Override
+	 public Byte2DoubleMap.Entry next() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  curr = prev = next;
+	  next = successor(next);
+	  return entryFor(curr);
+	 }
+	 @Override
+	 public Byte2DoubleMap.Entry previous() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  curr = next = prev;
+	  prev = predecessor(prev);
+	  return entryFor(curr);
+	 }
+	 @Override
+	 public void remove() {
+	  if (curr == NIL) throw new IllegalStateException();
+	  final boolean twoChildren = left[curr] != NIL && right[curr] != NIL;
+	  if (curr == prev) {
+	   prev = predecessor(curr);
+	   // The entry of the next node is going to be moved into the current one
+	   if (twoChildren) next = curr;
+	  }
+	  else next = twoChildren ? curr : successor(curr);
+	  removeNode(curr);
+	  curr = NIL;
+	 }
+	}
+	/** The entry set of this map or of a submap. */
+	private final class EntrySet extends AbstractObjectSortedSet<Byte2DoubleMap.Entry > implements FastSortedEntrySet {
+	 /** The submap whose entries are contained in this set, or {@code null} for the whole map. */
+	 private final Submap range;
+	 private final Comparator<? super Byte2DoubleMap.Entry > comparator = (x, y) -> compare(x.getByteKey(), y.getByteKey());
+	 EntrySet(final Submap range) {
+	  this.range = range;
+	 }
+	 @Override
+	 public Comparator<? super Byte2DoubleMap.Entry > comparator() {
+	  return comparator;
+	 }
+	 @Override
+	 public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator() {
+	  return new EntryIterator(range, false);
+	 }
+	 @Override
+	 public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator(final Byte2DoubleMap.Entry from) {
+	  return new EntryIterator(range, false, from.getByteKey());
+	 }
+	 @Override
+	 public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > fastIterator() {
+	  return new EntryIterator(range, true);
+	 }
+	 @Override
+	 public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > fastIterator(final Byte2DoubleMap.Entry from) {
+	  return new EntryIterator(range, true, from.getByteKey());
+	 }
+	 /** Returns the node of the entry with the same key as a given object, if in range.
+		 *
+		 * @param o an object.
+		 * @return the node of the entry of this set having the same key and value of {@code o}, or {@link #NIL}.
+		 */
+	
+	 private int find(final Object o) {
+	  if (! (o instanceof Map.Entry)) return NIL;
+	  final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	  if (e.getKey() == null || ! (e.getKey() instanceof Byte)) return NIL;
+	  if (e.getValue() == null || ! (e.getValue() instanceof Double)) return NIL;
+	  final byte k = ((Byte)( e.getKey())).byteValue();
+	  if (range != null && ! range.in(k)) return NIL;
+	  final int n = findKey(k);
+	  return n != NIL && ( Double.doubleToLongBits(value[n]) == Double.doubleToLongBits(((Double)(e.getValue())).doubleValue()) ) ? n : NIL;
+	 }
+	 @Override
+	 public boolean contains(final Object o) {
+	  return find(o) != NIL;
+	 }
+	 @Override
+	 public boolean remove(final Object o) {
+	  final int n = find(o);
+	  if (n == NIL) return false;
+	  removeNode(n);
+	  return true;
+	 }
+	 @Override
+	 public int size() {
+	  return range == null ? count : range.size();
+	 }
+	 @Override
+	 public boolean isEmpty() {
+	  return firstNode(range) == NIL;
+	 }
+	 @Override
+	 public void clear() {
+	  if (range == null) Byte2DoubleArenaTreeMap.this.clear();
+	  else range.clear();
+	 }
+	 @Override
+	 public Byte2DoubleMap.Entry first() {
+	  final int n = firstNode(range);
+	  if (n == NIL) throw new NoSuchElementException();
+	  return new NodeEntry(n);
+	 }
+	 @Override
+	 public Byte2DoubleMap.Entry last() {
+	  final int n = lastNode(range);
+	  if (n == NIL) throw new NoSuchElementException();
+	  return new NodeEntry(n);
+	 }
+	 @Override
+	 public ObjectSortedSet<Byte2DoubleMap.Entry > subSet(final Byte2DoubleMap.Entry from, final Byte2DoubleMap.Entry to) {
+	  return (range == null ? Byte2DoubleArenaTreeMap.this.subMap(from.getByteKey(), to.getByteKey()) : range.subMap(from.getByteKey(), to.getByteKey())).byte2DoubleEntrySet();
+	 }
+	 @Override
+	 public ObjectSortedSet<Byte2DoubleMap.Entry > headSet(final Byte2DoubleMap.Entry to) {
+	  return (range == null ? Byte2DoubleArenaTreeMap.this.headMap(to.getByteKey()) : range.headMap(to.getByteKey())).byte2DoubleEntrySet();
+	 }
+	 @Override
+	 public ObjectSortedSet<Byte2DoubleMap.Entry > tailSet(final Byte2DoubleMap.Entry from) {
+	  return (range == null ? Byte2DoubleArenaTreeMap.this.tailMap(from.getByteKey()) : range.tailMap(from.getByteKey())).byte2DoubleEntrySet();
+	 }
+	}
+	/** A submap with given range.
+	 *
+	 * <p>This class represents a submap. One has to specify the left/right
+	 * limits (which can be set to -&infin; or &infin;). Since the submap is a
+	 * view on the map, at a given moment it could happen that the limits of
+	 * the range are not any longer in the main map. Thus, things such as
+	 * {@link java.util.SortedMap#firstKey()} or {@link java.util.Collection#size()} must be always computed
+	 * on-the-fly.
+	 */
+	private final class Submap extends AbstractByte2DoubleSortedMap implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 /** The start of the submap range, unless {@link #bottom} is true. */
+	 final byte from;
+	 /** The end of the submap range, unless {@link #top} is true. */
+	 final byte to;
+	 /** If true, the submap range starts from -&infin;. */
+	 final boolean bottom;
+	 /** If true, the submap range goes to &infin;. */
+	 final boolean top;
+	 /** Cached set of entries. */
+	 transient ObjectSortedSet<Byte2DoubleMap.Entry > entries;
+	 /** Creates a new submap with given key range.
+		 *
+		 * @param from the start of the submap range.
+		 * @param bottom if true, the first parameter is ignored and the range starts from -&infin;.
+		 * @param to the end of the submap range.
+		 * @param top if true, the third parameter is ignored and the range goes to &infin;.
+		 */
+	 Submap(final byte from, final boolean bottom, final byte to, final boolean top) {
+	  if (! bottom && ! top && Byte2DoubleArenaTreeMap.this.compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	  this.from = from;
+	  this.bottom = bottom;
+	  this.to = to;
+	  this.top = top;
+	  this.defRetValue = Byte2DoubleArenaTreeMap.this.defRetValue;
+	 }
+	 /** Checks whether a key is in the submap range.
+		 * @param k a key.
+		 * @return true if is the key is in the submap range.
+		 */
+	 final boolean in(final byte k) {
+	  return (bottom || Byte2DoubleArenaTreeMap.this.compare(k, from) >= 0) && (top || Byte2DoubleArenaTreeMap.this.compare(k, to) < 0);
+	 }
+	 @Override
+	 public ObjectSortedSet<Byte2DoubleMap.Entry > byte2DoubleEntrySet() {
+	  if (entries == null) entries = new EntrySet(this);
+	  return entries;
+	 }
+	 @Override
+	
+	 public boolean containsKey(final byte k) {
+	  return in( k) && Byte2DoubleArenaTreeMap.this.containsKey(k);
+	 }
+	 @Override
+	
+	 public double get(final byte k) {
+	  final int n;
+	  return in( k) && (n = findKey( k)) != NIL ? value[n] : defRetValue;
+	 }
+	 @Override
+	 public double put(final byte k, final double v) {
+	  if (! in(k)) throw new IllegalArgumentException("Key (" + k + ") out of range [" + (bottom ? "-" : String.valueOf(from)) + ", " + (top ? "-" : String.valueOf(to)) + ")");
+	  final int n = findKey(k);
+	  if (n == NIL) {
+	   Byte2DoubleArenaTreeMap.this.put(k, v);
+	   return defRetValue;
+	  }
+	  final double oldValue = value[n];
+	  value[n] = v;
+	  return oldValue;
+	 }
+	 @Override
+	
+	 public double remove(final byte k) {
+	  final int n;
+	  if (! in( k) || (n = findKey( k)) == NIL) return defRetValue;
+	  final double oldValue = value[n];
+	  removeNode(n);
+	  return oldValue;
+	 }
+	 @Override
+	 public int size() {
+	  final EntryIterator i = new EntryIterator(this, true);
+	  int n = 0;
+	  while (i.hasNext()) {
+	   i.next();
+	   n++;
+	  }
+	  return n;
+	 }
+	 @Override
+	 public boolean isEmpty() {
+	  return firstNode(this) == NIL;
+	 }
+	 @Override
+	 public void clear() {
+	  final EntryIterator i = new EntryIterator(this, true);
+	  while (i.hasNext()) {
+	   i.next();
+	   i.remove();
+	  }
+	 }
+	 @Override
+	 public ByteComparator comparator() {
+	  return actualComparator;
+	 }
+	 @Override
+	 public byte firstByteKey() {
+	  return byte2DoubleEntrySet().first().getByteKey();
+	 }
+	 @Override
+	 public byte lastByteKey() {
+	  return byte2DoubleEntrySet().last().getByteKey();
+	 }
+	 @Override
+	 public Byte2DoubleSortedMap headMap(final byte to) {
+	  if (top) return new Submap(from, bottom, to, false);
+	  return compare(to, this.to) < 0 ? new Submap(from, bottom, to, false) : this;
+	 }
+	 @Override
+	 public Byte2DoubleSortedMap tailMap(final byte from) {
+	  if (bottom) return new Submap(from, false, to, top);
+	  return compare(from, this.from) > 0 ? new Submap(from, false, to, top) : this;
+	 }
+	 @Override
+	 public Byte2DoubleSortedMap subMap(byte from, byte to) {
+	  if (top && bottom) return new Submap(from, false, to, false);
+	  if (! top) to = compare(to, this.to) < 0 ? to : this.to;
+	  if (! bottom) from = compare(from, this.from) > 0 ? from : this.from;
+	  if (! top && ! bottom && from == this.from && to == this.to) return this;
+	  return new Submap(from, false, to, false);
+	 }
+	}
+	/** Returns a deep copy of this tree map.
+	 *
+	 * <p>This method performs a deep copy of this tree map; the data stored in the
+	 * set, however, is not cloned. Note that this makes a difference only for object keys.
+	 *
+	 * @return a deep copy of this tree map.
+	 */
+	@Override
+
+	public Byte2DoubleArenaTreeMap clone() {
+	 Byte2DoubleArenaTreeMap c;
+	 try {
+	  c = (Byte2DoubleArenaTreeMap )super.clone();
+	 }
+	 catch(CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.key = key.clone();
+	 c.value = value.clone();
+	 c.left = left.clone();
+	 c.right = right.clone();
+	 c.parent = parent.clone();
+	 c.height = height.clone();
+	 c.entries = null;
+	 return c;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 for(int n = firstNode(); n != NIL; n = successor(n)) {
+	  s.writeByte(key[n]);
+	  s.writeDouble(value[n]);
+	 }
+	}
+
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 setActualComparator();
+	 final int n = count;
+	 allocate(n);
+	 count = 0;
+	 for(int i = 0; i < n; i++) {
+	  final byte k = s.readByte();
+	  put(k, s.readDouble());
+	 }
+	}
+}
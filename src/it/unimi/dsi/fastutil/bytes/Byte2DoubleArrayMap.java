@@ -29,6 +29,9 @@ import it.unimi.dsi.fastutil.doubles.DoubleArrays;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of pairs: just put them into two parallel arrays and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several keys per iteration without short-circuiting, so that there
+	* is a single branch per block of keys.
 	*/
 public class Byte2DoubleArrayMap extends AbstractByte2DoubleMap implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -266,15 +269,17 @@ public class Byte2DoubleArrayMap extends AbstractByte2DoubleMap implements java.
 	}
 	private int findKey(final byte k) {
 	 final byte[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( (key[i]) == (k) )) return i;
+	 int i = size;
+	 // Non-short-circuit operators leave a single branch for each block of four keys
+	 for(; i >= 4; i -= 4) if (( (key[i - 1]) == (k) ) | ( (key[i - 2]) == (k) ) | ( (key[i - 3]) == (k) ) | ( (key[i - 4]) == (k) )) break;
+	 while(i-- != 0) if (( (key[i]) == (k) )) return i;
 	 return -1;
 	}
 	@Override
 
 	public double get(final byte k) {
-	 final byte[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( (key[i]) == (k) )) return value[i];
-	 return defRetValue;
+	 final int i = findKey(k);
+	 return i == -1 ? defRetValue : value[i];
 	}
 	@Override
 	public int size() { return size; }
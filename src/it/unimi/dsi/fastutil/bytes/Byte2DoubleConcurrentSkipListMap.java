@@ -0,0 +1,1092 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+import it.unimi.dsi.fastutil.doubles.DoubleCollection;
+import it.unimi.dsi.fastutil.doubles.DoubleIterator;
+import it.unimi.dsi.fastutil.doubles.DoubleSpliterator;
+import it.unimi.dsi.fastutil.doubles.DoubleSpliterators;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.SortedMap;
+import java.util.Spliterator;
+import java.util.concurrent.ThreadLocalRandom;
+import java.util.concurrent.atomic.AtomicReferenceFieldUpdater;
+import java.util.concurrent.atomic.LongAdder;
+/** A type-specific concurrent sorted map based on a lock-free skip list.
+	*
+	* <p>This class is a type-specific analogue of {@link java.util.concurrent.ConcurrentSkipListMap}: entries
+	* are stored, without boxing, in a sorted linked list of nodes, on top of which a hierarchy of sparser index lists
+	* makes it possible to locate a key in expected logarithmic time. Lookups, insertions of new keys and iteration
+	* are lock-free: all operations can be performed safely and concurrently by multiple threads.
+	* The only exception are the update of the value associated with a key already present and the removal of a key,
+	* which synchronize briefly on the node of the key: since values are primitive, they cannot be
+	* replaced atomically together with the deletion mark of the node, as {@link java.util.concurrent.ConcurrentSkipListMap}
+	* does with a {@code null} value.
+	*
+	* <p>{@link #putIfAbsent putIfAbsent()}, {@link #replace replace()} and the two-argument type-specific {@code remove()}
+	* are atomic. Other default methods of the map interfaces (e.g., {@code computeIfAbsent()} or {@code merge()})
+	* are not.
+	*
+	* <p>Submaps returned by {@link #headMap headMap()}, {@link #tailMap tailMap()} and {@link #subMap subMap()}
+	* are concurrent views on a range of this map. The iterators and spliterators of the views of this map and of its submaps are
+	* <em>weakly consistent</em>: they never throw {@link java.util.ConcurrentModificationException}, they return each entry at most once,
+	* and they reflect the state of the map at some point at or since their creation.
+	* Entries returned by iterators are immutable snapshots. Iterators are bidirectional,
+	* but every call to {@code previous()} requires a logarithmic search.
+	*
+	* <p>As in the case of {@link java.util.concurrent.ConcurrentSkipListMap}, the result of {@link #size()} is only an estimate if
+	* there are concurrent modifications; moreover, the size of a submap is computed by enumerating its entries.
+	*/
+public class Byte2DoubleConcurrentSkipListMap extends AbstractByte2DoubleSortedMap implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** A node of the base list. */
+	static final class Node {
+	 /** The key (meaningless for markers and for the header). */
+	 final byte key;
+	 /** The value; it does not change after {@link #deleted} has been set. */
+	 volatile double value;
+	 /** The next node. */
+	 volatile Node next;
+	 /** Whether this node has been deleted; value updates and deletion happen while synchronizing on the node. */
+	 volatile boolean deleted;
+	 /** Whether this node is a marker, that is, a node appended to a deleted node so that no node can be inserted after it. */
+	 final boolean marker;
+	 Node(final byte key, final double value, final Node next) {
+	  this.key = key;
+	  this.value = value;
+	  this.next = next;
+	  this.marker = false;
+	 }
+	 /** Creates a marker.
+		 *
+		 * @param next the next node.
+		 */
+	 Node(final Node next) {
+	  this.key = ((byte)0);
+	  this.next = next;
+	  this.marker = true;
+	 }
+	}
+	/** A node of an index list. */
+	static final class Index {
+	 /** The indexed node of the base list. */
+	 final Node node;
+	 /** The index of the same node in the list below, or {@code null}. */
+	 final Index down;
+	 /** The next index in this list. */
+	 volatile Index right;
+	 Index(final Node node, final Index down, final Index right) {
+	  this.node = node;
+	  this.down = down;
+	  this.right = right;
+	 }
+	}
+
+	private static final AtomicReferenceFieldUpdater<Node, Node> NEXT = AtomicReferenceFieldUpdater.newUpdater(Node.class, Node.class, "next");
+
+	private static final AtomicReferenceFieldUpdater<Index, Index> RIGHT = AtomicReferenceFieldUpdater.newUpdater(Index.class, Index.class, "right");
+
+	private static final AtomicReferenceFieldUpdater<Byte2DoubleConcurrentSkipListMap, Index> HEAD = AtomicReferenceFieldUpdater.newUpdater(Byte2DoubleConcurrentSkipListMap.class, Index.class, "head");
+	/** Relation flags for {@link #findNear findNear()}. */
+	private static final int EQ = 1, LT = 2, GT = 0;
+	/** The header of the base list; it is never deleted. */
+	private transient Node header;
+	/** The topmost index list (whose first index points at {@link #header}). */
+	private transient volatile Index head;
+	/** The number of entries, updated after insertions and deletions. */
+	private transient LongAdder count;
+	/** A submap comprising the whole key range, providing the views of this map. */
+	private transient Submap whole;
+	/** This map's comparator, as provided in the constructor. */
+	protected final Comparator<? super Byte> storedComparator;
+	/** This map's actual comparator; it may differ from {@link #storedComparator} because it is
+		always a type-specific comparator, so it could be derived from the former by wrapping. */
+	protected transient ByteComparator actualComparator;
+	/** Creates a new empty map.
+	 */
+	public Byte2DoubleConcurrentSkipListMap() {
+	 this((Comparator<? super Byte>)null);
+	}
+	/** Creates a new empty map with the given comparator.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 */
+	public Byte2DoubleConcurrentSkipListMap(final Comparator<? super Byte> c) {
+	 storedComparator = c;
+	 setActualComparator();
+	 initialize();
+	}
+	/** Creates a new map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new map.
+	 */
+	public Byte2DoubleConcurrentSkipListMap(final Map<? extends Byte, ? extends Double> m) {
+	 this();
+	 putAll(m);
+	}
+	/** Creates a new map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new map.
+	 */
+	public Byte2DoubleConcurrentSkipListMap(final SortedMap<Byte,Double> m) {
+	 this(m.comparator());
+	 putAll(m);
+	}
+	/** Creates a new map copying a given type-specific map.
+	 *
+	 * @param m a type-specific map to be copied into the new map.
+	 */
+	public Byte2DoubleConcurrentSkipListMap(final Byte2DoubleMap m) {
+	 this();
+	 putAll(m);
+	}
+	/** Creates a new map copying a given type-specific sorted map (and its {@link Comparator}).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new map.
+	 */
+	public Byte2DoubleConcurrentSkipListMap(final Byte2DoubleSortedMap m) {
+	 this(m.comparator());
+	 putAll(m);
+	}
+	/** Generates the comparator that will be actually used.
+	 *
+	 * <p>When a given {@link Comparator} is specified and stored in {@link
+	 * #storedComparator}, we must check whether it is type-specific.  If it is
+	 * so, we can used directly, and we store it in {@link #actualComparator}. Otherwise,
+	 * we adapt it using a helper static method.
+	 */
+	private void setActualComparator() {
+	 actualComparator = ByteComparators.asByteComparator(storedComparator);
+	}
+	/** Sets up an empty skip list. */
+	private void initialize() {
+	 header = new Node (((byte)0), (0), null);
+	 head = new Index (header, null, null);
+	 count = new LongAdder();
+	 whole = new Submap(((byte)0), true, ((byte)0), true);
+	}
+	/** Compares two keys in the right way.
+	 *
+	 * <p>This method uses the {@link #actualComparator} if it is non-{@code null}.
+	 * Otherwise, it resorts to primitive type comparisons or to {@link Comparable#compareTo(Object) compareTo()}.
+	 *
+	 * @param k1 the first key.
+	 * @param k2 the second key.
+	 * @return a number smaller than, equal to or greater than 0, as usual
+	 * (i.e., when k1 &lt; k2, k1 = k2 or k1 &gt; k2, respectively).
+	 */
+
+	final int compare(final byte k1, final byte k2) {
+	 return actualComparator == null ? ( Byte.compare((k1),(k2)) ) : actualComparator.compare(k1, k2);
+	}
+	/** Appends a marker to a deleted node, unless it is already marked.
+	 *
+	 * @param n a deleted node.
+	 * @return the successor of {@code n} following the marker.
+	 */
+	private static Node mark(final Node n) {
+	 for (;;) {
+	  final Node f = n.next;
+	  if (f != null && f.marker) return f.next;
+	  if (NEXT.compareAndSet(n, f, new Node (f))) return f;
+	 }
+	}
+	/** Tries to unlink a deleted node from its predecessor, marking it first.
+	 *
+	 * @param b the predecessor of {@code n}.
+	 * @param n a deleted node.
+	 */
+	private static void unlinkNode(final Node b, final Node n) {
+	 NEXT.compareAndSet(b, n, mark(n));
+	}
+	/** Sets the deletion mark of a node.
+	 *
+	 * @param n a node.
+	 * @return true if this call deleted the node; false if it had already been deleted.
+	 */
+	private static boolean delete(final Node n) {
+	 synchronized (n) {
+	  if (n.deleted) return false;
+	  n.deleted = true;
+	  return true;
+	 }
+	}
+	/** Returns a base-list node whose key is smaller than a given key, unlinking on the way index nodes pointing at deleted nodes.
+	 *
+	 * @param k a key.
+	 * @return a node (possibly the header) whose key is smaller than {@code k}.
+	 */
+	private Node findPredecessor(final byte k) {
+	 for (Index q = head, r, d;;) {
+	  while ((r = q.right) != null) {
+	   final Node p = r.node;
+	   if (p.deleted) RIGHT.compareAndSet(q, r, r.right);
+	   else if (compare(k, p.key) > 0) q = r;
+	   else break;
+	  }
+	  if ((d = q.down) != null) q = d;
+	  else return q.node;
+	 }
+	}
+	/** Returns the node of a given key, unlinking on the way deleted nodes.
+	 *
+	 * @param k a key.
+	 * @return the node of {@code k}, or {@code null}; the node might have been deleted in the meantime.
+	 */
+	private Node findNode(final byte k) {
+	 outer: for (;;) {
+	  Node b = findPredecessor(k);
+	  for (;;) {
+	   final Node n = b.next;
+	   if (n == null) return null;
+	   if (n.marker) continue outer; // b has been deleted
+	   if (n.deleted) {
+	    unlinkNode(b, n);
+	    continue;
+	   }
+	   final int c = compare(k, n.key);
+	   if (c > 0) b = n;
+	   else return c == 0 ? n : null;
+	  }
+	 }
+	}
+	/** Returns the node closest to a given key in a given relation.
+	 *
+	 * @param k a key.
+	 * @param rel {@link #LT}, {@link #LT} | {@link #EQ}, {@link #GT} or {@link #GT} | {@link #EQ}.
+	 * @return the node closest to {@code k} satisfying the given relation, or {@code null};
+	 * in the {@link #LT} case, the node might be deleted.
+	 */
+	private Node findNear(final byte k, final int rel) {
+	 outer: for (;;) {
+	  Node b = findPredecessor(k);
+	  for (;;) {
+	   final Node n = b.next;
+	   if (n == null) return (rel & LT) != 0 && b != header ? b : null;
+	   if (n.marker) continue outer;
+	   if (n.deleted) {
+	    unlinkNode(b, n);
+	    continue;
+	   }
+	   final int c = compare(k, n.key);
+	   if (c == 0 && (rel & EQ) != 0 || c < 0 && (rel & LT) == 0) return n;
+	   if (c <= 0 && (rel & LT) != 0) return b != header ? b : null;
+	   b = n;
+	  }
+	 }
+	}
+	/** Returns the live node closest to a given key in a given relation.
+	 *
+	 * @param k a key.
+	 * @param rel {@link #LT}, {@link #LT} | {@link #EQ}, {@link #GT} or {@link #GT} | {@link #EQ}.
+	 * @return the node closest to {@code k} satisfying the given relation, or {@code null}.
+	 */
+	private Node nearNode(final byte k, final int rel) {
+	 for (;;) {
+	  final Node n = findNear(k, rel);
+	  if (n == null || ! n.deleted) return n;
+	  mark(n);
+	 }
+	}
+	/** Returns the first live node.
+	 *
+	 * @return the first live node, or {@code null}.
+	 */
+	private Node firstNode() {
+	 for (Node n; (n = header.next) != null;) {
+	  if (! n.deleted) return n;
+	  unlinkNode(header, n);
+	 }
+	 return null;
+	}
+	/** Returns the last live node.
+	 *
+	 * @return the last live node, or {@code null}.
+	 */
+	private Node lastNode() {
+	 outer: for (;;) {
+	  Index q = head;
+	  for (Index r, d;;) {
+	   while ((r = q.right) != null) {
+	    if (r.node.deleted) RIGHT.compareAndSet(q, r, r.right);
+	    else q = r;
+	   }
+	   if ((d = q.down) != null) q = d;
+	   else break;
+	  }
+	  Node b = q.node;
+	  for (;;) {
+	   final Node n = b.next;
+	   if (n == null) {
+	    if (b == header) return null;
+	    if (! b.deleted) return b;
+	    mark(b);
+	    continue outer;
+	   }
+	   if (n.marker) continue outer;
+	   if (n.deleted) unlinkNode(b, n);
+	   else b = n;
+	  }
+	 }
+	}
+	/** Adds a pair to the map, or updates the value of an existing key.
+	 *
+	 * @param k the key.
+	 * @param v the value.
+	 * @param onlyIfAbsent if true, the value of an existing key is not updated.
+	 * @param absent the value to return if the key was not present.
+	 * @return the value previously associated with {@code k}, or {@code absent}.
+	 */
+	private double doPut(final byte k, final double v, final boolean onlyIfAbsent, final double absent) {
+	 for (;;) {
+	  final Index h = head;
+	  Index q = h;
+	  int levels = 0;
+	  for (Index r, d;;) {
+	   while ((r = q.right) != null) {
+	    final Node p = r.node;
+	    if (p.deleted) RIGHT.compareAndSet(q, r, r.right);
+	    else if (compare(k, p.key) > 0) q = r;
+	    else break;
+	   }
+	   if ((d = q.down) == null) break;
+	   levels++;
+	   q = d;
+	  }
+	  Node b = q.node, z = null;
+	  for (;;) {
+	   final Node n = b.next;
+	   if (n != null) {
+	    if (n.marker) break; // b has been deleted: restart
+	    if (n.deleted) {
+	     unlinkNode(b, n);
+	     continue;
+	    }
+	    final int c = compare(k, n.key);
+	    if (c > 0) {
+	     b = n;
+	     continue;
+	    }
+	    if (c == 0) {
+	     if (onlyIfAbsent) {
+	      final double oldValue = n.value;
+	      if (! n.deleted) return oldValue;
+	     }
+	     else synchronized (n) {
+	      if (! n.deleted) {
+	       final double oldValue = n.value;
+	       n.value = v;
+	       return oldValue;
+	      }
+	     }
+	     continue;
+	    }
+	   }
+	   final Node p = new Node (k, v, n);
+	   if (NEXT.compareAndSet(b, n, p)) {
+	    z = p;
+	    break;
+	   }
+	  }
+	  if (z == null) continue;
+	  long rnd = ThreadLocalRandom.current().nextLong();
+	  if ((rnd & 0x3) == 0) { // Add indices with probability 1/4
+	   int skips = levels; // Levels to descend before adding
+	   Index x = null;
+	   // At most 62 indices, as the two lowest bits are zero
+	   for (;;) {
+	    x = new Index (z, x, null);
+	    if (rnd >= 0 || --skips < 0) break;
+	    rnd <<= 1;
+	   }
+	   if (addIndices(h, skips, x) && skips < 0 && head == h) { // Try to add a new level
+	    final Index hx = new Index (z, x, null);
+	    HEAD.compareAndSet(this, h, new Index (h.node, h, hx));
+	   }
+	   if (z.deleted) findPredecessor(k); // Deleted while adding indices: clean up
+	  }
+	  count.increment();
+	  return absent;
+	 }
+	}
+	/** Adds a tower of indices to the index lists.
+	 *
+	 * @param q the starting index.
+	 * @param skips the number of levels to descend before starting to add indices.
+	 * @param x the topmost index of the tower.
+	 * @return true if the tower has been added.
+	 */
+	private boolean addIndices(Index q, int skips, final Index x) {
+	 final byte k = x.node.key;
+	 boolean retrying = false;
+	 for (;;) { // Find the splice point
+	  final Index r = q.right;
+	  int c;
+	  if (r != null) {
+	   final Node p = r.node;
+	   if (p.deleted) {
+	    RIGHT.compareAndSet(q, r, r.right);
+	    c = 0;
+	   }
+	   else if ((c = compare(k, p.key)) > 0) q = r;
+	   else if (c == 0) return false; // Stale
+	  }
+	  else c = -1;
+	  if (c < 0) {
+	   final Index d = q.down;
+	   if (d != null && skips > 0) {
+	    skips--;
+	    q = d;
+	   }
+	   else if (d != null && ! retrying && ! addIndices(d, 0, x.down)) return false;
+	   else {
+	    x.right = r;
+	    if (RIGHT.compareAndSet(q, r, x)) return true;
+	    retrying = true; // Find the splice point again
+	   }
+	  }
+	 }
+	}
+	/** Removes a key.
+	 *
+	 * @param k the key.
+	 * @param matchValue if true, the key is removed only if it is associated with {@code v}.
+	 * @param v a value (used only if {@code matchValue} is true).
+	 * @return the deleted node, whose value is the value that was associated with {@code k}, or {@code null}.
+	 */
+	private Node doRemove(final byte k, final boolean matchValue, final double v) {
+	 outer: for (;;) {
+	  Node b = findPredecessor(k);
+	  for (;;) {
+	   final Node n = b.next;
+	   if (n == null) return null;
+	   if (n.marker) continue outer;
+	   if (n.deleted) {
+	    unlinkNode(b, n);
+	    continue;
+	   }
+	   final int c = compare(k, n.key);
+	   if (c > 0) {
+	    b = n;
+	    continue;
+	   }
+	   if (c < 0) return null;
+	   synchronized (n) {
+	    if (n.deleted) continue;
+	    if (matchValue && ! ( Double.doubleToLongBits(n.value) == Double.doubleToLongBits(v) )) return null;
+	    n.deleted = true;
+	   }
+	   unlinkNode(b, n);
+	   findPredecessor(k); // Unlinks index nodes
+	   count.decrement();
+	   return n;
+	  }
+	 }
+	}
+	/** Replaces the value of an existing key.
+	 *
+	 * @param k the key.
+	 * @param v the new value.
+	 * @param absent the value to return if the key is not present.
+	 * @return the value previously associated with {@code k}, or {@code absent}.
+	 */
+	private double doReplace(final byte k, final double v, final double absent) {
+	 for (;;) {
+	  final Node n = findNode(k);
+	  if (n == null) return absent;
+	  synchronized (n) {
+	   if (! n.deleted) {
+	    final double oldValue = n.value;
+	    n.value = v;
+	    return oldValue;
+	   }
+	  }
+	 }
+	}
+	/** Replaces the value of an existing key, if it is equal to a given value.
+	 *
+	 * @param k the key.
+	 * @param oldValue the expected value.
+	 * @param v the new value.
+	 * @return true if the value was replaced.
+	 */
+	private boolean doReplaceIfEqual(final byte k, final double oldValue, final double v) {
+	 for (;;) {
+	  final Node n = findNode(k);
+	  if (n == null) return false;
+	  synchronized (n) {
+	   if (! n.deleted) {
+	    if (! ( Double.doubleToLongBits(n.value) == Double.doubleToLongBits(oldValue) )) return false;
+	    n.value = v;
+	    return true;
+	   }
+	  }
+	 }
+	}
+	/** Returns the value associated with a key.
+	 *
+	 * @param k a key.
+	 * @param absent the value to return if the key is not present.
+	 * @return the value associated with {@code k}, or {@code absent}.
+	 */
+	private double doGet(final byte k, final double absent) {
+	 final Node n = findNode(k);
+	 if (n == null) return absent;
+	 final double v = n.value;
+	 return n.deleted ? absent : v;
+	}
+	@Override
+	public double put(final byte k, final double v) {
+	 return doPut(k, v, false, defRetValue);
+	}
+	/** {@inheritDoc} */
+	@Override
+	public double putIfAbsent(final byte k, final double v) {
+	 return doPut(k, v, true, defRetValue);
+	}
+
+	@Override
+	public double remove(final byte k) {
+	 final Node n = doRemove( k, false, (0));
+	 return n == null ? defRetValue : n.value;
+	}
+	/** {@inheritDoc} */
+
+	@Override
+	public boolean remove(final byte k, final double v) {
+	 return doRemove( k, true, v) != null;
+	}
+	/** {@inheritDoc} */
+	@Override
+	public boolean replace(final byte k, final double oldValue, final double v) {
+	 return doReplaceIfEqual(k, oldValue, v);
+	}
+	/** {@inheritDoc} */
+	@Override
+	public double replace(final byte k, final double v) {
+	 return doReplace(k, v, defRetValue);
+	}
+
+	@Override
+	public double get(final byte k) {
+	 return doGet( k, defRetValue);
+	}
+
+	@Override
+	public boolean containsKey(final byte k) {
+	
+	 return findNode( k) != null;
+	}
+	@Override
+	public boolean containsValue(final double v) {
+	 for (Node n = header.next; n != null; n = n.next) {
+	  if (n.marker) continue;
+	  final double w = n.value;
+	  if (! n.deleted && ( Double.doubleToLongBits(w) == Double.doubleToLongBits(v) )) return true;
+	 }
+	 return false;
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>This method returns an estimate if the map is modified concurrently.
+	 */
+	@Override
+	public int size() {
+	 final long c = count.sum();
+	 return c <= 0 ? 0 : c >= Integer.MAX_VALUE ? Integer.MAX_VALUE : (int)c;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return firstNode() == null;
+	}
+	@Override
+	public void clear() {
+	 for (;;) {
+	  final Index h = head, r = h.right, d = h.down;
+	  if (r != null) RIGHT.compareAndSet(h, r, null);
+	  else if (d != null) HEAD.compareAndSet(this, h, d);
+	  else {
+	   long c = 0;
+	   for (Node n; (n = header.next) != null;) {
+	    if (delete(n)) c--;
+	    unlinkNode(header, n);
+	   }
+	   if (c == 0) break;
+	   count.add(c);
+	  }
+	 }
+	}
+	@Override
+	public byte firstByteKey() {
+	 final Node n = firstNode();
+	 if (n == null) throw new NoSuchElementException();
+	 return n.key;
+	}
+	@Override
+	public byte lastByteKey() {
+	 final Node n = lastNode();
+	 if (n == null) throw new NoSuchElementException();
+	 return n.key;
+	}
+	@Override
+	public ByteComparator comparator() { return actualComparator; }
+	@Override
+	public ObjectSortedSet<Byte2DoubleMap.Entry > byte2DoubleEntrySet() { return whole.byte2DoubleEntrySet(); }
+	/** Returns a type-specific sorted set view of the keys contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#keySet()}, you can
+	 * safely cast the set returned by this call to a type-specific sorted
+	 * set interface.
+	 *
+	 * @return a type-specific sorted set view of the keys contained in this map.
+	 */
+	@Override
+	public ByteSortedSet keySet() { return whole.keySet(); }
+	/** Returns a type-specific collection view of the values contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#values()}, you can
+	 * safely cast the collection returned by this call to a type-specific collection
+	 * interface.
+	 *
+	 * @return a type-specific collection view of the values contained in this map.
+	 */
+	@Override
+	public DoubleCollection values() { return whole.values(); }
+	@Override
+	public Byte2DoubleSortedMap headMap(final byte to) { return new Submap(((byte)0), true, to, false); }
+	@Override
+	public Byte2DoubleSortedMap tailMap(final byte from) { return new Submap(from, false, ((byte)0), true); }
+	@Override
+	public Byte2DoubleSortedMap subMap(final byte from, final byte to) { return new Submap(from, false, to, false); }
+	/** A submap with given range.
+	 *
+	 * <p>This class represents a concurrent view on a range of the map. One has to specify the left/right
+	 * limits (which can be set to -&infin; or &infin;). The views of the map are
+	 * the views of a submap with infinite limits.
+	 */
+	private final class Submap extends AbstractByte2DoubleSortedMap implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 /** The start of the submap range, unless {@link #bottom} is true. */
+	 final byte from;
+	 /** The end of the submap range, unless {@link #top} is true. */
+	 final byte to;
+	 /** If true, the submap range starts from -&infin;. */
+	 final boolean bottom;
+	 /** If true, the submap range goes to &infin;. */
+	 final boolean top;
+	 /** Cached set of entries. */
+	 protected transient ObjectSortedSet<Byte2DoubleMap.Entry > entries;
+	 /** Cached set of keys. */
+	 protected transient ByteSortedSet keys;
+	 /** Cached collection of values. */
+	 protected transient DoubleCollection values;
+	 /** Creates a new submap with given key range.
+		 *
+		 * @param from the start of the submap range.
+		 * @param bottom if true, the first parameter is ignored and the range starts from -&infin;.
+		 * @param to the end of the submap range.
+		 * @param top if true, the third parameter is ignored and the range goes to &infin;.
+		 */
+	 Submap(final byte from, final boolean bottom, final byte to, final boolean top) {
+	  if (! bottom && ! top && Byte2DoubleConcurrentSkipListMap.this.compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	  this.from = from;
+	  this.bottom = bottom;
+	  this.to = to;
+	  this.top = top;
+	  this.defRetValue = Byte2DoubleConcurrentSkipListMap.this.defRetValue;
+	 }
+	 /** Checks whether a key is smaller than the start of the submap range. */
+	 final boolean tooLow(final byte k) {
+	  return ! bottom && compare(k, from) < 0;
+	 }
+	 /** Checks whether a key is greater than or equal to the end of the submap range. */
+	 final boolean tooHigh(final byte k) {
+	  return ! top && compare(k, to) >= 0;
+	 }
+	 /** Checks whether a key is in the submap range.
+		 * @param k a key.
+		 * @return true if is the key is in the submap range.
+		 */
+	 final boolean in(final byte k) {
+	  return ! tooLow(k) && ! tooHigh(k);
+	 }
+	 /** Returns the first live node of the range, or {@code null}. */
+	 final Node loNode() {
+	  final Node n = bottom ? firstNode() : nearNode(from, GT | EQ);
+	  return n == null || tooHigh(n.key) ? null : n;
+	 }
+	 /** Returns the last live node of the range, or {@code null}. */
+	 final Node hiNode() {
+	  final Node n = top ? lastNode() : nearNode(to, LT);
+	  return n == null || tooLow(n.key) ? null : n;
+	 }
+	 private void ensureInRange(final byte k) {
+	  if (! in(k)) throw new IllegalArgumentException("Key (" + k + ") out of range [" + (bottom ? "-" : String.valueOf(from)) + ", " + (top ? "-" : String.valueOf(to)) + ")");
+	 }
+	 @Override
+	 public double put(final byte k, final double v) {
+	  ensureInRange(k);
+	  return doPut(k, v, false, defRetValue);
+	 }
+	 @Override
+	 public double putIfAbsent(final byte k, final double v) {
+	  ensureInRange(k);
+	  return doPut(k, v, true, defRetValue);
+	 }
+	
+	 @Override
+	 public double remove(final byte k) {
+	  if (! in( k)) return defRetValue;
+	  final Node n = doRemove( k, false, (0));
+	  return n == null ? defRetValue : n.value;
+	 }
+	
+	 @Override
+	 public boolean remove(final byte k, final double v) {
+	  return in( k) && doRemove( k, true, v) != null;
+	 }
+	 @Override
+	 public boolean replace(final byte k, final double oldValue, final double v) {
+	  return in(k) && doReplaceIfEqual(k, oldValue, v);
+	 }
+	 @Override
+	 public double replace(final byte k, final double v) {
+	  return in(k) ? doReplace(k, v, defRetValue) : defRetValue;
+	 }
+	
+	 @Override
+	 public double get(final byte k) {
+	  return in( k) ? doGet( k, defRetValue) : defRetValue;
+	 }
+	
+	 @Override
+	 public boolean containsKey(final byte k) {
+	 
+	  return in( k) && findNode( k) != null;
+	 }
+	 @Override
+	 public boolean containsValue(final double v) {
+	  for (final SubmapIterator i = new SubmapIterator(); i.hasNext();) {
+	   i.nextNode();
+	   if (( Double.doubleToLongBits(i.currValue) == Double.doubleToLongBits(v) )) return true;
+	  }
+	  return false;
+	 }
+	 @Override
+	 public int size() {
+	  if (bottom && top) return Byte2DoubleConcurrentSkipListMap.this.size();
+	  int c = 0;
+	  for (final SubmapIterator i = new SubmapIterator(); i.hasNext(); i.nextNode()) c++;
+	  return c;
+	 }
+	 @Override
+	 public boolean isEmpty() {
+	  return loNode() == null;
+	 }
+	 @Override
+	 public void clear() {
+	  if (bottom && top) Byte2DoubleConcurrentSkipListMap.this.clear();
+	  else for (final SubmapIterator i = new SubmapIterator(); i.hasNext();) {
+	   i.nextNode();
+	   i.remove();
+	  }
+	 }
+	 @Override
+	 public byte firstByteKey() {
+	  final Node n = loNode();
+	  if (n == null) throw new NoSuchElementException();
+	  return n.key;
+	 }
+	 @Override
+	 public byte lastByteKey() {
+	  final Node n = hiNode();
+	  if (n == null) throw new NoSuchElementException();
+	  return n.key;
+	 }
+	 @Override
+	 public ByteComparator comparator() { return actualComparator; }
+	 @Override
+	 public Byte2DoubleSortedMap headMap(final byte to) {
+	  if (top) return new Submap(from, bottom, to, false);
+	  return compare(to, this.to) < 0 ? new Submap(from, bottom, to, false) : this;
+	 }
+	 @Override
+	 public Byte2DoubleSortedMap tailMap(final byte from) {
+	  if (bottom) return new Submap(from, false, to, top);
+	  return compare(from, this.from) > 0 ? new Submap(from, false, to, top) : this;
+	 }
+	 @Override
+	 public Byte2DoubleSortedMap subMap(byte from, byte to) {
+	  if (top && bottom) return new Submap(from, false, to, false);
+	  if (! top) to = compare(to, this.to) < 0 ? to : this.to;
+	  if (! bottom) from = compare(from, this.from) > 0 ? from : this.from;
+	  if (! top && ! bottom && from == this.from && to == this.to) return this;
+	  return new Submap(from, false, to, false);
+	 }
+	 /** Returns a snapshot of the first or last entry of the range.
+		 *
+		 * @param first whether to return the first or the last entry.
+		 * @return a snapshot of the requested entry.
+		 * @throws NoSuchElementException if the range is empty.
+		 */
+	 private Byte2DoubleMap.Entry extremeEntry(final boolean first) {
+	  for (;;) {
+	   final Node n = first ? loNode() : hiNode();
+	   if (n == null) throw new NoSuchElementException();
+	   final double v = n.value;
+	   if (! n.deleted) return new AbstractByte2DoubleMap.BasicEntry (n.key, v);
+	  }
+	 }
+	 @Override
+	
+	 public ObjectSortedSet<Byte2DoubleMap.Entry > byte2DoubleEntrySet() {
+	  if (entries == null) entries = new AbstractObjectSortedSet<Byte2DoubleMap.Entry >() {
+	    final Comparator<? super Byte2DoubleMap.Entry > comparator = (Byte2DoubleConcurrentSkipListMap.this.actualComparator == null ?
+	      (Comparator<Byte2DoubleMap.Entry >) (x, y) -> ( Byte.compare((x.getByteKey()),(y.getByteKey())) ) :
+	      (Comparator<Byte2DoubleMap.Entry >) (x, y) -> Byte2DoubleConcurrentSkipListMap.this.actualComparator.compare(x.getByteKey(), y.getByteKey())
+	    );
+	    @Override
+	    public Comparator<? super Byte2DoubleMap.Entry > comparator() { return comparator; }
+	    @Override
+	    public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator() { return new SubmapEntryIterator(); }
+	    @Override
+	    public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator(final Byte2DoubleMap.Entry from) { return new SubmapEntryIterator(from.getByteKey()); }
+	    @Override
+	    public ObjectSpliterator<Byte2DoubleMap.Entry > spliterator() {
+	     return ObjectSpliterators.asSpliteratorUnknownSize(iterator(), Spliterator.DISTINCT | Spliterator.ORDERED | Spliterator.NONNULL | Spliterator.CONCURRENT);
+	    }
+	    @Override
+	   
+	    public boolean contains(final Object o) {
+	     if (!(o instanceof Map.Entry)) return false;
+	     final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	     if (e.getKey() == null) return false;
+	     if (! (e.getKey() instanceof Byte)) return false;
+	     if (e.getValue() == null || ! (e.getValue() instanceof Double)) return false;
+	     final byte k = ((Byte)( e.getKey())).byteValue();
+	     if (! in(k)) return false;
+	     final Node n = findNode(k);
+	     if (n == null) return false;
+	     final double v = n.value;
+	     return ! n.deleted && ( Double.doubleToLongBits(v) == Double.doubleToLongBits(((Double)(e.getValue())).doubleValue()) );
+	    }
+	    @Override
+	   
+	    public boolean remove(final Object o) {
+	     if (!(o instanceof Map.Entry)) return false;
+	     final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	     if (e.getKey() == null) return false;
+	     if (! (e.getKey() instanceof Byte)) return false;
+	     if (e.getValue() == null || ! (e.getValue() instanceof Double)) return false;
+	     final byte k = ((Byte)( e.getKey())).byteValue();
+	     return in(k) && doRemove(k, true, ((Double)(e.getValue())).doubleValue()) != null;
+	    }
+	    @Override
+	    public int size() { return Submap.this.size(); }
+	    @Override
+	    public boolean isEmpty() { return Submap.this.isEmpty(); }
+	    @Override
+	    public void clear() { Submap.this.clear(); }
+	    @Override
+	    public Byte2DoubleMap.Entry first() { return extremeEntry(true); }
+	    @Override
+	    public Byte2DoubleMap.Entry last() { return extremeEntry(false); }
+	    @Override
+	    public ObjectSortedSet<Byte2DoubleMap.Entry > subSet(Byte2DoubleMap.Entry from, Byte2DoubleMap.Entry to) { return subMap(from.getByteKey(), to.getByteKey()).byte2DoubleEntrySet(); }
+	    @Override
+	    public ObjectSortedSet<Byte2DoubleMap.Entry > headSet(Byte2DoubleMap.Entry to) { return headMap(to.getByteKey()).byte2DoubleEntrySet(); }
+	    @Override
+	    public ObjectSortedSet<Byte2DoubleMap.Entry > tailSet(Byte2DoubleMap.Entry from) { return tailMap(from.getByteKey()).byte2DoubleEntrySet(); }
+	   };
+	  return entries;
+	 }
+	 /** A keyset implementation using a more direct implementation for iterators. */
+	 private final class KeySet extends AbstractByte2DoubleSortedMap .KeySet {
+	  @Override
+	  public ByteBidirectionalIterator iterator() { return new SubmapKeyIterator(); }
+	  @Override
+	  public ByteBidirectionalIterator iterator(final byte from) { return new SubmapKeyIterator(from); }
+	  @Override
+	  public ByteSpliterator spliterator() {
+	   return ByteSpliterators.asSpliteratorFromSortedUnknownSize(iterator(), Spliterator.DISTINCT | Spliterator.CONCURRENT, actualComparator);
+	  }
+	  @Override
+	  public boolean isEmpty() { return Submap.this.isEmpty(); }
+	 
+	  @Override
+	  public boolean remove(final byte k) {
+	   return in( k) && doRemove( k, false, (0)) != null;
+	  }
+	 }
+	 @Override
+	 public ByteSortedSet keySet() {
+	  if (keys == null) keys = new KeySet();
+	  return keys;
+	 }
+	 @Override
+	 public DoubleCollection values() {
+	  if (values == null) values = new ValuesCollection() {
+	    @Override
+	    public DoubleIterator iterator() { return new SubmapValueIterator(); }
+	    @Override
+	    public DoubleSpliterator spliterator() {
+	     return DoubleSpliterators.asSpliteratorUnknownSize(iterator(), Spliterator.ORDERED | Spliterator.CONCURRENT);
+	    }
+	    @Override
+	    public boolean isEmpty() { return Submap.this.isEmpty(); }
+	   };
+	  return values;
+	 }
+	 /** A weakly consistent iterator on a subrange of the base list.
+		 *
+		 * <p>The value of each node is read when the node is located, so that it can be returned
+		 * even if the node is deleted in the meantime.
+		 */
+	 private class SubmapIterator {
+	  /** The node that will be returned by the next call to {@link #nextNode()}, or {@code null}. */
+	  Node next;
+	  /** The node that will be returned by the next call to {@link #previousNode()}, or {@code null}. */
+	  Node prev;
+	  /** The last node returned, or {@code null} if there is no such node or it has been removed. */
+	  Node curr;
+	  /** The values of {@link #next}, {@link #prev} and {@link #curr}, as read when the nodes were located. */
+	  double nextValue, prevValue, currValue;
+	  SubmapIterator() {
+	   locateNext(loNode());
+	  }
+	  SubmapIterator(final byte k) {
+	   if (tooLow(k)) locateNext(loNode());
+	   else {
+	    locateNext(tooHigh(k) ? null : nearNode(k, GT));
+	    locatePrevious(k, true);
+	   }
+	  }
+	  /** Sets {@link #next} to the first live node in the range starting from a given node (inclusive).
+			 *
+			 * @param e a node, or {@code null}.
+			 */
+	  private void locateNext(Node e) {
+	   double v = (0);
+	   for (; e != null; e = e.next) {
+	    if (e.marker) continue;
+	    v = e.value;
+	    if (! e.deleted) break;
+	   }
+	   if (e != null && tooHigh(e.key)) e = null;
+	   next = e;
+	   nextValue = v;
+	  }
+	  /** Sets {@link #prev} to the last live node in the range smaller than (or equal to) a given key.
+			 *
+			 * @param k a key.
+			 * @param inclusive whether {@code k} itself should be considered.
+			 */
+	  private void locatePrevious(final byte k, final boolean inclusive) {
+	   final boolean high = tooHigh(k);
+	   for (;;) {
+	    final Node e = nearNode(high ? to : k, high || ! inclusive ? LT : LT | EQ);
+	    if (e == null || tooLow(e.key)) {
+	     prev = null;
+	     return;
+	    }
+	    final double v = e.value;
+	    if (! e.deleted) {
+	     prev = e;
+	     prevValue = v;
+	     return;
+	    }
+	   }
+	  }
+	  public boolean hasNext() { return next != null; }
+	  public boolean hasPrevious() { return prev != null; }
+	  final Node nextNode() {
+	   if (next == null) throw new NoSuchElementException();
+	   curr = prev = next;
+	   currValue = prevValue = nextValue;
+	   locateNext(curr.next);
+	   return curr;
+	  }
+	  final Node previousNode() {
+	   if (prev == null) throw new NoSuchElementException();
+	   curr = next = prev;
+	   currValue = nextValue = prevValue;
+	   locatePrevious(curr.key, false);
+	   return curr;
+	  }
+	  public void remove() {
+	   if (curr == null) throw new IllegalStateException();
+	   doRemove(curr.key, false, (0));
+	   if (next == curr) locateNext(curr.next);
+	   if (prev == curr) locatePrevious(curr.key, false);
+	   curr = null;
+	  }
+	 }
+	 private final class SubmapEntryIterator extends SubmapIterator implements ObjectBidirectionalIterator<Byte2DoubleMap.Entry > {
+	  SubmapEntryIterator() {}
+	  SubmapEntryIterator(final byte k) {
+	   super(k);
+	  }
+	  @Override
+	  public Byte2DoubleMap.Entry next() { return new AbstractByte2DoubleMap.BasicEntry (nextNode().key, currValue); }
+	  @Override
+	  public Byte2DoubleMap.Entry previous() { return new AbstractByte2DoubleMap.BasicEntry (previousNode().key, currValue); }
+	 }
+	 private final class SubmapKeyIterator extends SubmapIterator implements ByteBidirectionalIterator {
+	  SubmapKeyIterator() {}
+	  SubmapKeyIterator(final byte k) {
+	   super(k);
+	  }
+	  @Override
+	  public byte nextByte() { return nextNode().key; }
+	  @Override
+	  public byte previousByte() { return previousNode().key; }
+	 }
+	 private final class SubmapValueIterator extends SubmapIterator implements DoubleIterator {
+	  @Override
+	  public double nextDouble() {
+	   nextNode();
+	   return currValue;
+	  }
+	 }
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 for (Node n = header.next; n != null; n = n.next) {
+	  if (n.marker) continue;
+	  final double v = n.value;
+	  if (n.deleted) continue;
+	  s.writeBoolean(true);
+	  s.writeByte(n.key);
+	  s.writeDouble(v);
+	 }
+	 s.writeBoolean(false);
+	}
+
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 /* The storedComparator is now correctly set, but we must restore
+		   on-the-fly the actualComparator. */
+	 setActualComparator();
+	 initialize();
+	 while (s.readBoolean()) put( s.readByte(), s.readDouble());
+	}
+}
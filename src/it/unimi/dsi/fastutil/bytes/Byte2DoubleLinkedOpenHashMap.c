@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2DoubleLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2DoubleAVLTreeMap
 #define RB_TREE_MAP Byte2DoubleRBTreeMap
+#define CACHE Byte2DoubleCache
+#define STATIC_FUNCTION Byte2DoubleStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
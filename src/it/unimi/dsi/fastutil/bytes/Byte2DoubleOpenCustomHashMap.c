@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2DoubleOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2DoubleAVLTreeMap
 #define RB_TREE_MAP Byte2DoubleRBTreeMap
+#define CACHE Byte2DoubleCache
+#define STATIC_FUNCTION Byte2DoubleStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
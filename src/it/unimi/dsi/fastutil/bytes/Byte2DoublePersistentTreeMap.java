@@ -0,0 +1,1021 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+import it.unimi.dsi.fastutil.doubles.DoubleCollection;
+import it.unimi.dsi.fastutil.doubles.AbstractDoubleCollection;
+import it.unimi.dsi.fastutil.doubles.DoubleIterator;
+import it.unimi.dsi.fastutil.doubles.DoubleSpliterator;
+import it.unimi.dsi.fastutil.doubles.DoubleSpliterators;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.SortedMap;
+import java.util.NoSuchElementException;
+import java.util.function.Consumer;
+/** A type-specific persistent sorted map.
+	*
+	* <p>Instances of this class are immutable: methods such as {@link #with with()} and {@link #without without()}
+	* return a new version of the map, leaving this map untouched. Versions share all the structure
+	* they have in common: the map is a weight-balanced binary search tree, and an update copies just
+	* the nodes on the path from the root to the updated key, so its cost in time and space is logarithmic.
+	* As a result, a reference to a version is a consistent snapshot that can be published to other threads
+	* without copying and without synchronization (beyond a safe publication of the reference).
+	*
+	* <p>Each node records the size of its subtree. Thus, {@link #headMap headMap()}, {@link #tailMap tailMap()}
+	* and {@link #subMap subMap()} return in logarithmic time new persistent maps sharing structure with this map, rather than views.
+	*
+	* <p>Bulk modifications can be performed using a {@linkplain Transient transient version} of the map,
+	* returned by {@link #asTransient()}: a transient version modifies in place the nodes it has created,
+	* so a sequence of updates does not copy repeatedly the same paths. Calling {@link Transient#persistent()}
+	* returns a new persistent map and ends the life of the transient version.
+	*
+	* <p>The spliterators of the views of this class split by rank, so they are always sized.
+	* The iterators provided by the views of this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators} that do not support removal.
+	* Mutators inherited from the map interfaces throw an {@link UnsupportedOperationException}.
+	*/
+public class Byte2DoublePersistentTreeMap extends AbstractByte2DoubleSortedMap implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	private static final boolean ASSERTS = false;
+	/** A subtree is out of balance if its size exceeds this number times the size of its sibling (plus one). */
+	private static final int DELTA = 3;
+	/** The threshold, on the ratio between the sizes of the children of the heavier subtree, deciding between a single and a double rotation. */
+	private static final int RATIO = 2;
+	/** A node of the tree; it is also the entry returned by iterators on the entry set. */
+	protected static final class Node extends AbstractByte2DoubleMap.BasicEntry {
+	 /** The left and right subtree. */
+	 Node left, right;
+	 /** The number of entries in the subtree rooted at this node. */
+	 int size;
+	 /** The transient version that created this node and can thus modify it, or {@code null}. */
+	 Object owner;
+	 Node(final byte key, final double value, final Object owner) {
+	  super(key, value);
+	  this.owner = owner;
+	 }
+	}
+	/** The root of the tree, or {@code null} if the map is empty. */
+	protected transient Node root;
+	/** This map's comparator, as provided in the constructor. */
+	protected final Comparator<? super Byte> storedComparator;
+	/** This map's actual comparator; it may differ from {@link #storedComparator} because it is
+		always a type-specific comparator, so it could be derived from the former by wrapping. */
+	protected transient ByteComparator actualComparator;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Byte2DoubleMap.Entry > entries;
+	/** Cached set of keys. */
+	protected transient ByteSortedSet keys;
+	/** Cached collection of values. */
+	protected transient DoubleCollection values;
+	/** Creates a new empty persistent map.
+	 */
+	public Byte2DoublePersistentTreeMap() {
+	 this((Comparator<? super Byte>)null);
+	}
+	/** Creates a new empty persistent map with the given comparator.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 */
+	public Byte2DoublePersistentTreeMap(final Comparator<? super Byte> c) {
+	 storedComparator = c;
+	 setActualComparator();
+	}
+	/** Creates a new persistent map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new persistent map.
+	 */
+	public Byte2DoublePersistentTreeMap(final Map<? extends Byte, ? extends Double> m) {
+	 this();
+	 final Transient t = asTransient();
+	 t.putAll(m);
+	 root = t.persistent().root;
+	}
+	/** Creates a new persistent map copying a given sorted map (and its {@link Comparator}).
+	 *
+	 * <p>This constructor takes time linear in the size of {@code m}.
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new persistent map.
+	 */
+	public Byte2DoublePersistentTreeMap(final SortedMap<Byte,Double> m) {
+	 this(m.comparator());
+	 root = buildTree(m.entrySet().iterator(), m.size());
+	}
+	/** Creates a new persistent map copying a given type-specific map.
+	 *
+	 * @param m a type-specific map to be copied into the new persistent map.
+	 */
+	public Byte2DoublePersistentTreeMap(final Byte2DoubleMap m) {
+	 this();
+	 final Transient t = asTransient();
+	 t.putAll(m);
+	 root = t.persistent().root;
+	}
+	/** Creates a new persistent map copying a given type-specific sorted map (and its {@link Comparator}).
+	 *
+	 * <p>This constructor takes time linear in the size of {@code m}.
+	 *
+	 * @param m a type-specific sorted map to be copied into the new persistent map.
+	 */
+	public Byte2DoublePersistentTreeMap(final Byte2DoubleSortedMap m) {
+	 this(m.comparator());
+	 root = buildTree(m.byte2DoubleEntrySet().iterator(), m.size());
+	}
+	/** Creates a new persistent map using the elements of two parallel arrays and the given comparator.
+	 *
+	 * @param k the array of keys of the new persistent map.
+	 * @param v the array of corresponding values in the new persistent map.
+	 * @param c a (possibly type-specific) comparator.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2DoublePersistentTreeMap(final byte[] k, final double v[], final Comparator<? super Byte> c) {
+	 this(c);
+	 if (k.length != v.length) throw new IllegalArgumentException("The key array and the value array have different lengths (" + k.length + " and " + v.length + ")");
+	 final Object owner = new Object();
+	 for(int i = 0; i < k.length; i++) root = insert(root, k[i], v[i], owner);
+	 root = freeze(root, owner);
+	}
+	/** Creates a new persistent map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new persistent map.
+	 * @param v the array of corresponding values in the new persistent map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths.
+	 */
+	public Byte2DoublePersistentTreeMap(final byte[] k, final double v[]) {
+	 this(k, v, null);
+	}
+	/** Creates a new persistent map whose keys are returned by a given iterator in increasing order, all mapped to the null value.
+	 *
+	 * <p>This constructor is used by persistent tree sets, and takes linear time.
+	 *
+	 * @param c a (possibly type-specific) comparator.
+	 * @param i an iterator returning keys in increasing order.
+	 * @param n the number of keys to read from {@code i}.
+	 */
+	Byte2DoublePersistentTreeMap(final Comparator<? super Byte> c, final ByteIterator i, final int n) {
+	 this(c);
+	 root = buildKeyTree(i, n);
+	}
+	/** Returns a new version of this map with a given tree, sharing comparators and default return value.
+	 *
+	 * @param tree the tree of the new version.
+	 * @return this map, if {@code tree} is its tree; otherwise, a new map with the given tree.
+	 */
+	private Byte2DoublePersistentTreeMap derive(final Node tree) {
+	 if (tree == root) return this;
+	 final Byte2DoublePersistentTreeMap m = new Byte2DoublePersistentTreeMap (storedComparator);
+	 m.root = tree;
+	 m.defRetValue = defRetValue;
+	 if (ASSERTS) m.checkTree();
+	 return m;
+	}
+	/** Generates the comparator that will be actually used.
+	 *
+	 * <p>When a given {@link Comparator} is specified and stored in {@link
+	 * #storedComparator}, we must check whether it is type-specific.  If it is
+	 * so, we can used directly, and we store it in {@link #actualComparator}. Otherwise,
+	 * we adapt it using a helper static method.
+	 */
+	private void setActualComparator() {
+	 actualComparator = ByteComparators.asByteComparator(storedComparator);
+	}
+	/** Compares two keys in the right way.
+	 *
+	 * <p>This method uses the {@link #actualComparator} if it is non-{@code null}.
+	 * Otherwise, it resorts to primitive type comparisons or to {@link Comparable#compareTo(Object) compareTo()}.
+	 *
+	 * @param k1 the first key.
+	 * @param k2 the second key.
+	 * @return a number smaller than, equal to or greater than 0, as usual
+	 * (i.e., when k1 &lt; k2, k1 = k2 or k1 &gt; k2, respectively).
+	 */
+
+	final int compare(final byte k1, final byte k2) {
+	 return actualComparator == null ? ( Byte.compare((k1),(k2)) ) : actualComparator.compare(k1, k2);
+	}
+	private static int size(final Node n) {
+	 return n == null ? 0 : n.size;
+	}
+	/** Returns a node with the key and value of a given node and given subtrees.
+	 *
+	 * <p>If the given node has been created by the given owner (which must be non-{@code null}), it is modified
+	 * in place; otherwise, a new node, created by the given owner, is returned. Note that the key and
+	 * the value of {@code n} are read before the subtrees are set, so {@code l} and {@code r} may
+	 * be computed from {@code n}.
+	 *
+	 * @param n a node.
+	 * @param l the new left subtree.
+	 * @param r the new right subtree.
+	 * @param owner the transient version performing the update, or {@code null}.
+	 * @return a node with the key and value of {@code n} and subtrees {@code l} and {@code r}.
+	 */
+	private static Node node(final Node n, final Node l, final Node r, final Object owner) {
+	 final Node t = owner != null && n.owner == owner ? n : new Node (n.key, n.value, owner);
+	 t.left = l;
+	 t.right = r;
+	 t.size = size(l) + size(r) + 1;
+	 return t;
+	}
+	/** Returns a balanced tree with the key and value of a given node and given subtrees, which must
+	 * be at most slightly out of balance (e.g., because of a single insertion or deletion).
+	 *
+	 * @param p a node.
+	 * @param l the new left subtree.
+	 * @param r the new right subtree.
+	 * @param owner the transient version performing the update, or {@code null}.
+	 * @return a balanced tree containing {@code l}, the entry of {@code p} and {@code r}.
+	 */
+	private static Node balance(final Node p, final Node l, final Node r, final Object owner) {
+	 final int sl = size(l), sr = size(r);
+	 if (sl + sr >= 2) {
+	  if (sr > DELTA * sl) {
+	   final Node rl = r.left, rr = r.right;
+	   if (size(rl) < RATIO * size(rr)) return node(r, node(p, l, rl, owner), rr, owner);
+	   return node(rl, node(p, l, rl.left, owner), node(r, rl.right, rr, owner), owner);
+	  }
+	  if (sl > DELTA * sr) {
+	   final Node ll = l.left, lr = l.right;
+	   if (size(lr) < RATIO * size(ll)) return node(l, ll, node(p, lr, r, owner), owner);
+	   return node(lr, node(l, ll, lr.left, owner), node(p, lr.right, r, owner), owner);
+	  }
+	 }
+	 return node(p, l, r, owner);
+	}
+	/** Returns the node with a given key, or {@code null}. */
+	final Node findKey(final byte k) {
+	 Node n = root;
+	 int cmp;
+	 while (n != null && (cmp = compare(k, n.key)) != 0) n = cmp < 0 ? n.left : n.right;
+	 return n;
+	}
+	/** Returns a tree with a given key mapped to a given value.
+	 *
+	 * @param n a tree.
+	 * @param k a key.
+	 * @param v a value.
+	 * @param owner the transient version performing the update, or {@code null}.
+	 * @return a tree with the same entries as {@code n}, except for {@code k} being mapped to {@code v}.
+	 */
+	final Node insert(final Node n, final byte k, final double v, final Object owner) {
+	 if (n == null) {
+	  final Node t = new Node (k, v, owner);
+	  t.size = 1;
+	  return t;
+	 }
+	 final int cmp = compare(k, n.key);
+	 if (cmp < 0) return balance(n, insert(n.left, k, v, owner), n.right, owner);
+	 if (cmp > 0) return balance(n, n.left, insert(n.right, k, v, owner), owner);
+	 final Node t = node(n, n.left, n.right, owner);
+	 t.value = v;
+	 return t;
+	}
+	/** Returns a tree without a given key, which must be present.
+	 *
+	 * @param n a tree containing {@code k}.
+	 * @param k a key.
+	 * @param owner the transient version performing the update, or {@code null}.
+	 * @return a tree with the same entries as {@code n}, except for {@code k}.
+	 */
+	final Node delete(final Node n, final byte k, final Object owner) {
+	 final int cmp = compare(k, n.key);
+	 if (cmp < 0) return balance(n, delete(n.left, k, owner), n.right, owner);
+	 if (cmp > 0) return balance(n, n.left, delete(n.right, k, owner), owner);
+	 final Node l = n.left, r = n.right;
+	 if (l == null) return r;
+	 if (r == null) return l;
+	 // We replace the deleted node with the extremal node of the larger subtree
+	 if (l.size > r.size) {
+	  Node m = l;
+	  while (m.right != null) m = m.right;
+	  return balance(m, deleteMax(l, owner), r, owner);
+	 }
+	 Node m = r;
+	 while (m.left != null) m = m.left;
+	 return balance(m, l, deleteMin(r, owner), owner);
+	}
+	private static Node deleteMin(final Node n, final Object owner) {
+	 if (n.left == null) return n.right;
+	 return balance(n, deleteMin(n.left, owner), n.right, owner);
+	}
+	private static Node deleteMax(final Node n, final Object owner) {
+	 if (n.right == null) return n.left;
+	 return balance(n, n.left, deleteMax(n.right, owner), owner);
+	}
+	/** Returns a balanced tree containing the entries of two trees and the entry of a node,
+	 * assuming that the keys of the first tree are smaller than the key of the node, which is
+	 * in turn smaller than the keys of the second tree.
+	 *
+	 * <p>This method creates new nodes and never modifies existing ones.
+	 *
+	 * @param p a node.
+	 * @param l a tree.
+	 * @param r a tree.
+	 * @return a balanced tree containing the entries of {@code l}, the entry of {@code p} and the entries of {@code r}.
+	 */
+	private static Node link(final Node p, final Node l, final Node r) {
+	 if (l == null) return insertMin(p, r);
+	 if (r == null) return insertMax(p, l);
+	 if (DELTA * l.size < r.size) return balance(r, link(p, l, r.left), r.right, null);
+	 if (DELTA * r.size < l.size) return balance(l, l.left, link(p, l.right, r), null);
+	 return node(p, l, r, null);
+	}
+	private static Node insertMin(final Node p, final Node n) {
+	 if (n == null) return node(p, null, null, null);
+	 return balance(n, insertMin(p, n.left), n.right, null);
+	}
+	private static Node insertMax(final Node p, final Node n) {
+	 if (n == null) return node(p, null, null, null);
+	 return balance(n, n.left, insertMax(p, n.right), null);
+	}
+	/** Returns a tree containing the entries of a given tree whose key is smaller than a given key.
+	 *
+	 * @param n a tree.
+	 * @param k a key.
+	 * @return a tree containing the entries of {@code n} with keys smaller than {@code k}, sharing structure with {@code n}.
+	 */
+	private Node headTree(final Node n, final byte k) {
+	 if (n == null) return null;
+	 if (compare(k, n.key) <= 0) return headTree(n.left, k);
+	 final Node r = headTree(n.right, k);
+	 return r == n.right ? n : link(n, n.left, r);
+	}
+	/** Returns a tree containing the entries of a given tree whose key is greater than or equal to a given key.
+	 *
+	 * @param n a tree.
+	 * @param k a key.
+	 * @return a tree containing the entries of {@code n} with keys greater than or equal to {@code k}, sharing structure with {@code n}.
+	 */
+	private Node tailTree(final Node n, final byte k) {
+	 if (n == null) return null;
+	 if (compare(n.key, k) < 0) return tailTree(n.right, k);
+	 final Node l = tailTree(n.left, k);
+	 return l == n.left ? n : link(n, l, n.right);
+	}
+	/** Builds a perfectly balanced tree from a sorted sequence of entries.
+	 *
+	 * @param i an iterator returning entries in increasing key order.
+	 * @param n the number of entries to read from {@code i}.
+	 * @return a perfectly balanced tree containing the next {@code n} entries returned by {@code i}.
+	 */
+	private static Node buildTree(final java.util.Iterator<? extends Map.Entry<Byte, Double>> i, final int n) {
+	 if (n == 0) return null;
+	 final int leftSize = (n - 1) >>> 1;
+	 final Node left = buildTree(i, leftSize);
+	 final Map.Entry<Byte, Double> e = i.next();
+	 final Node t;
+	 if (e instanceof Byte2DoubleMap.Entry) {
+	 
+	  final Byte2DoubleMap.Entry f = (Byte2DoubleMap.Entry )e;
+	  t = new Node (f.getByteKey(), f.getDoubleValue(), null);
+	 }
+	 else t = new Node ((e.getKey()).byteValue(), (e.getValue()).doubleValue(), null);
+	 t.left = left;
+	 t.right = buildTree(i, n - 1 - leftSize);
+	 t.size = n;
+	 return t;
+	}
+	/** Builds a perfectly balanced tree from a sorted sequence of keys, mapping all keys to the null value.
+	 *
+	 * @param i an iterator returning keys in increasing order.
+	 * @param n the number of keys to read from {@code i}.
+	 * @return a perfectly balanced tree containing the next {@code n} keys returned by {@code i}.
+	 */
+	private static Node buildKeyTree(final ByteIterator i, final int n) {
+	 if (n == 0) return null;
+	 final int leftSize = (n - 1) >>> 1;
+	 final Node left = buildKeyTree(i, leftSize);
+	 final Node t = new Node (i.nextByte(), (0), null);
+	 t.left = left;
+	 t.right = buildKeyTree(i, n - 1 - leftSize);
+	 t.size = n;
+	 return t;
+	}
+	/** Clears the owner of the nodes created by a given owner, so that they can no longer be modified.
+	 *
+	 * <p>This method visits just the part of the tree created by {@code owner}: since a node created by
+	 * a transient version may only have been reached by copying the path leading to it,
+	 * all ancestors of such a node have been created by the same transient version.
+	 *
+	 * @param n a tree.
+	 * @param owner a transient version.
+	 * @return {@code n}.
+	 */
+	private static Node freeze(final Node n, final Object owner) {
+	 if (n != null && n.owner == owner) {
+	  n.owner = null;
+	  freeze(n.left, owner);
+	  freeze(n.right, owner);
+	 }
+	 return n;
+	}
+	/** Returns a new version of this map in which a given key is mapped to a given value.
+	 *
+	 * @param k a key.
+	 * @param v a value.
+	 * @return a map sharing structure with this map, in which {@code k} is mapped to {@code v}, and
+	 * all other keys are mapped as in this map.
+	 */
+	public Byte2DoublePersistentTreeMap with(final byte k, final double v) {
+	 return derive(insert(root, k, v, null));
+	}
+	/** Returns a new version of this map in which a given key is not mapped.
+	 *
+	 * @param k a key.
+	 * @return this map, if {@code k} is not a key of this map; otherwise, a map sharing structure with this map,
+	 * with the same entries but the one with key {@code k}.
+	 */
+	public Byte2DoublePersistentTreeMap without(final byte k) {
+	 return findKey(k) == null ? this : derive(delete(root, k, null));
+	}
+	/** Returns a transient version of this map.
+	 *
+	 * <p>The returned object can be used to perform efficiently many modifications,
+	 * starting from the entries of this map, which is not affected by them.
+	 *
+	 * @return a transient version of this map.
+	 */
+	public Transient asTransient() {
+	 return new Transient (this);
+	}
+	/** A transient version of a persistent map.
+	 *
+	 * <p>Instances of this class can be modified in place, and updates modify in place the nodes created by
+	 * the instance itself, copying only nodes shared with persistent versions. Once all modifications
+	 * have been performed, {@link #persistent()} returns a persistent map, and any further
+	 * access to the instance will cause an {@link IllegalStateException}.
+	 *
+	 * <p>Instances of this class are not thread safe.
+	 */
+	public static final class Transient {
+	 /** The persistent map from which this instance was derived. */
+	 private final Byte2DoublePersistentTreeMap map;
+	 /** The current tree. */
+	 private Node root;
+	 /** The owner token of the nodes created by this instance, or {@code null} after a call to {@link #persistent()}. */
+	 private Object owner;
+	 private Transient(final Byte2DoublePersistentTreeMap map) {
+	  this.map = map;
+	  this.root = map.root;
+	  this.owner = new Object();
+	 }
+	 private void ensureEditable() {
+	  if (owner == null) throw new IllegalStateException("This transient map has already been made persistent");
+	 }
+	 /** Adds a pair to this transient map.
+		 *
+		 * @param k the key.
+		 * @param v the value.
+		 * @return the old value, or the default return value of the originating map if no value was present for the given key.
+		 */
+	 public double put(final byte k, final double v) {
+	  ensureEditable();
+	  Node n = root;
+	  int cmp;
+	  while (n != null && (cmp = map.compare(k, n.key)) != 0) n = cmp < 0 ? n.left : n.right;
+	  if (n == null) {
+	   root = map.insert(root, k, v, owner);
+	   return map.defRetValue;
+	  }
+	  final double oldValue = n.value;
+	  if (n.owner == owner) n.value = v;
+	  else root = map.insert(root, k, v, owner);
+	  return oldValue;
+	 }
+	 /** Adds all pairs of a map to this transient map.
+		 *
+		 * @param m a map.
+		 */
+	 public void putAll(final Map<? extends Byte, ? extends Double> m) {
+	  if (m instanceof Byte2DoubleMap) {
+	  
+	   final ObjectIterator<Byte2DoubleMap.Entry > i = Byte2DoubleMaps.fastIterator((Byte2DoubleMap )m);
+	   while (i.hasNext()) {
+	    final Byte2DoubleMap.Entry e = i.next();
+	    put(e.getByteKey(), e.getDoubleValue());
+	   }
+	  }
+	  else for (final Map.Entry<? extends Byte, ? extends Double> e : m.entrySet()) put((e.getKey()).byteValue(), (e.getValue()).doubleValue());
+	 }
+	 /** Removes a key from this transient map.
+		 *
+		 * @param k the key.
+		 * @return the old value, or the default return value of the originating map if no value was present for the given key.
+		 */
+	 public double remove(final byte k) {
+	  ensureEditable();
+	  Node n = root;
+	  int cmp;
+	  while (n != null && (cmp = map.compare(k, n.key)) != 0) n = cmp < 0 ? n.left : n.right;
+	  if (n == null) return map.defRetValue;
+	  final double oldValue = n.value;
+	  root = map.delete(root, k, owner);
+	  return oldValue;
+	 }
+	 /** Returns the value to which a given key is mapped.
+		 *
+		 * @param k the key.
+		 * @return the corresponding value, or the default return value of the originating map if no value was present for the given key.
+		 */
+	 public double get(final byte k) {
+	  ensureEditable();
+	  Node n = root;
+	  int cmp;
+	  while (n != null && (cmp = map.compare(k, n.key)) != 0) n = cmp < 0 ? n.left : n.right;
+	  return n == null ? map.defRetValue : n.value;
+	 }
+	 /** Returns true if this transient map contains a mapping for a given key.
+		 *
+		 * @param k the key.
+		 * @return true if this transient map contains a mapping for {@code k}.
+		 */
+	 public boolean containsKey(final byte k) {
+	  ensureEditable();
+	  Node n = root;
+	  int cmp;
+	  while (n != null && (cmp = map.compare(k, n.key)) != 0) n = cmp < 0 ? n.left : n.right;
+	  return n != null;
+	 }
+	 /** Returns the number of entries in this transient map.
+		 *
+		 * @return the number of entries in this transient map.
+		 */
+	 public int size() {
+	  ensureEditable();
+	  return Byte2DoublePersistentTreeMap.size(root);
+	 }
+	 /** Returns a persistent map with the entries of this transient map, and ends the life of this transient map.
+		 *
+		 * @return a persistent map with the entries of this transient map.
+		 * @throws IllegalStateException if this method has already been called.
+		 */
+	 public Byte2DoublePersistentTreeMap persistent() {
+	  ensureEditable();
+	  root = freeze(root, owner);
+	  owner = null;
+	  return map.derive(root);
+	 }
+	}
+
+	@Override
+	public boolean containsKey(final byte k) {
+	
+	 return findKey( k) != null;
+	}
+
+	@Override
+	public double get(final byte k) {
+	 final Node n = findKey( k);
+	 return n == null ? defRetValue : n.value;
+	}
+	@Override
+	public boolean containsValue(final double v) {
+	 final DoubleIterator i = values().iterator();
+	 while (i.hasNext()) if (( Double.doubleToLongBits(i.nextDouble()) == Double.doubleToLongBits(v) )) return true;
+	 return false;
+	}
+	@Override
+	public int size() {
+	 return size(root);
+	}
+	@Override
+	public boolean isEmpty() {
+	 return root == null;
+	}
+	@Override
+	public byte firstByteKey() {
+	 if (root == null) throw new NoSuchElementException();
+	 Node n = root;
+	 while (n.left != null) n = n.left;
+	 return n.key;
+	}
+	@Override
+	public byte lastByteKey() {
+	 if (root == null) throw new NoSuchElementException();
+	 Node n = root;
+	 while (n.right != null) n = n.right;
+	 return n.key;
+	}
+	/** An abstract iterator on the whole range.
+	 *
+	 * <p>The iterator keeps track of the path from the root to the node of the next entry, which
+	 * is empty if there is no next entry, and of the rank of the next entry.
+	 */
+	private class TreeIterator {
+	 /** The path from the root to the node of the next entry; its first {@link #depth} elements are meaningful. */
+	
+	 Node [] path = new Node[16];
+	 /** The length of {@link #path}, or zero if there is no next entry. */
+	 int depth;
+	 /** The rank of the next entry. */
+	 int index;
+	 TreeIterator() {
+	  for (Node n = root; n != null; n = n.left) push(n);
+	 }
+	 /** Positions this iterator so that its next entry has a given rank.
+		 *
+		 * @param rank a rank between 0 and the size of this map (inclusive).
+		 */
+	 final void moveTo(int rank) {
+	  depth = 0;
+	  index = rank;
+	  if (rank >= size()) return;
+	  Node n = root;
+	  for(;;) {
+	   push(n);
+	   final int s = size(n.left);
+	   if (rank == s) break;
+	   if (rank < s) n = n.left;
+	   else {
+	    rank -= s + 1;
+	    n = n.right;
+	   }
+	  }
+	 }
+	 /** Creates a new iterator whose next entry is the first whose key is greater than a given key.
+		 *
+		 * @param k a key.
+		 */
+	 TreeIterator(final byte k) {
+	  int d = 0, rank = 0, r = 0;
+	  for (Node n = root; n != null;) {
+	   push(n);
+	   if (compare(k, n.key) < 0) {
+	    d = depth;
+	    r = rank + size(n.left);
+	    n = n.left;
+	   }
+	   else {
+	    rank += size(n.left) + 1;
+	    n = n.right;
+	   }
+	  }
+	  depth = d;
+	  index = d == 0 ? rank : r;
+	 }
+	 private void push(final Node n) {
+	  if (depth == path.length) path = Arrays.copyOf(path, depth * 2);
+	  path[depth++] = n;
+	 }
+	 public boolean hasNext() { return depth != 0; }
+	 public boolean hasPrevious() { return index != 0; }
+	 /** Moves the path to the successor of the last node of the path. */
+	 private void advance() {
+	  Node n = path[depth - 1];
+	  if (n.right != null) {
+	   push(n = n.right);
+	   while (n.left != null) push(n = n.left);
+	  }
+	  else {
+	   Node c;
+	   do c = path[--depth]; while (depth != 0 && path[depth - 1].right == c);
+	  }
+	 }
+	 /** Moves the path to the predecessor of the last node of the path, or to the last node if the path is empty. */
+	 private void retreat() {
+	  if (depth == 0) {
+	   for (Node n = root; n != null; n = n.right) push(n);
+	   return;
+	  }
+	  Node n = path[depth - 1];
+	  if (n.left != null) {
+	   push(n = n.left);
+	   while (n.right != null) push(n = n.right);
+	  }
+	  else {
+	   Node c;
+	   do c = path[--depth]; while (depth != 0 && path[depth - 1].left == c);
+	  }
+	 }
+	 Node nextNode() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  final Node n = path[depth - 1];
+	  advance();
+	  index++;
+	  return n;
+	 }
+	 Node previousNode() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  retreat();
+	  index--;
+	  return path[depth - 1];
+	 }
+	 public int skip(final int n) {
+	  int i = n;
+	  while(i-- != 0 && hasNext()) nextNode();
+	  return n - i - 1;
+	 }
+	 public int back(final int n) {
+	  int i = n;
+	  while(i-- != 0 && hasPrevious()) previousNode();
+	  return n - i - 1;
+	 }
+	}
+	/** An iterator on the entries of the whole range. */
+	private class EntryIterator extends TreeIterator implements ObjectBidirectionalIterator<Byte2DoubleMap.Entry > {
+	 EntryIterator() {}
+	 EntryIterator(final byte k) {
+	  super(k);
+	 }
+	 @Override
+	 public Byte2DoubleMap.Entry next() { return nextNode(); }
+	 @Override
+	 public Byte2DoubleMap.Entry previous() { return previousNode(); }
+	}
+	/** An abstract spliterator on a range of ranks.
+	 *
+	 * <p>Splitting halves the range of ranks, and the node of the first entry is located lazily.
+	 */
+	private abstract class TreeSpliterator<ConsumerType, SplitType extends TreeSpliterator<ConsumerType, SplitType>> {
+	 /** The rank of the next entry. */
+	 int pos;
+	 /** The rank of the first entry that must not be returned. */
+	 final int max;
+	 /** An iterator positioned at {@link #pos}, or {@code null}. */
+	 TreeIterator i;
+	 TreeSpliterator(final int pos, final int max) {
+	  this.pos = pos;
+	  this.max = max;
+	 }
+	 abstract void acceptOnNode(final ConsumerType action, final Node n);
+	 abstract SplitType makeForSplit(int pos, int max);
+	 public boolean tryAdvance(final ConsumerType action) {
+	  if (pos >= max) return false;
+	  if (i == null) (i = new TreeIterator()).moveTo(pos);
+	  pos++;
+	  acceptOnNode(action, i.nextNode());
+	  return true;
+	 }
+	 public void forEachRemaining(final ConsumerType action) {
+	  if (pos >= max) return;
+	  if (i == null) (i = new TreeIterator()).moveTo(pos);
+	  for(; pos < max; pos++) acceptOnNode(action, i.nextNode());
+	 }
+	 public long estimateSize() {
+	  return max - pos;
+	 }
+	 public SplitType trySplit() {
+	  final int len = max - pos;
+	  if (len < 2) return null;
+	  final int mid = pos + (len >>> 1);
+	  final SplitType split = makeForSplit(pos, mid);
+	  split.i = i;
+	  i = null;
+	  pos = mid;
+	  return split;
+	 }
+	}
+	private final class EntrySpliterator extends TreeSpliterator<Consumer<? super Byte2DoubleMap.Entry >, EntrySpliterator> implements ObjectSpliterator<Byte2DoubleMap.Entry > {
+	 private static final int CHARACTERISTICS = ObjectSpliterators.SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 EntrySpliterator(final int pos, final int max) {
+	  super(pos, max);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return CHARACTERISTICS;
+	 }
+	 @Override
+	 final void acceptOnNode(final Consumer<? super Byte2DoubleMap.Entry > action, final Node n) {
+	  action.accept(n);
+	 }
+	 @Override
+	 final EntrySpliterator makeForSplit(final int pos, final int max) {
+	  return new EntrySpliterator(pos, max);
+	 }
+	}
+	@Override
+
+	public ObjectSortedSet<Byte2DoubleMap.Entry > byte2DoubleEntrySet() {
+	 if (entries == null) entries = new AbstractObjectSortedSet<Byte2DoubleMap.Entry >() {
+	   final Comparator<? super Byte2DoubleMap.Entry > comparator = (Byte2DoublePersistentTreeMap.this.actualComparator == null ?
+	     (Comparator<Byte2DoubleMap.Entry >) (x, y) -> ( Byte.compare((x.getByteKey()),(y.getByteKey())) ) :
+	     (Comparator<Byte2DoubleMap.Entry >) (x, y) -> Byte2DoublePersistentTreeMap.this.actualComparator.compare(x.getByteKey(), y.getByteKey())
+	   );
+	   @Override
+	   public Comparator<? super Byte2DoubleMap.Entry > comparator() { return comparator; }
+	   @Override
+	   public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator() { return new EntryIterator(); }
+	   @Override
+	   public ObjectBidirectionalIterator<Byte2DoubleMap.Entry > iterator(final Byte2DoubleMap.Entry from) { return new EntryIterator(from.getByteKey()); }
+	   @Override
+	   public ObjectSpliterator<Byte2DoubleMap.Entry > spliterator() { return new EntrySpliterator(0, size()); }
+	   @Override
+	  
+	   public boolean contains(final Object o) {
+	    if (o == null || !(o instanceof Map.Entry)) return false;
+	    final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	    if (e.getKey() == null) return false;
+	    if (! (e.getKey() instanceof Byte)) return false;
+	    if (e.getValue() == null || ! (e.getValue() instanceof Double)) return false;
+	    final Node n = findKey(((Byte)( e.getKey())).byteValue());
+	    return n != null && ( Double.doubleToLongBits(n.value) == Double.doubleToLongBits(((Double)(e.getValue())).doubleValue()) );
+	   }
+	   @Override
+	   public int size() { return Byte2DoublePersistentTreeMap.this.size(); }
+	   @Override
+	   public Byte2DoubleMap.Entry first() {
+	    if (root == null) throw new NoSuchElementException();
+	    return findKey(firstByteKey());
+	   }
+	   @Override
+	   public Byte2DoubleMap.Entry last() {
+	    if (root == null) throw new NoSuchElementException();
+	    return findKey(lastByteKey());
+	   }
+	   @Override
+	   public ObjectSortedSet<Byte2DoubleMap.Entry > subSet(Byte2DoubleMap.Entry from, Byte2DoubleMap.Entry to) { return subMap(from.getByteKey(), to.getByteKey()).byte2DoubleEntrySet(); }
+	   @Override
+	   public ObjectSortedSet<Byte2DoubleMap.Entry > headSet(Byte2DoubleMap.Entry to) { return headMap(to.getByteKey()).byte2DoubleEntrySet(); }
+	   @Override
+	   public ObjectSortedSet<Byte2DoubleMap.Entry > tailSet(Byte2DoubleMap.Entry from) { return tailMap(from.getByteKey()).byte2DoubleEntrySet(); }
+	  };
+	 return entries;
+	}
+	/** An iterator on the keys of the whole range. */
+	private final class KeyIterator extends TreeIterator implements ByteBidirectionalIterator {
+	 public KeyIterator() {}
+	 public KeyIterator(final byte k) { super(k); }
+	 @Override
+	 public byte nextByte() { return nextNode().key; }
+	 @Override
+	 public byte previousByte() { return previousNode().key; }
+	};
+	private final class KeySpliterator extends TreeSpliterator<ByteConsumer , KeySpliterator> implements ByteSpliterator {
+	 private static final int CHARACTERISTICS = ByteSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 KeySpliterator(final int pos, final int max) {
+	  super(pos, max);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return CHARACTERISTICS;
+	 }
+	 @Override
+	 public ByteComparator getComparator() {
+	  return actualComparator;
+	 }
+	 @Override
+	 final void acceptOnNode(final ByteConsumer action, final Node n) {
+	  action.accept(n.key);
+	 }
+	 @Override
+	 final KeySpliterator makeForSplit(final int pos, final int max) {
+	  return new KeySpliterator(pos, max);
+	 }
+	}
+	/** A keyset implementation using a more direct implementation for iterators. */
+	private class KeySet extends AbstractByte2DoubleSortedMap .KeySet {
+	 @Override
+	 public ByteBidirectionalIterator iterator() { return new KeyIterator(); }
+	 @Override
+	 public ByteBidirectionalIterator iterator(final byte from) { return new KeyIterator(from); }
+	 @Override
+	 public ByteSpliterator spliterator() { return new KeySpliterator(0, size()); }
+	}
+	/** Returns a type-specific sorted set view of the keys contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#keySet()}, you can
+	 * safely cast the set returned by this call to a type-specific sorted
+	 * set interface.
+	 *
+	 * @return a type-specific sorted set view of the keys contained in this map.
+	 */
+	@Override
+	public ByteSortedSet keySet() {
+	 if (keys == null) keys = new KeySet();
+	 return keys;
+	}
+	/** An iterator on the values of the whole range. */
+	private final class ValueIterator extends TreeIterator implements DoubleIterator {
+	 @Override
+	 public double nextDouble() { return nextNode().value; }
+	};
+	private final class ValueSpliterator extends TreeSpliterator<java.util.function.DoubleConsumer, ValueSpliterator> implements DoubleSpliterator {
+	 private static final int CHARACTERISTICS = DoubleSpliterators.COLLECTION_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.ORDERED | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 ValueSpliterator(final int pos, final int max) {
+	  super(pos, max);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return CHARACTERISTICS;
+	 }
+	 @Override
+	 final void acceptOnNode(final java.util.function.DoubleConsumer action, final Node n) {
+	  action.accept(n.value);
+	 }
+	 @Override
+	 final ValueSpliterator makeForSplit(final int pos, final int max) {
+	  return new ValueSpliterator(pos, max);
+	 }
+	}
+	/** Returns a type-specific collection view of the values contained in this map.
+	 *
+	 * <p>In addition to the semantics of {@link java.util.Map#values()}, you can
+	 * safely cast the collection returned by this call to a type-specific collection
+	 * interface.
+	 *
+	 * @return a type-specific collection view of the values contained in this map.
+	 */
+	@Override
+	public DoubleCollection values() {
+	 if (values == null) values = new AbstractDoubleCollection () {
+	   @Override
+	   public DoubleIterator iterator() { return new ValueIterator(); }
+	   @Override
+	   public DoubleSpliterator spliterator() { return new ValueSpliterator(0, size()); }
+	   @Override
+	   public boolean contains(final double k) { return containsValue(k); }
+	   @Override
+	   public int size() { return Byte2DoublePersistentTreeMap.this.size(); }
+	  };
+	 return values;
+	}
+	@Override
+	public ByteComparator comparator() { return actualComparator; }
+	/** Returns a persistent map containing the entries of this map with keys smaller than a given key.
+	 *
+	 * <p>The returned map is not a view, but rather a persistent map sharing structure with this map.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param to the upper bound (exclusive) of the keys of the returned map.
+	 * @return a persistent map containing the entries of this map with keys smaller than {@code to}.
+	 */
+	@Override
+	public Byte2DoublePersistentTreeMap headMap(final byte to) { return derive(headTree(root, to)); }
+	/** Returns a persistent map containing the entries of this map with keys greater than or equal to a given key.
+	 *
+	 * <p>The returned map is not a view, but rather a persistent map sharing structure with this map.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param from the lower bound (inclusive) of the keys of the returned map.
+	 * @return a persistent map containing the entries of this map with keys greater than or equal to {@code from}.
+	 */
+	@Override
+	public Byte2DoublePersistentTreeMap tailMap(final byte from) { return derive(tailTree(root, from)); }
+	/** Returns a persistent map containing the entries of this map with keys in a given range.
+	 *
+	 * <p>The returned map is not a view, but rather a persistent map sharing structure with this map.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param from the lower bound (inclusive) of the keys of the returned map.
+	 * @param to the upper bound (exclusive) of the keys of the returned map.
+	 * @return a persistent map containing the entries of this map with keys greater than or equal to {@code from} and smaller than {@code to}.
+	 * @throws IllegalArgumentException if {@code from} is greater than {@code to}.
+	 */
+	@Override
+	public Byte2DoublePersistentTreeMap subMap(final byte from, final byte to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	 return derive(headTree(tailTree(root, from), to));
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(size());
+	 for (final TreeIterator i = new TreeIterator(); i.hasNext();) {
+	  final Node n = i.nextNode();
+	  s.writeByte(n.key);
+	  s.writeDouble(n.value);
+	 }
+	}
+	/** Reads a perfectly balanced tree from a stream.
+	 *
+	 * @param s the stream.
+	 * @param n the number of entries to read.
+	 * @return a perfectly balanced tree containing the next {@code n} entries of the stream.
+	 */
+
+	private Node readTree(final java.io.ObjectInputStream s, final int n) throws java.io.IOException, ClassNotFoundException {
+	 if (n == 0) return null;
+	 final int leftSize = (n - 1) >>> 1;
+	 final Node left = readTree(s, leftSize);
+	 final Node t = new Node ( s.readByte(), s.readDouble(), null);
+	 t.left = left;
+	 t.right = readTree(s, n - 1 - leftSize);
+	 t.size = n;
+	 return t;
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 /* The storedComparator is now correctly set, but we must restore
+		   on-the-fly the actualComparator. */
+	 setActualComparator();
+	 root = readTree(s, s.readInt());
+	 if (ASSERTS) checkTree();
+	}
+	private void checkTree() {}
+}
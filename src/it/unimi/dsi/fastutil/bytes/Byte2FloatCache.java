@@ -0,0 +1,476 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.HashCommon;
+/** An abstract type-specific bounded-capacity cache.
+	*
+	* <p>Instances of this class are {@linkplain it.unimi.dsi.fastutil.Function functions}
+	* that never contain more entries than their {@linkplain #capacity() capacity}: when an insertion
+	* exceeds the capacity, an entry is evicted following the policy of the concrete implementation,
+	* and passed to the {@linkplain #evictionListener(EvictionListener) eviction listener}, if any.
+	* Concrete implementations are provided as nested classes: {@link LRU}, {@link SLRU}
+	* and {@link WindowTinyLFU}.
+	*
+	* <p>Caches are built on {@linkplain it.unimi.dsi.fastutil.ints.Int2IntLinkedOpenHashMap linked hash maps},
+	* which provide constant-time moves to the end of the iteration order and removal of the first
+	* entry; no object is allocated by lookups, and keys and values are never boxed.
+	*
+	* <p>Lookups by {@link #get(Object) get()} (and its type-specific versions) count as accesses
+	* and update the hit/miss statistics; {@link #containsKey(Object) containsKey()} does neither.
+	* A {@link #put(Object,Object) put()} on a key already in the cache counts as an access, but
+	* does not change the statistics.
+	*
+	* <p>This class is not synchronized.
+	*/
+public abstract class Byte2FloatCache extends AbstractByte2FloatFunction {
+	private static final long serialVersionUID = 0L;
+	/** A listener notified of evictions. */
+	@FunctionalInterface
+	public interface EvictionListener {
+	 /** Notifies the eviction of an entry.
+		 *
+		 * @param key the evicted key.
+		 * @param value the value associated with {@code key}.
+		 */
+	 void onEviction(byte key, float value);
+	}
+	/** The maximum number of entries in this cache. */
+	protected final int capacity;
+	/** The number of lookups that found their key. */
+	protected long hits;
+	/** The number of lookups that did not find their key. */
+	protected long misses;
+	/** The number of evicted entries. */
+	protected long evictions;
+	/** The eviction listener, or {@code null}. */
+	protected transient EvictionListener listener;
+	/** Creates a new cache.
+	 *
+	 * @param capacity the maximum number of entries in the cache.
+	 */
+	protected Byte2FloatCache(final int capacity) {
+	 if (capacity <= 0) throw new IllegalArgumentException("The capacity must be positive: " + capacity);
+	 this.capacity = capacity;
+	}
+	/** Returns the maximum number of entries in this cache.
+	 *
+	 * @return the maximum number of entries in this cache.
+	 */
+	public int capacity() {
+	 return capacity;
+	}
+	/** Returns the number of lookups that found their key.
+	 *
+	 * @return the number of hits since creation or since the last call to {@link #resetStatistics()}.
+	 */
+	public long hits() {
+	 return hits;
+	}
+	/** Returns the number of lookups that did not find their key.
+	 *
+	 * @return the number of misses since creation or since the last call to {@link #resetStatistics()}.
+	 */
+	public long misses() {
+	 return misses;
+	}
+	/** Returns the number of evicted entries.
+	 *
+	 * @return the number of evictions since creation or since the last call to {@link #resetStatistics()}.
+	 */
+	public long evictions() {
+	 return evictions;
+	}
+	/** Resets the hit, miss and eviction counters. */
+	public void resetStatistics() {
+	 hits = misses = evictions = 0;
+	}
+	/** Sets the eviction listener.
+	 *
+	 * @param listener a listener that will be notified of evictions, or {@code null}.
+	 */
+	public void evictionListener(final EvictionListener listener) {
+	 this.listener = listener;
+	}
+	/** Returns the eviction listener.
+	 *
+	 * @return the eviction listener, or {@code null}.
+	 */
+	public EvictionListener evictionListener() {
+	 return listener;
+	}
+	/** Records the eviction of an entry.
+	 *
+	 * @param k the evicted key.
+	 * @param v the evicted value.
+	 */
+	protected void evicted(final byte k, final float v) {
+	 evictions++;
+	 if (listener != null) listener.onEviction(k, v);
+	}
+	/** Evicts the first entry in iteration order of a segment.
+	 *
+	 * @param segment a nonempty segment.
+	 */
+	protected void evict(final Byte2FloatLinkedOpenHashMap segment) {
+	 final byte k = segment.firstByteKey();
+	 evicted(k, segment.removeFirstFloat());
+	}
+	/** Removes a key from a segment.
+	 *
+	 * @param segment a segment.
+	 * @param k a key.
+	 * @return the value associated with {@code k} in {@code segment}, or the {@linkplain #defaultReturnValue() default return value} of
+	 * this cache if {@code k} is not in {@code segment}.
+	 */
+	protected float removeFrom(final Byte2FloatLinkedOpenHashMap segment, final byte k) {
+	 final int size = segment.size();
+	 final float v = segment.remove(k);
+	 return segment.size() != size ? v : defRetValue;
+	}
+	/** A cache with least-recently-used eviction policy.
+	 *
+	 * <p>Entries are kept in a linked hash map in access order; when the capacity is exceeded,
+	 * the least recently used entry is evicted.
+	 */
+	public static class LRU extends Byte2FloatCache {
+	 private static final long serialVersionUID = 0L;
+	 /** The entries, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap map;
+	 /** Creates a new LRU cache.
+		 *
+		 * @param capacity the maximum number of entries in the cache.
+		 */
+	 public LRU(final int capacity) {
+	  super(capacity);
+	  map = new Byte2FloatLinkedOpenHashMap (capacity + 1);
+	 }
+	 @Override
+	
+	 public float get(final byte k) {
+	  final int pos = map.moveToLastIndex( k);
+	  if (pos < 0) {
+	   misses++;
+	   return defRetValue;
+	  }
+	  hits++;
+	  return map.value[pos];
+	 }
+	 @Override
+	 public float put(final byte k, final float v) {
+	  final int pos = map.moveToLastIndex(k);
+	  if (pos >= 0) {
+	   final float oldValue = map.value[pos];
+	   map.value[pos] = v;
+	   return oldValue;
+	  }
+	  map.put(k, v);
+	  if (map.size() > capacity) evict(map);
+	  return defRetValue;
+	 }
+	 @Override
+	 public float remove(final byte k) {
+	  return removeFrom(map, k);
+	 }
+	 @Override
+	 public boolean containsKey(final byte k) {
+	  return map.containsKey(k);
+	 }
+	 @Override
+	 public int size() {
+	  return map.size();
+	 }
+	 @Override
+	 public void clear() {
+	  map.clear();
+	 }
+	}
+	/** A cache with segmented least-recently-used eviction policy.
+	 *
+	 * <p>New entries enter a <em>probation</em> segment; entries that are accessed while in probation
+	 * are promoted to a <em>protected</em> segment, whose least recently used entries are demoted back to probation
+	 * when it overflows. When the capacity is exceeded, the least recently used entry in probation is evicted.
+	 * In this way, entries accessed just once cannot flush out entries accessed repeatedly.
+	 */
+	public static class SLRU extends Byte2FloatCache {
+	 private static final long serialVersionUID = 0L;
+	 /** The default fraction of the capacity reserved to the protected segment. */
+	 public static final float DEFAULT_PROTECTED_FRACTION = .8f;
+	 /** The maximum number of entries in {@link #protectedSegment}. */
+	 protected final int protectedCapacity;
+	 /** The probation segment, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap probation;
+	 /** The protected segment, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap protectedSegment;
+	 /** Creates a new SLRU cache.
+		 *
+		 * @param capacity the maximum number of entries in the cache.
+		 * @param protectedFraction the fraction of {@code capacity} reserved to the protected segment.
+		 */
+	 public SLRU(final int capacity, final float protectedFraction) {
+	  super(capacity);
+	  if (protectedFraction < 0 || protectedFraction >= 1) throw new IllegalArgumentException("The protected fraction must be nonnegative and smaller than one: " + protectedFraction);
+	  protectedCapacity = Math.min(capacity - 1, (int)(capacity * protectedFraction));
+	  probation = new Byte2FloatLinkedOpenHashMap (capacity + 1);
+	  protectedSegment = new Byte2FloatLinkedOpenHashMap (protectedCapacity + 1);
+	 }
+	 /** Creates a new SLRU cache with {@link #DEFAULT_PROTECTED_FRACTION} as protected fraction.
+		 *
+		 * @param capacity the maximum number of entries in the cache.
+		 */
+	 public SLRU(final int capacity) {
+	  this(capacity, DEFAULT_PROTECTED_FRACTION);
+	 }
+	 /** Looks up a key, promoting it if it is in probation.
+		 *
+		 * @param k a key.
+		 * @return the segment containing {@code k} after the lookup, with {@code k} in last position, or {@code null}.
+		 */
+	 private Byte2FloatLinkedOpenHashMap access(final byte k) {
+	  if (protectedSegment.moveToLastIndex(k) >= 0) return protectedSegment;
+	  if (probation.moveToLastIndex(k) < 0) return null;
+	  if (protectedCapacity == 0) return probation;
+	  // k is now the last key in probation
+	  protectedSegment.put(k, probation.removeLastFloat());
+	  if (protectedSegment.size() > protectedCapacity) {
+	   final byte d = protectedSegment.firstByteKey();
+	   probation.put(d, protectedSegment.removeFirstFloat());
+	  }
+	  return protectedSegment;
+	 }
+	 @Override
+	
+	 public float get(final byte k) {
+	  final Byte2FloatLinkedOpenHashMap segment = access( k);
+	  if (segment == null) {
+	   misses++;
+	   return defRetValue;
+	  }
+	  hits++;
+	  return segment.value[segment.last];
+	 }
+	 @Override
+	 public float put(final byte k, final float v) {
+	  final Byte2FloatLinkedOpenHashMap segment = access(k);
+	  if (segment != null) {
+	   final float oldValue = segment.value[segment.last];
+	   segment.value[segment.last] = v;
+	   return oldValue;
+	  }
+	  probation.put(k, v);
+	  if (probation.size() + protectedSegment.size() > capacity) evict(probation);
+	  return defRetValue;
+	 }
+	 @Override
+	 public float remove(final byte k) {
+	  if (protectedSegment.containsKey(k)) return removeFrom(protectedSegment, k);
+	  return removeFrom(probation, k);
+	 }
+	 @Override
+	 public boolean containsKey(final byte k) {
+	  return protectedSegment.containsKey(k) || probation.containsKey(k);
+	 }
+	 @Override
+	 public int size() {
+	  return probation.size() + protectedSegment.size();
+	 }
+	 @Override
+	 public void clear() {
+	  probation.clear();
+	  protectedSegment.clear();
+	 }
+	}
+	/** A cache with window TinyLFU eviction policy.
+	 *
+	 * <p>New entries enter a small LRU <em>window</em>. Entries leaving the window are admitted
+	 * to a main {@linkplain SLRU segmented LRU} region only if their estimated access frequency is larger than
+	 * that of the entry the main region would evict; otherwise, they are evicted. Frequencies are
+	 * estimated by a count-min sketch with four-bit counters, which are halved periodically so that
+	 * the history of the cache ages.
+	 *
+	 * @see <a href="https://arxiv.org/abs/1512.00727">Gil Einziger, Roy Friedman, and Ben Manes, &ldquo;TinyLFU:
+	 * A Highly Efficient Cache Admission Policy&rdquo;, <i>ACM Transactions on Storage</i>, 13(4), 2017</a>
+	 */
+	public static class WindowTinyLFU extends Byte2FloatCache {
+	 private static final long serialVersionUID = 0L;
+	 /** The default fraction of the capacity reserved to the window. */
+	 public static final float DEFAULT_WINDOW_FRACTION = .01f;
+	 /** The maximum number of entries in {@link #window}. */
+	 protected final int windowCapacity;
+	 /** The maximum number of entries in {@link #probation} and {@link #protectedSegment}. */
+	 protected final int mainCapacity;
+	 /** The maximum number of entries in {@link #protectedSegment}. */
+	 protected final int protectedCapacity;
+	 /** The window, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap window;
+	 /** The probation segment of the main region, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap probation;
+	 /** The protected segment of the main region, in access order. */
+	 protected final Byte2FloatLinkedOpenHashMap protectedSegment;
+	 /** The count-min sketch: sixteen four-bit counters per long. */
+	 private final long[] sketch;
+	 /** The mask for the counter indices of {@link #sketch}. */
+	 private final int sketchMask;
+	 /** The number of increments after which all counters are halved. */
+	 private final int sampleSize;
+	 /** The number of increments since the last halving (more precisely, minus half of the increments before it). */
+	 private int samples;
+	 /** Creates a new window TinyLFU cache.
+		 *
+		 * @param capacity the maximum number of entries in the cache.
+		 * @param windowFraction the fraction of {@code capacity} reserved to the window.
+		 */
+	 public WindowTinyLFU(final int capacity, final float windowFraction) {
+	  super(capacity);
+	  if (windowFraction <= 0 || windowFraction > 1) throw new IllegalArgumentException("The window fraction must be positive and at most one: " + windowFraction);
+	  windowCapacity = Math.max(1, (int)(capacity * windowFraction));
+	  mainCapacity = capacity - windowCapacity;
+	  protectedCapacity = (int)(mainCapacity * SLRU.DEFAULT_PROTECTED_FRACTION);
+	  window = new Byte2FloatLinkedOpenHashMap (windowCapacity + 1);
+	  probation = new Byte2FloatLinkedOpenHashMap (mainCapacity + 1);
+	  protectedSegment = new Byte2FloatLinkedOpenHashMap (protectedCapacity + 1);
+	  final int counters = (int)Math.min(1 << 30, HashCommon.nextPowerOfTwo(Math.max(64, 4L * capacity)));
+	  sketch = new long[counters >>> 4];
+	  sketchMask = counters - 1;
+	  sampleSize = (int)Math.min(Integer.MAX_VALUE, 10L * capacity);
+	 }
+	 /** Creates a new window TinyLFU cache with {@link #DEFAULT_WINDOW_FRACTION} as window fraction.
+		 *
+		 * @param capacity the maximum number of entries in the cache.
+		 */
+	 public WindowTinyLFU(final int capacity) {
+	  this(capacity, DEFAULT_WINDOW_FRACTION);
+	 }
+	 private long spread(final byte k) {
+	  return HashCommon.murmurHash3((k) + 0x9E3779B97F4A7C15L);
+	 }
+	 private int counter(final int i) {
+	  return (int)(sketch[i >>> 4] >>> ((i & 15) << 2)) & 15;
+	 }
+	 /** Returns the estimated frequency of a key.
+		 *
+		 * @param k a key.
+		 * @return the estimated frequency of {@code k} (at most 15).
+		 */
+	 protected int frequency(final byte k) {
+	  final long h = spread(k);
+	  final int h0 = (int)h, h1 = (int)(h >>> 32) | 1;
+	  int min = 15;
+	  for(int r = 0; r < 4; r++) min = Math.min(min, counter(h0 + r * h1 & sketchMask));
+	  return min;
+	 }
+	 /** Records an access to a key in the sketch, incrementing (conservatively) its counters.
+		 *
+		 * @param k a key.
+		 */
+	 private void record(final byte k) {
+	  final long h = spread(k);
+	  final int h0 = (int)h, h1 = (int)(h >>> 32) | 1;
+	  int min = 15;
+	  for(int r = 0; r < 4; r++) min = Math.min(min, counter(h0 + r * h1 & sketchMask));
+	  if (min == 15) return;
+	  for(int r = 0; r < 4; r++) {
+	   final int i = h0 + r * h1 & sketchMask;
+	   if (counter(i) == min) sketch[i >>> 4] += 1L << ((i & 15) << 2);
+	  }
+	  if (++samples == sampleSize) {
+	   // Age the sketch by halving all counters
+	   final long[] sketch = this.sketch;
+	   for(int i = sketch.length; i-- != 0;) sketch[i] = (sketch[i] >>> 1) & 0x7777777777777777L;
+	   samples /= 2;
+	  }
+	 }
+	 /** Looks up a key, promoting it if it is in probation.
+		 *
+		 * @param k a key.
+		 * @return the segment containing {@code k} after the lookup, with {@code k} in last position, or {@code null}.
+		 */
+	 private Byte2FloatLinkedOpenHashMap access(final byte k) {
+	  if (window.moveToLastIndex(k) >= 0) return window;
+	  if (protectedSegment.moveToLastIndex(k) >= 0) return protectedSegment;
+	  if (probation.moveToLastIndex(k) < 0) return null;
+	  if (protectedCapacity == 0) return probation;
+	  // k is now the last key in probation
+	  protectedSegment.put(k, probation.removeLastFloat());
+	  if (protectedSegment.size() > protectedCapacity) {
+	   final byte d = protectedSegment.firstByteKey();
+	   probation.put(d, protectedSegment.removeFirstFloat());
+	  }
+	  return protectedSegment;
+	 }
+	 @Override
+	
+	 public float get(final byte key) {
+	  final byte k = key;
+	  record(k);
+	  final Byte2FloatLinkedOpenHashMap segment = access(k);
+	  if (segment == null) {
+	   misses++;
+	   return defRetValue;
+	  }
+	  hits++;
+	  return segment.value[segment.last];
+	 }
+	 @Override
+	 public float put(final byte k, final float v) {
+	  record(k);
+	  final Byte2FloatLinkedOpenHashMap segment = access(k);
+	  if (segment != null) {
+	   final float oldValue = segment.value[segment.last];
+	   segment.value[segment.last] = v;
+	   return oldValue;
+	  }
+	  window.put(k, v);
+	  if (window.size() > windowCapacity) {
+	   final byte candidate = window.firstByteKey();
+	   final float value = window.removeFirstFloat();
+	   if (probation.size() + protectedSegment.size() < mainCapacity) probation.put(candidate, value);
+	   else {
+	    // The main region is full: the candidate must beat the victim
+	    final Byte2FloatLinkedOpenHashMap victims = probation.isEmpty() ? protectedSegment : probation;
+	    if (! victims.isEmpty() && frequency(candidate) > frequency(victims.firstByteKey())) {
+	     evict(victims);
+	     probation.put(candidate, value);
+	    }
+	    else evicted(candidate, value);
+	   }
+	  }
+	  return defRetValue;
+	 }
+	 @Override
+	 public float remove(final byte k) {
+	  if (window.containsKey(k)) return removeFrom(window, k);
+	  if (protectedSegment.containsKey(k)) return removeFrom(protectedSegment, k);
+	  return removeFrom(probation, k);
+	 }
+	 @Override
+	 public boolean containsKey(final byte k) {
+	  return window.containsKey(k) || protectedSegment.containsKey(k) || probation.containsKey(k);
+	 }
+	 @Override
+	 public int size() {
+	  return window.size() + probation.size() + protectedSegment.size();
+	 }
+	 /** Removes all entries from this cache; the frequency history is forgotten, too. */
+	 @Override
+	 public void clear() {
+	  window.clear();
+	  probation.clear();
+	  protectedSegment.clear();
+	  java.util.Arrays.fill(sketch, 0);
+	  samples = 0;
+	 }
+	}
+}
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2FloatLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2FloatAVLTreeMap
 #define RB_TREE_MAP Byte2FloatRBTreeMap
+#define CACHE Byte2FloatCache
+#define STATIC_FUNCTION Byte2FloatStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
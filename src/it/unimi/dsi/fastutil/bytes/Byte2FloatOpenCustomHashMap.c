@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2FloatOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2FloatAVLTreeMap
 #define RB_TREE_MAP Byte2FloatRBTreeMap
+#define CACHE Byte2FloatCache
+#define STATIC_FUNCTION Byte2FloatStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
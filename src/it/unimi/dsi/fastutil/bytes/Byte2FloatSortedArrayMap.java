@@ -0,0 +1,436 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+import it.unimi.dsi.fastutil.floats.FloatCollection;
+import it.unimi.dsi.fastutil.floats.AbstractFloatCollection;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.SortedMap;
+/** An immutable sorted map based on two parallel sorted backing arrays.
+	*
+	* <p>Instances of this class keep their keys sorted in an array, and the corresponding values in
+	* a parallel array, so they use much less memory than a tree-based map, and scan much faster.
+	* Lookups use the same search strategy of sorted-array sets: a branchless binary search, preceded,
+	* for integral keys in their natural order, by a few rounds of interpolation search.
+	* Submaps and key sets are views over a slice of the backing arrays, and they are created in logarithmic
+	* time without copying any entry.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by the views of this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class Byte2FloatSortedArrayMap extends AbstractByte2FloatSortedMap implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The sorted keys (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient byte[] key;
+	/** The values (parallel to {@link #key}). */
+	protected transient float[] value;
+	/** The index of the first entry of this map in {@link #key}. */
+	protected transient int from;
+	/** The index after the last entry of this map in {@link #key}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #key}, or {@code null} for the natural order. */
+	protected ByteComparator comparator;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Byte2FloatMap.Entry > entries;
+	/** Cached set of keys. */
+	protected transient ByteSortedSet keys;
+	/** Cached collection of values. */
+	protected transient FloatCollection values;
+	/** Creates a new map backed by a slice of two parallel arrays, the first of which must be sorted and contain distinct keys. */
+	protected Byte2FloatSortedArrayMap(final byte[] key, final float[] value, final int from, final int to, final ByteComparator comparator) {
+	 this.key = key;
+	 this.value = value;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new map using the given parallel arrays, after sorting them by key.
+	 *
+	 * @param key an array of distinct keys, which will be modified by this constructor.
+	 * @param value an array of values, which will be modified by this constructor.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether {@code key} is already sorted.
+	 * @throws IllegalArgumentException if {@code key} and {@code value} have different lengths, or {@code key} contains duplicates.
+	 */
+	private Byte2FloatSortedArrayMap(final byte[] key, final float[] value, final ByteComparator comparator, final boolean sorted) {
+	 this(key, value, 0, key.length, comparator);
+	 if (key.length != value.length) throw new IllegalArgumentException("Keys and values have different lengths (" + key.length + ", " + value.length + ")");
+	 if (! sorted) sort();
+	}
+	/** Sorts the backing arrays by key.
+	 *
+	 * @throws IllegalArgumentException if the keys contain duplicates.
+	 */
+	private void sort() {
+	 final byte[] key = this.key;
+	 final float[] value = this.value;
+	 it.unimi.dsi.fastutil.Arrays.quickSort(from, to, this::compareAt, (i, j) -> {
+	  final byte k = key[i];
+	  key[i] = key[j];
+	  key[j] = k;
+	  final float v = value[i];
+	  value[i] = value[j];
+	  value[j] = v;
+	 });
+	 for (int i = from + 1; i < to; i++) if (compareAt(i - 1, i) == 0) throw new IllegalArgumentException("Duplicate key: " + key[i]);
+	}
+	/** Creates a new map using the elements of two parallel arrays and a given comparator.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Byte2FloatSortedArrayMap(final byte[] k, final float[] v, final Comparator<? super Byte> c) {
+	 this(k.clone(), v.clone(), asComparator(c), false);
+	}
+	/** Creates a new map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Byte2FloatSortedArrayMap(final byte[] k, final float[] v) {
+	 this(k, v, null);
+	}
+	/** Creates a new map copying a given type-specific map.
+	 *
+	 * @param m a type-specific map to be copied into the new map.
+	 */
+	public Byte2FloatSortedArrayMap(final Byte2FloatMap m) {
+	 this(new byte[m.size()], new float[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given type-specific sorted map (and its comparator).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new map.
+	 */
+	public Byte2FloatSortedArrayMap(final Byte2FloatSortedMap m) {
+	 this(new byte[m.size()], new float[m.size()], m.comparator(), true);
+	 int i = 0;
+	 for (final Byte2FloatMap.Entry e : m.byte2FloatEntrySet()) {
+	  key[i] = e.getByteKey();
+	  value[i++] = e.getFloatValue();
+	 }
+	}
+	/** Creates a new map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new map.
+	 */
+	public Byte2FloatSortedArrayMap(final Map<? extends Byte, ? extends Float> m) {
+	 this(new byte[m.size()], new float[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given sorted map (and its comparator).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new map.
+	 */
+	public Byte2FloatSortedArrayMap(final SortedMap<Byte, Float> m) {
+	 this(new byte[m.size()], new float[m.size()], asComparator(m.comparator()), true);
+	 int i = 0;
+	 for (final Map.Entry<Byte, Float> e : m.entrySet()) {
+	  key[i] = (e.getKey()).byteValue();
+	  value[i++] = (e.getValue()).floatValue();
+	 }
+	}
+	/** Fills the backing arrays with the entries of a map. */
+
+	private void copy(final Map<? extends Byte, ? extends Float> m) {
+	 int i = 0;
+	 if (m instanceof Byte2FloatMap) {
+	  for (final Byte2FloatMap.Entry e : ((Byte2FloatMap )m).byte2FloatEntrySet()) {
+	   key[i] = e.getByteKey();
+	   value[i++] = e.getFloatValue();
+	  }
+	 }
+	 else {
+	  for (final Map.Entry<? extends Byte, ? extends Float> e : m.entrySet()) {
+	   key[i] = (e.getKey()).byteValue();
+	   value[i++] = (e.getValue()).floatValue();
+	  }
+	 }
+	}
+	private static ByteComparator asComparator(final Comparator<? super Byte> c) {
+	 return ByteComparators.asByteComparator(c);
+	}
+	/** Compares the keys at two given positions of the backing array. */
+
+	private int compareAt(final int i, final int j) {
+	 return comparator == null ? ( Byte.compare(( key[i]),( key[j])) ) : comparator.compare( key[i], key[j]);
+	}
+
+	private int compare(final byte k1, final byte k2) {
+	 return comparator == null ? ( Byte.compare((k1),(k2)) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first key of this map greater than or equal to a given key, or {@link #to}. */
+	private int lowerBound(final byte k) {
+	 return ByteSortedArraySet.lowerBound(key, from, to, k, comparator);
+	}
+	/** Returns the index of a given key in the backing array, or -1 if the key is not in this map. */
+
+	private int findKey(final byte k) {
+	 final int i = lowerBound(k);
+	 return i < to && compare( key[i], k) == 0 ? i : -1;
+	}
+	@Override
+
+	public float get(final byte k) {
+	 final int i = findKey( k);
+	 return i == -1 ? defRetValue : value[i];
+	}
+	@Override
+
+	public boolean containsKey(final byte k) {
+	 return findKey( k) != -1;
+	}
+	@Override
+	public boolean containsValue(final float v) {
+	 for (int i = from; i < to; i++) if (( Float.floatToIntBits(value[i]) == Float.floatToIntBits(v) )) return true;
+	 return false;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+
+	public byte firstByteKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return key[from];
+	}
+	@Override
+
+	public byte lastByteKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return key[to - 1];
+	}
+	@Override
+	public ByteComparator comparator() {
+	 return comparator;
+	}
+	/** Returns a view on a range of this map sharing its default return value.
+	 *
+	 * @param from the start of the range in the backing arrays (inclusive).
+	 * @param to the end of the range in the backing arrays (exclusive).
+	 * @return a view on the given range.
+	 */
+	private Byte2FloatSortedArrayMap view(final int from, final int to) {
+	 final Byte2FloatSortedArrayMap m = new Byte2FloatSortedArrayMap (key, value, from, to, comparator);
+	 m.defRetValue = defRetValue;
+	 return m;
+	}
+	@Override
+	public Byte2FloatSortedMap headMap(final byte to) {
+	 return view(from, lowerBound(to));
+	}
+	@Override
+	public Byte2FloatSortedMap tailMap(final byte from) {
+	 return view(lowerBound(from), to);
+	}
+	@Override
+	public Byte2FloatSortedMap subMap(final byte from, final byte to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	 return view(lowerBound(from), lowerBound(to));
+	}
+	@Override
+	public ByteSortedSet keySet() {
+	 if (keys == null) keys = new ByteSortedArraySet (key, from, to, comparator);
+	 return keys;
+	}
+	@Override
+	public FloatCollection values() {
+	 if (values == null) values = new AbstractFloatCollection () {
+	  @Override
+	  public boolean contains(final float v) {
+	   return containsValue(v);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.floats.FloatIterator iterator() {
+	   return it.unimi.dsi.fastutil.floats.FloatIterators.wrap( value, from, to - from);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.floats.FloatSpliterator spliterator() {
+	   return it.unimi.dsi.fastutil.floats.FloatSpliterators.wrap( value, from, to - from, java.util.Spliterator.IMMUTABLE);
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	 };
+	 return values;
+	}
+	/** A bidirectional iterator on the entries of a slice of the backing arrays. */
+	private final class EntryIterator implements ObjectBidirectionalIterator<Byte2FloatMap.Entry > {
+	 /** The index of the next entry to be returned. */
+	 int pos;
+	 EntryIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	
+	 public Byte2FloatMap.Entry next() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return new AbstractByte2FloatMap.BasicEntry ( key[pos], value[pos++]);
+	 }
+	 @Override
+	
+	 public Byte2FloatMap.Entry previous() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  --pos;
+	  return new AbstractByte2FloatMap.BasicEntry ( key[pos], value[pos]);
+	 }
+	}
+	/** A spliterator on the entries of a slice of the backing arrays. */
+	private final class EntrySpliterator extends ObjectSpliterators.EarlyBindingSizeIndexBasedSpliterator<Byte2FloatMap.Entry > implements ObjectSpliterator<Byte2FloatMap.Entry > {
+	 EntrySpliterator(final int pos, final int maxPos) {
+	  super(pos, maxPos);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return ObjectSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 }
+	 @Override
+	 public Comparator<? super Byte2FloatMap.Entry > getComparator() {
+	  return byte2FloatEntrySet().comparator();
+	 }
+	 @Override
+	
+	 protected Byte2FloatMap.Entry get(final int location) {
+	  return new AbstractByte2FloatMap.BasicEntry ( key[location], value[location]);
+	 }
+	 @Override
+	 protected EntrySpliterator makeForSplit(final int pos, final int maxPos) {
+	  return new EntrySpliterator(pos, maxPos);
+	 }
+	}
+	@Override
+	public ObjectSortedSet<Byte2FloatMap.Entry > byte2FloatEntrySet() {
+	 if (entries == null) entries = new AbstractObjectSortedSet<Byte2FloatMap.Entry >() {
+	  final Comparator<? super Byte2FloatMap.Entry > comparator = (x, y) -> Byte2FloatSortedArrayMap.this.compare(x.getByteKey(), y.getByteKey());
+	  @Override
+	  public Comparator<? super Byte2FloatMap.Entry > comparator() {
+	   return comparator;
+	  }
+	  @Override
+	  public ObjectBidirectionalIterator<Byte2FloatMap.Entry > iterator() {
+	   return new EntryIterator(from);
+	  }
+	  @Override
+	 
+	  public ObjectBidirectionalIterator<Byte2FloatMap.Entry > iterator(final Byte2FloatMap.Entry from) {
+	   int i = lowerBound(from.getByteKey());
+	   if (i < to && compare( key[i], from.getByteKey()) == 0) i++;
+	   return new EntryIterator(i);
+	  }
+	  @Override
+	  public ObjectSpliterator<Byte2FloatMap.Entry > spliterator() {
+	   return new EntrySpliterator(from, to);
+	  }
+	  @Override
+	 
+	  public boolean contains(final Object o) {
+	   if (! (o instanceof Map.Entry)) return false;
+	   final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	   if (e.getKey() == null || ! (e.getKey() instanceof Byte)) return false;
+	   if (e.getValue() == null || ! (e.getValue() instanceof Float)) return false;
+	   final int i = findKey(((Byte)( e.getKey())).byteValue());
+	   return i != -1 && ( Float.floatToIntBits(value[i]) == Float.floatToIntBits(((Float)(e.getValue())).floatValue()) );
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	  @Override
+	  public Byte2FloatMap.Entry first() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(from).next();
+	  }
+	  @Override
+	  public Byte2FloatMap.Entry last() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(to).previous();
+	  }
+	  @Override
+	  public ObjectSortedSet<Byte2FloatMap.Entry > subSet(final Byte2FloatMap.Entry from, final Byte2FloatMap.Entry to) {
+	   return subMap(from.getByteKey(), to.getByteKey()).byte2FloatEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Byte2FloatMap.Entry > headSet(final Byte2FloatMap.Entry to) {
+	   return headMap(to.getByteKey()).byte2FloatEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Byte2FloatMap.Entry > tailSet(final Byte2FloatMap.Entry from) {
+	   return tailMap(from.getByteKey()).byte2FloatEntrySet();
+	  }
+	 };
+	 return entries;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) {
+	  s.writeByte(key[i]);
+	  s.writeFloat(value[i]);
+	 }
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 key = new byte[to];
+	 value = new float[to];
+	 for (int i = 0; i < to; i++) {
+	  key[i] = s.readByte();
+	  value[i] = s.readFloat();
+	 }
+	}
+}
@@ -0,0 +1,300 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import it.unimi.dsi.fastutil.HashCommon;
+import java.util.Arrays;
+/** An immutable type-specific function over a static set of keys based on a minimal perfect hash function.
+	*
+	* <p>Instances of this class are built once from a set of distinct keys and the associated values.
+	* The keys are mapped bijectively onto the positions of a dense array of values by a
+	* <a href="https://doi.org/10.1007/978-3-540-73951-7_13">BDZ</a>-style minimal perfect hash function
+	* obtained by peeling a random 3-hypergraph. The function uses about 2.5 bits per key, plus
+	* a ranking structure of about a tenth of a bit per key, and lookups require a fixed
+	* number of memory accesses. The keys themselves are <em>not stored</em>: the memory
+	* footprint is thus a fraction of that of an open-addressing hash map, which must store keys and values
+	* in tables that are never full.
+	*
+	* <p>Since keys are not stored, the behavior on keys not in the original set depends on the
+	* <em>signature width</em> <var>w</var> specified at construction time:
+	* <ul>
+	* <li>if <var>w</var> is zero, there is no verification, and the type-specific getter
+	* will return the value associated with some key in the set for most keys
+	* outside the set (sometimes, it will be able to detect that the key is not in the set, and return the
+	* {@linkplain #defaultReturnValue() default return value});
+	* <li>if <var>w</var> is positive, a fingerprint of <var>w</var> bits is stored for each key, and keys outside the set will be
+	* detected (and the default return value returned) with probability 1&nbsp;&minus;&nbsp;2<sup>&minus;<var>w</var></sup>;
+	* <li>if <var>w</var> is 64, fingerprints are in bijection with the 64-bit signatures of the keys: for primitive
+	* keys, this makes verification exact.
+	* </ul>
+	*
+	* <p>Accordingly, {@code containsKey()} may report false positives unless verification is
+	* exact, and {@link #size()} returns the number of keys in the original set.
+	*
+	* <p>Reference keys are turned into 64-bit signatures by a hasher that can be specified at construction time
+	* (and that must be serializable if the function is to be serialized). Distinct keys with the same signature
+	* will cause an {@link IllegalArgumentException} at construction time.
+	*
+	* <p>Construction requires temporary space of about 24 bytes per key, and the expected
+	* number of attempts to generate a peelable hypergraph is a small constant.
+	*/
+public class Byte2FloatStaticFunction extends AbstractByte2FloatFunction implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The ratio between the number of vertices and the number of edges of the hypergraph. */
+	private static final double GAMMA = 1.23;
+	/** The number of keys. */
+	private int n;
+	/** The number of vertices in each of the three parts of the hypergraph. */
+	private int segmentSize;
+	/** The seed used to generate the hypergraph. */
+	private long seed;
+	/** The 2-bit values associated with the vertices (32 per long); unused vertices have value 3. */
+	private long[] g;
+	/** The number of used vertices before each block of eight longs of {@link #g}. */
+	private int[] count;
+	/** The width in bits of the signatures (0 if there is no verification). */
+	private int signatureWidth;
+	/** The signatures, packed in {@link #signatureWidth}-bit fields, in minimal-perfect-hash order. */
+	private long[] signatures;
+	/** The values, in minimal-perfect-hash order. */
+	private float[] value;
+	/** Creates a new static function with given keys and values.
+	 *
+	 * @param key the keys (they must be distinct).
+	 * @param value the values (the array <em>must</em> have the same length as {@code key}).
+	 * @param signatureWidth the number of bits of the fingerprint used to detect keys not in {@code key}, from 0 to 64.
+	 */
+	public Byte2FloatStaticFunction(final byte[] key, final float[] value, final int signatureWidth) {
+	 final long[] signature = new long[key.length];
+	 for (int i = 0; i < key.length; i++) signature[i] = signature(key[i]);
+	 build(signature, value.clone(), signatureWidth);
+	}
+	/** Creates a new static function copying a given type-specific map.
+	 *
+	 * <p>The {@linkplain #defaultReturnValue() default return value} of {@code m} is copied, too.
+	 *
+	 * @param m a type-specific map.
+	 * @param signatureWidth the number of bits of the fingerprint used to detect keys not in {@code m}, from 0 to 64.
+	 */
+	public Byte2FloatStaticFunction(final Byte2FloatMap m, final int signatureWidth) {
+	 final int n = m.size();
+	 final long[] signature = new long[n];
+	 final float[] value = new float[n];
+	 int i = 0;
+	 for (final Byte2FloatMap.Entry e : m.byte2FloatEntrySet()) {
+	  signature[i] = signature(e.getByteKey());
+	  value[i++] = e.getFloatValue();
+	 }
+	 defRetValue = m.defaultReturnValue();
+	 build(signature, value, signatureWidth);
+	}
+	/** Returns the 64-bit signature of a key; it is injective on keys, as {@link HashCommon#murmurHash3(long)} is a bijection. */
+	private static long signature(final byte k) {
+	 return HashCommon.murmurHash3((long)k);
+	}
+	/** Returns the fingerprint of a signature; it is a bijection, so 64-bit fingerprints of distinct signatures are distinct. */
+	private static long fingerprint(final long signature) {
+	 return HashCommon.mix(signature);
+	}
+	private static int get2(final long[] g, final int v) {
+	 return (int)(g[v >>> 5] >>> ((v & 31) << 1)) & 3;
+	}
+	private static void set2(final long[] g, final int v, final int x) {
+	 final int shift = (v & 31) << 1;
+	 g[v >>> 5] = g[v >>> 5] & ~(3L << shift) | (long)x << shift;
+	}
+	/** Returns the number of used vertices (i.e., those with a value different from 3) in a word of {@link #g}. */
+	private static int used(final long w) {
+	 return 32 - Long.bitCount(w & w >>> 1 & 0x5555555555555555L);
+	}
+	/** Stores in the given array the three vertices of the edge associated with a signature. */
+	private static void edge(final long signature, final long seed, final int segmentSize, final int[] e) {
+	 final long h0 = HashCommon.murmurHash3(signature ^ seed);
+	 final long h1 = HashCommon.murmurHash3(h0 ^ 0x9E3779B97F4A7C15L);
+	 e[0] = (int)(((h0 >>> 32) * segmentSize) >>> 32);
+	 e[1] = (int)(((h0 & 0xFFFFFFFFL) * segmentSize) >>> 32) + segmentSize;
+	 e[2] = (int)(((h1 >>> 32) * segmentSize) >>> 32) + 2 * segmentSize;
+	}
+	private static long getBits(final long[] a, final long pos, final int width) {
+	 final int word = (int)(pos >>> 6);
+	 final int bit = (int)(pos & 63);
+	 final long mask = width == Long.SIZE ? -1L : (1L << width) - 1;
+	 if (bit + width <= Long.SIZE) return a[word] >>> bit & mask;
+	 return (a[word] >>> bit | a[word + 1] << -bit) & mask;
+	}
+	private static void setBits(final long[] a, final long pos, final int width, final long x) {
+	 final int word = (int)(pos >>> 6);
+	 final int bit = (int)(pos & 63);
+	 final long mask = width == Long.SIZE ? -1L : (1L << width) - 1;
+	 a[word] = a[word] & ~(mask << bit) | x << bit;
+	 if (bit + width > Long.SIZE) a[word + 1] = a[word + 1] & ~(mask >>> -bit) | x >>> -bit;
+	}
+	/** Builds the minimal perfect hash function and lays out values and signatures.
+	 *
+	 * @param signature the signatures of the keys (which must be distinct).
+	 * @param value the values, parallel to {@code signature}; the array will be reused.
+	 * @param signatureWidth the signature width.
+	 */
+	private void build(final long[] signature, final float[] value, final int signatureWidth) {
+	 if (signatureWidth < 0 || signatureWidth > Long.SIZE) throw new IllegalArgumentException("Invalid signature width: " + signatureWidth);
+	 if (signature.length != value.length) throw new IllegalArgumentException("Keys and values have different lengths (" + signature.length + ", " + value.length + ")");
+	 final int n = this.n = signature.length;
+	 this.signatureWidth = signatureWidth;
+	 final long[] sorted = signature.clone();
+	 it.unimi.dsi.fastutil.longs.LongArrays.radixSort(sorted);
+	 for (int i = 1; i < n; i++) if (sorted[i] == sorted[i - 1]) throw new IllegalArgumentException("Duplicate key or 64-bit signature collision: " + sorted[i]);
+	 final long segmentSize = n == 0 ? 0 : (long)Math.ceil(n * GAMMA / 3) + 1;
+	 if (3 * segmentSize > Integer.MAX_VALUE - Long.SIZE) throw new IllegalArgumentException("Too many keys: " + n);
+	 final int m = (int)(3 * segmentSize);
+	 this.segmentSize = (int)segmentSize;
+	 final int[] degree = new int[m];
+	 final int[] xorEdge = new int[m];
+	 final int[] stack = new int[m];
+	 final int[] order = new int[n];
+	 final byte[] hinge = new byte[n];
+	 final int[] e = new int[3];
+	 for (long attempt = 0;; attempt++) {
+	  seed = attempt * 0x9E3779B97F4A7C15L;
+	  Arrays.fill(degree, 0);
+	  Arrays.fill(xorEdge, 0);
+	  for (int i = 0; i < n; i++) {
+	   edge(signature[i], seed, this.segmentSize, e);
+	   for (int j = 0; j < 3; j++) {
+	    degree[e[j]]++;
+	    xorEdge[e[j]] ^= i;
+	   }
+	  }
+	  // Peeling: we repeatedly remove edges incident to a vertex of degree one
+	  int sp = 0, peeled = 0;
+	  for (int v = 0; v < m; v++) if (degree[v] == 1) stack[sp++] = v;
+	  while (sp != 0) {
+	   final int v = stack[--sp];
+	   if (degree[v] != 1) continue;
+	   final int i = xorEdge[v];
+	   edge(signature[i], seed, this.segmentSize, e);
+	   order[peeled] = i;
+	   for (int j = 0; j < 3; j++) {
+	    if (e[j] == v) hinge[peeled] = (byte)j;
+	    degree[e[j]]--;
+	    xorEdge[e[j]] ^= i;
+	    if (degree[e[j]] == 1) stack[sp++] = e[j];
+	   }
+	   peeled++;
+	  }
+	  if (peeled == n) break;
+	 }
+	 // Assignment, in reverse peeling order
+	 final long[] g = this.g = new long[(m + 31) >>> 5];
+	 Arrays.fill(g, -1);
+	 for (int p = n; p-- != 0;) {
+	  edge(signature[order[p]], seed, this.segmentSize, e);
+	  final int s = get2(g, e[0]) + get2(g, e[1]) + get2(g, e[2]);
+	  set2(g, e[hinge[p]], ((hinge[p] - s) % 3 + 3) % 3);
+	 }
+	 final int[] count = this.count = new int[(g.length + 7) >>> 3];
+	 int c = 0;
+	 for (int w = 0; w < g.length; w++) {
+	  if ((w & 7) == 0) count[w >>> 3] = c;
+	  c += used(g[w]);
+	 }
+	 assert c == n : c + " != " + n;
+	 final float[] permuted = this.value = new float[n];
+	 final long[] signatures = this.signatures = new long[(int)((n * (long)signatureWidth + Long.SIZE - 1) / Long.SIZE)];
+	 for (int p = 0; p < n; p++) {
+	  final int i = order[p];
+	  edge(signature[i], seed, this.segmentSize, e);
+	  final int r = rank(e[hinge[p]]);
+	  permuted[r] = value[i];
+	  if (signatureWidth != 0) setBits(signatures, (long)r * signatureWidth, signatureWidth, fingerprint(signature[i]) >>> -signatureWidth);
+	 }
+	}
+	/** Returns the number of used vertices before a given vertex. */
+	private int rank(final int v) {
+	 final long[] g = this.g;
+	 final int word = v >>> 5;
+	 int r = count[word >>> 3];
+	 for (int w = word & ~7; w < word; w++) r += used(g[w]);
+	 final long mask = (1L << ((v & 31) << 1)) - 1;
+	 return r + (v & 31) - Long.bitCount(g[word] & g[word] >>> 1 & 0x5555555555555555L & mask);
+	}
+	/** Returns the position associated with a signature, or -1.
+	 *
+	 * @param signature a signature.
+	 * @return the position in {@link #value} associated with {@code signature}, or -1 if the signature is
+	 * detected not to belong to the key set.
+	 */
+	private int find(final long signature) {
+	 if (n == 0) return -1;
+	 final long[] g = this.g;
+	 final long h0 = HashCommon.murmurHash3(signature ^ seed);
+	 final long h1 = HashCommon.murmurHash3(h0 ^ 0x9E3779B97F4A7C15L);
+	 final int v0 = (int)(((h0 >>> 32) * segmentSize) >>> 32);
+	 final int v1 = (int)(((h0 & 0xFFFFFFFFL) * segmentSize) >>> 32) + segmentSize;
+	 final int v2 = (int)(((h1 >>> 32) * segmentSize) >>> 32) + 2 * segmentSize;
+	 final int g0 = get2(g, v0), g1 = get2(g, v1), g2 = get2(g, v2);
+	 final int s = (g0 + g1 + g2) % 3;
+	 final int v = s == 0 ? v0 : s == 1 ? v1 : v2;
+	 // A key in the set is always mapped to a used vertex
+	 if ((s == 0 ? g0 : s == 1 ? g1 : g2) == 3) return -1;
+	 final int r = rank(v);
+	 final int w = signatureWidth;
+	 if (w != 0 && getBits(signatures, (long)r * w, w) != fingerprint(signature) >>> -w) return -1;
+	 return r;
+	}
+	/** Returns the position of a key in the minimal perfect hash order.
+	 *
+	 * <p>For keys in the set, the result is a distinct integer in [0..{@link #size()}).
+	 * For other keys, the result is either -1 or, if verification fails to detect
+	 * the key (see the class documentation), a position in the same range.
+	 *
+	 * @param k a key.
+	 * @return the position of {@code k}, or -1.
+	 */
+	public int index(final byte k) {
+	 return find(signature(k));
+	}
+	@Override
+
+	public float get(final byte k) {
+	 final int r = find(signature( k));
+	 return r == -1 ? defRetValue : value[r];
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>Unless verification is exact, this method may return true for keys not in the set. */
+	@Override
+
+	public boolean containsKey(final byte k) {
+	 return find(signature( k)) != -1;
+	}
+	@Override
+	public int size() {
+	 return n;
+	}
+	/** Returns the width of the signatures used to verify keys.
+	 *
+	 * @return the width of the signatures used to verify keys (0 if there is no verification).
+	 */
+	public int signatureWidth() {
+	 return signatureWidth;
+	}
+	/** Returns the number of bits used by this function, excluding values.
+	 *
+	 * @return the number of bits used by the minimal perfect hash function, its ranking structure and the signatures.
+	 */
+	public long numBits() {
+	 return (long)g.length * Long.SIZE + (long)count.length * Integer.SIZE + (long)signatures.length * Long.SIZE;
+	}
+}
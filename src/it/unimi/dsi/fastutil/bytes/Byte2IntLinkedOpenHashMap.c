@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2IntLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2IntAVLTreeMap
 #define RB_TREE_MAP Byte2IntRBTreeMap
+#define CACHE Byte2IntCache
+#define STATIC_FUNCTION Byte2IntStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2IntOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2IntAVLTreeMap
 #define RB_TREE_MAP Byte2IntRBTreeMap
+#define CACHE Byte2IntCache
+#define STATIC_FUNCTION Byte2IntStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ObjectOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ObjectAVLTreeMap
 #define RB_TREE_MAP Byte2ObjectRBTreeMap
+#define CACHE Byte2ObjectCache
+#define STATIC_FUNCTION Byte2ObjectStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
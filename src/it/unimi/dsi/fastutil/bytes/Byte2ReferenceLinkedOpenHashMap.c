@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ByteLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Byte2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ReferenceLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ReferenceAVLTreeMap
 #define RB_TREE_MAP Byte2ReferenceRBTreeMap
+#define CACHE Byte2ReferenceCache
+#define STATIC_FUNCTION Byte2ReferenceStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ByteOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ByteOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Byte2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Byte2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Byte2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Byte2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedByte2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Byte2ReferenceOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ByteRBTreeSet
 #define AVL_TREE_MAP Byte2ReferenceAVLTreeMap
 #define RB_TREE_MAP Byte2ReferenceRBTreeMap
+#define CACHE Byte2ReferenceCache
+#define STATIC_FUNCTION Byte2ReferenceStaticFunction
 #define ARRAY_LIST ByteArrayList
 #define IMMUTABLE_LIST ByteImmutableList
 #define BIG_ARRAY_BIG_LIST ByteBigArrayBigList
@@ -0,0 +1,648 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.NoSuchElementException;
+/** A type-specific list based on a sequence of chunks, providing fast insertions and removals at any position.
+	*
+	* <p>Instances of this class store elements in chunks of at most {@value #CHUNK_SIZE} elements.
+	* Insertions and removals move elements only within a chunk, so, contrarily to an array-based list,
+	* their cost does not depend on the size of the list. Chunks are split when they are full, and merged
+	* with a neighbour when they become too small. Positional access, insertion and removal require
+	* logarithmic time in the number of chunks, as the chunk containing a given position is located using a
+	* <a href="https://en.wikipedia.org/wiki/Fenwick_tree">Fenwick tree</a> over the chunk lengths.
+	*
+	* <p>Iterators and spliterators scan chunks sequentially, so they are as fast as those of an array-based list,
+	* and {@link #getElements getElements()}, {@link #addElements addElements()} and
+	* {@link #removeElements removeElements()} copy, allocate or drop a chunk at a time.
+	* A big-list view of an instance of this class can be obtained using {@code asBigList()} from the type-specific big-list
+	* utility class.
+	*/
+public class ByteChunkedList extends AbstractByteList implements Cloneable, java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The base-2 logarithm of the maximum number of elements in a chunk. */
+	private static final int LOG2_CHUNK_SIZE = 11;
+	/** The maximum number of elements in a chunk. */
+	public static final int CHUNK_SIZE = 1 << LOG2_CHUNK_SIZE;
+	/** Chunks shorter than this are merged with a neighbour, if their joint length is at most half {@link #CHUNK_SIZE}. */
+	private static final int MIN_CHUNK_LENGTH = CHUNK_SIZE / 4;
+	/** The minimum capacity of a newly allocated chunk. */
+	private static final int MIN_CHUNK_CAPACITY = 16;
+	/** The chunks; only the first {@link #chunks} are in use. */
+	protected transient byte[][] chunk;
+	/** The number of elements in each chunk, which is always positive for chunks in use. */
+	protected transient int[] chunkLength;
+	/** A Fenwick tree over {@link #chunkLength}, indexed from one. */
+	protected transient int[] tree;
+	/** The number of chunks in use. */
+	protected transient int chunks;
+	/** The number of elements in the list. */
+	protected transient int size;
+	/** Creates a new empty chunked list. */
+	public ByteChunkedList() {
+	 allocate(0);
+	}
+	/** Creates a new chunked list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public ByteChunkedList(final byte a[], final int offset, final int length) {
+	 ByteArrays.ensureOffsetLength(a, offset, length);
+	 allocate(length);
+	 for (int c = 0; c < chunks; c++) System.arraycopy(a, offset + (c << LOG2_CHUNK_SIZE), chunk[c], 0, chunkLength[c]);
+	}
+	/** Creates a new chunked list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 */
+	public ByteChunkedList(final byte a[]) {
+	 this(a, 0, a.length);
+	}
+	/** Creates a new chunked list and fills it with a given type-specific collection.
+	 *
+	 * @param c a type-specific collection that will be used to fill the list.
+	 */
+	public ByteChunkedList(final ByteCollection c) {
+	 this(c.toByteArray());
+	}
+	/** Creates a new chunked list and fills it with a given collection.
+	 *
+	 * @param c a collection that will be used to fill the list.
+	 */
+	public ByteChunkedList(final Collection<? extends Byte> c) {
+	 this(unwrap(c));
+	}
+	/** Returns the elements of a collection as an array.
+	 *
+	 * @param c a collection.
+	 * @return an array containing the elements of {@code c}.
+	 */
+	private static byte[] unwrap(final Collection<? extends Byte> c) {
+	 if (c instanceof ByteCollection) return ((ByteCollection)c).toByteArray();
+	 return ByteIterators.unwrap(ByteIterators.asByteIterator(c.iterator()));
+	}
+	/** Allocates full chunks for a given number of elements, discarding the current content.
+	 *
+	 * @param n the number of elements.
+	 */
+	private void allocate(final int n) {
+	 chunks = (int)((long)n + CHUNK_SIZE - 1 >>> LOG2_CHUNK_SIZE);
+	 chunk = new byte[Math.max(1, chunks)][];
+	 chunkLength = new int[chunk.length];
+	 tree = new int[chunk.length + 1];
+	 for (int c = 0; c < chunks; c++) chunk[c] = new byte[chunkLength[c] = Math.min(CHUNK_SIZE, n - (c << LOG2_CHUNK_SIZE))];
+	 size = n;
+	 rebuild();
+	}
+	/** Rebuilds {@link #tree} from {@link #chunkLength}. */
+	private void rebuild() {
+	 final int[] tree = this.tree;
+	 for (int i = 1; i <= chunks; i++) tree[i] = chunkLength[i - 1];
+	 for (int i = 1; i <= chunks; i++) {
+	  final int j = i + (i & -i);
+	  if (j <= chunks) tree[j] += tree[i];
+	 }
+	}
+	/** Adds a quantity to the length of a chunk in {@link #tree}.
+	 *
+	 * @param c a chunk.
+	 * @param delta the quantity to add.
+	 */
+	private void update(final int c, final int delta) {
+	 for (int i = c + 1; i <= chunks; i += i & -i) tree[i] += delta;
+	}
+	/** Locates an element.
+	 *
+	 * @param index an index between 0 and the size of this list (inclusive).
+	 * @return the chunk containing the element of given index in the upper 32 bits and
+	 * its offset in the chunk in the lower 32 bits; if {@code index} is the size of this list,
+	 * the number of chunks in the upper 32 bits and zero in the lower 32 bits.
+	 */
+	private long locate(int index) {
+	 int c = 0;
+	 for (int step = Integer.highestOneBit(chunks); step != 0; step >>>= 1) {
+	  final int t = c + step;
+	  if (t <= chunks && tree[t] <= index) {
+	   c = t;
+	   index -= tree[t];
+	  }
+	 }
+	 return (long)c << 32 | index;
+	}
+	/** Makes room for new chunks; the caller must rebuild {@link #tree} afterwards.
+	 *
+	 * @param p the position of the first new chunk.
+	 * @param k the number of new chunks.
+	 */
+	private void insertChunks(final int p, final int k) {
+	 if (chunks + k > chunk.length) {
+	  final int length = (int)Math.min(it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE, Math.max(chunks + k, 2L * chunk.length));
+	  chunk = Arrays.copyOf(chunk, length);
+	  chunkLength = Arrays.copyOf(chunkLength, length);
+	  tree = new int[length + 1];
+	 }
+	 System.arraycopy(chunk, p, chunk, p + k, chunks - p);
+	 System.arraycopy(chunkLength, p, chunkLength, p + k, chunks - p);
+	 chunks += k;
+	}
+	/** Removes chunks; the caller must rebuild {@link #tree} afterwards.
+	 *
+	 * @param p the position of the first chunk to remove.
+	 * @param k the number of chunks to remove.
+	 */
+	private void removeChunks(final int p, final int k) {
+	 System.arraycopy(chunk, p + k, chunk, p, chunks - p - k);
+	 System.arraycopy(chunkLength, p + k, chunkLength, p, chunks - p - k);
+	 Arrays.fill(chunk, chunks - k, chunks, null);
+	 chunks -= k;
+	}
+	/** Ensures that a chunk can contain a given number of elements.
+	 *
+	 * @param c a chunk.
+	 * @param capacity a capacity not larger than {@link #CHUNK_SIZE}.
+	 */
+	private void ensureChunkCapacity(final int c, final int capacity) {
+	 final byte[] t = chunk[c];
+	 if (t.length < capacity) chunk[c] = Arrays.copyOf(t, Math.min(CHUNK_SIZE, Math.max(capacity, 2 * t.length)));
+	}
+	/** Splits a chunk in two; the caller must rebuild {@link #tree} afterwards.
+	 *
+	 * @param c a chunk.
+	 * @param at the number of elements that will remain in {@code c}; the remaining ones will be moved to a new chunk following {@code c}.
+	 */
+	private void split(final int c, final int at) {
+	 insertChunks(c + 1, 1);
+	 final int l = chunkLength[c] - at;
+	 final byte[] t = new byte[Math.max(MIN_CHUNK_CAPACITY, l)];
+	 System.arraycopy(chunk[c], at, t, 0, l);
+	 chunk[c + 1] = t;
+	 chunkLength[c + 1] = l;
+	 chunkLength[c] = at;
+	}
+	/** Merges a chunk with the following one; the caller must rebuild {@link #tree} afterwards.
+	 *
+	 * @param c a chunk followed by another chunk.
+	 */
+	private void merge(final int c) {
+	 final int l = chunkLength[c], m = chunkLength[c + 1];
+	 ensureChunkCapacity(c, l + m);
+	 System.arraycopy(chunk[c + 1], 0, chunk[c], l, m);
+	 chunkLength[c] = l + m;
+	 removeChunks(c + 1, 1);
+	}
+	/** Removes a chunk if it is empty, or merges it with a neighbour if it is too short.
+	 *
+	 * <p>If this method returns true, {@link #tree} has been rebuilt; otherwise, it has not been modified.
+	 *
+	 * @param c a chunk.
+	 * @return true if the chunks have been modified.
+	 */
+	private boolean compact(final int c) {
+	 final int l = chunkLength[c];
+	 if (l == 0) removeChunks(c, 1);
+	 else if (l >= MIN_CHUNK_LENGTH) return false;
+	 else if (c + 1 < chunks && l + chunkLength[c + 1] <= CHUNK_SIZE / 2) merge(c);
+	 else if (c > 0 && chunkLength[c - 1] + l <= CHUNK_SIZE / 2) merge(c - 1);
+	 else return false;
+	 rebuild();
+	 return true;
+	}
+	@Override
+	public byte getByte(final int index) {
+	 if (index < 0 || index >= size) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + size + ")");
+	 final long p = locate(index);
+	 return chunk[(int)(p >>> 32)][(int)p];
+	}
+	@Override
+	public byte set(final int index, final byte k) {
+	 if (index < 0 || index >= size) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + size + ")");
+	 final long p = locate(index);
+	 final byte[] t = chunk[(int)(p >>> 32)];
+	 final byte old = t[(int)p];
+	 t[(int)p] = k;
+	 return old;
+	}
+	@Override
+	public void add(final int index, final byte k) {
+	 ensureIndex(index);
+	 final long p = locate(index);
+	 int c = (int)(p >>> 32), o = (int)p;
+	 boolean restructured = false;
+	 // At a chunk boundary we prefer appending to the previous chunk
+	 if (o == 0 && c > 0 && chunkLength[c - 1] < CHUNK_SIZE) o = chunkLength[--c];
+	 else if (c == chunks) {
+	  insertChunks(c, 1);
+	  chunk[c] = new byte[MIN_CHUNK_CAPACITY];
+	  chunkLength[c] = 0;
+	  restructured = true;
+	 }
+	 else if (chunkLength[c] == CHUNK_SIZE) {
+	  split(c, CHUNK_SIZE / 2);
+	  if (o > CHUNK_SIZE / 2) {
+	   c++;
+	   o -= CHUNK_SIZE / 2;
+	  }
+	  restructured = true;
+	 }
+	 ensureChunkCapacity(c, chunkLength[c] + 1);
+	 final byte[] t = chunk[c];
+	 System.arraycopy(t, o, t, o + 1, chunkLength[c] - o);
+	 t[o] = k;
+	 chunkLength[c]++;
+	 size++;
+	 if (restructured) rebuild();
+	 else update(c, 1);
+	}
+	@Override
+	public byte removeByte(final int index) {
+	 if (index < 0 || index >= size) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + size + ")");
+	 final long p = locate(index);
+	 final int c = (int)(p >>> 32), o = (int)p;
+	 final byte[] t = chunk[c];
+	 final byte old = t[o];
+	 System.arraycopy(t, o + 1, t, o, --chunkLength[c] - o);
+	 size--;
+	 if (! compact(c)) update(c, -1);
+	 return old;
+	}
+	@Override
+	public void addElements(final int index, final byte a[], int offset, final int length) {
+	 ensureIndex(index);
+	 ByteArrays.ensureOffsetLength(a, offset, length);
+	 if (length == 0) return;
+	 if (size + length < 0) throw new IllegalStateException("Too many elements");
+	 final long p = locate(index);
+	 int c = (int)(p >>> 32), o = (int)p;
+	 if (o == 0 && c > 0 && chunkLength[c - 1] + length <= CHUNK_SIZE) o = chunkLength[--c];
+	 if (c < chunks && chunkLength[c] + length <= CHUNK_SIZE) {
+	  // The elements fit in an existing chunk
+	  ensureChunkCapacity(c, chunkLength[c] + length);
+	  final byte[] t = chunk[c];
+	  System.arraycopy(t, o, t, o + length, chunkLength[c] - o);
+	  System.arraycopy(a, offset, t, o, length);
+	  chunkLength[c] += length;
+	  size += length;
+	  update(c, length);
+	  return;
+	 }
+	 // We split the chunk containing index and insert new chunks of similar length in between
+	 if (o != 0) split(c++, o);
+	 final int k = (int)((long)length + CHUNK_SIZE - 1 >>> LOG2_CHUNK_SIZE);
+	 insertChunks(c, k);
+	 for (int i = 0; i < k; i++) {
+	  final int l = length / k + (i < length % k ? 1 : 0);
+	  chunk[c + i] = Arrays.copyOfRange(a, offset, offset + l);
+	  chunkLength[c + i] = l;
+	  offset += l;
+	 }
+	 size += length;
+	 rebuild();
+	}
+	@Override
+	public void removeElements(final int from, final int to) {
+	 it.unimi.dsi.fastutil.Arrays.ensureFromTo(size, from, to);
+	 if (from == to) return;
+	 final long p = locate(from), q = locate(to);
+	 final int cf = (int)(p >>> 32), of = (int)p, ct = (int)(q >>> 32), ot = (int)q;
+	 size -= to - from;
+	 if (cf == ct) {
+	  final byte[] t = chunk[cf];
+	  System.arraycopy(t, ot, t, of, chunkLength[cf] - ot);
+	  chunkLength[cf] -= to - from;
+	  if (! compact(cf)) update(cf, -(to - from));
+	  return;
+	 }
+	 // We trim the first and the last chunk, and drop the chunks in between
+	 if (ot != 0) {
+	  final byte[] t = chunk[ct];
+	  System.arraycopy(t, ot, t, 0, chunkLength[ct] - ot);
+	  chunkLength[ct] -= ot;
+	 }
+	 chunkLength[cf] = of;
+	 final int first = of == 0 ? cf : cf + 1;
+	 removeChunks(first, ct - first);
+	 rebuild();
+	 if (first < chunks) compact(first);
+	 if (first > 0) compact(first - 1);
+	}
+	@Override
+	public void getElements(final int from, final byte[] a, int offset, int length) {
+	 ByteArrays.ensureOffsetLength(a, offset, length);
+	 if (from < 0 || from + length > size) throw new IndexOutOfBoundsException("Range [" + from + ".." + (from + length) + ") is out of bounds for list size " + size);
+	 if (length == 0) return;
+	 final long p = locate(from);
+	 int c = (int)(p >>> 32), o = (int)p;
+	 while (length != 0) {
+	  final int l = Math.min(length, chunkLength[c] - o);
+	  System.arraycopy(chunk[c], o, a, offset, l);
+	  offset += l;
+	  length -= l;
+	  c++;
+	  o = 0;
+	 }
+	}
+	@Override
+	public boolean addAll(final int index, final ByteCollection c) {
+	 final byte[] t = c.toByteArray();
+	 addElements(index, t);
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final int index, final Collection<? extends Byte> c) {
+	 final byte[] t = unwrap(c);
+	 addElements(index, t);
+	 return t.length != 0;
+	}
+	@Override
+	public int size() {
+	 return size;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return size == 0;
+	}
+	@Override
+	public void clear() {
+	 allocate(0);
+	}
+	@Override
+	public void forEach(final ByteConsumer action) {
+	 for (int c = 0; c < chunks; c++) {
+	  final byte[] t = chunk[c];
+	  for (int i = 0, l = chunkLength[c]; i < l; i++) action.accept(t[i]);
+	 }
+	}
+	@Override
+	public int indexOf(final byte k) {
+	 for (int c = 0, start = 0; c < chunks; start += chunkLength[c++]) {
+	  final byte[] t = chunk[c];
+	  for (int i = 0, l = chunkLength[c]; i < l; i++) if (( (k) == (t[i]) )) return start + i;
+	 }
+	 return -1;
+	}
+	@Override
+	public int lastIndexOf(final byte k) {
+	 for (int c = chunks, end = size; c-- != 0;) {
+	  final byte[] t = chunk[c];
+	  end -= chunkLength[c];
+	  for (int i = chunkLength[c]; i-- != 0;) if (( (k) == (t[i]) )) return end + i;
+	 }
+	 return -1;
+	}
+	/** A list iterator that scans chunks sequentially. */
+	private final class ChunkedListIterator implements ByteListIterator {
+	 /** The index of the next element to be returned. */
+	 int index;
+	 /** The chunk containing the element of index {@link #index}, or -1 if it must be recomputed. */
+	 int c = -1;
+	 /** The offset in {@link #c} of the element of index {@link #index}. */
+	 int o;
+	 /** The index of the last returned element, or -1. */
+	 int last = -1;
+	 ChunkedListIterator(final int index) {
+	  this.index = index;
+	 }
+	 /** Computes {@link #c} and {@link #o} from {@link #index}, if necessary. */
+	 private void sync() {
+	  if (c == -1) {
+	   final long p = locate(index);
+	   c = (int)(p >>> 32);
+	   o = (int)p;
+	  }
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return index < size;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return index > 0;
+	 }
+	 @Override
+	 public int nextIndex() {
+	  return index;
+	 }
+	 @Override
+	 public int previousIndex() {
+	  return index - 1;
+	 }
+	 @Override
+	 public byte nextByte() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  sync();
+	  if (o == chunkLength[c]) {
+	   c++;
+	   o = 0;
+	  }
+	  last = index++;
+	  return chunk[c][o++];
+	 }
+	 @Override
+	 public byte previousByte() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  sync();
+	  if (o == 0) o = chunkLength[--c];
+	  last = --index;
+	  return chunk[c][--o];
+	 }
+	 @Override
+	 public void forEachRemaining(final ByteConsumer action) {
+	  if (! hasNext()) return;
+	  sync();
+	  while (index < size) {
+	   if (o == chunkLength[c]) {
+	    c++;
+	    o = 0;
+	   }
+	   final byte[] t = chunk[c];
+	   final int l = chunkLength[c];
+	   while (o < l) {
+	    action.accept(t[o++]);
+	    index++;
+	   }
+	  }
+	  last = index - 1;
+	 }
+	 @Override
+	 public void set(final byte k) {
+	  if (last == -1) throw new IllegalStateException();
+	  ByteChunkedList.this.set(last, k);
+	 }
+	 @Override
+	 public void add(final byte k) {
+	  ByteChunkedList.this.add(index++, k);
+	  last = -1;
+	  c = -1;
+	 }
+	 @Override
+	 public void remove() {
+	  if (last == -1) throw new IllegalStateException();
+	  ByteChunkedList.this.removeByte(last);
+	  if (last < index) index--;
+	  last = -1;
+	  c = -1;
+	 }
+	 @Override
+	 public int skip(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, size - index);
+	  if (skipped != 0) {
+	   index += skipped;
+	   last = index - 1;
+	   c = -1;
+	  }
+	  return skipped;
+	 }
+	 @Override
+	 public int back(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, index);
+	  if (skipped != 0) {
+	   index -= skipped;
+	   last = index;
+	   c = -1;
+	  }
+	  return skipped;
+	 }
+	}
+	@Override
+	public ByteListIterator listIterator(final int index) {
+	 ensureIndex(index);
+	 return new ChunkedListIterator(index);
+	}
+	/** A late-binding spliterator that scans chunks sequentially and splits at chunk boundaries. */
+	private final class ChunkedSpliterator implements ByteSpliterator {
+	 /** The index of the next element to be returned. */
+	 int index;
+	 /** The index of the first element not returned by this spliterator, or -1 if not bound yet. */
+	 int max;
+	 /** The chunk containing the element of index {@link #index}, or -1 if it must be recomputed. */
+	 int c = -1;
+	 /** The offset in {@link #c} of the element of index {@link #index}. */
+	 int o;
+	 ChunkedSpliterator(final int index, final int max) {
+	  this.index = index;
+	  this.max = max;
+	 }
+	 /** Returns the index of the first element not returned by this spliterator, binding it if necessary. */
+	 private int max() {
+	  if (max == -1) max = size;
+	  return max;
+	 }
+	 /** Computes {@link #c} and {@link #o} from {@link #index}, if necessary, and moves to the next chunk if the current one is exhausted. */
+	 private void sync() {
+	  if (c == -1) {
+	   final long p = locate(index);
+	   c = (int)(p >>> 32);
+	   o = (int)p;
+	  }
+	  if (o == chunkLength[c]) {
+	   c++;
+	   o = 0;
+	  }
+	 }
+	 @Override
+	 public int characteristics() {
+	  return ByteSpliterators.LIST_SPLITERATOR_CHARACTERISTICS;
+	 }
+	 @Override
+	 public long estimateSize() {
+	  return max() - index;
+	 }
+	 @Override
+	 public boolean tryAdvance(final ByteConsumer action) {
+	  if (index >= max()) return false;
+	  sync();
+	  index++;
+	  action.accept(chunk[c][o++]);
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final ByteConsumer action) {
+	  final int max = max();
+	  while (index < max) {
+	   sync();
+	   final byte[] t = chunk[c];
+	   final int l = Math.min(chunkLength[c] - o, max - index);
+	   for (int i = 0; i < l; i++) action.accept(t[o++]);
+	   index += l;
+	  }
+	 }
+	 @Override
+	 public long skip(final long n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = (int)Math.min(n, max() - index);
+	  if (skipped != 0) {
+	   index += skipped;
+	   c = -1;
+	  }
+	  return skipped;
+	 }
+	 @Override
+	 public ByteSpliterator trySplit() {
+	  final int max = max();
+	  if (max - index < 2) return null;
+	  int mid = index + (max - index >>> 1);
+	  // We move the split point to the start of its chunk, if this does not empty the prefix
+	  final int start = mid - (int)locate(mid);
+	  if (start > index) mid = start;
+	  final ChunkedSpliterator prefix = new ChunkedSpliterator(index, mid);
+	  prefix.c = c;
+	  prefix.o = o;
+	  index = mid;
+	  c = -1;
+	  return prefix;
+	 }
+	}
+	@Override
+	public ByteSpliterator spliterator() {
+	 return new ChunkedSpliterator(0, -1);
+	}
+	@Override
+	public ByteChunkedList clone() {
+	 final ByteChunkedList c;
+	 try {
+	  c = (ByteChunkedList)super.clone();
+	 }
+	 catch(final CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.chunk = new byte[chunk.length][];
+	 for (int i = 0; i < chunks; i++) c.chunk[i] = chunk[i].clone();
+	 c.chunkLength = chunkLength.clone();
+	 c.tree = tree.clone();
+	 return c;
+	}
+	private void writeObject(final java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(size);
+	 for (int c = 0; c < chunks; c++) {
+	  final byte[] t = chunk[c];
+	  for (int i = 0, l = chunkLength[c]; i < l; i++) s.writeByte(t[i]);
+	 }
+	}
+	private void readObject(final java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 allocate(s.readInt());
+	 for (int c = 0; c < chunks; c++) {
+	  final byte[] t = chunk[c];
+	  for (int i = 0, l = chunkLength[c]; i < l; i++) t[i] = s.readByte();
+	 }
+	}
+}
@@ -0,0 +1,345 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import static it.unimi.dsi.fastutil.bytes.ByteArrayFrontCodedList.count;
+import it.unimi.dsi.fastutil.objects.AbstractObjectBigList;
+import it.unimi.dsi.fastutil.objects.ObjectBigListIterator;
+import it.unimi.dsi.fastutil.longs.LongMappedBigList;
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.util.NoSuchElementException;
+import java.util.RandomAccess;
+/** A front-coded big list of arrays read directly from memory-mapped files.
+	*
+	* <p>This class exposes the files written by the {@code dump()} method of the corresponding front-coded big list
+	* (the compressed arrays and the pointers to entire arrays) as an immutable big list of arrays. The files are
+	* {@linkplain #map(FileChannel, FileChannel, int) mapped} using two mapped big lists, so opening the list
+	* requires no deserialization, no heap copy and no rescan of the data, independently of its size;
+	* lookups then read directly from mapped memory, and pages are loaded by the operating system on demand.
+	*
+	* <p>Instances of this class are not thread safe, but the {@link #copy()} method provides a lightweight
+	* duplicate that can be read independently by another thread.
+	*/
+public class ByteMappedArrayFrontCodedBigList extends AbstractObjectBigList<byte[]> implements RandomAccess {
+	/** The number of arrays in the list. */
+	protected final long n;
+	/** The ratio of this front-coded list. */
+	protected final int ratio;
+	/** The mapped big list containing the compressed arrays. */
+	protected final ByteMappedBigList array;
+	/** The mapped pointers to entire arrays in the list. */
+	protected final LongMappedBigList p;
+	/** Creates a new mapped front-coded big list.
+	 *
+	 * @param array the mapped big list containing the compressed arrays.
+	 * @param p the mapped pointers to entire arrays in the list.
+	 * @param n the number of arrays in the list.
+	 * @param ratio the ratio of the list.
+	 */
+	protected ByteMappedArrayFrontCodedBigList(final ByteMappedBigList array, final LongMappedBigList p, final long n, final int ratio) {
+	 if (ratio < 1) throw new IllegalArgumentException("Illegal ratio (" + ratio + ")");
+	 if (p.size64() != (n + ratio - 1) / ratio) throw new IllegalArgumentException("The number of pointers (" + p.size64() + ") is not compatible with " + n + " arrays and ratio " + ratio);
+	 this.array = array;
+	 this.p = p;
+	 this.n = n;
+	 this.ratio = ratio;
+	}
+	/** Maps the files written by the {@code dump()} method of a front-coded big list.
+	 *
+	 * @param array a file channel on the compressed arrays.
+	 * @param pointers a file channel on the pointers.
+	 * @param ratio the ratio of the dumped list.
+	 * @return a mapped front-coded big list with the same content of the dumped list.
+	 */
+	public static ByteMappedArrayFrontCodedBigList map(final FileChannel array, final FileChannel pointers, final int ratio) throws IOException {
+	 return map(array, pointers, ratio, ByteOrder.BIG_ENDIAN);
+	}
+	/** Maps a compressed array file and a pointer file using a given byte order.
+	 *
+	 * <p>The number of arrays is computed by scanning the last block of arrays, and the ratio is
+	 * checked by scanning the first block, so this method runs in time proportional to the ratio.
+	 * Since the ratio is not stored in the files, a wrong ratio is detected only when the list contains
+	 * more than one block; otherwise, the arrays are all in the same block, and any ratio larger than or
+	 * equal to their number yields the same list.
+	 *
+	 * @param array a file channel on the compressed arrays.
+	 * @param pointers a file channel on the pointers.
+	 * @param ratio the ratio of the mapped list.
+	 * @param byteOrder the byte order of the two files.
+	 * @return a mapped front-coded big list over the content of the two files.
+	 * @throws IllegalArgumentException if the files do not match the ratio.
+	 */
+	public static ByteMappedArrayFrontCodedBigList map(final FileChannel array, final FileChannel pointers, final int ratio, final ByteOrder byteOrder) throws IOException {
+	 if (ratio < 1) throw new IllegalArgumentException("Illegal ratio (" + ratio + ")");
+	 final ByteMappedBigList a = ByteMappedBigList.map(array, byteOrder);
+	 final LongMappedBigList p = LongMappedBigList.map(pointers, byteOrder);
+	 final long blocks = p.size64();
+	 long n = 0;
+	 if (blocks > 1) {
+	  // Decoding exactly ratio arrays from the first block must end at the second block
+	  final long next = p.getLong(1);
+	  long pos = p.getLong(0);
+	  int length = readInt(a, pos);
+	  pos += count(length) + length;
+	  int i;
+	  for (i = 1; i < ratio && pos < next; i++) {
+	   length = readInt(a, pos);
+	   pos += count(length) + count(readInt(a, pos + count(length))) + length;
+	  }
+	  if (i != ratio || pos != next) throw new IllegalArgumentException("The array file does not match the pointer file and ratio " + ratio);
+	 }
+	 if (blocks != 0) {
+	  // Count the arrays in the last block
+	  long pos = p.getLong(blocks - 1);
+	  int length = readInt(a, pos);
+	  pos += count(length) + length;
+	  n = (blocks - 1) * ratio + 1;
+	  while (pos < a.size64()) {
+	   length = readInt(a, pos);
+	   pos += count(length) + count(readInt(a, pos + count(length))) + length;
+	   n++;
+	  }
+	  if (pos != a.size64() || n > blocks * ratio) throw new IllegalArgumentException("The array file does not match the pointer file and ratio " + ratio);
+	 }
+	 return new ByteMappedArrayFrontCodedBigList(a, p, n, ratio);
+	}
+	/** Reads a coded length.
+	 * @param a the mapped data.
+	 * @param pos the starting position.
+	 * @return the decoded length.
+	 */
+	private static int readInt(final ByteMappedBigList a, long pos) {
+	 final byte b0 = a.getByte(pos);
+	 if (b0 >= 0) return b0;
+	 final byte b1 = a.getByte(pos + 1);
+	 if (b1 >= 0) return (- b0 - 1) << 7 | b1;
+	 final byte b2 = a.getByte(pos + 2);
+	 if (b2 >= 0) return (- b0 - 1) << 14 | (- b1 - 1) << 7 | b2;
+	 final byte b3 = a.getByte(pos + 3);
+	 if (b3 >= 0) return (- b0 - 1) << 21 | (- b1 - 1) << 14 | (- b2 - 1) << 7 | b3;
+	 return (- b0 - 1) << 28 | (- b1 - 1) << 21 | (- b2 - 1) << 14 | (- b3 - 1) << 7 | a.getByte(pos + 4);
+	}
+	/** Returns a lightweight duplicate that can be read independently by another thread.
+	 *
+	 * @return a lightweight duplicate that can be read independently by another thread.
+	 */
+	public ByteMappedArrayFrontCodedBigList copy() {
+	 return new ByteMappedArrayFrontCodedBigList(array.copy(), p.copy(), n, ratio);
+	}
+	public int ratio() {
+	 return ratio;
+	}
+	/** Computes the length of the array at the given index.
+	 *
+	 * <p>This private version of {@link #arrayLength(long)} does not check its argument.
+	 *
+	 * @param index an index.
+	 * @return the length of the {@code index}-th array.
+	 */
+	private int length(final long index) {
+	 final ByteMappedBigList array = this.array;
+	 final int delta = (int)(index % ratio); // The index into the p array, and the delta inside the block.
+	 long pos = p.getLong(index / ratio); // The position into the array of the first entire word before the index-th.
+	 int length = readInt(array, pos);
+	 if (delta == 0) return length;
+	 // First of all, we recover the array length and the maximum amount of copied elements.
+	 int common;
+	 pos += count(length) + length;
+	 length = readInt(array, pos);
+	 common = readInt(array, pos + count(length));
+	 for(int i = 0; i < delta - 1; i++) {
+	  pos += count(length) + count(common) + length;
+	  length = readInt(array, pos);
+	  common = readInt(array, pos + count(length));
+	 }
+	 return length + common;
+	}
+	/** Computes the length of the array at the given index.
+	 *
+	 * @param index an index.
+	 * @return the length of the {@code index}-th array.
+	 */
+	public int arrayLength(final long index) {
+	 ensureRestrictedIndex(index);
+	 return length(index);
+	}
+	/** Extracts the array at the given index.
+	 *
+	 * @param index an index.
+	 * @param a the array that will store the result (we assume that it can hold the result).
+	 * @param offset an offset into {@code a} where elements will be store.
+	 * @param length a maximum number of elements to store in {@code a}.
+	 * @return the length of the extracted array.
+	 */
+	private int extract(final long index, final byte a[], final int offset, final int length) {
+	 final int delta = (int)(index % ratio); // The delta inside the block.
+	 final long startPos = p.getLong(index / ratio); // The position into the array of the first entire word before the index-th.
+	 long pos, prevArrayPos;
+	 int arrayLength = readInt(array, pos = startPos), currLen = 0, actualCommon;
+	 if (delta == 0) {
+	  pos = startPos + count(arrayLength);
+	  array.getElements(pos, a, offset, Math.min(length, arrayLength));
+	  return arrayLength;
+	 }
+	 int common = 0;
+	 for(int i = 0; i < delta; i++) {
+	  prevArrayPos = pos + count(arrayLength) + (i != 0 ? count(common) : 0);
+	  pos = prevArrayPos + arrayLength;
+	  arrayLength = readInt(array, pos);
+	  common = readInt(array, pos + count(arrayLength));
+	  actualCommon = Math.min(common, length);
+	  if (actualCommon <= currLen) currLen = actualCommon;
+	  else {
+	   array.getElements(prevArrayPos, a, currLen + offset, actualCommon - currLen);
+	   currLen = actualCommon;
+	  }
+	 }
+	 if (currLen < length) array.getElements(pos + count(arrayLength) + count(common), a, currLen + offset, Math.min(arrayLength, length - currLen));
+	 return arrayLength + common;
+	}
+	/** {@inheritDoc}
+	 * @implSpec This implementation delegates to {@link #getArray(long)}. */
+	@Override
+	public byte[] get(final long index) {
+	 return getArray(index);
+	}
+	/** Returns an array stored in this front-coded list.
+	 *
+	 * @param index an index.
+	 * @return the corresponding array stored in this front-coded list.
+	 */
+	public byte[] getArray(final long index) {
+	 ensureRestrictedIndex(index);
+	 final int length = length(index);
+	 final byte a[] = new byte[length];
+	 extract(index, a, 0, length);
+	 return a;
+	}
+	/** Stores in the given array elements from an array stored in this front-coded list.
+	 *
+	 * @param index an index.
+	 * @param a the array that will store the result.
+	 * @param offset an offset into {@code a} where elements will be store.
+	 * @param length a maximum number of elements to store in {@code a}.
+	 * @return if {@code a} can hold the extracted elements, the number of extracted elements;
+	 * otherwise, the number of remaining elements with the sign changed.
+	 */
+	public int get(final long index, final byte[] a, final int offset, final int length) {
+	 ensureRestrictedIndex(index);
+	 ByteArrays.ensureOffsetLength(a, offset, length);
+	 final int arrayLength = extract(index, a, offset, length);
+	 if (length >= arrayLength) return arrayLength;
+	 return length - arrayLength;
+	}
+	/** Stores in the given array an array stored in this front-coded list.
+	 *
+	 * @param index an index.
+	 * @param a the array that will store the content of the result (we assume that it can hold the result).
+	 * @return if {@code a} can hold the extracted elements, the number of extracted elements;
+	 * otherwise, the number of remaining elements with the sign changed.
+	 */
+	public int get(final long index, final byte[] a) {
+	 return get(index, a, 0, a.length);
+	}
+	@Override
+	public long size64() {
+	 return n;
+	}
+	@Override
+	public ObjectBigListIterator<byte[]> listIterator(final long start) {
+	 ensureIndex(start);
+	 return new ObjectBigListIterator<byte[]>() {
+	   byte s[] = ByteArrays.EMPTY_ARRAY;
+	   long i = 0;
+	   long pos = 0;
+	   boolean inSync; // Whether the current value in a is the string just before the next to be produced.
+	   {
+	    if (start != 0) {
+	     if (start == n) i = start; // If we start at the end, we do nothing.
+	     else {
+	      pos = p.getLong(start / ratio);
+	      int j = (int)(start % ratio);
+	      i = start - j;
+	      while(j-- != 0) next();
+	     }
+	    }
+	   }
+	   @Override
+	   public boolean hasNext() {
+	    return i < n;
+	   }
+	   @Override
+	   public boolean hasPrevious() {
+	    return i > 0;
+	   }
+	   @Override
+	   public long previousIndex() {
+	    return i - 1;
+	   }
+	   @Override
+	   public long nextIndex() {
+	    return i;
+	   }
+	   @Override
+	   public byte[] next() {
+	    int length, common;
+	    if (! hasNext()) throw new NoSuchElementException();
+	    if (i % ratio == 0) {
+	     pos = p.getLong(i / ratio);
+	     length = readInt(array, pos);
+	     s = ByteArrays.ensureCapacity(s, length, 0);
+	     array.getElements(pos + count(length), s, 0, length);
+	     pos += length + count(length);
+	     inSync = true;
+	    }
+	    else {
+	     if (inSync) {
+	      length = readInt(array, pos);
+	      common = readInt(array, pos + count(length));
+	      s = ByteArrays.ensureCapacity(s, length + common, common);
+	      array.getElements(pos + count(length) + count (common), s, common, length);
+	      pos += count(length) + count(common) + length;
+	      length += common;
+	     }
+	     else {
+	      s = ByteArrays.ensureCapacity(s, length = length(i), 0);
+	      extract(i, s, 0, length);
+	     }
+	    }
+	    i++;
+	    return ByteArrays.copy(s, 0, length);
+	   }
+	   @Override
+	   public byte[] previous() {
+	    if (! hasPrevious()) throw new NoSuchElementException();
+	    inSync = false;
+	    return getArray(--i);
+	   }
+	  };
+	}
+	@Override
+	public String toString() {
+	 final StringBuffer s = new StringBuffer();
+	 s.append("[");
+	 for(long i = 0; i < n; i++) {
+	  if (i != 0) s.append(", ");
+	  s.append(ByteArrayList.wrap(getArray(i)).toString());
+	 }
+	 s.append("]");
+	 return s.toString();
+	}
+}
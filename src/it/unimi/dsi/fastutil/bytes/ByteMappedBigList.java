@@ -23,6 +23,8 @@ import java.nio.MappedByteBuffer;
 import java.nio.channels.FileChannel;
 import java.nio.channels.FileChannel.MapMode;
 import java.util.Arrays;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.RecursiveAction;
 /** A bridge between byte {@linkplain ByteBuffer buffers} and type-specific {@linkplain it.unimi.dsi.fastutil.BigList big lists}.
 	*
 	* <p>Java's {@linkplain FileChannel#map(MapMode, long, long) memory-mapping facilities} have
@@ -39,6 +41,13 @@ import java.util.Arrays;
 	* duplicate that can be read independently by another thread.
 	* Only chunks that are actually used will be {@linkplain ByteBuffer#duplicate() duplicated} lazily.
 	* If you are modifiying the content of list, however, you will need to provide external synchronization.
+	* For the same reason, the {@linkplain #spliterator() spliterator} of this class splits preferably at chunk boundaries,
+	* and each split duplicates lazily the chunks it uses, so that parallel streams scale with the number of threads.
+	*
+	* <p>Cold scans of a mapped big list are bound by the latency of page faults, which
+	* happen one at a time. The {@link #prefetch(long, long)} and {@link #load()} methods
+	* touch in parallel the pages backing a range of elements, so that the content of the file is read
+	* into memory at the bandwidth of the storage device.
 	* 
 	* @author Sebastiano Vigna
 	*/
@@ -53,11 +62,17 @@ public class ByteMappedBigList extends AbstractByteBigList {
 	public static final long CHUNK_SIZE = 1L << CHUNK_SHIFT;
 	/** The mask used to compute the offset in the chunk in longs. */
 	private static final long CHUNK_MASK = CHUNK_SIZE - 1;
+	/** The granularity, in bytes, of the pages touched by {@link #prefetch(long, long)}. */
+	private static final int PAGE_SIZE = 1 << 12;
+	/** The number of bytes below which {@link #prefetch(long, long)} does not split further the range to touch. */
+	private static final long PREFETCH_GRAIN = 1 << 24;
 	/** The underlying buffers. */
 	private final ByteBuffer[] buffer;
 	/** An array parallel to {@link #buffer} specifying which buffers do not need to be
 	 * duplicated before being used. */
 	private final boolean[] readyToUse;
+	/** The mapped byte buffers underlying {@link #buffer}, or {@code null} if this list was not created by mapping a file. */
+	private final MappedByteBuffer[] mapped;
 	/** The number of byte buffers. */
 	private final int n;
 	/** The overall size in elements. */
@@ -72,7 +87,11 @@ public class ByteMappedBigList extends AbstractByteBigList {
 	 * will be used internally by the newly created mapped big list.
 	 */
 	protected ByteMappedBigList(final ByteBuffer[] buffer, final long size, final boolean[] readyToUse) {
+	 this(buffer, size, readyToUse, null);
+	}
+	private ByteMappedBigList(final ByteBuffer[] buffer, final long size, final boolean[] readyToUse, final MappedByteBuffer[] mapped) {
 	 this.buffer = buffer;
+	 this.mapped = mapped;
 	 this.n = buffer.length;
 	 this.size = size;
 	 this.readyToUse = readyToUse;
@@ -112,10 +131,14 @@ public class ByteMappedBigList extends AbstractByteBigList {
 	 final long size = fileChannel.size() / Byte.BYTES;
 	 final int chunks = (int)((size + (CHUNK_SIZE - 1)) / CHUNK_SIZE);
 	 final ByteBuffer[] buffer = new ByteBuffer[chunks];
-	 for(int i = 0; i < chunks; i++) buffer[i] = fileChannel.map(mapMode, i * CHUNK_SIZE * Byte.BYTES, Math.min(CHUNK_SIZE, size - i * CHUNK_SIZE) * Byte.BYTES);
+	 final MappedByteBuffer[] mapped = new MappedByteBuffer[chunks];
+	 for(int i = 0; i < chunks; i++) {
+	  mapped[i] = fileChannel.map(mapMode, i * CHUNK_SIZE * Byte.BYTES, Math.min(CHUNK_SIZE, size - i * CHUNK_SIZE) * Byte.BYTES);
+	  buffer[i] = mapped[i];
+	 }
 	 final boolean[] readyToUse = new boolean[chunks];
 	 Arrays.fill(readyToUse, true);
-	 return new ByteMappedBigList(buffer, size, readyToUse);
+	 return new ByteMappedBigList(buffer, size, readyToUse, mapped);
 	}
 	private ByteBuffer ByteBuffer(final int n) {
 	 if (readyToUse[n]) return buffer[n];
@@ -128,7 +151,77 @@ public class ByteMappedBigList extends AbstractByteBigList {
 	 * @return a lightweight duplicate that can be read independently by another thread.
 	 */
 	public ByteMappedBigList copy() {
-	 return new ByteMappedBigList(buffer.clone(), size, new boolean[n]);
+	 return new ByteMappedBigList(buffer.clone(), size, new boolean[n], mapped);
+	}
+	/** A recursive action touching a page every {@link #PAGE_SIZE} bytes in a range of mapped byte buffers. */
+	private static final class Prefetcher extends RecursiveAction {
+	 private static final long serialVersionUID = 1L;
+	 private final MappedByteBuffer[] mapped;
+	 private final long from;
+	 private final long to;
+	 /** The exclusive or of the touched bytes, stored so that reads are not optimized away. */
+	 @SuppressWarnings("unused")
+	 private byte sink;
+	 /** Creates a new prefetcher.
+		 *
+		 * @param mapped the mapped byte buffers, each containing a chunk.
+		 * @param from the first byte to touch, a multiple of {@link #PAGE_SIZE}.
+		 * @param to one past the last byte to touch.
+		 */
+	 public Prefetcher(final MappedByteBuffer[] mapped, final long from, final long to) {
+	  this.mapped = mapped;
+	  this.from = from;
+	  this.to = to;
+	 }
+	 @Override
+	 protected void compute() {
+	  if (to - from > PREFETCH_GRAIN) {
+	   final long mid = (from + to) >>> 1 & -PAGE_SIZE;
+	   invokeAll(new Prefetcher(mapped, from, mid), new Prefetcher(mapped, mid, to));
+	   return;
+	  }
+	  final int chunkShift = CHUNK_SHIFT + LOG2_BYTES;
+	  final long chunkMask = (1L << chunkShift) - 1;
+	  byte x = 0;
+	  for (long p = from; p < to; p += PAGE_SIZE) x ^= mapped[(int)(p >>> chunkShift)].get((int)(p & chunkMask));
+	  sink = x;
+	 }
+	}
+	/** Brings into memory the pages of the underlying file containing a range of elements.
+	 *
+	 * <p>Pages are touched in parallel using the {@linkplain ForkJoinPool#commonPool() common pool}, so that
+	 * many page faults are outstanding at the same time. Like {@link MappedByteBuffer#load()}, this method is
+	 * just a best effort: there is no guarantee that the pages will still be resident when they will be accessed.
+	 *
+	 * <p>This method has no effect if this list was not created by mapping a file.
+	 *
+	 * @param from the index of the first element to prefetch (inclusive).
+	 * @param to the index of the last element to prefetch (exclusive).
+	 */
+	public void prefetch(final long from, final long to) {
+	 ensureIndex(from);
+	 ensureIndex(to);
+	 if (from > to) throw new IndexOutOfBoundsException("Start index (" + from + ") is greater than end index (" + to + ")");
+	 if (mapped == null || from == to) return;
+	 ForkJoinPool.commonPool().invoke(new Prefetcher(mapped, (from << LOG2_BYTES) & -PAGE_SIZE, to << LOG2_BYTES));
+	}
+	/** Brings into memory the whole underlying file.
+	 *
+	 * @see #prefetch(long, long)
+	 */
+	public void load() {
+	 prefetch(0, size);
+	}
+	/** Returns whether it is likely that the whole underlying file is resident in physical memory.
+	 *
+	 * @return true if it is likely that the whole underlying file is resident in physical memory; always
+	 * false if this list was not created by mapping a file.
+	 * @see MappedByteBuffer#isLoaded()
+	 */
+	public boolean isLoaded() {
+	 if (mapped == null) return false;
+	 for (final MappedByteBuffer m : mapped) if (! m.isLoaded()) return false;
+	 return true;
 	}
 	@Override
 	public byte getByte(final long index) {
@@ -165,4 +258,74 @@ public class ByteMappedBigList extends AbstractByteBigList {
 	public long size64() {
 	 return size;
 	}
+	private final class Spliterator implements ByteSpliterator {
+	 /** Lazily duplicated buffers private to this spliterator. */
+	 private final ByteBuffer[] buffer = new ByteBuffer[n];
+	 private long pos, max;
+	 private Spliterator(final long pos, final long max) {
+	  assert pos <= max : "pos " + pos + " must be <= max " + max;
+	  this.pos = pos;
+	  this.max = max;
+	 }
+	 private ByteBuffer ByteBuffer(final int chunk) {
+	  final ByteBuffer b = buffer[chunk];
+	  if (b != null) return b;
+	  return buffer[chunk] = ByteMappedBigList.this.buffer[chunk].duplicate();
+	 }
+	 @Override
+	 public int characteristics() { return ByteSpliterators.LIST_SPLITERATOR_CHARACTERISTICS; }
+	 @Override
+	 public long estimateSize() { return max - pos; }
+	 @Override
+	 public boolean tryAdvance(final ByteConsumer action) {
+	  if (pos >= max) return false;
+	  action.accept(ByteBuffer((int)(pos >>> CHUNK_SHIFT)).get((int)(pos & CHUNK_MASK)));
+	  pos++;
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final ByteConsumer action) {
+	  while (pos < max) {
+	   final ByteBuffer b = ByteBuffer((int)(pos >>> CHUNK_SHIFT));
+	   final int from = (int)(pos & CHUNK_MASK);
+	   final int to = (int)Math.min(b.capacity(), from + (max - pos));
+	   for (int i = from; i < to; i++) action.accept(b.get(i));
+	   pos += to - from;
+	  }
+	 }
+	 @Override
+	 public long skip(long n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  if (pos >= max) return 0;
+	  final long remaining = max - pos;
+	  if (n < remaining) {
+	   pos += n;
+	   return n;
+	  }
+	  n = remaining;
+	  pos = max;
+	  return n;
+	 }
+	 @Override
+	 public ByteSpliterator trySplit() {
+	  final long retLen = (max - pos) >> 1;
+	  if (retLen <= 1) return null;
+	  long myNewPos = pos + retLen;
+	  // Align to the nearest chunk boundary if it falls within the range
+	  final long boundary = (myNewPos + CHUNK_SIZE / 2) & ~CHUNK_MASK;
+	  if (boundary > pos && boundary < max) myNewPos = boundary;
+	  final long oldPos = pos;
+	  pos = myNewPos;
+	  return new Spliterator(oldPos, myNewPos);
+	 }
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>The spliterator returned by this method splits preferably at chunk boundaries, and its splits
+	 * use private duplicates of the underlying buffers, so they can be traversed concurrently.
+	 */
+	@Override
+	public ByteSpliterator spliterator() {
+	 return new Spliterator(0, size);
+	}
 }
@@ -0,0 +1,316 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.bytes;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.NoSuchElementException;
+import java.util.SortedSet;
+import java.util.Spliterator;
+/** An immutable sorted set based on a sorted backing array.
+	*
+	* <p>Instances of this class keep their elements sorted in a single array, so they use much less memory
+	* than a tree-based set, and scan much faster. Lookups use a branchless binary search, preceded,
+	* for integral elements in their natural order, by a few rounds of interpolation search.
+	* Subsets are views over a slice of the backing array, and they are created in logarithmic
+	* time without copying any element.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class ByteSortedArraySet extends AbstractByteSortedSet implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The backing array (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient byte[] a;
+	/** The index of the first element of this set in {@link #a}. */
+	protected transient int from;
+	/** The index after the last element of this set in {@link #a}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #a}, or {@code null} for the natural order. */
+	protected ByteComparator comparator;
+	/** Creates a new set backed by a slice of a sorted array containing distinct elements. */
+	protected ByteSortedArraySet(final byte[] a, final int from, final int to, final ByteComparator comparator) {
+	 this.a = a;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new set using the given array, after sorting it and removing duplicates.
+	 *
+	 * @param a an array, which will be modified by this constructor.
+	 * @param size the number of valid elements in {@code a}.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether the first {@code size} elements of {@code a} are already sorted and distinct.
+	 */
+
+	private ByteSortedArraySet(final byte[] a, int size, final ByteComparator comparator, final boolean sorted) {
+	 this.comparator = comparator;
+	 if (! sorted && size > 1) {
+	  if (comparator == null) ByteArrays.quickSort(a, 0, size);
+	  else ByteArrays.quickSort(a, 0, size, comparator);
+	  int j = 0;
+	  for (int i = 1; i < size; i++) if (compare( a[j], a[i]) != 0) a[++j] = a[i];
+	  size = j + 1;
+	 }
+	 this.a = ByteArrays.trim(a, size);
+	 this.from = 0;
+	 this.to = size;
+	}
+	/** Creates a new set containing the elements of an array, using a given comparator.
+	 *
+	 * @param a an array.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 */
+	public ByteSortedArraySet(final byte[] a, final Comparator<? super Byte> c) {
+	 this(a.clone(), a.length, asComparator(c), false);
+	}
+	/** Creates a new set containing the elements of an array.
+	 *
+	 * @param a an array.
+	 */
+	public ByteSortedArraySet(final byte[] a) {
+	 this(a, null);
+	}
+	/** Creates a new set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection.
+	 */
+	public ByteSortedArraySet(final ByteCollection c) {
+	 this(c.toByteArray(), c.size(), null, false);
+	}
+	/** Creates a new set copying a given collection.
+	 *
+	 * @param c a collection.
+	 */
+	public ByteSortedArraySet(final Collection<? extends Byte> c) {
+	 this(toKeyArray(c), c.size(), null, false);
+	}
+	/** Creates a new set copying a given type-specific sorted set (and its comparator).
+	 *
+	 * @param s a type-specific sorted set.
+	 */
+	public ByteSortedArraySet(final ByteSortedSet s) {
+	 this(s.toByteArray(), s.size(), s.comparator(), true);
+	}
+	/** Creates a new set copying a given sorted set (and its comparator).
+	 *
+	 * @param s a sorted set.
+	 */
+	public ByteSortedArraySet(final SortedSet<Byte> s) {
+	 this(toKeyArray(s), s.size(), asComparator(s.comparator()), true);
+	}
+	private static ByteComparator asComparator(final Comparator<? super Byte> c) {
+	 return ByteComparators.asByteComparator(c);
+	}
+	private static byte[] toKeyArray(final Collection<? extends Byte> c) {
+	 final byte[] a = new byte[c.size()];
+	 int i = 0;
+	 for (final Byte k : c) a[i++] = (k).byteValue();
+	 return a;
+	}
+
+	final int compare(final byte k1, final byte k2) {
+	 return comparator == null ? ( Byte.compare((k1),(k2)) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first element of this set greater than or equal to a given key.
+	 *
+	 * @param k a key.
+	 * @return the index in {@link #a} of the first element of this set greater than or equal to {@code k}, or {@link #to}.
+	 */
+
+	final int lowerBound(final byte k) {
+	 return lowerBound(a, from, to, k, comparator);
+	}
+	/** Returns the index of the first element of a sorted array slice greater than or equal to a given key.
+	 *
+	 * <p>The search is branchless. For integral keys in their natural order, a few rounds of
+	 * interpolation search narrow the range first, which for uniformly distributed keys
+	 * brings the range down to a handful of elements.
+	 *
+	 * @param a a sorted array.
+	 * @param from the first index of the slice (inclusive).
+	 * @param to the last index of the slice (exclusive).
+	 * @param k a key.
+	 * @param comparator the comparator used to sort {@code a}, or {@code null} for the natural order.
+	 * @return the index of the first element of the slice greater than or equal to {@code k}, or {@code to}.
+	 */
+
+	static int lowerBound(final byte[] a, int from, final int to, final byte k, final ByteComparator comparator) {
+	 int n = to - from;
+	 if (n == 0) return from;
+	 if (comparator == null) {
+	  int hi = to - 1;
+	  for (int probes = 4; probes-- != 0 && hi - from > 64;) {
+	   final byte lo = a[from], high = a[hi];
+	   if (k <= lo) {
+	    hi = from;
+	    break;
+	   }
+	   if (k > high) return hi + 1;
+	   final int p = Math.min(hi, from + (int)(((double)k - lo) / ((double)high - lo) * (hi - from)));
+	   if (a[p] < k) from = p + 1;
+	   else hi = p;
+	  }
+	  n = hi - from + 1;
+	  while (n > 1) {
+	   final int half = n >>> 1;
+	   from = ( ( a[from + half]) < (k) ) ? from + half : from;
+	   n -= half;
+	  }
+	  return ( ( a[from]) < (k) ) ? from + 1 : from;
+	 }
+	 while (n > 1) {
+	  final int half = n >>> 1;
+	  from = comparator.compare( a[from + half], k) < 0 ? from + half : from;
+	  n -= half;
+	 }
+	 return comparator.compare( a[from], k) < 0 ? from + 1 : from;
+	}
+	@Override
+
+	public boolean contains(final byte k) {
+	 final int i = lowerBound( k);
+	 return i < to && compare( a[i], k) == 0;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+
+	public byte firstByte() {
+	 if (from == to) throw new NoSuchElementException();
+	 return a[from];
+	}
+	@Override
+
+	public byte lastByte() {
+	 if (from == to) throw new NoSuchElementException();
+	 return a[to - 1];
+	}
+	@Override
+	public ByteComparator comparator() {
+	 return comparator;
+	}
+	/** An iterator on a slice of the backing array. */
+	private final class SetIterator implements ByteBidirectionalIterator {
+	 /** The index of the next element to be returned. */
+	 int pos;
+	 SetIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	
+	 public byte nextByte() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return a[pos++];
+	 }
+	 @Override
+	
+	 public byte previousByte() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  return a[--pos];
+	 }
+	 @Override
+	
+	 public void forEachRemaining(final ByteConsumer action) {
+	  final byte[] a = ByteSortedArraySet.this.a;
+	  for (final int max = to; pos < max;) action.accept( a[pos++]);
+	 }
+	 @Override
+	 public int skip(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, to - pos);
+	  pos += skipped;
+	  return skipped;
+	 }
+	 @Override
+	 public int back(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, pos - from);
+	  pos -= skipped;
+	  return skipped;
+	 }
+	}
+	@Override
+	public ByteBidirectionalIterator iterator() {
+	 return new SetIterator(from);
+	}
+	@Override
+
+	public ByteBidirectionalIterator iterator(final byte from) {
+	 int i = lowerBound(from);
+	 if (i < to && compare( a[i], from) == 0) i++;
+	 return new SetIterator(i);
+	}
+	@Override
+
+	public ByteSpliterator spliterator() {
+	 return ByteSpliterators.wrapPreSorted( a, from, to - from, Spliterator.DISTINCT | Spliterator.IMMUTABLE, comparator);
+	}
+	@Override
+
+	public void forEach(final ByteConsumer action) {
+	 final byte[] a = this.a;
+	 for (int i = from, max = to; i < max; i++) action.accept( a[i]);
+	}
+	@Override
+	public ByteSortedSet headSet(final byte to) {
+	 return new ByteSortedArraySet (a, from, lowerBound(to), comparator);
+	}
+	@Override
+	public ByteSortedSet tailSet(final byte from) {
+	 return new ByteSortedArraySet (a, lowerBound(from), to, comparator);
+	}
+	@Override
+	public ByteSortedSet subSet(final byte from, final byte to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start element (" + from + ") is larger than end element (" + to + ")");
+	 return new ByteSortedArraySet (a, lowerBound(from), lowerBound(to), comparator);
+	}
+	@Override
+	public byte[] toByteArray() {
+	 return java.util.Arrays.copyOfRange(a, from, to);
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) s.writeByte(a[i]);
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 a = new byte[to];
+	 for (int i = 0; i < to; i++) a[i] = s.readByte();
+	}
+}
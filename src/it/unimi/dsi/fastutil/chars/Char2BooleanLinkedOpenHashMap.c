@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET CharLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2BooleanLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2BooleanAVLTreeMap
 #define RB_TREE_MAP Char2BooleanRBTreeMap
+#define CACHE Char2BooleanCache
+#define STATIC_FUNCTION Char2BooleanStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET CharOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Char2BooleanOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Char2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2BooleanOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2BooleanOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2BooleanAVLTreeMap
 #define RB_TREE_MAP Char2BooleanRBTreeMap
+#define CACHE Char2BooleanCache
+#define STATIC_FUNCTION Char2BooleanStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
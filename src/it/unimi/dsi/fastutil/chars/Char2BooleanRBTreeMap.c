@@ -315,22 +315,44 @@
 #define OPEN_HASH_BIG_SET CharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedCharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Char2BooleanOpenDoubleHashMap
 #define ARRAY_SET CharArraySet
 #define ARRAY_MAP Char2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET CharLinkedOpenHashSet
 #define AVL_TREE_SET CharAVLTreeSet
 #define RB_TREE_SET CharRBTreeSet
+#define BTREE_SET CharBTreeSet
+#define PERSISTENT_TREE_SET CharPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET CharConcurrentSkipListSet
+#define SORTED_ARRAY_SET CharSortedArraySet
 #define AVL_TREE_MAP Char2BooleanAVLTreeMap
+#define ARENA_TREE_MAP Char2BooleanArenaTreeMap
 #define RB_TREE_MAP Char2BooleanRBTreeMap
+#define BTREE_MAP Char2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Char2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Char2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Char2BooleanSortedArrayMap
+#define CACHE Char2BooleanCache
+#define STATIC_FUNCTION Char2BooleanStaticFunction
+#define BLOOM_FILTER CharBloomFilter
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST CharCopyOnWriteArrayList
+#define CHUNKED_LIST CharChunkedList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
 #define MAPPED_BIG_LIST CharMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST CharAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST CharArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST CharArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST CharMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST CharEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET CharEliasFanoSortedSet
+#define PACKED_BIG_LIST CharPackedBigList
 #define HEAP_PRIORITY_QUEUE CharHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE CharHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE CharHeapIndirectPriorityQueue
@@ -0,0 +1,436 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.chars;
+import it.unimi.dsi.fastutil.objects.AbstractObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSortedSet;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+import it.unimi.dsi.fastutil.booleans.BooleanCollection;
+import it.unimi.dsi.fastutil.booleans.AbstractBooleanCollection;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.SortedMap;
+/** An immutable sorted map based on two parallel sorted backing arrays.
+	*
+	* <p>Instances of this class keep their keys sorted in an array, and the corresponding values in
+	* a parallel array, so they use much less memory than a tree-based map, and scan much faster.
+	* Lookups use the same search strategy of sorted-array sets: a branchless binary search, preceded,
+	* for integral keys in their natural order, by a few rounds of interpolation search.
+	* Submaps and key sets are views over a slice of the backing arrays, and they are created in logarithmic
+	* time without copying any entry.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by the views of this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class Char2BooleanSortedArrayMap extends AbstractChar2BooleanSortedMap implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The sorted keys (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient char[] key;
+	/** The values (parallel to {@link #key}). */
+	protected transient boolean[] value;
+	/** The index of the first entry of this map in {@link #key}. */
+	protected transient int from;
+	/** The index after the last entry of this map in {@link #key}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #key}, or {@code null} for the natural order. */
+	protected CharComparator comparator;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Char2BooleanMap.Entry > entries;
+	/** Cached set of keys. */
+	protected transient CharSortedSet keys;
+	/** Cached collection of values. */
+	protected transient BooleanCollection values;
+	/** Creates a new map backed by a slice of two parallel arrays, the first of which must be sorted and contain distinct keys. */
+	protected Char2BooleanSortedArrayMap(final char[] key, final boolean[] value, final int from, final int to, final CharComparator comparator) {
+	 this.key = key;
+	 this.value = value;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new map using the given parallel arrays, after sorting them by key.
+	 *
+	 * @param key an array of distinct keys, which will be modified by this constructor.
+	 * @param value an array of values, which will be modified by this constructor.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether {@code key} is already sorted.
+	 * @throws IllegalArgumentException if {@code key} and {@code value} have different lengths, or {@code key} contains duplicates.
+	 */
+	private Char2BooleanSortedArrayMap(final char[] key, final boolean[] value, final CharComparator comparator, final boolean sorted) {
+	 this(key, value, 0, key.length, comparator);
+	 if (key.length != value.length) throw new IllegalArgumentException("Keys and values have different lengths (" + key.length + ", " + value.length + ")");
+	 if (! sorted) sort();
+	}
+	/** Sorts the backing arrays by key.
+	 *
+	 * @throws IllegalArgumentException if the keys contain duplicates.
+	 */
+	private void sort() {
+	 final char[] key = this.key;
+	 final boolean[] value = this.value;
+	 it.unimi.dsi.fastutil.Arrays.quickSort(from, to, this::compareAt, (i, j) -> {
+	  final char k = key[i];
+	  key[i] = key[j];
+	  key[j] = k;
+	  final boolean v = value[i];
+	  value[i] = value[j];
+	  value[j] = v;
+	 });
+	 for (int i = from + 1; i < to; i++) if (compareAt(i - 1, i) == 0) throw new IllegalArgumentException("Duplicate key: " + key[i]);
+	}
+	/** Creates a new map using the elements of two parallel arrays and a given comparator.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Char2BooleanSortedArrayMap(final char[] k, final boolean[] v, final Comparator<? super Character> c) {
+	 this(k.clone(), v.clone(), asComparator(c), false);
+	}
+	/** Creates a new map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Char2BooleanSortedArrayMap(final char[] k, final boolean[] v) {
+	 this(k, v, null);
+	}
+	/** Creates a new map copying a given type-specific map.
+	 *
+	 * @param m a type-specific map to be copied into the new map.
+	 */
+	public Char2BooleanSortedArrayMap(final Char2BooleanMap m) {
+	 this(new char[m.size()], new boolean[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given type-specific sorted map (and its comparator).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new map.
+	 */
+	public Char2BooleanSortedArrayMap(final Char2BooleanSortedMap m) {
+	 this(new char[m.size()], new boolean[m.size()], m.comparator(), true);
+	 int i = 0;
+	 for (final Char2BooleanMap.Entry e : m.char2BooleanEntrySet()) {
+	  key[i] = e.getCharKey();
+	  value[i++] = e.getBooleanValue();
+	 }
+	}
+	/** Creates a new map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new map.
+	 */
+	public Char2BooleanSortedArrayMap(final Map<? extends Character, ? extends Boolean> m) {
+	 this(new char[m.size()], new boolean[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given sorted map (and its comparator).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new map.
+	 */
+	public Char2BooleanSortedArrayMap(final SortedMap<Character, Boolean> m) {
+	 this(new char[m.size()], new boolean[m.size()], asComparator(m.comparator()), true);
+	 int i = 0;
+	 for (final Map.Entry<Character, Boolean> e : m.entrySet()) {
+	  key[i] = (e.getKey()).charValue();
+	  value[i++] = (e.getValue()).booleanValue();
+	 }
+	}
+	/** Fills the backing arrays with the entries of a map. */
+
+	private void copy(final Map<? extends Character, ? extends Boolean> m) {
+	 int i = 0;
+	 if (m instanceof Char2BooleanMap) {
+	  for (final Char2BooleanMap.Entry e : ((Char2BooleanMap )m).char2BooleanEntrySet()) {
+	   key[i] = e.getCharKey();
+	   value[i++] = e.getBooleanValue();
+	  }
+	 }
+	 else {
+	  for (final Map.Entry<? extends Character, ? extends Boolean> e : m.entrySet()) {
+	   key[i] = (e.getKey()).charValue();
+	   value[i++] = (e.getValue()).booleanValue();
+	  }
+	 }
+	}
+	private static CharComparator asComparator(final Comparator<? super Character> c) {
+	 return CharComparators.asCharComparator(c);
+	}
+	/** Compares the keys at two given positions of the backing array. */
+
+	private int compareAt(final int i, final int j) {
+	 return comparator == null ? ( Character.compare(( key[i]),( key[j])) ) : comparator.compare( key[i], key[j]);
+	}
+
+	private int compare(final char k1, final char k2) {
+	 return comparator == null ? ( Character.compare((k1),(k2)) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first key of this map greater than or equal to a given key, or {@link #to}. */
+	private int lowerBound(final char k) {
+	 return CharSortedArraySet.lowerBound(key, from, to, k, comparator);
+	}
+	/** Returns the index of a given key in the backing array, or -1 if the key is not in this map. */
+
+	private int findKey(final char k) {
+	 final int i = lowerBound(k);
+	 return i < to && compare( key[i], k) == 0 ? i : -1;
+	}
+	@Override
+
+	public boolean get(final char k) {
+	 final int i = findKey( k);
+	 return i == -1 ? defRetValue : value[i];
+	}
+	@Override
+
+	public boolean containsKey(final char k) {
+	 return findKey( k) != -1;
+	}
+	@Override
+	public boolean containsValue(final boolean v) {
+	 for (int i = from; i < to; i++) if (( (value[i]) == (v) )) return true;
+	 return false;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+
+	public char firstCharKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return key[from];
+	}
+	@Override
+
+	public char lastCharKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return key[to - 1];
+	}
+	@Override
+	public CharComparator comparator() {
+	 return comparator;
+	}
+	/** Returns a view on a range of this map sharing its default return value.
+	 *
+	 * @param from the start of the range in the backing arrays (inclusive).
+	 * @param to the end of the range in the backing arrays (exclusive).
+	 * @return a view on the given range.
+	 */
+	private Char2BooleanSortedArrayMap view(final int from, final int to) {
+	 final Char2BooleanSortedArrayMap m = new Char2BooleanSortedArrayMap (key, value, from, to, comparator);
+	 m.defRetValue = defRetValue;
+	 return m;
+	}
+	@Override
+	public Char2BooleanSortedMap headMap(final char to) {
+	 return view(from, lowerBound(to));
+	}
+	@Override
+	public Char2BooleanSortedMap tailMap(final char from) {
+	 return view(lowerBound(from), to);
+	}
+	@Override
+	public Char2BooleanSortedMap subMap(final char from, final char to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	 return view(lowerBound(from), lowerBound(to));
+	}
+	@Override
+	public CharSortedSet keySet() {
+	 if (keys == null) keys = new CharSortedArraySet (key, from, to, comparator);
+	 return keys;
+	}
+	@Override
+	public BooleanCollection values() {
+	 if (values == null) values = new AbstractBooleanCollection () {
+	  @Override
+	  public boolean contains(final boolean v) {
+	   return containsValue(v);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.booleans.BooleanIterator iterator() {
+	   return it.unimi.dsi.fastutil.booleans.BooleanIterators.wrap( value, from, to - from);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.booleans.BooleanSpliterator spliterator() {
+	   return it.unimi.dsi.fastutil.booleans.BooleanSpliterators.wrap( value, from, to - from, java.util.Spliterator.IMMUTABLE);
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	 };
+	 return values;
+	}
+	/** A bidirectional iterator on the entries of a slice of the backing arrays. */
+	private final class EntryIterator implements ObjectBidirectionalIterator<Char2BooleanMap.Entry > {
+	 /** The index of the next entry to be returned. */
+	 int pos;
+	 EntryIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	
+	 public Char2BooleanMap.Entry next() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return new AbstractChar2BooleanMap.BasicEntry ( key[pos], value[pos++]);
+	 }
+	 @Override
+	
+	 public Char2BooleanMap.Entry previous() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  --pos;
+	  return new AbstractChar2BooleanMap.BasicEntry ( key[pos], value[pos]);
+	 }
+	}
+	/** A spliterator on the entries of a slice of the backing arrays. */
+	private final class EntrySpliterator extends ObjectSpliterators.EarlyBindingSizeIndexBasedSpliterator<Char2BooleanMap.Entry > implements ObjectSpliterator<Char2BooleanMap.Entry > {
+	 EntrySpliterator(final int pos, final int maxPos) {
+	  super(pos, maxPos);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return ObjectSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 }
+	 @Override
+	 public Comparator<? super Char2BooleanMap.Entry > getComparator() {
+	  return char2BooleanEntrySet().comparator();
+	 }
+	 @Override
+	
+	 protected Char2BooleanMap.Entry get(final int location) {
+	  return new AbstractChar2BooleanMap.BasicEntry ( key[location], value[location]);
+	 }
+	 @Override
+	 protected EntrySpliterator makeForSplit(final int pos, final int maxPos) {
+	  return new EntrySpliterator(pos, maxPos);
+	 }
+	}
+	@Override
+	public ObjectSortedSet<Char2BooleanMap.Entry > char2BooleanEntrySet() {
+	 if (entries == null) entries = new AbstractObjectSortedSet<Char2BooleanMap.Entry >() {
+	  final Comparator<? super Char2BooleanMap.Entry > comparator = (x, y) -> Char2BooleanSortedArrayMap.this.compare(x.getCharKey(), y.getCharKey());
+	  @Override
+	  public Comparator<? super Char2BooleanMap.Entry > comparator() {
+	   return comparator;
+	  }
+	  @Override
+	  public ObjectBidirectionalIterator<Char2BooleanMap.Entry > iterator() {
+	   return new EntryIterator(from);
+	  }
+	  @Override
+	 
+	  public ObjectBidirectionalIterator<Char2BooleanMap.Entry > iterator(final Char2BooleanMap.Entry from) {
+	   int i = lowerBound(from.getCharKey());
+	   if (i < to && compare( key[i], from.getCharKey()) == 0) i++;
+	   return new EntryIterator(i);
+	  }
+	  @Override
+	  public ObjectSpliterator<Char2BooleanMap.Entry > spliterator() {
+	   return new EntrySpliterator(from, to);
+	  }
+	  @Override
+	 
+	  public boolean contains(final Object o) {
+	   if (! (o instanceof Map.Entry)) return false;
+	   final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	   if (e.getKey() == null || ! (e.getKey() instanceof Character)) return false;
+	   if (e.getValue() == null || ! (e.getValue() instanceof Boolean)) return false;
+	   final int i = findKey(((Character)( e.getKey())).charValue());
+	   return i != -1 && ( (value[i]) == (((Boolean)(e.getValue())).booleanValue()) );
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	  @Override
+	  public Char2BooleanMap.Entry first() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(from).next();
+	  }
+	  @Override
+	  public Char2BooleanMap.Entry last() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(to).previous();
+	  }
+	  @Override
+	  public ObjectSortedSet<Char2BooleanMap.Entry > subSet(final Char2BooleanMap.Entry from, final Char2BooleanMap.Entry to) {
+	   return subMap(from.getCharKey(), to.getCharKey()).char2BooleanEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Char2BooleanMap.Entry > headSet(final Char2BooleanMap.Entry to) {
+	   return headMap(to.getCharKey()).char2BooleanEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Char2BooleanMap.Entry > tailSet(final Char2BooleanMap.Entry from) {
+	   return tailMap(from.getCharKey()).char2BooleanEntrySet();
+	  }
+	 };
+	 return entries;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) {
+	  s.writeChar(key[i]);
+	  s.writeBoolean(value[i]);
+	 }
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 key = new char[to];
+	 value = new boolean[to];
+	 for (int i = 0; i < to; i++) {
+	  key[i] = s.readChar();
+	  value[i] = s.readBoolean();
+	 }
+	}
+}
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET CharOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Char2ByteOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Char2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2ByteOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2ByteOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2ByteAVLTreeMap
 #define RB_TREE_MAP Char2ByteRBTreeMap
+#define CACHE Char2ByteCache
+#define STATIC_FUNCTION Char2ByteStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
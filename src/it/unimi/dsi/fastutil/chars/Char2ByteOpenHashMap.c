@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET CharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2ByteOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2ByteAVLTreeMap
 #define RB_TREE_MAP Char2ByteRBTreeMap
+#define CACHE Char2ByteCache
+#define STATIC_FUNCTION Char2ByteStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
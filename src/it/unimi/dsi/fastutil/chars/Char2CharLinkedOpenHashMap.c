@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET CharLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2CharLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2CharAVLTreeMap
 #define RB_TREE_MAP Char2CharRBTreeMap
+#define CACHE Char2CharCache
+#define STATIC_FUNCTION Char2CharStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
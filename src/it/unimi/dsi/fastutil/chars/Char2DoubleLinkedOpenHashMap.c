@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET CharLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2DoubleLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2DoubleAVLTreeMap
 #define RB_TREE_MAP Char2DoubleRBTreeMap
+#define CACHE Char2DoubleCache
+#define STATIC_FUNCTION Char2DoubleStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET CharOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Char2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Char2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2FloatOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2FloatAVLTreeMap
 #define RB_TREE_MAP Char2FloatRBTreeMap
+#define CACHE Char2FloatCache
+#define STATIC_FUNCTION Char2FloatStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET CharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2IntOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2IntOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2IntOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedCharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Char2IntOpenDoubleHashMap
 #define ARRAY_SET CharArraySet
 #define ARRAY_MAP Char2IntArrayMap
 #define LINKED_OPEN_HASH_SET CharLinkedOpenHashSet
 #define AVL_TREE_SET CharAVLTreeSet
 #define RB_TREE_SET CharRBTreeSet
+#define BTREE_SET CharBTreeSet
+#define PERSISTENT_TREE_SET CharPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET CharConcurrentSkipListSet
+#define SORTED_ARRAY_SET CharSortedArraySet
 #define AVL_TREE_MAP Char2IntAVLTreeMap
 #define RB_TREE_MAP Char2IntRBTreeMap
+#define BTREE_MAP Char2IntBTreeMap
+#define PERSISTENT_TREE_MAP Char2IntPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Char2IntConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Char2IntSortedArrayMap
+#define CACHE Char2IntCache
+#define STATIC_FUNCTION Char2IntStaticFunction
+#define BLOOM_FILTER CharBloomFilter
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
 #define MAPPED_BIG_LIST CharMappedBigList
 #define ARRAY_FRONT_CODED_LIST CharArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST CharArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST CharEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET CharEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE CharHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE CharHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE CharHeapIndirectPriorityQueue
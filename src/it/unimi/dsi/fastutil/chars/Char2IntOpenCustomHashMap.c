@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET CharOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Char2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Char2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2IntOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2IntAVLTreeMap
 #define RB_TREE_MAP Char2IntRBTreeMap
+#define CACHE Char2IntCache
+#define STATIC_FUNCTION Char2IntStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET CharLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2LongLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2LongAVLTreeMap
 #define RB_TREE_MAP Char2LongRBTreeMap
+#define CACHE Char2LongCache
+#define STATIC_FUNCTION Char2LongStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
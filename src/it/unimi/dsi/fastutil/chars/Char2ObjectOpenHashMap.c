@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET CharOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2ObjectOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2ObjectAVLTreeMap
 #define RB_TREE_MAP Char2ObjectRBTreeMap
+#define CACHE Char2ObjectCache
+#define STATIC_FUNCTION Char2ObjectStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
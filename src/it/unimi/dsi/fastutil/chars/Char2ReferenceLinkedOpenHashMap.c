@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET CharLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET CharLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Char2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Char2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Char2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Char2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedChar2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Char2ReferenceLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET CharRBTreeSet
 #define AVL_TREE_MAP Char2ReferenceAVLTreeMap
 #define RB_TREE_MAP Char2ReferenceRBTreeMap
+#define CACHE Char2ReferenceCache
+#define STATIC_FUNCTION Char2ReferenceStaticFunction
 #define ARRAY_LIST CharArrayList
 #define IMMUTABLE_LIST CharImmutableList
 #define BIG_ARRAY_BIG_LIST CharBigArrayBigList
@@ -25,6 +25,11 @@ import java.util.NoSuchElementException;
 	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
 	* Moreover, the iterator returned by {@code iterator()} can be safely cast
 	* to a type-specific {@linkplain java.util.ListIterator list iterator}.
+	*
+	* <p>This class does not keep subtree sizes: there are no order statistics, and the size of
+	* a subset is computed by enumerating its elements. If you need rank and select operations, or
+	* fast subset sizes, use the B+-tree set of the same type (e.g.,
+	* {@link it.unimi.dsi.fastutil.ints.IntBTreeSet}), which provides them in logarithmic time.
 	*/
 public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Serializable, Cloneable, CharSortedSet {
 	/** A reference to the root entry. */
@@ -106,7 +111,7 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	 * @param i a type-specific iterator whose elements will fill the set.
 	 */
 	public CharAVLTreeSet(final CharIterator i) {
-	 while(i.hasNext()) add(i.nextChar());
+	 this(CharIterators.unwrap(i));
 	}
 	/** Creates a new tree set using elements provided by an iterator.
 	 *
@@ -123,10 +128,19 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	 * @param length the number of elements to use.
 	 * @param c a {@link Comparator} (even better, a type-specific comparator).
 	 */
+
 	public CharAVLTreeSet(final char[] a, final int offset, final int length, final Comparator<? super Character> c) {
 	 this(c);
 	 CharArrays.ensureOffsetLength(a, offset, length);
-	 for(int i = 0; i < length; i++) add(a[offset + i]);
+	 if (isStrictlySorted(a, offset, length)) {
+	  final Entry [] e = new Entry[length];
+	  for(int i = 0; i < length; i++) {
+	  
+	   e[i] = new Entry (a[offset + i]);
+	  }
+	  setTree(e, length);
+	 }
+	 else for(int i = 0; i < length; i++) add(a[offset + i]);
 	}
 	/** Creates a new tree set and fills it with the elements of a given array.
 	 *
@@ -142,9 +156,7 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	 * @param a an array to be copied into the new tree set.
 	 */
 	public CharAVLTreeSet(final char[] a) {
-	 this();
-	 int i = a.length;
-	 while(i-- != 0) add(a[i]);
+	 this(a, 0, a.length, null);
 	}
 	/** Creates a new tree set copying the elements of an array using a given {@link Comparator}.
 	 *
@@ -152,9 +164,7 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	 * @param c a {@link Comparator} (even better, a type-specific comparator).
 	 */
 	public CharAVLTreeSet(final char[] a, final Comparator<? super Character> c) {
-	 this(c);
-	 int i = a.length;
-	 while(i-- != 0) add(a[i]);
+	 this(a, 0, a.length, c);
 	}
 	/*
 	 * The following methods implements some basic building blocks used by
@@ -905,6 +915,78 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	  curr = null;
 	 }
 	}
+	/** A spliterator on the whole tree.
+	 *
+	 * <p>Splitting happens at the tree level: the first split hands out the entries preceding the root,
+	 * and further splits use the right subtree of the current entry or the left subtree of the fence,
+	 * so that the returned prefix roughly halves the remaining entries. Enumeration follows
+	 * the threaded successor links and requires no stack.
+	 */
+	private final class SetSpliterator implements CharSpliterator {
+	 private static final int POST_SPLIT_CHARACTERISTICS = CharSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS & ~java.util.Spliterator.SIZED;
+	 /** The next entry to be returned, or {@code null} if we reached the end of the tree. */
+	 Entry current;
+	 /** The first entry that must not be returned, or {@code null} if we must reach the end of the tree. */
+	 final Entry fence;
+	 /** Zero if this spliterator has never been split (so we split at the root), positive if we split at the right subtree
+		 * of {@link #current}, negative if we split at the left subtree of {@link #fence}. */
+	 int side;
+	 /** The number of remaining elements (exact only if {@link #side} is zero). */
+	 int est;
+	 SetSpliterator() {
+	  this(firstEntry, null, 0, count);
+	 }
+	 SetSpliterator(final Entry current, final Entry fence, final int side, final int est) {
+	  this.current = current;
+	  this.fence = fence;
+	  this.side = side;
+	  this.est = est;
+	 }
+	 @Override
+	 public int characteristics() {
+	  return side == 0 ? CharSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS : POST_SPLIT_CHARACTERISTICS;
+	 }
+	 @Override
+	 public long estimateSize() {
+	  return est;
+	 }
+	 @Override
+	 public CharComparator getComparator() {
+	  return actualComparator;
+	 }
+	 @Override
+	 public boolean tryAdvance(final CharConsumer action) {
+	  final Entry e = current;
+	  if (e == null || e == fence) return false;
+	  current = e.next();
+	  if (est > 0) est--;
+	  action.accept(e.key);
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final CharConsumer action) {
+	  final Entry f = fence;
+	  Entry e = current;
+	  current = f;
+	  est = 0;
+	  while(e != f) {
+	   action.accept(e.key);
+	   e = e.next();
+	  }
+	 }
+	 @Override
+	 public CharSpliterator trySplit() {
+	  final Entry e = current, f = fence;
+	  final Entry s = e == null || e == f ? null : side == 0 ? tree : side > 0 ? e.right() : f != null ? f.left() : null;
+	  if (s == null || s == e || s == f || compare(e.key, s.key) >= 0) return null;
+	  final SetSpliterator split = new SetSpliterator(e, s, -1, est >>>= 1);
+	  current = s;
+	  side = 1;
+	  return split;
+	 }
+	}
+	@Override
+	public CharSpliterator spliterator() { return new SetSpliterator(); }
 	@Override
 	public CharBidirectionalIterator iterator() { return new SetIterator(); }
 	@Override
@@ -1104,6 +1186,77 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	  }
 	 }
 	}
+	/** The union operation for {@link #merge merge()}. */
+	private static final int UNION = 0;
+	/** The intersection operation for {@link #merge merge()}. */
+	private static final int INTERSECTION = 1;
+	/** The difference operation for {@link #merge merge()}. */
+	private static final int DIFFERENCE = 2;
+	/** Merges in linear time this set with a sorted set using the same order, and rebuilds the tree with the result.
+	 *
+	 * <p>Entries of this set that survive the operation are reused.
+	 *
+	 * @param s a sorted set using the same order as this set.
+	 * @param op the operation ({@link #UNION}, {@link #INTERSECTION} or {@link #DIFFERENCE}).
+	 * @return true if this set changed.
+	 */
+
+	private boolean merge(final CharSortedSet s, final int op) {
+	 final Entry [] e = new Entry[op == UNION ? count + s.size() : count];
+	 final CharIterator i = s.iterator();
+	 Entry p = firstEntry;
+	 boolean hasNext = i.hasNext();
+	 char k = hasNext ? i.nextChar() : ((char)0);
+	 int n = 0;
+	 while(p != null && hasNext) {
+	  final int cmp = compare(p.key, k);
+	  if (cmp <= 0) {
+	   if (cmp < 0 ? op != INTERSECTION : op != DIFFERENCE) e[n++] = p;
+	   p = p.next();
+	  }
+	  else if (op == UNION) e[n++] = new Entry (k);
+	  if (cmp >= 0 && (hasNext = i.hasNext())) k = i.nextChar();
+	 }
+	 if (op != INTERSECTION) for(; p != null; p = p.next()) e[n++] = p;
+	 if (op == UNION) while(hasNext) {
+	  e[n++] = new Entry (k);
+	  if (hasNext = i.hasNext()) k = i.nextChar();
+	 }
+	 // Sets with the same size contain the same elements
+	 if (n == count) return false;
+	 setTree(e, n);
+	 return true;
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a type-specific sorted set using the same order as this set and it is not
+	 * too small, this method merges the two sets in linear time.
+	 */
+	@Override
+	public boolean addAll(final CharCollection c) {
+	 if (c instanceof CharSortedSet && c.size() >= count >>> 4 && sameOrder(((CharSortedSet)c).comparator())) return merge((CharSortedSet)c, UNION);
+	 return super.addAll(c);
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a type-specific sorted set using the same order as this set and it is not
+	 * too large, this method merges the two sets in linear time.
+	 */
+	@Override
+	public boolean retainAll(final CharCollection c) {
+	 if (c instanceof CharSortedSet && c.size() >>> 4 <= count && sameOrder(((CharSortedSet)c).comparator())) return merge((CharSortedSet)c, INTERSECTION);
+	 return super.retainAll(c);
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a type-specific sorted set using the same order as this set and it is not
+	 * too small, this method merges the two sets in linear time.
+	 */
+	@Override
+	public boolean removeAll(final CharCollection c) {
+	 if (c instanceof CharSortedSet && c.size() >= count >>> 4 && sameOrder(((CharSortedSet)c).comparator())) return merge((CharSortedSet)c, DIFFERENCE);
+	 return super.removeAll(c);
+	}
 	/** Returns a deep copy of this tree set.
 	 *
 	 * <p>This method performs a deep copy of this tree set; the data stored in the
@@ -1206,6 +1359,79 @@ public class CharAVLTreeSet extends AbstractCharSortedSet implements java.io.Ser
 	 if (n == (n & -n)) top.balance(1); // Quick test for determining whether n is a power of 2.
 	 return top;
 	}
+	/** Links a sorted array of entries into a balanced tree, with the same shape as the one built by {@link #readTree readTree()}.
+	 *
+	 * <p>Entries are reused as they are, except for their links and their {@link Entry#info} field, which are rewritten.
+	 *
+	 * @param e an array of entries with distinct keys, sorted by key.
+	 * @param offset the index in {@code e} of the first entry of the tree.
+	 * @param n the (positive) number of entries of the tree.
+	 * @param pred the entry containing the key that preceeds the first key in the tree.
+	 * @param succ the entry containing the key that follows the last key in the tree.
+	 * @return the root of the tree.
+	 */
+	private static Entry buildTree(final Entry [] e, final int offset, final int n, final Entry pred, final Entry succ) {
+	 if (n == 1) {
+	  final Entry top = e[offset];
+	  top.info = 0;
+	  top.pred(pred);
+	  top.succ(succ);
+	  return top;
+	 }
+	 if (n == 2) {
+	  /* We handle separately this case so that recursion will
+			 *always* be on nonempty subtrees. */
+	  final Entry top = e[offset], right = e[offset + 1];
+	  top.info = right.info = 0;
+	  top.right(right);
+	  right.pred(top);
+	  top.balance(1);
+	  top.pred(pred);
+	  right.succ(succ);
+	  return top;
+	 }
+	 // The right subtree is the largest one.
+	 final int rightN = n / 2, leftN = n - rightN - 1;
+	 final Entry top = e[offset + leftN];
+	 top.info = 0;
+	 top.left(buildTree(e, offset, leftN, pred, top));
+	 top.right(buildTree(e, offset + leftN + 1, rightN, top, succ));
+	 if (n == (n & -n)) top.balance(1); // Quick test for determining whether n is a power of 2.
+	 return top;
+	}
+	/** Replaces the content of this set with a sorted array of entries.
+	 *
+	 * @param e an array of entries with distinct keys, sorted by key.
+	 * @param n the number of entries to use, starting from the first one.
+	 */
+	private void setTree(final Entry [] e, final int n) {
+	 count = n;
+	 if (n == 0) tree = firstEntry = lastEntry = null;
+	 else {
+	  tree = buildTree(e, 0, n, null, null);
+	  firstEntry = e[0];
+	  lastEntry = e[n - 1];
+	 }
+	}
+	/** Returns whether a sorted array fragment is strictly increasing in the order of this set.
+	 *
+	 * @param a an array.
+	 * @param offset the first element to check.
+	 * @param length the number of elements to check.
+	 * @return true if the elements of the fragment are strictly increasing.
+	 */
+	private boolean isStrictlySorted(final char[] a, final int offset, final int length) {
+	 for(int i = 1; i < length; i++) if (compare(a[offset + i - 1], a[offset + i]) >= 0) return false;
+	 return true;
+	}
+	/** Returns whether a comparator specifies the same order as the one of this set.
+	 *
+	 * @param c a comparator, or {@code null} for the natural order.
+	 * @return true if {@code c} is known to specify the same order as this set.
+	 */
+	private boolean sameOrder(final Comparator<?> c) {
+	 return actualComparator == null ? c == null : actualComparator.equals(c);
+	}
 	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
 	 s.defaultReadObject();
 	 /* The storedComparator is now correctly set, but we must restore
@@ -0,0 +1,295 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.chars;
+import java.io.Closeable;
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.CharBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.channels.FileChannel.MapMode;
+import java.util.Arrays;
+import it.unimi.dsi.fastutil.BigArrays;
+/** A type-specific big list that writes directly into a growing memory-mapped file.
+	*
+	* <p>This class is the writable counterpart of type-specific mapped big lists: elements are
+	* appended to a file channel, which is extended and mapped
+	* {@linkplain FileChannel#map(MapMode, long, long) read-write} on demand, so that
+	* a file can be built without going through a stream and mapped again. The file is
+	* divided into chunks of the same size as the ones used by mapped big lists; the mapping of the
+	* last chunk is enlarged geometrically as the list grows, and a new chunk is mapped only when the
+	* last one is full.
+	*
+	* <p>Elements can be read and modified anywhere, but they can only be
+	* added (or removed) at the end of the list; {@link #size(long)} can be used both to truncate the list and to extend it
+	* with zeroes.
+	*
+	* <p>Since mappings are enlarged ahead of need, the underlying file is usually longer than the list.
+	* Call {@link #force()} to make the content of the list durable, and {@link #close()} to force
+	* it and to {@linkplain FileChannel#truncate(long) truncate} the file to the size of the list: after
+	* closing, the file can be mapped by a mapped big list using the same byte order.
+	*
+	* <p>Instances of this class are not thread safe.
+	*/
+public class CharAppendableMappedBigList extends AbstractCharBigList implements Closeable {
+	/** The logarithm of the size in elements of a chunk. */
+	private static final int CHUNK_SHIFT = Long.numberOfTrailingZeros(CharMappedBigList.CHUNK_SIZE);
+	/** The mask used to compute the offset in the chunk in elements. */
+	private static final long CHUNK_MASK = CharMappedBigList.CHUNK_SIZE - 1;
+	/** The minimum number of elements mapped when a new chunk is started. */
+	private static final int MIN_CHUNK_CAPACITY = 1 << 16;
+	/** The underlying file channel. */
+	private final FileChannel fileChannel;
+	/** The byte order of the underlying file. */
+	private final ByteOrder byteOrder;
+	/** The mapped byte buffers, one per chunk, used to {@linkplain MappedByteBuffer#force() force} changes. */
+	private MappedByteBuffer[] mapped;
+	/** The type-specific views of {@link #mapped}. */
+	private CharBuffer[] buffer;
+	/** The number of mapped chunks. */
+	private int chunks;
+	/** The number of elements that can be stored without mapping further content. */
+	private long capacity;
+	/** The size of the list. */
+	private long size;
+	/** The maximum size ever reached by the list: positions past this one have never been written. */
+	private long written;
+	/** Creates a new appendable mapped big list on a given file channel using the
+	 * standard Java (i.e., {@link java.io.DataOutput}) byte order ({@link ByteOrder#BIG_ENDIAN}).
+	 *
+	 * @param fileChannel a file channel opened for reading and writing.
+	 */
+	public CharAppendableMappedBigList(final FileChannel fileChannel) throws IOException {
+	 this(fileChannel, ByteOrder.BIG_ENDIAN);
+	}
+	/** Creates a new appendable mapped big list on a given file channel.
+	 *
+	 * <p>The current content of the file channel (if any) becomes the initial content of the list.
+	 *
+	 * @param fileChannel a file channel opened for reading and writing.
+	 * @param byteOrder a prescribed byte order.
+	 */
+	public CharAppendableMappedBigList(final FileChannel fileChannel, final ByteOrder byteOrder) throws IOException {
+	 this.fileChannel = fileChannel;
+	 this.byteOrder = byteOrder;
+	 this.size = this.written = fileChannel.size() / Character.BYTES;
+	 final int n = (int)((size + CHUNK_MASK) >>> CHUNK_SHIFT);
+	 this.mapped = new MappedByteBuffer[Math.max(1, n)];
+	 this.buffer = new CharBuffer[Math.max(1, n)];
+	 for (int i = 0; i < n; i++) map(i, (int)Math.min(CharMappedBigList.CHUNK_SIZE, size - ((long)i << CHUNK_SHIFT)));
+	}
+	/** Maps (or remaps) a chunk with a given length, extending the file if necessary.
+	 *
+	 * @param chunk the chunk to be mapped.
+	 * @param length the length in elements of the mapping.
+	 */
+	private void map(final int chunk, final int length) throws IOException {
+	 final MappedByteBuffer m = fileChannel.map(MapMode.READ_WRITE, ((long)chunk << CHUNK_SHIFT) * Character.BYTES, (long)length * Character.BYTES);
+	 m.order(byteOrder);
+	 if (chunk == mapped.length) {
+	  mapped = Arrays.copyOf(mapped, chunk + 1);
+	  buffer = Arrays.copyOf(buffer, chunk + 1);
+	 }
+	 mapped[chunk] = m;
+	 buffer[chunk] = m.asCharBuffer();
+	 if (chunk == chunks) chunks++;
+	 capacity = ((long)(chunks - 1) << CHUNK_SHIFT) + buffer[chunks - 1].capacity();
+	}
+	/** Ensures that the mapped part of the file can contain a given number of elements.
+	 *
+	 * @param required the required capacity in elements.
+	 */
+	private void ensureCapacity(final long required) {
+	 try {
+	  while (capacity < required) {
+	   if (chunks == 0 || buffer[chunks - 1].capacity() == CharMappedBigList.CHUNK_SIZE) map(chunks, (int)Math.min(CharMappedBigList.CHUNK_SIZE, Math.max(MIN_CHUNK_CAPACITY, required - capacity)));
+	   else {
+	    final int last = chunks - 1;
+	    map(last, (int)Math.min(CharMappedBigList.CHUNK_SIZE, Math.max(2L * buffer[last].capacity(), required - ((long)last << CHUNK_SHIFT))));
+	   }
+	  }
+	 } catch (final IOException e) {
+	  throw new UncheckedIOException(e);
+	 }
+	}
+	@Override
+	public char getChar(final long index) {
+	 ensureRestrictedIndex(index);
+	 return buffer[(int)(index >>> CHUNK_SHIFT)].get((int)(index & CHUNK_MASK));
+	}
+	@Override
+	public char set(final long index, final char k) {
+	 ensureRestrictedIndex(index);
+	 final CharBuffer b = buffer[(int)(index >>> CHUNK_SHIFT)];
+	 final int i = (int)(index & CHUNK_MASK);
+	 final char previousValue = b.get(i);
+	 b.put(i, k);
+	 return previousValue;
+	}
+	@Override
+	public boolean add(final char k) {
+	 ensureCapacity(size + 1);
+	 buffer[(int)(size >>> CHUNK_SHIFT)].put((int)(size & CHUNK_MASK), k);
+	 if (++size > written) written = size;
+	 return true;
+	}
+	/** {@inheritDoc}
+	 *
+	 * @throws UnsupportedOperationException if {@code index} is not the size of this list.
+	 */
+	@Override
+	public void add(final long index, final char k) {
+	 ensureAppend(index);
+	 add(k);
+	}
+	private void ensureAppend(final long index) {
+	 ensureIndex(index);
+	 if (index != size) throw new UnsupportedOperationException("Elements can only be appended (index: " + index + ", size: " + size + ")");
+	}
+	/** Appends part of an array to this list.
+	 *
+	 * @param index the index at which to add elements, which must be equal to the size of this list.
+	 * @param a the array containing the elements.
+	 * @param offset the offset of the first element to add.
+	 * @param length the number of elements to add.
+	 * @throws UnsupportedOperationException if {@code index} is not the size of this list.
+	 */
+	public void addElements(final long index, final char a[], int offset, int length) {
+	 ensureAppend(index);
+	 CharArrays.ensureOffsetLength(a, offset, length);
+	 ensureCapacity(size + length);
+	 int chunk = (int)(size >>> CHUNK_SHIFT);
+	 int displ = (int)(size & CHUNK_MASK);
+	 size += length;
+	 if (size > written) written = size;
+	 while (length > 0) {
+	  final CharBuffer b = buffer[chunk];
+	  final int l = Math.min(b.capacity() - displ, length);
+	  b.position(displ);
+	  b.put(a, offset, l);
+	  displ = 0;
+	  chunk++;
+	  offset += l;
+	  length -= l;
+	 }
+	}
+	/** Appends an array to this list.
+	 *
+	 * @param index the index at which to add elements, which must be equal to the size of this list.
+	 * @param a the array containing the elements.
+	 * @throws UnsupportedOperationException if {@code index} is not the size of this list.
+	 */
+	public void addElements(final long index, final char a[]) {
+	 addElements(index, a, 0, a.length);
+	}
+	/** {@inheritDoc}
+	 *
+	 * @throws UnsupportedOperationException if {@code index} is not the size of this list.
+	 */
+	@Override
+	public void addElements(long index, final char a[][], long offset, long length) {
+	 ensureAppend(index);
+	 CharBigArrays.ensureOffsetLength(a, offset, length);
+	 ensureCapacity(size + length);
+	 while (length > 0) {
+	  final char[] s = a[BigArrays.segment(offset)];
+	  final int d = BigArrays.displacement(offset);
+	  final int l = (int)Math.min(s.length - d, length);
+	  addElements(index, s, d, l);
+	  index += l;
+	  offset += l;
+	  length -= l;
+	 }
+	}
+	@Override
+	public void getElements(final long from, final char a[], int offset, int length) {
+	 CharArrays.ensureOffsetLength(a, offset, length);
+	 if (from < 0 || from + length > size) throw new IndexOutOfBoundsException("Range [" + from + ".." + (from + length) + ") is not contained in [0.." + size + ")");
+	 int chunk = (int)(from >>> CHUNK_SHIFT);
+	 int displ = (int)(from & CHUNK_MASK);
+	 while (length > 0) {
+	  final CharBuffer b = buffer[chunk];
+	  final int l = Math.min(b.capacity() - displ, length);
+	  b.position(displ);
+	  b.get(a, offset, l);
+	  displ = 0;
+	  chunk++;
+	  offset += l;
+	  length -= l;
+	 }
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>When the list is extended, new elements are zeroes.
+	 */
+	@Override
+	public void size(final long size) {
+	 if (size < 0) throw new IllegalArgumentException("Negative size: " + size);
+	 if (size > this.size) {
+	  ensureCapacity(size);
+	  // Positions past the high-water mark come from file extension and are already zero
+	  for (long i = this.size, end = Math.min(size, written); i < end; i++) buffer[(int)(i >>> CHUNK_SHIFT)].put((int)(i & CHUNK_MASK), ((char)0));
+	  if (size > written) written = size;
+	 }
+	 this.size = size;
+	}
+	@Override
+	public void removeElements(final long from, final long to) {
+	 ensureIndex(to);
+	 if (from > to) throw new IndexOutOfBoundsException("Start index (" + from + ") is greater than end index (" + to + ")");
+	 if (to != size) throw new UnsupportedOperationException("Elements can only be removed from the end of the list");
+	 size(from);
+	}
+	@Override
+	public char removeChar(final long index) {
+	 ensureRestrictedIndex(index);
+	 if (index != size - 1) throw new UnsupportedOperationException("Elements can only be removed from the end of the list");
+	 final char k = getChar(index);
+	 size = index;
+	 return k;
+	}
+	@Override
+	public void clear() {
+	 size = 0;
+	}
+	@Override
+	public long size64() {
+	 return size;
+	}
+	/** Forces any change to the content of this list to be written to the storage device.
+	 *
+	 * @see MappedByteBuffer#force()
+	 */
+	public void force() {
+	 for (int i = 0; i < chunks; i++) mapped[i].force();
+	}
+	/** {@linkplain #force() Forces} the content of this list and truncates the underlying file
+	 * to the size of the list.
+	 *
+	 * <p>The underlying file channel is not closed. After this call this list must not be used anymore.
+	 */
+	@Override
+	public void close() throws IOException {
+	 if (mapped == null) return;
+	 force();
+	 mapped = null;
+	 buffer = null;
+	 chunks = 0;
+	 capacity = 0;
+	 fileChannel.truncate(size * Character.BYTES);
+	}
+}
@@ -19,12 +19,14 @@ import java.util.Collection;
 import java.util.Iterator;
 import java.util.RandomAccess;
 import java.util.NoSuchElementException;
+import it.unimi.dsi.fastutil.GrowthPolicy;
 /** A type-specific array-based list; provides some additional methods that use polymorphism to avoid (un)boxing.
 	*
 	* <p>This class implements a lightweight, fast, open, optimized,
 	* reuse-oriented version of array-based lists. Instances of this class
 	* represent a list with an array that is enlarged as needed when new entries
-	* are created (by increasing its current length by 50%), but is
+	* are created (by increasing its current length by 50%, unless a different
+	* {@linkplain #growthPolicy(GrowthPolicy) growth policy} is set), but is
 	* <em>never</em> made smaller (even on a {@link #clear()}). A family of
 	* {@linkplain #trim() trimming methods} lets you control the size of the
 	* backing array; this is particularly useful if you reuse instances of this class.
@@ -48,6 +50,8 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	protected transient char a[];
 	/** The current actual size of the list (never greater than the backing-array length). */
 	protected int size;
+	/** The policy used to enlarge the backing array, or {@code null} for the default 50% increase. */
+	protected GrowthPolicy growthPolicy;
 	/** Ensures that the component type of the given array is the proper type.
 	 * This is irrelevant for primitive types, so it will just do a trivial copy.
 	 * But for Reference types, you can have a {@code String[]} masquerading as an {@code Object[]},
@@ -232,16 +236,39 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	 a = CharArrays.ensureCapacity(a, capacity, size);
 	 assert size <= a.length;
 	}
+	/** Sets the growth policy of this array list.
+	 *
+	 * <p>The policy decides how much the backing array is enlarged when it is full;
+	 * by default, the capacity is increased by 50%. Explicit requests
+	 * (e.g., {@link #ensureCapacity(int)}) are not affected.
+	 *
+	 * @param growthPolicy the new growth policy, or {@code null} to restore the default policy.
+	 * @return this array list.
+	 * @see GrowthPolicy
+	 */
+	public CharArrayList growthPolicy(final GrowthPolicy growthPolicy) {
+	 this.growthPolicy = growthPolicy;
+	 return this;
+	}
+	/** Returns the growth policy of this array list.
+	 *
+	 * @return the growth policy of this array list ({@link GrowthPolicy#ONE_AND_A_HALF} if no policy has been set).
+	 */
+	public GrowthPolicy growthPolicy() {
+	 return growthPolicy == null ? GrowthPolicy.ONE_AND_A_HALF : growthPolicy;
+	}
 	/** Grows this array list, ensuring that it can contain the given number of entries without resizing,
-	 * and in case increasing the current capacity at least by a factor of 50%.
+	 * and in case increasing the current capacity as prescribed by the {@linkplain #growthPolicy() growth policy}.
 	 *
 	 * @param capacity the new minimum capacity for this array list.
 	 */
 
 	private void grow(int capacity) {
 	 if (capacity <= a.length) return;
-	 if (a != CharArrays.DEFAULT_EMPTY_ARRAY)
-	  capacity = (int)Math.max(Math.min((long)a.length + (a.length >> 1), it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE), capacity);
+	 if (a != CharArrays.DEFAULT_EMPTY_ARRAY) {
+	  if (growthPolicy == null) capacity = (int)Math.max(Math.min((long)a.length + (a.length >> 1), it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE), capacity);
+	  else capacity = (int)GrowthPolicy.grow(growthPolicy, a.length, capacity, it.unimi.dsi.fastutil.Arrays.MAX_ARRAY_SIZE);
+	 }
 	 else if (capacity < DEFAULT_INITIAL_CAPACITY) capacity = DEFAULT_INITIAL_CAPACITY;
 	 a = CharArrays.forceCapacity(a, capacity, size);
 	 assert size <= a.length;
@@ -352,8 +379,14 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	}
 	private class SubList extends AbstractCharList.CharRandomAccessSubList {
 	 private static final long serialVersionUID = -3185226345314976296L;
+	 /** The position in the backing array of the first element of this sublist. */
+	 private final int offset;
 	 protected SubList(int from, int to) {
-	  super(CharArrayList.this, from, to);
+	  this(CharArrayList.this, from, to, from);
+	 }
+	 private SubList(CharList l, int from, int to, int offset) {
+	  super(l, from, to);
+	  this.offset = offset;
 	 }
 	 // Most of the inherited methods should be fine, but we can override a few of them for performance.
 	 // Needed because we can't access the parent class' instance variables directly in a different instance of SubList.
@@ -363,15 +396,29 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	 @Override
 	 public char getChar(int i) {
 	  ensureRestrictedIndex(i);
-	  return a[i + from];
+	  return a[i + offset];
+	 }
+	 @Override
+	 public char set(final int i, final char k) {
+	  ensureRestrictedIndex(i);
+	  final char old = a[i + offset];
+	  a[i + offset] = k;
+	  return old;
+	 }
+	 @Override
+	 public void getElements(final int from, final char[] a, final int offset, final int length) {
+	  ensureIndex(from);
+	  if (from + length > size()) throw new IndexOutOfBoundsException("End index (" + from + length + ") is greater than list size (" + size() + ")");
+	  CharArrays.ensureOffsetLength(a, offset, length);
+	  System.arraycopy(getParentArray(), this.offset + from, a, offset, length);
 	 }
 	 private final class SubListIterator extends CharIterators.AbstractIndexBasedListIterator {
-	  // We are using pos == 0 to be 0 relative to SubList.from (meaning you need to do a[from + i] when accessing array).
+	  // We are using pos == 0 to be 0 relative to SubList.offset (meaning you need to do a[offset + i] when accessing array).
 	  SubListIterator(int index) {
 	   super(0, index);
 	  }
 	  @Override
-	  protected final char get(int i) { return a[from + i]; }
+	  protected final char get(int i) { return a[offset + i]; }
 	  @Override
 	  protected final void add(int i, char k) { SubList.this.add(i, k); }
 	  @Override
@@ -381,14 +428,14 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	  @Override
 	  protected final int getMaxPos() { return to - from; }
 	  @Override
-	  public char nextChar() { if (! hasNext()) throw new NoSuchElementException(); return a[from + (lastReturned = pos++)]; }
+	  public char nextChar() { if (! hasNext()) throw new NoSuchElementException(); return a[offset + (lastReturned = pos++)]; }
 	  @Override
-	  public char previousChar() { if (! hasPrevious()) throw new NoSuchElementException(); return a[from + (lastReturned = --pos)]; }
+	  public char previousChar() { if (! hasPrevious()) throw new NoSuchElementException(); return a[offset + (lastReturned = --pos)]; }
 	  @Override
 	  public void forEachRemaining(final CharConsumer action) {
 	   final int max = to - from;
 	   while(pos < max) {
-	    action.accept(a[from + (lastReturned = pos++)]);
+	    action.accept(a[offset + (lastReturned = pos++)]);
 	   }
 	  }
 	 }
@@ -399,13 +446,13 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	 private final class SubListSpliterator extends CharSpliterators.LateBindingSizeIndexBasedSpliterator {
 	  // We are using pos == 0 to be 0 relative to real array 0
 	  SubListSpliterator() {
-	   super(from);
+	   super(offset);
 	  }
 	  private SubListSpliterator(int pos, int maxPos) {
 	   super(pos, maxPos);
 	  }
 	  @Override
-	  protected final int getMaxPosFromBackingStore() { return to; }
+	  protected final int getMaxPosFromBackingStore() { return offset + size(); }
 	   @Override
 	  protected final char get(int i) { return a[i]; }
 	  @Override
@@ -431,11 +478,12 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	  return new SubListSpliterator();
 	 }
 	 boolean contentsEquals(char[] otherA, int otherAFrom, int otherATo) {
-	  if (a == otherA && from == otherAFrom && to == otherATo) return true;
+	  final int to = offset + size();
+	  if (a == otherA && offset == otherAFrom && to == otherATo) return true;
 	  if (otherATo - otherAFrom != size()) {
 	   return false;
 	  }
-	  int pos = from, otherPos = otherAFrom;
+	  int pos = offset, otherPos = otherAFrom;
 	  // We have already assured that the two ranges are the same size, so we only need to check one bound.
 	  // TODO When minimum version of Java becomes Java 9, use the Arrays.equals which takes bounds, which is vectorized.
 	  // Make sure to split out the reference equality case when you do this.
@@ -455,17 +503,18 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	  if (o instanceof CharArrayList.SubList) {
 	  
 	   CharArrayList .SubList other = (CharArrayList .SubList) o;
-	   return contentsEquals(other.getParentArray(), other.from, other.to);
+	   return contentsEquals(other.getParentArray(), other.offset, other.offset + other.size());
 	  }
 	  return super.equals(o);
 	 }
 	
 	 int contentsCompareTo(char[] otherA, int otherAFrom, int otherATo) {
-	  if (a == otherA && from == otherAFrom && to == otherATo) return 0;
+	  final int to = offset + size();
+	  if (a == otherA && offset == otherAFrom && to == otherATo) return 0;
 	  // TODO When minimum version of Java becomes Java 9, use Arrays.compare, which vectorizes.
 	  char e1, e2;
 	  int r, i, j;
-	  for(i = from, j = otherAFrom; i < to && i < otherATo; i++, j++) {
+	  for(i = offset, j = otherAFrom; i < to && i < otherATo; i++, j++) {
 	   e1 = a[i];
 	   e2 = otherA[j];
 	   if ((r = ( Character.compare((e1),(e2)) )) != 0) return r;
@@ -483,14 +532,19 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	  if (l instanceof CharArrayList.SubList) {
 	  
 	   CharArrayList .SubList other = (CharArrayList .SubList) l;
-	   return contentsCompareTo(other.getParentArray(), other.from, other.to);
+	   return contentsCompareTo(other.getParentArray(), other.offset, other.offset + other.size());
 	  }
 	  return super.compareTo(l);
 	 }
-	 // We don't override subList as we want AbstractList's "sub-sublist" nesting handling,
-	 // which would be tricky to do here.
-	 // TODO Do override it so array access isn't sent through N indirections.
-	 // This will likely mean making this class static.
+	 @Override
+	 public CharList subList(final int from, final int to) {
+	  ensureIndex(from);
+	  ensureIndex(to);
+	  if (from > to) throw new IllegalArgumentException("Start index (" + from + ") is greater than end index (" + to + ")");
+	  // Modifications are still propagated through this sublist, so that the "to" value of all
+	  // enclosing sublists is updated, but array accesses use directly the absolute offset.
+	  return new SubList(this, from, to, offset + from);
+	 }
 	}
 	@Override
 	public CharList subList(int from, int to) {
@@ -776,6 +830,7 @@ public class CharArrayList extends AbstractCharList implements RandomAccess, Clo
 	  // Preserve backwards compatibility and make new list have Object[] even if it was wrapped from some subclass.
 	  cloned = new CharArrayList (copyArraySafe(a, size), false);
 	  cloned.size = size;
+	  cloned.growthPolicy = growthPolicy;
 	 } else {
 	  try {
 	   cloned = (CharArrayList )super.clone();
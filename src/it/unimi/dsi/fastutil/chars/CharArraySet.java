@@ -22,6 +22,9 @@ import java.util.Set;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of items: just put them into an array and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several elements per iteration without short-circuiting, so that there
+	* is a single branch per block of elements.
 	*/
 public class CharArraySet extends AbstractCharSet implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -155,7 +158,11 @@ public class CharArraySet extends AbstractCharSet implements java.io.Serializabl
 	 return new CharArraySet (a);
 	}
 	private int findKey(final char o) {
-	 for(int i = size; i-- != 0;) if (( (a[i]) == (o) )) return i;
+	 final char[] a = this.a;
+	 int i = size;
+	 // Non-short-circuit operators leave a single branch for each block of four keys
+	 for(; i >= 4; i -= 4) if (( (a[i - 1]) == (o) ) | ( (a[i - 2]) == (o) ) | ( (a[i - 3]) == (o) ) | ( (a[i - 4]) == (o) )) break;
+	 while(i-- != 0) if (( (a[i]) == (o) )) return i;
 	 return -1;
 	}
 	// TODO Maybe make this return a list-iterator like the LinkedXHashSets do?
@@ -0,0 +1,244 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.chars;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.SortedSet;
+/** A type-specific B+-tree set with a fast, small-footprint implementation.
+	*
+	* <p>Instances of this class are backed by a type-specific B+-tree map storing no values: thus, keys are stored
+	* in arrays in the leaves of the tree, and there is no per-key object.
+	* Please see the documentation of the map for details.
+	*
+	* <p>This class provides logarithmic-time order statistics: see {@link #rank rank()} and {@link #select select()}.
+	* Moreover, the {@code size()} method of subsets is logarithmic.
+	*
+	* <p>The iterators provided by this class are type-specific {@link
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class CharBTreeSet extends AbstractCharSortedSet implements java.io.Serializable, Cloneable, CharSortedSet {
+	private static final long serialVersionUID = 0L;
+	/** The class of the value returned by the backing map for missing keys. */
+	private static final class NotPresent implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 private Object readResolve() {
+	  return NOT_PRESENT;
+	 }
+	}
+	/** The default return value of the backing map, which returns {@code null} for present keys. */
+	private static final Object NOT_PRESENT = new NotPresent();
+	/** The backing map. */
+	protected Char2ObjectBTreeMap <Object> map;
+	/** Creates a new empty tree set with the given comparator.
+	 *
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public CharBTreeSet(final Comparator<? super Character> c) {
+	 map = new Char2ObjectBTreeMap <Object>(c, true);
+	 map.defaultReturnValue(NOT_PRESENT);
+	}
+	/** Creates a new empty tree set.
+	 */
+	public CharBTreeSet() {
+	 this((Comparator<? super Character>)null);
+	}
+	/** Creates a new tree set copying a given collection.
+	 *
+	 * @param c a collection to be copied into the new tree set.
+	 */
+	public CharBTreeSet(final Collection<? extends Character> c) {
+	 this();
+	 addAll(c);
+	}
+	/** Creates a new tree set copying a given sorted set (and its {@link Comparator}).
+	 *
+	 * @param s a {@link SortedSet} to be copied into the new tree set.
+	 */
+	public CharBTreeSet(final SortedSet<Character> s) {
+	 this(s.comparator());
+	 addAll(s);
+	}
+	/** Creates a new tree set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection to be copied into the new tree set.
+	 */
+	public CharBTreeSet(final CharCollection c) {
+	 this();
+	 addAll(c);
+	}
+	/** Creates a new tree set copying a given type-specific sorted set (and its {@link Comparator}).
+	 *
+	 * @param s a type-specific sorted set to be copied into the new tree set.
+	 */
+	public CharBTreeSet(final CharSortedSet s) {
+	 this(s.comparator());
+	 addAll(s);
+	}
+	/** Creates a new tree set and fills it with the elements of a given array using a given {@link Comparator}.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public CharBTreeSet(final char[] a, final int offset, final int length, final Comparator<? super Character> c) {
+	 this(c);
+	 CharArrays.ensureOffsetLength(a, offset, length);
+	 for(int i = 0; i < length; i++) add(a[offset + i]);
+	}
+	/** Creates a new tree set and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public CharBTreeSet(final char[] a, final int offset, final int length) {
+	 this(a, offset, length, null);
+	}
+	/** Creates a new tree set copying the elements of an array.
+	 *
+	 * @param a an array to be copied into the new tree set.
+	 */
+	public CharBTreeSet(final char[] a) {
+	 this(a, 0, a.length, null);
+	}
+	/** Creates a new tree set copying the elements of an array using a given {@link Comparator}.
+	 *
+	 * @param a an array to be copied into the new tree set.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public CharBTreeSet(final char[] a, final Comparator<? super Character> c) {
+	 this(a, 0, a.length, c);
+	}
+	@Override
+	public boolean add(final char k) {
+	 return map.put(k, null) == NOT_PRESENT;
+	}
+	@Override
+	public boolean remove(final char k) {
+	 return map.remove(k) != NOT_PRESENT;
+	}
+	@Override
+	public boolean contains(final char k) {
+	 return map.containsKey(k);
+	}
+	@Override
+	public void clear() {
+	 map.clear();
+	}
+	@Override
+	public int size() {
+	 return map.size();
+	}
+	@Override
+	public boolean isEmpty() {
+	 return map.isEmpty();
+	}
+	@Override
+	public char firstChar() {
+	 return map.firstCharKey();
+	}
+	@Override
+	public char lastChar() {
+	 return map.lastCharKey();
+	}
+	/** Returns the rank of a key, that is, the number of elements of this set smaller than the given key.
+	 *
+	 * @param k a key.
+	 * @return the number of elements of this set that are smaller than {@code k}.
+	 */
+	public int rank(final char k) {
+	 return map.rank(k);
+	}
+	/** Returns the element of given rank, that is, the element in given position in this set.
+	 *
+	 * @param rank a rank, between 0 (inclusive) and the size of this set (exclusive).
+	 * @return the element of rank {@code rank}.
+	 * @throws IndexOutOfBoundsException if {@code rank} is negative or not smaller than the size of this set.
+	 */
+	public char select(final int rank) {
+	 return map.select(rank);
+	}
+	@Override
+	public CharBidirectionalIterator iterator() { return map.keySet().iterator(); }
+	@Override
+	public CharBidirectionalIterator iterator(final char from) { return map.keySet().iterator(from); }
+	@Override
+	public CharComparator comparator() { return map.comparator(); }
+	@Override
+	public CharSortedSet headSet(final char to) { return new Subset(map.headMap(to)); }
+	@Override
+	public CharSortedSet tailSet(final char from) { return new Subset(map.tailMap(from)); }
+	@Override
+	public CharSortedSet subSet(final char from, final char to) { return new Subset(map.subMap(from, to)); }
+	/** A subset with given range, backed by a submap of {@link #map}. */
+	private final class Subset extends AbstractCharSortedSet implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 /** The submap backing this subset. */
+	 final Char2ObjectSortedMap <Object> submap;
+	 Subset(final Char2ObjectSortedMap <Object> submap) {
+	  this.submap = submap;
+	 }
+	 @Override
+	 public boolean add(final char k) { return submap.put(k, null) == NOT_PRESENT; }
+	 @Override
+	 public boolean remove(final char k) { return submap.remove(k) != NOT_PRESENT; }
+	 @Override
+	 public boolean contains(final char k) { return submap.containsKey(k); }
+	 @Override
+	 public void clear() { submap.clear(); }
+	 @Override
+	 public int size() { return submap.size(); }
+	 @Override
+	 public boolean isEmpty() { return submap.isEmpty(); }
+	 @Override
+	 public char firstChar() { return submap.firstCharKey(); }
+	 @Override
+	 public char lastChar() { return submap.lastCharKey(); }
+	 @Override
+	 public CharBidirectionalIterator iterator() { return submap.keySet().iterator(); }
+	 @Override
+	 public CharBidirectionalIterator iterator(final char from) { return submap.keySet().iterator(from); }
+	 @Override
+	 public CharComparator comparator() { return submap.comparator(); }
+	 @Override
+	 public CharSortedSet headSet(final char to) { return new Subset(submap.headMap(to)); }
+	 @Override
+	 public CharSortedSet tailSet(final char from) { return new Subset(submap.tailMap(from)); }
+	 @Override
+	 public CharSortedSet subSet(final char from, final char to) { return new Subset(submap.subMap(from, to)); }
+	}
+	/** Returns a deep copy of this tree set.
+	 *
+	 * <p>This method performs a deep copy of this tree set; the data stored in the
+	 * set, however, is not cloned. Note that this makes a difference only for object keys.
+	 *
+	 * @return a deep copy of this tree set.
+	 */
+	@Override
+
+	public CharBTreeSet clone() {
+	 CharBTreeSet c;
+	 try {
+	  c = (CharBTreeSet )super.clone();
+	 }
+	 catch(CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.map = map.clone();
+	 return c;
+	}
+}
@@ -314,22 +314,38 @@
 #define OPEN_HASH_BIG_SET DoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedDoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Double2BooleanOpenDoubleHashMap
 #define ARRAY_SET DoubleArraySet
 #define ARRAY_MAP Double2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET DoubleLinkedOpenHashSet
 #define AVL_TREE_SET DoubleAVLTreeSet
 #define RB_TREE_SET DoubleRBTreeSet
+#define BTREE_SET DoubleBTreeSet
+#define PERSISTENT_TREE_SET DoublePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET DoubleConcurrentSkipListSet
+#define SORTED_ARRAY_SET DoubleSortedArraySet
 #define AVL_TREE_MAP Double2BooleanAVLTreeMap
 #define RB_TREE_MAP Double2BooleanRBTreeMap
+#define BTREE_MAP Double2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Double2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Double2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Double2BooleanSortedArrayMap
+#define CACHE Double2BooleanCache
+#define STATIC_FUNCTION Double2BooleanStaticFunction
+#define BLOOM_FILTER DoubleBloomFilter
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
 #define MAPPED_BIG_LIST DoubleMappedBigList
 #define ARRAY_FRONT_CODED_LIST DoubleArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST DoubleArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST DoubleEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET DoubleEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE DoubleHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE DoubleHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE DoubleHeapIndirectPriorityQueue
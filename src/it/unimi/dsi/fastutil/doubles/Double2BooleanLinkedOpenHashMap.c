@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2BooleanLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2BooleanAVLTreeMap
 #define RB_TREE_MAP Double2BooleanRBTreeMap
+#define CACHE Double2BooleanCache
+#define STATIC_FUNCTION Double2BooleanStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -314,6 +314,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Double2BooleanOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Double2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2BooleanOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2BooleanOpenCustomDoubleHashMap
@@ -324,6 +326,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2BooleanAVLTreeMap
 #define RB_TREE_MAP Double2BooleanRBTreeMap
+#define CACHE Double2BooleanCache
+#define STATIC_FUNCTION Double2BooleanStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
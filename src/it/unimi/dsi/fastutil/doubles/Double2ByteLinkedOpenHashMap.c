@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2ByteLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2ByteAVLTreeMap
 #define RB_TREE_MAP Double2ByteRBTreeMap
+#define CACHE Double2ByteCache
+#define STATIC_FUNCTION Double2ByteStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2ByteOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2ByteAVLTreeMap
 #define RB_TREE_MAP Double2ByteRBTreeMap
+#define CACHE Double2ByteCache
+#define STATIC_FUNCTION Double2ByteStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -315,22 +315,44 @@
 #define OPEN_HASH_BIG_SET DoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ByteOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedDoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Double2ByteOpenDoubleHashMap
 #define ARRAY_SET DoubleArraySet
 #define ARRAY_MAP Double2ByteArrayMap
 #define LINKED_OPEN_HASH_SET DoubleLinkedOpenHashSet
 #define AVL_TREE_SET DoubleAVLTreeSet
 #define RB_TREE_SET DoubleRBTreeSet
+#define BTREE_SET DoubleBTreeSet
+#define PERSISTENT_TREE_SET DoublePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET DoubleConcurrentSkipListSet
+#define SORTED_ARRAY_SET DoubleSortedArraySet
 #define AVL_TREE_MAP Double2ByteAVLTreeMap
+#define ARENA_TREE_MAP Double2ByteArenaTreeMap
 #define RB_TREE_MAP Double2ByteRBTreeMap
+#define BTREE_MAP Double2ByteBTreeMap
+#define PERSISTENT_TREE_MAP Double2BytePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Double2ByteConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Double2ByteSortedArrayMap
+#define CACHE Double2ByteCache
+#define STATIC_FUNCTION Double2ByteStaticFunction
+#define BLOOM_FILTER DoubleBloomFilter
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST DoubleCopyOnWriteArrayList
+#define CHUNKED_LIST DoubleChunkedList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
 #define MAPPED_BIG_LIST DoubleMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST DoubleAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST DoubleArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST DoubleArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST DoubleMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST DoubleEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET DoubleEliasFanoSortedSet
+#define PACKED_BIG_LIST DoublePackedBigList
 #define HEAP_PRIORITY_QUEUE DoubleHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE DoubleHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE DoubleHeapIndirectPriorityQueue
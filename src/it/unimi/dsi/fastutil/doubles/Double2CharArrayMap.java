@@ -30,6 +30,9 @@ import it.unimi.dsi.fastutil.chars.CharConsumer ;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of pairs: just put them into two parallel arrays and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several keys per iteration without short-circuiting, so that there
+	* is a single branch per block of keys.
 	*/
 public class Double2CharArrayMap extends AbstractDouble2CharMap implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -267,15 +270,17 @@ public class Double2CharArrayMap extends AbstractDouble2CharMap implements java.
 	}
 	private int findKey(final double k) {
 	 final double[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( Double.doubleToLongBits(key[i]) == Double.doubleToLongBits(k) )) return i;
+	 int i = size;
+	 // Non-short-circuit operators leave a single branch for each block of four keys
+	 for(; i >= 4; i -= 4) if (( Double.doubleToLongBits(key[i - 1]) == Double.doubleToLongBits(k) ) | ( Double.doubleToLongBits(key[i - 2]) == Double.doubleToLongBits(k) ) | ( Double.doubleToLongBits(key[i - 3]) == Double.doubleToLongBits(k) ) | ( Double.doubleToLongBits(key[i - 4]) == Double.doubleToLongBits(k) )) break;
+	 while(i-- != 0) if (( Double.doubleToLongBits(key[i]) == Double.doubleToLongBits(k) )) return i;
 	 return -1;
 	}
 	@Override
 
 	public char get(final double k) {
-	 final double[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( Double.doubleToLongBits(key[i]) == Double.doubleToLongBits(k) )) return value[i];
-	 return defRetValue;
+	 final int i = findKey(k);
+	 return i == -1 ? defRetValue : value[i];
 	}
 	@Override
 	public int size() { return size; }
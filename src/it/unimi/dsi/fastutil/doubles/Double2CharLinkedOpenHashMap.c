@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2CharLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2CharAVLTreeMap
 #define RB_TREE_MAP Double2CharRBTreeMap
+#define CACHE Double2CharCache
+#define STATIC_FUNCTION Double2CharStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2CharOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2CharAVLTreeMap
 #define RB_TREE_MAP Double2CharRBTreeMap
+#define CACHE Double2CharCache
+#define STATIC_FUNCTION Double2CharStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
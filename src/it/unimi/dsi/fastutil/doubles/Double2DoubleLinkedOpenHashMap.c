@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2DoubleLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2DoubleAVLTreeMap
 #define RB_TREE_MAP Double2DoubleRBTreeMap
+#define CACHE Double2DoubleCache
+#define STATIC_FUNCTION Double2DoubleStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Double2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Double2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2DoubleOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2DoubleAVLTreeMap
 #define RB_TREE_MAP Double2DoubleRBTreeMap
+#define CACHE Double2DoubleCache
+#define STATIC_FUNCTION Double2DoubleStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2FloatLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2FloatAVLTreeMap
 #define RB_TREE_MAP Double2FloatRBTreeMap
+#define CACHE Double2FloatCache
+#define STATIC_FUNCTION Double2FloatStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2IntLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2IntAVLTreeMap
 #define RB_TREE_MAP Double2IntRBTreeMap
+#define CACHE Double2IntCache
+#define STATIC_FUNCTION Double2IntStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
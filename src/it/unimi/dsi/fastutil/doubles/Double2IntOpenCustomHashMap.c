@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Double2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Double2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2IntOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2IntAVLTreeMap
 #define RB_TREE_MAP Double2IntRBTreeMap
+#define CACHE Double2IntCache
+#define STATIC_FUNCTION Double2IntStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
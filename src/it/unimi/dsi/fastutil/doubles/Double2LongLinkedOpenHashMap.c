@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2LongLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2LongAVLTreeMap
 #define RB_TREE_MAP Double2LongRBTreeMap
+#define CACHE Double2LongCache
+#define STATIC_FUNCTION Double2LongStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET DoubleOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Double2LongOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Double2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2LongOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2LongOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2LongOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2LongAVLTreeMap
 #define RB_TREE_MAP Double2LongRBTreeMap
+#define CACHE Double2LongCache
+#define STATIC_FUNCTION Double2LongStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
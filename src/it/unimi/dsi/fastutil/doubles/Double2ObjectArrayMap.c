@@ -314,22 +314,38 @@
 #define OPEN_HASH_BIG_SET DoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ObjectOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedDoubleOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Double2ObjectOpenDoubleHashMap
 #define ARRAY_SET DoubleArraySet
 #define ARRAY_MAP Double2ObjectArrayMap
 #define LINKED_OPEN_HASH_SET DoubleLinkedOpenHashSet
 #define AVL_TREE_SET DoubleAVLTreeSet
 #define RB_TREE_SET DoubleRBTreeSet
+#define BTREE_SET DoubleBTreeSet
+#define PERSISTENT_TREE_SET DoublePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET DoubleConcurrentSkipListSet
+#define SORTED_ARRAY_SET DoubleSortedArraySet
 #define AVL_TREE_MAP Double2ObjectAVLTreeMap
 #define RB_TREE_MAP Double2ObjectRBTreeMap
+#define BTREE_MAP Double2ObjectBTreeMap
+#define PERSISTENT_TREE_MAP Double2ObjectPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Double2ObjectConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Double2ObjectSortedArrayMap
+#define CACHE Double2ObjectCache
+#define STATIC_FUNCTION Double2ObjectStaticFunction
+#define BLOOM_FILTER DoubleBloomFilter
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
 #define MAPPED_BIG_LIST DoubleMappedBigList
 #define ARRAY_FRONT_CODED_LIST DoubleArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST DoubleArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST DoubleEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET DoubleEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE DoubleHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE DoubleHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE DoubleHeapIndirectPriorityQueue
@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2ObjectLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2ObjectAVLTreeMap
 #define RB_TREE_MAP Double2ObjectRBTreeMap
+#define CACHE Double2ObjectCache
+#define STATIC_FUNCTION Double2ObjectStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
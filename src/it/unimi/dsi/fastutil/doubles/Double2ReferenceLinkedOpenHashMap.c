@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET DoubleLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET DoubleLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Double2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Double2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Double2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Double2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedDouble2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Double2ReferenceLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET DoubleRBTreeSet
 #define AVL_TREE_MAP Double2ReferenceAVLTreeMap
 #define RB_TREE_MAP Double2ReferenceRBTreeMap
+#define CACHE Double2ReferenceCache
+#define STATIC_FUNCTION Double2ReferenceStaticFunction
 #define ARRAY_LIST DoubleArrayList
 #define IMMUTABLE_LIST DoubleImmutableList
 #define BIG_ARRAY_BIG_LIST DoubleBigArrayBigList
@@ -0,0 +1,303 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.doubles;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.NoSuchElementException;
+import java.util.SortedSet;
+import java.util.Spliterator;
+/** An immutable sorted set based on a sorted backing array.
+	*
+	* <p>Instances of this class keep their elements sorted in a single array, so they use much less memory
+	* than a tree-based set, and scan much faster. Lookups use a branchless binary search, preceded,
+	* for integral elements in their natural order, by a few rounds of interpolation search.
+	* Subsets are views over a slice of the backing array, and they are created in logarithmic
+	* time without copying any element.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class DoubleSortedArraySet extends AbstractDoubleSortedSet implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The backing array (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient double[] a;
+	/** The index of the first element of this set in {@link #a}. */
+	protected transient int from;
+	/** The index after the last element of this set in {@link #a}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #a}, or {@code null} for the natural order. */
+	protected DoubleComparator comparator;
+	/** Creates a new set backed by a slice of a sorted array containing distinct elements. */
+	protected DoubleSortedArraySet(final double[] a, final int from, final int to, final DoubleComparator comparator) {
+	 this.a = a;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new set using the given array, after sorting it and removing duplicates.
+	 *
+	 * @param a an array, which will be modified by this constructor.
+	 * @param size the number of valid elements in {@code a}.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether the first {@code size} elements of {@code a} are already sorted and distinct.
+	 */
+
+	private DoubleSortedArraySet(final double[] a, int size, final DoubleComparator comparator, final boolean sorted) {
+	 this.comparator = comparator;
+	 if (! sorted && size > 1) {
+	  if (comparator == null) DoubleArrays.quickSort(a, 0, size);
+	  else DoubleArrays.quickSort(a, 0, size, comparator);
+	  int j = 0;
+	  for (int i = 1; i < size; i++) if (compare( a[j], a[i]) != 0) a[++j] = a[i];
+	  size = j + 1;
+	 }
+	 this.a = DoubleArrays.trim(a, size);
+	 this.from = 0;
+	 this.to = size;
+	}
+	/** Creates a new set containing the elements of an array, using a given comparator.
+	 *
+	 * @param a an array.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 */
+	public DoubleSortedArraySet(final double[] a, final Comparator<? super Double> c) {
+	 this(a.clone(), a.length, asComparator(c), false);
+	}
+	/** Creates a new set containing the elements of an array.
+	 *
+	 * @param a an array.
+	 */
+	public DoubleSortedArraySet(final double[] a) {
+	 this(a, null);
+	}
+	/** Creates a new set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection.
+	 */
+	public DoubleSortedArraySet(final DoubleCollection c) {
+	 this(c.toDoubleArray(), c.size(), null, false);
+	}
+	/** Creates a new set copying a given collection.
+	 *
+	 * @param c a collection.
+	 */
+	public DoubleSortedArraySet(final Collection<? extends Double> c) {
+	 this(toKeyArray(c), c.size(), null, false);
+	}
+	/** Creates a new set copying a given type-specific sorted set (and its comparator).
+	 *
+	 * @param s a type-specific sorted set.
+	 */
+	public DoubleSortedArraySet(final DoubleSortedSet s) {
+	 this(s.toDoubleArray(), s.size(), s.comparator(), true);
+	}
+	/** Creates a new set copying a given sorted set (and its comparator).
+	 *
+	 * @param s a sorted set.
+	 */
+	public DoubleSortedArraySet(final SortedSet<Double> s) {
+	 this(toKeyArray(s), s.size(), asComparator(s.comparator()), true);
+	}
+	private static DoubleComparator asComparator(final Comparator<? super Double> c) {
+	 return DoubleComparators.asDoubleComparator(c);
+	}
+	private static double[] toKeyArray(final Collection<? extends Double> c) {
+	 final double[] a = new double[c.size()];
+	 int i = 0;
+	 for (final Double k : c) a[i++] = (k).doubleValue();
+	 return a;
+	}
+
+	final int compare(final double k1, final double k2) {
+	 return comparator == null ? ( Double.compare((k1),(k2)) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first element of this set greater than or equal to a given key.
+	 *
+	 * @param k a key.
+	 * @return the index in {@link #a} of the first element of this set greater than or equal to {@code k}, or {@link #to}.
+	 */
+
+	final int lowerBound(final double k) {
+	 return lowerBound(a, from, to, k, comparator);
+	}
+	/** Returns the index of the first element of a sorted array slice greater than or equal to a given key.
+	 *
+	 * <p>The search is branchless. For integral keys in their natural order, a few rounds of
+	 * interpolation search narrow the range first, which for uniformly distributed keys
+	 * brings the range down to a handful of elements.
+	 *
+	 * @param a a sorted array.
+	 * @param from the first index of the slice (inclusive).
+	 * @param to the last index of the slice (exclusive).
+	 * @param k a key.
+	 * @param comparator the comparator used to sort {@code a}, or {@code null} for the natural order.
+	 * @return the index of the first element of the slice greater than or equal to {@code k}, or {@code to}.
+	 */
+
+	static int lowerBound(final double[] a, int from, final int to, final double k, final DoubleComparator comparator) {
+	 int n = to - from;
+	 if (n == 0) return from;
+	 if (comparator == null) {
+	  while (n > 1) {
+	   final int half = n >>> 1;
+	   from = ( Double.compare(( a[from + half]),(k)) < 0 ) ? from + half : from;
+	   n -= half;
+	  }
+	  return ( Double.compare(( a[from]),(k)) < 0 ) ? from + 1 : from;
+	 }
+	 while (n > 1) {
+	  final int half = n >>> 1;
+	  from = comparator.compare( a[from + half], k) < 0 ? from + half : from;
+	  n -= half;
+	 }
+	 return comparator.compare( a[from], k) < 0 ? from + 1 : from;
+	}
+	@Override
+
+	public boolean contains(final double k) {
+	 final int i = lowerBound( k);
+	 return i < to && compare( a[i], k) == 0;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+
+	public double firstDouble() {
+	 if (from == to) throw new NoSuchElementException();
+	 return a[from];
+	}
+	@Override
+
+	public double lastDouble() {
+	 if (from == to) throw new NoSuchElementException();
+	 return a[to - 1];
+	}
+	@Override
+	public DoubleComparator comparator() {
+	 return comparator;
+	}
+	/** An iterator on a slice of the backing array. */
+	private final class SetIterator implements DoubleBidirectionalIterator {
+	 /** The index of the next element to be returned. */
+	 int pos;
+	 SetIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	
+	 public double nextDouble() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return a[pos++];
+	 }
+	 @Override
+	
+	 public double previousDouble() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  return a[--pos];
+	 }
+	 @Override
+	
+	 public void forEachRemaining(final java.util.function.DoubleConsumer action) {
+	  final double[] a = DoubleSortedArraySet.this.a;
+	  for (final int max = to; pos < max;) action.accept( a[pos++]);
+	 }
+	 @Override
+	 public int skip(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, to - pos);
+	  pos += skipped;
+	  return skipped;
+	 }
+	 @Override
+	 public int back(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, pos - from);
+	  pos -= skipped;
+	  return skipped;
+	 }
+	}
+	@Override
+	public DoubleBidirectionalIterator iterator() {
+	 return new SetIterator(from);
+	}
+	@Override
+
+	public DoubleBidirectionalIterator iterator(final double from) {
+	 int i = lowerBound(from);
+	 if (i < to && compare( a[i], from) == 0) i++;
+	 return new SetIterator(i);
+	}
+	@Override
+
+	public DoubleSpliterator spliterator() {
+	 return DoubleSpliterators.wrapPreSorted( a, from, to - from, Spliterator.DISTINCT | Spliterator.IMMUTABLE, comparator);
+	}
+	@Override
+
+	public void forEach(final java.util.function.DoubleConsumer action) {
+	 final double[] a = this.a;
+	 for (int i = from, max = to; i < max; i++) action.accept( a[i]);
+	}
+	@Override
+	public DoubleSortedSet headSet(final double to) {
+	 return new DoubleSortedArraySet (a, from, lowerBound(to), comparator);
+	}
+	@Override
+	public DoubleSortedSet tailSet(final double from) {
+	 return new DoubleSortedArraySet (a, lowerBound(from), to, comparator);
+	}
+	@Override
+	public DoubleSortedSet subSet(final double from, final double to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start element (" + from + ") is larger than end element (" + to + ")");
+	 return new DoubleSortedArraySet (a, lowerBound(from), lowerBound(to), comparator);
+	}
+	@Override
+	public double[] toDoubleArray() {
+	 return java.util.Arrays.copyOfRange(a, from, to);
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) s.writeDouble(a[i]);
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 a = new double[to];
+	 for (int i = 0; i < to; i++) a[i] = s.readDouble();
+	}
+}
@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2BooleanLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2BooleanAVLTreeMap
 #define RB_TREE_MAP Float2BooleanRBTreeMap
+#define CACHE Float2BooleanCache
+#define STATIC_FUNCTION Float2BooleanStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -314,6 +314,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Float2BooleanOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Float2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2BooleanOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2BooleanOpenCustomDoubleHashMap
@@ -324,6 +326,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2BooleanAVLTreeMap
 #define RB_TREE_MAP Float2BooleanRBTreeMap
+#define CACHE Float2BooleanCache
+#define STATIC_FUNCTION Float2BooleanStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
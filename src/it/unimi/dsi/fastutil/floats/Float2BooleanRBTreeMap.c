@@ -314,22 +314,44 @@
 #define OPEN_HASH_BIG_SET FloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedFloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Float2BooleanOpenDoubleHashMap
 #define ARRAY_SET FloatArraySet
 #define ARRAY_MAP Float2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET FloatLinkedOpenHashSet
 #define AVL_TREE_SET FloatAVLTreeSet
 #define RB_TREE_SET FloatRBTreeSet
+#define BTREE_SET FloatBTreeSet
+#define PERSISTENT_TREE_SET FloatPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET FloatConcurrentSkipListSet
+#define SORTED_ARRAY_SET FloatSortedArraySet
 #define AVL_TREE_MAP Float2BooleanAVLTreeMap
+#define ARENA_TREE_MAP Float2BooleanArenaTreeMap
 #define RB_TREE_MAP Float2BooleanRBTreeMap
+#define BTREE_MAP Float2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Float2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Float2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Float2BooleanSortedArrayMap
+#define CACHE Float2BooleanCache
+#define STATIC_FUNCTION Float2BooleanStaticFunction
+#define BLOOM_FILTER FloatBloomFilter
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST FloatCopyOnWriteArrayList
+#define CHUNKED_LIST FloatChunkedList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
 #define MAPPED_BIG_LIST FloatMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST FloatAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST FloatArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST FloatArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST FloatMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST FloatEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET FloatEliasFanoSortedSet
+#define PACKED_BIG_LIST FloatPackedBigList
 #define HEAP_PRIORITY_QUEUE FloatHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE FloatHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE FloatHeapIndirectPriorityQueue
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2ByteLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2ByteAVLTreeMap
 #define RB_TREE_MAP Float2ByteRBTreeMap
+#define CACHE Float2ByteCache
+#define STATIC_FUNCTION Float2ByteStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2CharLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2CharAVLTreeMap
 #define RB_TREE_MAP Float2CharRBTreeMap
+#define CACHE Float2CharCache
+#define STATIC_FUNCTION Float2CharStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2CharOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2CharAVLTreeMap
 #define RB_TREE_MAP Float2CharRBTreeMap
+#define CACHE Float2CharCache
+#define STATIC_FUNCTION Float2CharStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
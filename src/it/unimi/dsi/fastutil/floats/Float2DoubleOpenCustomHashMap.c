@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Float2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Float2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2DoubleOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2DoubleAVLTreeMap
 #define RB_TREE_MAP Float2DoubleRBTreeMap
+#define CACHE Float2DoubleCache
+#define STATIC_FUNCTION Float2DoubleStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET FloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2FloatOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2FloatOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2FloatOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedFloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Float2FloatOpenDoubleHashMap
 #define ARRAY_SET FloatArraySet
 #define ARRAY_MAP Float2FloatArrayMap
 #define LINKED_OPEN_HASH_SET FloatLinkedOpenHashSet
 #define AVL_TREE_SET FloatAVLTreeSet
 #define RB_TREE_SET FloatRBTreeSet
+#define BTREE_SET FloatBTreeSet
+#define PERSISTENT_TREE_SET FloatPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET FloatConcurrentSkipListSet
+#define SORTED_ARRAY_SET FloatSortedArraySet
 #define AVL_TREE_MAP Float2FloatAVLTreeMap
 #define RB_TREE_MAP Float2FloatRBTreeMap
+#define BTREE_MAP Float2FloatBTreeMap
+#define PERSISTENT_TREE_MAP Float2FloatPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Float2FloatConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Float2FloatSortedArrayMap
+#define CACHE Float2FloatCache
+#define STATIC_FUNCTION Float2FloatStaticFunction
+#define BLOOM_FILTER FloatBloomFilter
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
 #define MAPPED_BIG_LIST FloatMappedBigList
 #define ARRAY_FRONT_CODED_LIST FloatArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST FloatArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST FloatEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET FloatEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE FloatHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE FloatHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE FloatHeapIndirectPriorityQueue
@@ -26,6 +26,9 @@ import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of pairs: just put them into two parallel arrays and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several keys per iteration without short-circuiting, so that there
+	* is a single branch per block of keys.
 	*/
 public class Float2FloatArrayMap extends AbstractFloat2FloatMap implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -263,15 +266,17 @@ public class Float2FloatArrayMap extends AbstractFloat2FloatMap implements java.
 	}
 	private int findKey(final float k) {
 	 final float[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( Float.floatToIntBits(key[i]) == Float.floatToIntBits(k) )) return i;
+	 int i = size;
+	 // Non-short-circuit operators leave a single branch for each block of four keys
+	 for(; i >= 4; i -= 4) if (( Float.floatToIntBits(key[i - 1]) == Float.floatToIntBits(k) ) | ( Float.floatToIntBits(key[i - 2]) == Float.floatToIntBits(k) ) | ( Float.floatToIntBits(key[i - 3]) == Float.floatToIntBits(k) ) | ( Float.floatToIntBits(key[i - 4]) == Float.floatToIntBits(k) )) break;
+	 while(i-- != 0) if (( Float.floatToIntBits(key[i]) == Float.floatToIntBits(k) )) return i;
 	 return -1;
 	}
 	@Override
 
 	public float get(final float k) {
-	 final float[] key = this.key;
-	 for(int i = size; i-- != 0;) if (( Float.floatToIntBits(key[i]) == Float.floatToIntBits(k) )) return value[i];
-	 return defRetValue;
+	 final int i = findKey(k);
+	 return i == -1 ? defRetValue : value[i];
 	}
 	@Override
 	public int size() { return size; }
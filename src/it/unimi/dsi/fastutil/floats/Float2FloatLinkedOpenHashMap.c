@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2FloatLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2FloatAVLTreeMap
 #define RB_TREE_MAP Float2FloatRBTreeMap
+#define CACHE Float2FloatCache
+#define STATIC_FUNCTION Float2FloatStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2IntLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2IntAVLTreeMap
 #define RB_TREE_MAP Float2IntRBTreeMap
+#define CACHE Float2IntCache
+#define STATIC_FUNCTION Float2IntStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
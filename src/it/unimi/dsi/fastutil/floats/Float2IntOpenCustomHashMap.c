@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Float2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Float2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2IntOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2IntAVLTreeMap
 #define RB_TREE_MAP Float2IntRBTreeMap
+#define CACHE Float2IntCache
+#define STATIC_FUNCTION Float2IntStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
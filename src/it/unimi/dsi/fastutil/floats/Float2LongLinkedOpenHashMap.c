@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2LongLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2LongAVLTreeMap
 #define RB_TREE_MAP Float2LongRBTreeMap
+#define CACHE Float2LongCache
+#define STATIC_FUNCTION Float2LongStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
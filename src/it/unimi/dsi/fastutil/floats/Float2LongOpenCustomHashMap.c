@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Float2LongOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Float2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2LongOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2LongOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2LongOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2LongAVLTreeMap
 #define RB_TREE_MAP Float2LongRBTreeMap
+#define CACHE Float2LongCache
+#define STATIC_FUNCTION Float2LongStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
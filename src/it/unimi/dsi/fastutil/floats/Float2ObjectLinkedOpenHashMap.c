@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2ObjectLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2ObjectAVLTreeMap
 #define RB_TREE_MAP Float2ObjectRBTreeMap
+#define CACHE Float2ObjectCache
+#define STATIC_FUNCTION Float2ObjectStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
@@ -314,6 +314,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2ObjectOpenDoubleHashMap
@@ -324,6 +326,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2ObjectAVLTreeMap
 #define RB_TREE_MAP Float2ObjectRBTreeMap
+#define CACHE Float2ObjectCache
+#define STATIC_FUNCTION Float2ObjectStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
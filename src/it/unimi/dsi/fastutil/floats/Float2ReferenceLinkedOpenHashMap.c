@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET FloatLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Float2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Float2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2ReferenceLinkedOpenDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2ReferenceAVLTreeMap
 #define RB_TREE_MAP Float2ReferenceRBTreeMap
+#define CACHE Float2ReferenceCache
+#define STATIC_FUNCTION Float2ReferenceStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
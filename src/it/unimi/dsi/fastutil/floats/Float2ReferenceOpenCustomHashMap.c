@@ -314,6 +314,8 @@
 #define OPEN_HASH_BIG_SET FloatOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET FloatOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Float2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Float2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Float2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Float2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedFloat2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Float2ReferenceOpenCustomDoubleHashMap
@@ -324,6 +326,8 @@
 #define RB_TREE_SET FloatRBTreeSet
 #define AVL_TREE_MAP Float2ReferenceAVLTreeMap
 #define RB_TREE_MAP Float2ReferenceRBTreeMap
+#define CACHE Float2ReferenceCache
+#define STATIC_FUNCTION Float2ReferenceStaticFunction
 #define ARRAY_LIST FloatArrayList
 #define IMMUTABLE_LIST FloatImmutableList
 #define BIG_ARRAY_BIG_LIST FloatBigArrayBigList
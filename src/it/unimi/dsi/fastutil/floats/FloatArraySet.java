@@ -22,6 +22,9 @@ import java.util.Set;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of items: just put them into an array and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several elements per iteration without short-circuiting, so that there
+	* is a single branch per block of elements.
 	*/
 public class FloatArraySet extends AbstractFloatSet implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -155,7 +158,11 @@ public class FloatArraySet extends AbstractFloatSet implements java.io.Serializa
 	 return new FloatArraySet (a);
 	}
 	private int findKey(final float o) {
-	 for(int i = size; i-- != 0;) if (( Float.floatToIntBits(a[i]) == Float.floatToIntBits(o) )) return i;
+	 final float[] a = this.a;
+	 int i = size;
+	 // Non-short-circuit operators leave a single branch for each block of four keys
+	 for(; i >= 4; i -= 4) if (( Float.floatToIntBits(a[i - 1]) == Float.floatToIntBits(o) ) | ( Float.floatToIntBits(a[i - 2]) == Float.floatToIntBits(o) ) | ( Float.floatToIntBits(a[i - 3]) == Float.floatToIntBits(o) ) | ( Float.floatToIntBits(a[i - 4]) == Float.floatToIntBits(o) )) break;
+	 while(i-- != 0) if (( Float.floatToIntBits(a[i]) == Float.floatToIntBits(o) )) return i;
 	 return -1;
 	}
 	// TODO Maybe make this return a list-iterator like the LinkedXHashSets do?
@@ -0,0 +1,399 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.floats;
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.HashCommon;
+import it.unimi.dsi.fastutil.Size64;
+import java.util.Arrays;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
+import java.util.concurrent.RecursiveAction;
+import java.util.concurrent.atomic.AtomicLongArray;
+/** A type-specific blocked Bloom filter.
+	*
+	* <p>A Bloom filter is an approximate representation of a set: {@link #mightContain mightContain()}
+	* returns true on all keys that have been {@linkplain #add added} to the filter, but it might return true
+	* also on other keys (a <em>false positive</em>). The probability of a false positive depends on the
+	* number of bits per key: for example, about ten bits per key yield a false-positive rate of about 1%.
+	*
+	* <p>This implementation is <em>blocked</em>: the bit array is divided into blocks of 512 bits, the size of
+	* a typical cache line, and all bits associated with a key lie in the same block. As a consequence,
+	* a query costs a single random memory access (at most two, if the block straddles two cache lines),
+	* rather than one per hash function, at the price of a slightly larger false-positive rate for a given number of bits.
+	* A filter is thus a cheap way to answer negatively most queries for keys that are not in a large
+	* hash set, such as an {@link it.unimi.dsi.fastutil.longs.LongOpenHashBigSet}, without touching the set.
+	*
+	* <p>Filters can be built incrementally, or in bulk from a type-specific collection, an array or
+	* a big array. The parallel static factories split the keys among the threads of a {@link ForkJoinPool}
+	* (the {@linkplain ForkJoinPool#commonPool() common pool}, unless the method is called
+	* from within another pool); they need temporary space equal to the size of the filter.
+	*
+	* <p>Filters are serializable, and can thus be stored and loaded using {@link it.unimi.dsi.fastutil.io.BinIO#storeObject(Object, java.io.File)}
+	* and {@link it.unimi.dsi.fastutil.io.BinIO#loadObject(java.io.File)}.
+	*
+	* <p>This class is not synchronized.
+	*
+	* @see <a href="https://doi.org/10.1007/978-3-540-72845-0_9">Felix Putze, Peter Sanders, and Johannes Singler,
+	* &ldquo;Cache-, Hash- and Space-Efficient Bloom Filters&rdquo;, <i>WEA 2007</i></a>
+	*/
+public class FloatBloomFilter implements java.io.Serializable, Cloneable {
+	private static final long serialVersionUID = 0L;
+	/** The number of longs in a block. */
+	private static final int BLOCK_LONGS = 8;
+	/** The maximum number of hash functions. */
+	public static final int MAX_HASH_FUNCTIONS = 16;
+	/** The number of keys per parallel task under which we do not fork. */
+	private static final int PARALLEL_NO_FORK = 1 << 16;
+	/** The bit array, made of {@link #blocks} blocks of {@link #BLOCK_LONGS} longs. */
+	protected long[] bits;
+	/** The number of blocks. */
+	protected final int blocks;
+	/** The number of hash functions (i.e., of bits set for each key). */
+	protected final int hashFunctions;
+	/** Creates a new Bloom filter with given number of blocks and hash functions.
+	 *
+	 * @param blocks the number of blocks of 512 bits.
+	 * @param hashFunctions the number of hash functions.
+	 */
+	private FloatBloomFilter(final int blocks, final int hashFunctions) {
+	 if (blocks <= 0 || blocks > Integer.MAX_VALUE / BLOCK_LONGS) throw new IllegalArgumentException("Illegal number of blocks: " + blocks);
+	 if (hashFunctions <= 0 || hashFunctions > MAX_HASH_FUNCTIONS) throw new IllegalArgumentException("The number of hash functions must be between 1 and " + MAX_HASH_FUNCTIONS + ": " + hashFunctions);
+	 this.blocks = blocks;
+	 this.hashFunctions = hashFunctions;
+	 this.bits = new long[blocks * BLOCK_LONGS];
+	}
+	/** Creates a new Bloom filter for a given number of keys with a given false-positive rate.
+	 *
+	 * @param expectedKeys the expected number of keys.
+	 * @param fpp the desired false-positive rate (for a filter containing {@code expectedKeys} keys).
+	 */
+	public FloatBloomFilter(final long expectedKeys, final double fpp) {
+	 this(blocks(expectedKeys, fpp), hashFunctions(fpp));
+	}
+	/** Creates a new Bloom filter for a given number of keys with a false-positive rate of 1%.
+	 *
+	 * @param expectedKeys the expected number of keys.
+	 */
+	public FloatBloomFilter(final long expectedKeys) {
+	 this(expectedKeys, .01);
+	}
+	private static long bitsPerKey(final double fpp) {
+	 if (! (fpp > 0 && fpp < 1)) throw new IllegalArgumentException("The false-positive rate must be in (0..1): " + fpp);
+	 // Optimal number of bits of a classical filter, plus a correction for blocking
+	 return (long)Math.ceil(-Math.log(fpp) / (Math.log(2) * Math.log(2)) * 1.1);
+	}
+	private static int blocks(final long expectedKeys, final double fpp) {
+	 if (expectedKeys < 0) throw new IllegalArgumentException("The expected number of keys must be nonnegative: " + expectedKeys);
+	 final long blocks = Math.max(1, (Math.max(1, expectedKeys) * bitsPerKey(fpp) + 511) / 512);
+	 if (blocks > Integer.MAX_VALUE / BLOCK_LONGS) throw new IllegalArgumentException("Too many keys for a Bloom filter with false-positive rate " + fpp + ": " + expectedKeys);
+	 return (int)blocks;
+	}
+	private static int hashFunctions(final double fpp) {
+	 return (int)Math.max(1, Math.min(MAX_HASH_FUNCTIONS, Math.round(-Math.log(fpp) / Math.log(2))));
+	}
+	/** Returns a 64-bit hash of a key. */
+	private static long hash(final float k) {
+	 return HashCommon.murmurHash3((long)Float.floatToIntBits(k));
+	}
+	/** Returns the index of the first long of the block of a hash. */
+	private int block(final long h) {
+	 // The lower 32 bits choose the block, the upper 32 bits the bits in the block
+	 return (int)(((h & 0xFFFFFFFFL) * blocks) >>> 32) * BLOCK_LONGS;
+	}
+	/** Adds a key to this filter.
+	 *
+	 * @param k a key.
+	 * @return true if this filter changed as a result of the call (and thus {@code k} had certainly never been added before).
+	 */
+	public boolean add(final float k) {
+	 final long[] bits = this.bits;
+	 final long h = hash(k);
+	 final int block = block(h);
+	 final int h1 = (int)(h >>> 32), h2 = h1 >>> 9 | 1;
+	 boolean changed = false;
+	 for (int i = 0, p = h1; i < hashFunctions; i++, p += h2) {
+	  final int w = block + (p >>> 6 & 7);
+	  final long mask = 1L << p;
+	  if ((bits[w] & mask) == 0) {
+	   bits[w] |= mask;
+	   changed = true;
+	  }
+	 }
+	 return changed;
+	}
+	/** Returns whether a key might have been added to this filter.
+	 *
+	 * @param k a key.
+	 * @return false if {@code k} has certainly never been added to this filter; true
+	 * if {@code k} has been added, or as a false positive.
+	 */
+	public boolean mightContain(final float k) {
+	 final long[] bits = this.bits;
+	 final long h = hash(k);
+	 final int block = block(h);
+	 final int h1 = (int)(h >>> 32), h2 = h1 >>> 9 | 1;
+	 for (int i = 0, p = h1; i < hashFunctions; i++, p += h2) if ((bits[block + (p >>> 6 & 7)] & 1L << p) == 0) return false;
+	 return true;
+	}
+	/** Adds all keys returned by a type-specific iterator to this filter.
+	 *
+	 * @param i a type-specific iterator.
+	 */
+	public void addAll(final FloatIterator i) {
+	 while (i.hasNext()) add(i.nextFloat());
+	}
+	/** Adds all keys of a type-specific collection to this filter.
+	 *
+	 * @param c a type-specific collection.
+	 */
+	public void addAll(final FloatCollection c) {
+	 addAll(c.iterator());
+	}
+	/** Adds a fragment of an array to this filter.
+	 *
+	 * @param a an array.
+	 * @param offset the first position of the fragment.
+	 * @param length the length of the fragment.
+	 */
+	public void addAll(final float[] a, final int offset, final int length) {
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 for (int i = offset; i < offset + length; i++) add(a[i]);
+	}
+	/** Adds all keys of an array to this filter.
+	 *
+	 * @param a an array.
+	 */
+	public void addAll(final float[] a) {
+	 addAll(a, 0, a.length);
+	}
+	/** Adds all keys of a big array to this filter.
+	 *
+	 * @param a a big array.
+	 */
+	public void addAll(final float[][] a) {
+	 for (final float[] s : a) addAll(s);
+	}
+	/** ORs the content of another filter into this filter, which will then return true on
+	 * all keys for which either filter returned true.
+	 *
+	 * @param f a filter with the same number of bits and hash functions of this filter.
+	 */
+	public void merge(final FloatBloomFilter f) {
+	 if (f.blocks != blocks || f.hashFunctions != hashFunctions) throw new IllegalArgumentException("Incompatible filters");
+	 final long[] bits = this.bits, other = f.bits;
+	 for (int i = bits.length; i-- != 0;) bits[i] |= other[i];
+	}
+	/** Removes all keys from this filter. */
+	public void clear() {
+	 Arrays.fill(bits, 0);
+	}
+	/** Returns the number of bits of this filter.
+	 *
+	 * @return the number of bits of this filter.
+	 */
+	public long numBits() {
+	 return (long)bits.length * Long.SIZE;
+	}
+	/** Returns the number of hash functions of this filter.
+	 *
+	 * @return the number of bits set for each key.
+	 */
+	public int numHashFunctions() {
+	 return hashFunctions;
+	}
+	/** Returns the fraction of bits of this filter that are set; this number can be used to monitor saturation.
+	 *
+	 * @return the fraction of set bits.
+	 */
+	public double load() {
+	 long c = 0;
+	 for (final long b : bits) c += Long.bitCount(b);
+	 return (double)c / numBits();
+	}
+	/** Returns a deep copy of this filter.
+	 *
+	 * @return a deep copy of this filter.
+	 */
+	@Override
+	public FloatBloomFilter clone() {
+	 FloatBloomFilter c;
+	 try {
+	  c = (FloatBloomFilter)super.clone();
+	 }
+	 catch(CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 c.bits = bits.clone();
+	 return c;
+	}
+	@Override
+	public boolean equals(final Object o) {
+	 if (o == this) return true;
+	 if (! (o instanceof FloatBloomFilter)) return false;
+	 final FloatBloomFilter f = (FloatBloomFilter)o;
+	 return f.hashFunctions == hashFunctions && Arrays.equals(f.bits, bits);
+	}
+	@Override
+	public int hashCode() {
+	 return Arrays.hashCode(bits) ^ hashFunctions;
+	}
+	/** Returns a filter containing the keys of a type-specific collection.
+	 *
+	 * @param c a type-specific collection (possibly a {@linkplain it.unimi.dsi.fastutil.Size64 big} one).
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code c}.
+	 */
+	public static FloatBloomFilter of(final FloatCollection c, final double fpp) {
+	 final FloatBloomFilter f = new FloatBloomFilter(Size64.sizeOf(c), fpp);
+	 f.addAll(c);
+	 return f;
+	}
+	/** Returns a filter containing the keys of an array.
+	 *
+	 * @param a an array.
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code a}.
+	 */
+	public static FloatBloomFilter of(final float[] a, final double fpp) {
+	 final FloatBloomFilter f = new FloatBloomFilter(a.length, fpp);
+	 f.addAll(a);
+	 return f;
+	}
+	/** Returns a filter containing the keys of a big array.
+	 *
+	 * @param a a big array.
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code a}.
+	 */
+	public static FloatBloomFilter of(final float[][] a, final double fpp) {
+	 final FloatBloomFilter f = new FloatBloomFilter(BigArrays.length(a), fpp);
+	 f.addAll(a);
+	 return f;
+	}
+	/** Returns a filter containing the keys of an array, built in parallel.
+	 *
+	 * @param a an array.
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code a}.
+	 */
+	public static FloatBloomFilter parallelOf(final float[] a, final double fpp) {
+	 return parallelOf(new float[][] { a }, a.length, fpp);
+	}
+	/** Returns a filter containing the keys of a big array, built in parallel.
+	 *
+	 * @param a a big array.
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code a}.
+	 */
+	public static FloatBloomFilter parallelOf(final float[][] a, final double fpp) {
+	 return parallelOf(a, BigArrays.length(a), fpp);
+	}
+	/** Returns a filter containing the keys of a type-specific collection, built in parallel.
+	 *
+	 * <p>The keys are enumerated by splitting recursively the spliterator of the collection, so
+	 * the collection should have a spliterator that splits well (e.g., it should be an array-based
+	 * list or a hash set), and it must not be modified during the construction.
+	 *
+	 * @param c a type-specific collection (possibly a {@linkplain it.unimi.dsi.fastutil.Size64 big} one).
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code c}.
+	 */
+	public static FloatBloomFilter parallelOf(final FloatCollection c, final double fpp) {
+	 final FloatBloomFilter f = new FloatBloomFilter(Size64.sizeOf(c), fpp);
+	 final AtomicLongArray bits = new AtomicLongArray(f.bits.length);
+	 ForkJoinPool pool = ForkJoinTask.getPool();
+	 if (pool == null) pool = ForkJoinPool.commonPool();
+	 pool.invoke(new ForkJoinSpliteratorAdd(f, bits, c.spliterator()));
+	 for (int i = f.bits.length; i-- != 0;) f.bits[i] = bits.get(i);
+	 return f;
+	}
+	/** Builds a filter in parallel from a list of arrays (possibly the segments of a big array).
+	 *
+	 * @param a a list of arrays.
+	 * @param n the overall number of keys in {@code a}.
+	 * @param fpp the desired false-positive rate.
+	 * @return a filter containing the keys in {@code a}.
+	 */
+	private static FloatBloomFilter parallelOf(final float[][] a, final long n, final double fpp) {
+	 final FloatBloomFilter f = new FloatBloomFilter(n, fpp);
+	 final AtomicLongArray bits = new AtomicLongArray(f.bits.length);
+	 ForkJoinPool pool = ForkJoinTask.getPool();
+	 if (pool == null) pool = ForkJoinPool.commonPool();
+	 for (final float[] s : a) pool.invoke(new ForkJoinAdd(f, bits, s, 0, s.length));
+	 for (int i = f.bits.length; i-- != 0;) f.bits[i] = bits.get(i);
+	 return f;
+	}
+	/** Adds a key to a filter whose bits are represented by an atomic array (which might be modified concurrently). */
+	private void add(final AtomicLongArray bits, final float k) {
+	 final long h = hash(k);
+	 final int block = block(h);
+	 final int h1 = (int)(h >>> 32), h2 = h1 >>> 9 | 1;
+	 for (int i = 0, p = h1; i < hashFunctions; i++, p += h2) {
+	  final int w = block + (p >>> 6 & 7);
+	  final long mask = 1L << p;
+	  for(;;) {
+	   final long b = bits.get(w);
+	   if ((b & mask) != 0 || bits.compareAndSet(w, b, b | mask)) break;
+	  }
+	 }
+	}
+	private static final class ForkJoinAdd extends RecursiveAction {
+	 private static final long serialVersionUID = 1L;
+	 private final FloatBloomFilter f;
+	 private final AtomicLongArray bits;
+	 private final float[] a;
+	 private final int from;
+	 private final int to;
+	 public ForkJoinAdd(final FloatBloomFilter f, final AtomicLongArray bits, final float[] a, final int from, final int to) {
+	  this.f = f;
+	  this.bits = bits;
+	  this.a = a;
+	  this.from = from;
+	  this.to = to;
+	 }
+	 @Override
+	 protected void compute() {
+	  if (to - from <= PARALLEL_NO_FORK) {
+	   for (int i = from; i < to; i++) f.add(bits, a[i]);
+	   return;
+	  }
+	  final int mid = (from + to) >>> 1;
+	  invokeAll(new ForkJoinAdd(f, bits, a, from, mid), new ForkJoinAdd(f, bits, a, mid, to));
+	 }
+	}
+	private static final class ForkJoinSpliteratorAdd extends RecursiveAction {
+	 private static final long serialVersionUID = 1L;
+	 private final FloatBloomFilter f;
+	 private final AtomicLongArray bits;
+	 private final FloatSpliterator spliterator;
+	 public ForkJoinSpliteratorAdd(final FloatBloomFilter f, final AtomicLongArray bits, final FloatSpliterator spliterator) {
+	  this.f = f;
+	  this.bits = bits;
+	  this.spliterator = spliterator;
+	 }
+	 @Override
+	 protected void compute() {
+	  if (spliterator.estimateSize() > PARALLEL_NO_FORK) {
+	   final FloatSpliterator prefix = spliterator.trySplit();
+	   if (prefix != null) {
+	    invokeAll(new ForkJoinSpliteratorAdd(f, bits, prefix), new ForkJoinSpliteratorAdd(f, bits, spliterator));
+	    return;
+	   }
+	  }
+	  spliterator.forEachRemaining((FloatConsumer )k -> f.add(bits, k));
+	 }
+	}
+}
@@ -0,0 +1,208 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.floats;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.SortedSet;
+/** A type-specific concurrent sorted set based on a lock-free skip list.
+	*
+	* <p>Instances of this class are backed by a type-specific concurrent skip-list map storing no values:
+	* please see the documentation of the map for details. Additions, removals and lookups can be performed safely
+	* and concurrently by multiple threads; additions and lookups are lock-free.
+	*
+	* <p>The iterators provided by this class are weakly consistent type-specific {@link
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}, and subsets are concurrent views.
+	*/
+public class FloatConcurrentSkipListSet extends AbstractFloatSortedSet implements java.io.Serializable, FloatSortedSet {
+	private static final long serialVersionUID = 0L;
+	/** The class of the value returned by the backing map for missing keys. */
+	private static final class NotPresent implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 private Object readResolve() {
+	  return NOT_PRESENT;
+	 }
+	}
+	/** The default return value of the backing map, which returns {@code null} for present keys. */
+	private static final Object NOT_PRESENT = new NotPresent();
+	/** The backing map. */
+	protected final Float2ObjectConcurrentSkipListMap <Object> map;
+	/** Creates a new empty set with the given comparator.
+	 *
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatConcurrentSkipListSet(final Comparator<? super Float> c) {
+	 map = new Float2ObjectConcurrentSkipListMap <Object>(c);
+	 map.defaultReturnValue(NOT_PRESENT);
+	}
+	/** Creates a new empty set.
+	 */
+	public FloatConcurrentSkipListSet() {
+	 this((Comparator<? super Float>)null);
+	}
+	/** Creates a new set copying a given collection.
+	 *
+	 * @param c a collection to be copied into the new set.
+	 */
+	public FloatConcurrentSkipListSet(final Collection<? extends Float> c) {
+	 this();
+	 addAll(c);
+	}
+	/** Creates a new set copying a given sorted set (and its {@link Comparator}).
+	 *
+	 * @param s a {@link SortedSet} to be copied into the new set.
+	 */
+	public FloatConcurrentSkipListSet(final SortedSet<Float> s) {
+	 this(s.comparator());
+	 addAll(s);
+	}
+	/** Creates a new set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection to be copied into the new set.
+	 */
+	public FloatConcurrentSkipListSet(final FloatCollection c) {
+	 this();
+	 addAll(c);
+	}
+	/** Creates a new set copying a given type-specific sorted set (and its {@link Comparator}).
+	 *
+	 * @param s a type-specific sorted set to be copied into the new set.
+	 */
+	public FloatConcurrentSkipListSet(final FloatSortedSet s) {
+	 this(s.comparator());
+	 addAll(s);
+	}
+	/** Creates a new set and fills it with the elements of a given array using a given {@link Comparator}.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatConcurrentSkipListSet(final float[] a, final int offset, final int length, final Comparator<? super Float> c) {
+	 this(c);
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 for(int i = 0; i < length; i++) add(a[offset + i]);
+	}
+	/** Creates a new set and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public FloatConcurrentSkipListSet(final float[] a, final int offset, final int length) {
+	 this(a, offset, length, null);
+	}
+	/** Creates a new set copying the elements of an array.
+	 *
+	 * @param a an array to be copied into the new set.
+	 */
+	public FloatConcurrentSkipListSet(final float[] a) {
+	 this(a, 0, a.length, null);
+	}
+	/** Creates a new set copying the elements of an array using a given {@link Comparator}.
+	 *
+	 * @param a an array to be copied into the new set.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatConcurrentSkipListSet(final float[] a, final Comparator<? super Float> c) {
+	 this(a, 0, a.length, c);
+	}
+	@Override
+	public boolean add(final float k) {
+	 return map.putIfAbsent(k, null) == NOT_PRESENT;
+	}
+	@Override
+	public boolean remove(final float k) {
+	 return map.remove(k) != NOT_PRESENT;
+	}
+	@Override
+	public boolean contains(final float k) {
+	 return map.containsKey(k);
+	}
+	@Override
+	public void clear() {
+	 map.clear();
+	}
+	@Override
+	public int size() {
+	 return map.size();
+	}
+	@Override
+	public boolean isEmpty() {
+	 return map.isEmpty();
+	}
+	@Override
+	public float firstFloat() {
+	 return map.firstFloatKey();
+	}
+	@Override
+	public float lastFloat() {
+	 return map.lastFloatKey();
+	}
+	@Override
+	public FloatBidirectionalIterator iterator() { return map.keySet().iterator(); }
+	@Override
+	public FloatBidirectionalIterator iterator(final float from) { return map.keySet().iterator(from); }
+	@Override
+	public FloatSpliterator spliterator() { return map.keySet().spliterator(); }
+	@Override
+	public FloatComparator comparator() { return map.comparator(); }
+	@Override
+	public FloatSortedSet headSet(final float to) { return new Subset(map.headMap(to)); }
+	@Override
+	public FloatSortedSet tailSet(final float from) { return new Subset(map.tailMap(from)); }
+	@Override
+	public FloatSortedSet subSet(final float from, final float to) { return new Subset(map.subMap(from, to)); }
+	/** A subset with given range, backed by a submap of {@link #map}. */
+	private final class Subset extends AbstractFloatSortedSet implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 /** The submap backing this subset. */
+	 final Float2ObjectSortedMap <Object> submap;
+	 Subset(final Float2ObjectSortedMap <Object> submap) {
+	  this.submap = submap;
+	 }
+	 @Override
+	 public boolean add(final float k) { return submap.putIfAbsent(k, null) == NOT_PRESENT; }
+	 @Override
+	 public boolean remove(final float k) { return submap.remove(k) != NOT_PRESENT; }
+	 @Override
+	 public boolean contains(final float k) { return submap.containsKey(k); }
+	 @Override
+	 public void clear() { submap.clear(); }
+	 @Override
+	 public int size() { return submap.size(); }
+	 @Override
+	 public boolean isEmpty() { return submap.isEmpty(); }
+	 @Override
+	 public float firstFloat() { return submap.firstFloatKey(); }
+	 @Override
+	 public float lastFloat() { return submap.lastFloatKey(); }
+	 @Override
+	 public FloatBidirectionalIterator iterator() { return submap.keySet().iterator(); }
+	 @Override
+	 public FloatBidirectionalIterator iterator(final float from) { return submap.keySet().iterator(from); }
+	 @Override
+	 public FloatSpliterator spliterator() { return submap.keySet().spliterator(); }
+	 @Override
+	 public FloatComparator comparator() { return submap.comparator(); }
+	 @Override
+	 public FloatSortedSet headSet(final float to) { return new Subset(submap.headMap(to)); }
+	 @Override
+	 public FloatSortedSet tailSet(final float from) { return new Subset(submap.tailMap(from)); }
+	 @Override
+	 public FloatSortedSet subSet(final float from, final float to) { return new Subset(submap.subMap(from, to)); }
+	}
+}
@@ -0,0 +1,417 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.floats;
+import java.util.Arrays;
+import java.util.Collection;
+import java.util.RandomAccess;
+import java.util.function.Consumer;
+/** A type-specific thread-safe array-based list in which all mutative operations make a fresh copy of the backing array.
+	*
+	* <p>This class is the type-specific analogue of {@link java.util.concurrent.CopyOnWriteArrayList}, and it is
+	* meant for lists that are read much more often than they are modified, and that are shared by several threads.
+	* The backing array is never modified after it has been published, and it is read through a volatile field:
+	* thus, reads never block, and they are as fast as reads from a plain array. Writers are serialized
+	* by an internal lock, and every mutative operation copies the backing array once.
+	*
+	* <p>To amortize the cost of copying over several modifications, use {@link #update(Consumer)}, which
+	* applies an arbitrary sequence of modifications to a private array-based list and then publishes
+	* the result atomically. Bulk operations such as {@code addAll()}, {@code removeIf()} or
+	* {@code sort()} perform a single copy.
+	*
+	* <p>Iterators and spliterators traverse the snapshot of the list at the time they were created:
+	* they never throw {@link java.util.ConcurrentModificationException}, and they do not support
+	* modifications. The method {@link #snapshot()} returns the current content of the list as an immutable list, without copying.
+	* Note that views returned by {@link #subList(int, int) subList()} are not snapshots.
+	*/
+public class FloatCopyOnWriteArrayList extends AbstractFloatList implements RandomAccess, Cloneable, java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The lock serializing mutative operations. */
+	private transient Object lock = new Object();
+	/** The backing array; all elements are part of this list, and it is never modified after publication. */
+	private transient volatile float[] a;
+	/** Creates a new empty copy-on-write list. */
+	public FloatCopyOnWriteArrayList() {
+	 a = FloatArrays.EMPTY_ARRAY;
+	}
+	/** Creates a new copy-on-write list and fills it with a given type-specific collection.
+	 *
+	 * @param c a type-specific collection that will be used to fill the list.
+	 */
+	public FloatCopyOnWriteArrayList(final FloatCollection c) {
+	 a = c.toFloatArray();
+	}
+	/** Creates a new copy-on-write list and fills it with a given collection.
+	 *
+	 * @param c a collection that will be used to fill the list.
+	 */
+	public FloatCopyOnWriteArrayList(final Collection<? extends Float> c) {
+	 a = unwrap(c);
+	}
+	/** Creates a new copy-on-write list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public FloatCopyOnWriteArrayList(final float a[], final int offset, final int length) {
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 this.a = Arrays.copyOfRange(a, offset, offset + length);
+	}
+	/** Creates a new copy-on-write list and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the list.
+	 */
+	public FloatCopyOnWriteArrayList(final float a[]) {
+	 this(a, 0, a.length);
+	}
+	/** Returns the elements of a collection as an array.
+	 *
+	 * @param c a collection.
+	 * @return an array containing the elements of {@code c}.
+	 */
+	private static float[] unwrap(final Collection<? extends Float> c) {
+	 if (c instanceof FloatCollection) return ((FloatCollection)c).toFloatArray();
+	 return FloatIterators.unwrap(FloatIterators.asFloatIterator(c.iterator()));
+	}
+	/** Returns an immutable snapshot of the current content of this list.
+	 *
+	 * <p>This method requires constant time, as the backing array is shared with the snapshot.
+	 *
+	 * @return an immutable list containing the current elements of this list.
+	 */
+	public FloatImmutableList snapshot() {
+	 return new FloatImmutableList(a);
+	}
+	/** Applies a sequence of modifications atomically, copying the backing array just once.
+	 *
+	 * <p>The updater receives a private array-based list containing the current elements
+	 * of this list; when the updater returns, the content of the array-based list becomes
+	 * the content of this list. Other mutative operations on this list wait until the
+	 * updater returns, whereas readers keep seeing the previous content. The updater must
+	 * not modify this list, and it must not keep a reference to its argument.
+	 *
+	 * @param updater a consumer modifying the array-based list it receives.
+	 */
+	public void update(final Consumer<? super FloatArrayList> updater) {
+	 synchronized (lock) {
+	  final FloatArrayList l = FloatArrayList.wrap(a.clone());
+	  updater.accept(l);
+	  final float[] t = l.elements();
+	  a = t.length == l.size() ? t : Arrays.copyOf(t, l.size());
+	 }
+	}
+	@Override
+	public float getFloat(final int index) {
+	 final float[] a = this.a;
+	 if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	 return a[index];
+	}
+	@Override
+	public int size() {
+	 return a.length;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return a.length == 0;
+	}
+	@Override
+	public int indexOf(final float k) {
+	 final float[] a = this.a;
+	 for(int i = 0; i < a.length; i++) if (( Float.floatToIntBits(k) == Float.floatToIntBits(a[i]) )) return i;
+	 return -1;
+	}
+	@Override
+	public int lastIndexOf(final float k) {
+	 final float[] a = this.a;
+	 for(int i = a.length; i-- != 0;) if (( Float.floatToIntBits(k) == Float.floatToIntBits(a[i]) )) return i;
+	 return -1;
+	}
+	@Override
+	public boolean contains(final float k) {
+	 return indexOf(k) >= 0;
+	}
+	@Override
+	public void getElements(final int from, final float[] a, final int offset, final int length) {
+	 final float[] t = this.a;
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 if (from < 0 || from + length > t.length) throw new IndexOutOfBoundsException("Range [" + from + ".." + (from + length) + ") is out of bounds for list size " + t.length);
+	 System.arraycopy(t, from, a, offset, length);
+	}
+	@Override
+	public void forEach(final FloatConsumer action) {
+	 for (final float k : a) action.accept(k);
+	}
+	@Override
+	public float[] toFloatArray() {
+	 final float[] a = this.a;
+	 return a.length == 0 ? FloatArrays.EMPTY_ARRAY : a.clone();
+	}
+	@Override
+	public float[] toArray(float a[]) {
+	 final float[] t = this.a;
+	 if (a == null || a.length < t.length) a = new float[t.length];
+	 System.arraycopy(t, 0, a, 0, t.length);
+	 return a;
+	}
+	/** Inserts elements in the backing array; the caller must hold {@link #lock}.
+	 *
+	 * @param index the index at which the elements will be inserted.
+	 * @param t an array containing the elements to insert.
+	 * @param offset the offset of the first element to insert.
+	 * @param length the number of elements to insert.
+	 */
+	private void insert(final int index, final float[] t, final int offset, final int length) {
+	 final float[] a = this.a;
+	 if (index < 0) throw new IndexOutOfBoundsException("Index (" + index + ") is negative");
+	 if (index > a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than list size (" + a.length + ")");
+	 final float[] b = new float[a.length + length];
+	 System.arraycopy(a, 0, b, 0, index);
+	 System.arraycopy(t, offset, b, index, length);
+	 System.arraycopy(a, index, b, index + length, a.length - index);
+	 this.a = b;
+	}
+	@Override
+	public boolean add(final float k) {
+	 synchronized (lock) {
+	  final float[] a = this.a;
+	  final float[] b = Arrays.copyOf(a, a.length + 1);
+	  b[a.length] = k;
+	  this.a = b;
+	 }
+	 return true;
+	}
+	@Override
+	public void add(final int index, final float k) {
+	 synchronized (lock) {
+	  insert(index, new float[] { k }, 0, 1);
+	 }
+	}
+	@Override
+	public boolean addAll(final int index, final FloatCollection c) {
+	 final float[] t = c.toFloatArray();
+	 synchronized (lock) {
+	  insert(index, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final FloatCollection c) {
+	 final float[] t = c.toFloatArray();
+	 synchronized (lock) {
+	  insert(a.length, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final int index, final FloatList l) {
+	 return addAll(index, (FloatCollection)l);
+	}
+	@Override
+	public boolean addAll(final FloatList l) {
+	 return addAll((FloatCollection)l);
+	}
+	@Override
+	public boolean addAll(final int index, final Collection<? extends Float> c) {
+	 final float[] t = unwrap(c);
+	 synchronized (lock) {
+	  insert(index, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public boolean addAll(final Collection<? extends Float> c) {
+	 final float[] t = unwrap(c);
+	 synchronized (lock) {
+	  insert(a.length, t, 0, t.length);
+	 }
+	 return t.length != 0;
+	}
+	@Override
+	public void addElements(final int index, final float a[], final int offset, final int length) {
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 synchronized (lock) {
+	  insert(index, a, offset, length);
+	 }
+	}
+	@Override
+	public float set(final int index, final float k) {
+	 synchronized (lock) {
+	  final float[] a = this.a;
+	  if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	  final float old = a[index];
+	  final float[] b = a.clone();
+	  b[index] = k;
+	  this.a = b;
+	  return old;
+	 }
+	}
+	@Override
+	public void setElements(final int index, final float a[], final int offset, final int length) {
+	 FloatArrays.ensureOffsetLength(a, offset, length);
+	 synchronized (lock) {
+	  final float[] t = this.a;
+	  if (index < 0 || index + length > t.length) throw new IndexOutOfBoundsException("Range [" + index + ".." + (index + length) + ") is out of bounds for list size " + t.length);
+	  final float[] b = t.clone();
+	  System.arraycopy(a, offset, b, index, length);
+	  this.a = b;
+	 }
+	}
+	@Override
+	public float removeFloat(final int index) {
+	 synchronized (lock) {
+	  final float[] a = this.a;
+	  if (index >= a.length) throw new IndexOutOfBoundsException("Index (" + index + ") is greater than or equal to list size (" + a.length + ")");
+	  final float old = a[index];
+	  removeRange(index, index + 1);
+	  return old;
+	 }
+	}
+	@Override
+	public boolean rem(final float k) {
+	 synchronized (lock) {
+	  final int index = indexOf(k);
+	  if (index == -1) return false;
+	  removeRange(index, index + 1);
+	  return true;
+	 }
+	}
+	/** Removes a range of elements from the backing array; the caller must hold {@link #lock}.
+	 *
+	 * @param from the start index (inclusive).
+	 * @param to the end index (exclusive).
+	 */
+	private void removeRange(final int from, final int to) {
+	 final float[] a = this.a;
+	 it.unimi.dsi.fastutil.Arrays.ensureFromTo(a.length, from, to);
+	 final float[] b = new float[a.length - (to - from)];
+	 System.arraycopy(a, 0, b, 0, from);
+	 System.arraycopy(a, to, b, from, a.length - to);
+	 this.a = b;
+	}
+	@Override
+	public void removeElements(final int from, final int to) {
+	 synchronized (lock) {
+	  removeRange(from, to);
+	 }
+	}
+	@Override
+	public boolean removeIf(final FloatPredicate filter) {
+	 java.util.Objects.requireNonNull(filter);
+	 synchronized (lock) {
+	  final float[] a = this.a;
+	  final float[] b = new float[a.length];
+	  int j = 0;
+	  for (final float k : a) if (! filter.test(k)) b[j++] = k;
+	  if (j == a.length) return false;
+	  this.a = Arrays.copyOf(b, j);
+	  return true;
+	 }
+	}
+	@Override
+	public boolean removeAll(final FloatCollection c) {
+	 return removeIf((FloatPredicate ) k -> c.contains(it.unimi.dsi.fastutil.SafeMath.safeDoubleToFloat(k)));
+	}
+	@Override
+	public boolean removeAll(final Collection<?> c) {
+	 return removeIf((FloatPredicate ) k -> c.contains(Float.valueOf(it.unimi.dsi.fastutil.SafeMath.safeDoubleToFloat(k))));
+	}
+	@Override
+	public boolean retainAll(final FloatCollection c) {
+	 return removeIf((FloatPredicate ) k -> ! c.contains(it.unimi.dsi.fastutil.SafeMath.safeDoubleToFloat(k)));
+	}
+	@Override
+	public boolean retainAll(final Collection<?> c) {
+	 return removeIf((FloatPredicate ) k -> ! c.contains(Float.valueOf(it.unimi.dsi.fastutil.SafeMath.safeDoubleToFloat(k))));
+	}
+	@Override
+	public void replaceAll(final FloatUnaryOperator operator) {
+	 synchronized (lock) {
+	  final float[] b = a.clone();
+	  for (int i = 0; i < b.length; i++) b[i] = operator.apply(b[i]);
+	  a = b;
+	 }
+	}
+	@Override
+	public void sort(final FloatComparator comp) {
+	 synchronized (lock) {
+	  final float[] b = a.clone();
+	  if (comp == null) FloatArrays.stableSort(b);
+	  else FloatArrays.stableSort(b, comp);
+	  a = b;
+	 }
+	}
+	@Override
+	public void unstableSort(final FloatComparator comp) {
+	 synchronized (lock) {
+	  final float[] b = a.clone();
+	  if (comp == null) FloatArrays.unstableSort(b);
+	  else FloatArrays.unstableSort(b, comp);
+	  a = b;
+	 }
+	}
+	@Override
+	public void size(final int size) {
+	 if (size < 0) throw new IllegalArgumentException("Negative size: " + size);
+	 synchronized (lock) {
+	  a = Arrays.copyOf(a, size);
+	 }
+	}
+	@Override
+	public void clear() {
+	 synchronized (lock) {
+	  a = FloatArrays.EMPTY_ARRAY;
+	 }
+	}
+	/** Returns a list iterator over a snapshot of this list.
+	 *
+	 * <p>The iterator does not support modifications.
+	 */
+	@Override
+	public FloatListIterator listIterator(final int index) {
+	 return snapshot().listIterator(index);
+	}
+	/** Returns a spliterator over a snapshot of this list. */
+	@Override
+	public FloatSpliterator spliterator() {
+	 return snapshot().spliterator();
+	}
+	@Override
+	public FloatCopyOnWriteArrayList clone() {
+	 final FloatCopyOnWriteArrayList c;
+	 try {
+	  c = (FloatCopyOnWriteArrayList)super.clone();
+	 }
+	 catch(final CloneNotSupportedException cantHappen) {
+	  throw new InternalError();
+	 }
+	 // The backing array is immutable, so it can be shared
+	 c.lock = new Object();
+	 return c;
+	}
+	private void writeObject(final java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 final float[] a = this.a;
+	 s.writeInt(a.length);
+	 for(int i = 0; i < a.length; i++) s.writeFloat(a[i]);
+	}
+	private void readObject(final java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 final float[] a = new float[s.readInt()];
+	 for(int i = 0; i < a.length; i++) a[i] = s.readFloat();
+	 lock = new Object();
+	 this.a = a;
+	}
+}
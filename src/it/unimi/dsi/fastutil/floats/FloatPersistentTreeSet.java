@@ -0,0 +1,290 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.floats;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.SortedSet;
+/** A type-specific persistent sorted set.
+	*
+	* <p>Instances of this class are immutable: methods such as {@link #with with()} and {@link #without without()}
+	* return a new version of the set, leaving this set untouched. Versions share all the structure
+	* they have in common, and an update has logarithmic cost in time and space.
+	* Subsets are new persistent sets (rather than views) computed in logarithmic time, and bulk
+	* modifications can be performed using a {@linkplain Transient transient version}, returned by {@link #asTransient()}.
+	*
+	* <p>Instances of this class are backed by a type-specific persistent map storing no values: please
+	* see the documentation of the map for details.
+	*
+	* <p>The iterators provided by this class are type-specific {@link
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators} that do not support removal.
+	* Mutators inherited from the set interfaces throw an {@link UnsupportedOperationException}.
+	*/
+public class FloatPersistentTreeSet extends AbstractFloatSortedSet implements java.io.Serializable, FloatSortedSet {
+	private static final long serialVersionUID = 0L;
+	/** The class of the value returned by the backing map for missing keys. */
+	private static final class NotPresent implements java.io.Serializable {
+	 private static final long serialVersionUID = 0L;
+	 private Object readResolve() {
+	  return NOT_PRESENT;
+	 }
+	}
+	/** The default return value of the backing map, which returns {@code null} for present keys. */
+	private static final Object NOT_PRESENT = new NotPresent();
+	/** The backing map. */
+	protected final Float2ObjectPersistentTreeMap <Object> map;
+	/** Creates a new persistent set backed by a given map.
+	 *
+	 * @param map a persistent map whose default return value is {@link #NOT_PRESENT}.
+	 */
+	private FloatPersistentTreeSet(final Float2ObjectPersistentTreeMap <Object> map) {
+	 this.map = map;
+	}
+	/** Creates a new empty persistent set with the given comparator.
+	 *
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatPersistentTreeSet(final Comparator<? super Float> c) {
+	 this(new Float2ObjectPersistentTreeMap <Object>(c));
+	 map.defaultReturnValue(NOT_PRESENT);
+	}
+	/** Creates a new empty persistent set.
+	 */
+	public FloatPersistentTreeSet() {
+	 this((Comparator<? super Float>)null);
+	}
+	/** Creates a new persistent set copying a given collection.
+	 *
+	 * @param c a collection to be copied into the new persistent set.
+	 */
+	public FloatPersistentTreeSet(final Collection<? extends Float> c) {
+	 this(withAll(new FloatPersistentTreeSet (), FloatIterators.asFloatIterator(c.iterator())));
+	}
+	/** Creates a new persistent set copying a given sorted set (and its {@link Comparator}).
+	 *
+	 * <p>This constructor takes time linear in the size of {@code s}.
+	 *
+	 * @param s a {@link SortedSet} to be copied into the new persistent set.
+	 */
+	public FloatPersistentTreeSet(final SortedSet<Float> s) {
+	 this(new Float2ObjectPersistentTreeMap <Object>(s.comparator(), FloatIterators.asFloatIterator(s.iterator()), s.size()));
+	 map.defaultReturnValue(NOT_PRESENT);
+	}
+	/** Creates a new persistent set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection to be copied into the new persistent set.
+	 */
+	public FloatPersistentTreeSet(final FloatCollection c) {
+	 this(withAll(new FloatPersistentTreeSet (), c.iterator()));
+	}
+	/** Creates a new persistent set copying a given type-specific sorted set (and its {@link Comparator}).
+	 *
+	 * <p>This constructor takes time linear in the size of {@code s}.
+	 *
+	 * @param s a type-specific sorted set to be copied into the new persistent set.
+	 */
+	public FloatPersistentTreeSet(final FloatSortedSet s) {
+	 this(new Float2ObjectPersistentTreeMap <Object>(s.comparator(), s.iterator(), s.size()));
+	 map.defaultReturnValue(NOT_PRESENT);
+	}
+	/** Creates a new persistent set and fills it with the elements of a given array using a given {@link Comparator}.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatPersistentTreeSet(final float[] a, final int offset, final int length, final Comparator<? super Float> c) {
+	 this(withAll(new FloatPersistentTreeSet (c), FloatIterators.wrap(a, offset, length)));
+	}
+	/** Creates a new persistent set and fills it with the elements of a given array.
+	 *
+	 * @param a an array whose elements will be used to fill the set.
+	 * @param offset the first element to use.
+	 * @param length the number of elements to use.
+	 */
+	public FloatPersistentTreeSet(final float[] a, final int offset, final int length) {
+	 this(a, offset, length, null);
+	}
+	/** Creates a new persistent set copying the elements of an array.
+	 *
+	 * @param a an array to be copied into the new persistent set.
+	 */
+	public FloatPersistentTreeSet(final float[] a) {
+	 this(a, 0, a.length, null);
+	}
+	/** Creates a new persistent set copying the elements of an array using a given {@link Comparator}.
+	 *
+	 * @param a an array to be copied into the new persistent set.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator).
+	 */
+	public FloatPersistentTreeSet(final float[] a, final Comparator<? super Float> c) {
+	 this(a, 0, a.length, c);
+	}
+	/** Returns the map backing the set obtained by adding the elements returned by an iterator to a given set. */
+	private static Float2ObjectPersistentTreeMap <Object> withAll(final FloatPersistentTreeSet s, final FloatIterator i) {
+	 final Transient t = s.asTransient();
+	 while (i.hasNext()) t.add(i.nextFloat());
+	 return t.persistent().map;
+	}
+	/** Returns a new version of this set backed by a given map.
+	 *
+	 * @param m a version of the backing map.
+	 * @return this set, if {@code m} is its backing map; otherwise, a new set backed by {@code m}.
+	 */
+	private FloatPersistentTreeSet derive(final Float2ObjectPersistentTreeMap <Object> m) {
+	 return m == map ? this : new FloatPersistentTreeSet (m);
+	}
+	/** Returns a new version of this set containing a given element.
+	 *
+	 * @param k an element.
+	 * @return this set, if it contains {@code k}; otherwise, a set sharing structure with this set,
+	 * with the same elements and {@code k}.
+	 */
+	public FloatPersistentTreeSet with(final float k) {
+	 return contains(k) ? this : derive(map.with(k, null));
+	}
+	/** Returns a new version of this set not containing a given element.
+	 *
+	 * @param k an element.
+	 * @return this set, if it does not contain {@code k}; otherwise, a set sharing structure with this set,
+	 * with the same elements but {@code k}.
+	 */
+	public FloatPersistentTreeSet without(final float k) {
+	 return derive(map.without(k));
+	}
+	/** Returns a transient version of this set.
+	 *
+	 * <p>The returned object can be used to perform efficiently many modifications,
+	 * starting from the elements of this set, which is not affected by them.
+	 *
+	 * @return a transient version of this set.
+	 */
+	public Transient asTransient() {
+	 return new Transient (map.asTransient());
+	}
+	/** A transient version of a persistent set.
+	 *
+	 * <p>Instances of this class are backed by a transient version of the backing map: please see its documentation for details.
+	 *
+	 * <p>Instances of this class are not thread safe.
+	 */
+	public static final class Transient {
+	 /** The backing transient map. */
+	 private final Float2ObjectPersistentTreeMap.Transient <Object> map;
+	 private Transient(final Float2ObjectPersistentTreeMap.Transient <Object> map) {
+	  this.map = map;
+	 }
+	 /** Adds an element to this transient set.
+		 *
+		 * @param k an element.
+		 * @return true if this transient set did not contain {@code k}.
+		 */
+	 public boolean add(final float k) {
+	  return map.put(k, null) == NOT_PRESENT;
+	 }
+	 /** Removes an element from this transient set.
+		 *
+		 * @param k an element.
+		 * @return true if this transient set contained {@code k}.
+		 */
+	 public boolean remove(final float k) {
+	  return map.remove(k) != NOT_PRESENT;
+	 }
+	 /** Returns true if this transient set contains a given element.
+		 *
+		 * @param k an element.
+		 * @return true if this transient set contains {@code k}.
+		 */
+	 public boolean contains(final float k) {
+	  return map.containsKey(k);
+	 }
+	 /** Returns the number of elements in this transient set.
+		 *
+		 * @return the number of elements in this transient set.
+		 */
+	 public int size() {
+	  return map.size();
+	 }
+	 /** Returns a persistent set with the elements of this transient set, and ends the life of this transient set.
+		 *
+		 * @return a persistent set with the elements of this transient set.
+		 * @throws IllegalStateException if this method has already been called.
+		 */
+	 public FloatPersistentTreeSet persistent() {
+	  return new FloatPersistentTreeSet (map.persistent());
+	 }
+	}
+	@Override
+	public boolean contains(final float k) {
+	 return map.containsKey(k);
+	}
+	@Override
+	public int size() {
+	 return map.size();
+	}
+	@Override
+	public boolean isEmpty() {
+	 return map.isEmpty();
+	}
+	@Override
+	public float firstFloat() {
+	 return map.firstFloatKey();
+	}
+	@Override
+	public float lastFloat() {
+	 return map.lastFloatKey();
+	}
+	@Override
+	public FloatBidirectionalIterator iterator() { return map.keySet().iterator(); }
+	@Override
+	public FloatBidirectionalIterator iterator(final float from) { return map.keySet().iterator(from); }
+	@Override
+	public FloatSpliterator spliterator() { return map.keySet().spliterator(); }
+	@Override
+	public FloatComparator comparator() { return map.comparator(); }
+	/** Returns a persistent set containing the elements of this set smaller than a given element.
+	 *
+	 * <p>The returned set is not a view, but rather a persistent set sharing structure with this set.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param to the upper bound (exclusive) of the elements of the returned set.
+	 * @return a persistent set containing the elements of this set smaller than {@code to}.
+	 */
+	@Override
+	public FloatPersistentTreeSet headSet(final float to) { return derive(map.headMap(to)); }
+	/** Returns a persistent set containing the elements of this set greater than or equal to a given element.
+	 *
+	 * <p>The returned set is not a view, but rather a persistent set sharing structure with this set.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param from the lower bound (inclusive) of the elements of the returned set.
+	 * @return a persistent set containing the elements of this set greater than or equal to {@code from}.
+	 */
+	@Override
+	public FloatPersistentTreeSet tailSet(final float from) { return derive(map.tailMap(from)); }
+	/** Returns a persistent set containing the elements of this set in a given range.
+	 *
+	 * <p>The returned set is not a view, but rather a persistent set sharing structure with this set.
+	 * It is computed in logarithmic time.
+	 *
+	 * @param from the lower bound (inclusive) of the elements of the returned set.
+	 * @param to the upper bound (exclusive) of the elements of the returned set.
+	 * @return a persistent set containing the elements of this set greater than or equal to {@code from} and smaller than {@code to}.
+	 * @throws IllegalArgumentException if {@code from} is greater than {@code to}.
+	 */
+	@Override
+	public FloatPersistentTreeSet subSet(final float from, final float to) { return derive(map.subMap(from, to)); }
+}
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2BooleanLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2BooleanAVLTreeMap
 #define RB_TREE_MAP Int2BooleanRBTreeMap
+#define CACHE Int2BooleanCache
+#define STATIC_FUNCTION Int2BooleanStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET IntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2ByteOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedIntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Int2ByteOpenDoubleHashMap
 #define ARRAY_SET IntArraySet
 #define ARRAY_MAP Int2ByteArrayMap
 #define LINKED_OPEN_HASH_SET IntLinkedOpenHashSet
 #define AVL_TREE_SET IntAVLTreeSet
 #define RB_TREE_SET IntRBTreeSet
+#define BTREE_SET IntBTreeSet
+#define PERSISTENT_TREE_SET IntPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET IntConcurrentSkipListSet
+#define SORTED_ARRAY_SET IntSortedArraySet
 #define AVL_TREE_MAP Int2ByteAVLTreeMap
 #define RB_TREE_MAP Int2ByteRBTreeMap
+#define BTREE_MAP Int2ByteBTreeMap
+#define PERSISTENT_TREE_MAP Int2BytePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Int2ByteConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Int2ByteSortedArrayMap
+#define CACHE Int2ByteCache
+#define STATIC_FUNCTION Int2ByteStaticFunction
+#define BLOOM_FILTER IntBloomFilter
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
 #define MAPPED_BIG_LIST IntMappedBigList
 #define ARRAY_FRONT_CODED_LIST IntArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST IntArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST IntEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET IntEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE IntHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE IntHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE IntHeapIndirectPriorityQueue
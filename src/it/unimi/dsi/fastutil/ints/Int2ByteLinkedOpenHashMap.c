@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2ByteLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2ByteAVLTreeMap
 #define RB_TREE_MAP Int2ByteRBTreeMap
+#define CACHE Int2ByteCache
+#define STATIC_FUNCTION Int2ByteStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
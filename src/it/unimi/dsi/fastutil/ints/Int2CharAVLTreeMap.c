@@ -316,22 +316,44 @@
 #define OPEN_HASH_BIG_SET IntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2CharOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedIntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Int2CharOpenDoubleHashMap
 #define ARRAY_SET IntArraySet
 #define ARRAY_MAP Int2CharArrayMap
 #define LINKED_OPEN_HASH_SET IntLinkedOpenHashSet
 #define AVL_TREE_SET IntAVLTreeSet
 #define RB_TREE_SET IntRBTreeSet
+#define BTREE_SET IntBTreeSet
+#define PERSISTENT_TREE_SET IntPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET IntConcurrentSkipListSet
+#define SORTED_ARRAY_SET IntSortedArraySet
 #define AVL_TREE_MAP Int2CharAVLTreeMap
+#define ARENA_TREE_MAP Int2CharArenaTreeMap
 #define RB_TREE_MAP Int2CharRBTreeMap
+#define BTREE_MAP Int2CharBTreeMap
+#define PERSISTENT_TREE_MAP Int2CharPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Int2CharConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Int2CharSortedArrayMap
+#define CACHE Int2CharCache
+#define STATIC_FUNCTION Int2CharStaticFunction
+#define BLOOM_FILTER IntBloomFilter
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST IntCopyOnWriteArrayList
+#define CHUNKED_LIST IntChunkedList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
 #define MAPPED_BIG_LIST IntMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST IntAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST IntArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST IntArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST IntMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST IntEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET IntEliasFanoSortedSet
+#define PACKED_BIG_LIST IntPackedBigList
 #define HEAP_PRIORITY_QUEUE IntHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE IntHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE IntHeapIndirectPriorityQueue
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2CharLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2CharAVLTreeMap
 #define RB_TREE_MAP Int2CharRBTreeMap
+#define CACHE Int2CharCache
+#define STATIC_FUNCTION Int2CharStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET IntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2CharOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2CharAVLTreeMap
 #define RB_TREE_MAP Int2CharRBTreeMap
+#define CACHE Int2CharCache
+#define STATIC_FUNCTION Int2CharStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
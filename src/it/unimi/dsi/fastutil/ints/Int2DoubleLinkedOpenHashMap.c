@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2DoubleLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2DoubleAVLTreeMap
 #define RB_TREE_MAP Int2DoubleRBTreeMap
+#define CACHE Int2DoubleCache
+#define STATIC_FUNCTION Int2DoubleStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET IntOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Int2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Int2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2DoubleOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2DoubleAVLTreeMap
 #define RB_TREE_MAP Int2DoubleRBTreeMap
+#define CACHE Int2DoubleCache
+#define STATIC_FUNCTION Int2DoubleStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2FloatLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2FloatAVLTreeMap
 #define RB_TREE_MAP Int2FloatRBTreeMap
+#define CACHE Int2FloatCache
+#define STATIC_FUNCTION Int2FloatStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
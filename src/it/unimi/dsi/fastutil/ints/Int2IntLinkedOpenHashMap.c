@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2IntLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2IntAVLTreeMap
 #define RB_TREE_MAP Int2IntRBTreeMap
+#define CACHE Int2IntCache
+#define STATIC_FUNCTION Int2IntStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
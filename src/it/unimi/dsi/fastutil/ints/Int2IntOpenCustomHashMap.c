@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET IntOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Int2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Int2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2IntOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2IntAVLTreeMap
 #define RB_TREE_MAP Int2IntRBTreeMap
+#define CACHE Int2IntCache
+#define STATIC_FUNCTION Int2IntStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
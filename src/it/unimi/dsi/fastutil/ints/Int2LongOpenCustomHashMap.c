@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET IntOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Int2LongOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Int2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2LongOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2LongOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2LongOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2LongAVLTreeMap
 #define RB_TREE_MAP Int2LongRBTreeMap
+#define CACHE Int2LongCache
+#define STATIC_FUNCTION Int2LongStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
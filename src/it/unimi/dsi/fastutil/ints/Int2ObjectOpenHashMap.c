@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET IntOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2ObjectOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2ObjectAVLTreeMap
 #define RB_TREE_MAP Int2ObjectRBTreeMap
+#define CACHE Int2ObjectCache
+#define STATIC_FUNCTION Int2ObjectStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
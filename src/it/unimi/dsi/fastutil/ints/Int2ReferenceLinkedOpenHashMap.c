@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET IntLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Int2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Int2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2ReferenceLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2ReferenceAVLTreeMap
 #define RB_TREE_MAP Int2ReferenceRBTreeMap
+#define CACHE Int2ReferenceCache
+#define STATIC_FUNCTION Int2ReferenceStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
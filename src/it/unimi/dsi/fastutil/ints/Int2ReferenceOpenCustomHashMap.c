@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET IntOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET IntOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Int2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Int2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Int2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Int2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedInt2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Int2ReferenceOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET IntRBTreeSet
 #define AVL_TREE_MAP Int2ReferenceAVLTreeMap
 #define RB_TREE_MAP Int2ReferenceRBTreeMap
+#define CACHE Int2ReferenceCache
+#define STATIC_FUNCTION Int2ReferenceStaticFunction
 #define ARRAY_LIST IntArrayList
 #define IMMUTABLE_LIST IntImmutableList
 #define BIG_ARRAY_BIG_LIST IntBigArrayBigList
@@ -0,0 +1,472 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.ints;
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.longs.LongBigArrays;
+import java.io.Serializable;
+import java.util.NoSuchElementException;
+import java.util.RandomAccess;
+import java.util.Spliterator;
+/** An immutable, succinct big list of nondecreasing elements based on the Elias&ndash;Fano representation.
+	*
+	* <p>Instances of this class store a nondecreasing sequence of <var>n</var> elements between a
+	* lower bound and an upper bound at distance <var>u</var> using
+	* 2 + &lceil;log(<var>u</var> / <var>n</var>)&rceil; bits per element, plus a small overhead for
+	* selection: this is close to the information-theoretical lower bound, and typically four to eight
+	* times less than a sorted array of longs. The representation is immutable, and it is usually built
+	* once (e.g., for posting lists or timestamp indices) and then {@linkplain it.unimi.dsi.fastutil.io.BinIO#storeObject(Object, CharSequence) serialized}.
+	*
+	* <p>Random access by {@link #get(long)} and {@link #successorIndex successorIndex()}, which
+	* finds the first element greater than or equal to a given bound, require expected constant time
+	* for non-adversarial distributions (see below). Iterators,
+	* spliterators and {@link #getElements getElements()} decode elements sequentially,
+	* which is faster than repeated random accesses; moreover, skipping elements with an iterator
+	* requires a single selection.
+	*
+	* <H2>Implementation Details</H2>
+	*
+	* <p>Each element is stored as its difference <var>v</var> from the lower bound. The
+	* &#x2113; = max(0, &lfloor;log(<var>u</var> / <var>n</var>)&rfloor;) lower bits of <var>v</var> are
+	* stored explicitly in a bit array, whereas the <var>i</var>-th element sets bit
+	* (<var>v</var> &gg; &#x2113;) + <var>i</var> of the upper-bits array. In the upper-bits array, ones
+	* thus represent elements and zeros represent buckets of elements sharing the same upper bits.
+	* The position of a sample of ones and zeros is recorded, and selection scans the upper bits
+	* from the nearest sample. The scan takes constant time when the elements are reasonably spread, but
+	* there is no special handling for long runs of zeros or ones between samples (i.e., large gaps or many
+	* repeated elements), which make it proportionally longer; similarly,
+	* {@link #successorIndex successorIndex()} scans linearly the elements in a bucket. The samples are not serialized, and they are
+	* rebuilt on deserialization.
+	*/
+public class IntEliasFanoBigList extends AbstractIntBigList implements Serializable, RandomAccess {
+	private static final long serialVersionUID = 0L;
+	/** The base-2 logarithm of the distance between sampled ones. */
+	private static final int LOG2_ONES_STEP = 8;
+	/** The base-2 logarithm of the distance between sampled zeros. */
+	private static final int LOG2_ZEROS_STEP = 8;
+	/** The characteristics of spliterators over this list. */
+	private static final int SPLITERATOR_CHARACTERISTICS = IntSpliterators.LIST_SPLITERATOR_CHARACTERISTICS | Spliterator.IMMUTABLE | Spliterator.NONNULL;
+	/** The number of elements in the list. */
+	protected final long n;
+	/** The lower bound, which is subtracted from all elements. */
+	protected final long base;
+	/** The number of lower bits stored explicitly for each element. */
+	protected final int l;
+	/** The number of buckets, that is, the number of zeros in {@link #upperBits}. */
+	protected final long buckets;
+	/** The lower bits of the elements, {@link #l} bits for each element. */
+	protected final long[][] lowerBits;
+	/** The upper bits of the elements, in unary code. */
+	protected final long[][] upperBits;
+	/** The positions of the ones in {@link #upperBits} whose rank is a multiple of 2<sup>{@value #LOG2_ONES_STEP}</sup>. */
+	protected transient long[] ones;
+	/** The positions of the zeros in {@link #upperBits} whose rank is a multiple of 2<sup>{@value #LOG2_ZEROS_STEP}</sup>. */
+	protected transient long[] zeros;
+	/** Creates a new Elias&ndash;Fano big list containing the first elements returned by an iterator.
+	 *
+	 * @param n the number of elements to read from {@code i}.
+	 * @param lowerBound a lower bound for all elements.
+	 * @param upperBound an upper bound for all elements.
+	 * @param i an iterator returning a nondecreasing sequence of at least {@code n} elements.
+	 * @param strict whether the sequence must be strictly increasing.
+	 * @throws IllegalArgumentException if the iterator returns less than {@code n} elements,
+	 * an element is out of bounds, or the sequence is not nondecreasing (or not increasing, if {@code strict} is true).
+	 */
+	protected IntEliasFanoBigList(final long n, final int lowerBound, final int upperBound, final IntIterator i, final boolean strict) {
+	 if (n < 0) throw new IllegalArgumentException("Negative number of elements: " + n);
+	 final long span = (long)upperBound - lowerBound;
+	 if (n != 0 && span < 0) throw new IllegalArgumentException("The upper bound (" + upperBound + ") is smaller than the lower bound (" + lowerBound + ") or too distant from it");
+	 this.n = n;
+	 this.base = lowerBound;
+	 final long ratio = n == 0 ? 0 : span / n;
+	 this.l = ratio == 0 ? 0 : Long.SIZE - 1 - Long.numberOfLeadingZeros(ratio);
+	 this.buckets = n == 0 ? 0 : (span >>> l) + 1;
+	 this.lowerBits = LongBigArrays.newBigArray(n * l + Long.SIZE - 1 >>> 6);
+	 this.upperBits = LongBigArrays.newBigArray(n + buckets + Long.SIZE - 1 >>> 6);
+	 final long lowerMask = (1L << l) - 1;
+	 int prev = lowerBound;
+	 for (long j = 0; j < n; j++) {
+	  if (! i.hasNext()) throw new IllegalArgumentException("The iterator returned " + j + " elements, but " + n + " were expected");
+	  final int x = i.nextInt();
+	  if (x < lowerBound || x > upperBound) throw new IllegalArgumentException("Element " + x + " is out of bounds [" + lowerBound + ".." + upperBound + "]");
+	  if (j != 0 && (x < prev || strict && x == prev)) throw new IllegalArgumentException("The sequence is not " + (strict ? "increasing" : "nondecreasing") + ": " + x + " follows " + prev);
+	  final long v = x - base;
+	  if (l != 0) {
+	   final long b = j * l;
+	   final long w = b >>> 6;
+	   final int offset = (int)(b & 63);
+	   BigArrays.set(lowerBits, w, BigArrays.get(lowerBits, w) | (v & lowerMask) << offset);
+	   if (offset + l > Long.SIZE) BigArrays.set(lowerBits, w + 1, BigArrays.get(lowerBits, w + 1) | (v & lowerMask) >>> Long.SIZE - offset);
+	  }
+	  final long p = (v >>> l) + j;
+	  BigArrays.set(upperBits, p >>> 6, BigArrays.get(upperBits, p >>> 6) | 1L << p);
+	  prev = x;
+	 }
+	 buildSamples();
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the elements of a big list.
+	 *
+	 * @param l a nondecreasing big list.
+	 * @param strict whether the list must be strictly increasing.
+	 */
+	protected IntEliasFanoBigList(final IntBigList l, final boolean strict) {
+	 this(l.size64(), l.isEmpty() ? 0 : l.getInt(0), l.isEmpty() ? 0 : l.getInt(l.size64() - 1), l.iterator(), strict);
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the first elements returned by an iterator.
+	 *
+	 * <p>This is the most memory-efficient constructor, as the elements are never buffered.
+	 *
+	 * @param n the number of elements to read from {@code i}.
+	 * @param lowerBound a lower bound for all elements.
+	 * @param upperBound an upper bound for all elements.
+	 * @param i an iterator returning a nondecreasing sequence of at least {@code n} elements.
+	 */
+	public IntEliasFanoBigList(final long n, final int lowerBound, final int upperBound, final IntIterator i) {
+	 this(n, lowerBound, upperBound, i, false);
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the elements of a nondecreasing big list.
+	 *
+	 * @param l a nondecreasing big list.
+	 */
+	public IntEliasFanoBigList(final IntBigList l) {
+	 this(l, false);
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the elements returned by an iterator.
+	 *
+	 * <p>Since bounds and number of elements are unknown, elements are buffered before compression.
+	 *
+	 * @param i an iterator returning a nondecreasing sequence.
+	 */
+	public IntEliasFanoBigList(final IntIterator i) {
+	 this(new IntBigArrayBigList(i), false);
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the elements of a nondecreasing big array.
+	 *
+	 * @param a a nondecreasing big array.
+	 */
+	public IntEliasFanoBigList(final int[][] a) {
+	 this(IntBigArrayBigList.wrap(a), false);
+	}
+	/** Creates a new Elias&ndash;Fano big list containing the elements of a nondecreasing array.
+	 *
+	 * @param a a nondecreasing array.
+	 */
+	public IntEliasFanoBigList(final int[] a) {
+	 this(IntBigArrayBigList.wrap(IntBigArrays.wrap(a)), false);
+	}
+	/** Records the positions of the sampled ones and zeros of {@link #upperBits}. */
+	private void buildSamples() {
+	 final long[] ones = new long[(int)(n + (1 << LOG2_ONES_STEP) - 1 >>> LOG2_ONES_STEP)];
+	 final long[] zeros = new long[(int)(buckets + (1 << LOG2_ZEROS_STEP) - 1 >>> LOG2_ZEROS_STEP)];
+	 final long words = BigArrays.length(upperBits);
+	 long onesSoFar = 0, zerosSoFar = 0, nextOne = 0, nextZero = 0;
+	 int o = 0, z = 0;
+	 for (long w = 0; w < words; w++) {
+	  final long word = BigArrays.get(upperBits, w);
+	  final int c = Long.bitCount(word);
+	  while (nextOne < n && nextOne < onesSoFar + c) {
+	   ones[o++] = w << 6 | select(word, (int)(nextOne - onesSoFar));
+	   nextOne += 1 << LOG2_ONES_STEP;
+	  }
+	  // Zeros beyond the end of the bit array have rank at least buckets, so they are never sampled
+	  while (nextZero < buckets && nextZero < zerosSoFar + Long.SIZE - c) {
+	   zeros[z++] = w << 6 | select(~word, (int)(nextZero - zerosSoFar));
+	   nextZero += 1 << LOG2_ZEROS_STEP;
+	  }
+	  onesSoFar += c;
+	  zerosSoFar += Long.SIZE - c;
+	 }
+	 this.ones = ones;
+	 this.zeros = zeros;
+	}
+	/** Returns the position of the one of given rank in a word.
+	 *
+	 * @param word a word.
+	 * @param rank a rank smaller than the number of ones in {@code word}.
+	 * @return the position of the one of rank {@code rank} in {@code word}.
+	 */
+	private static int select(long word, int rank) {
+	 while (rank-- != 0) word &= word - 1;
+	 return Long.numberOfTrailingZeros(word);
+	}
+	/** Returns the position of the one of given rank in {@link #upperBits}.
+	 *
+	 * @param rank a rank smaller than {@link #n}.
+	 * @return the position of the one of rank {@code rank}.
+	 */
+	private long select1(final long rank) {
+	 final long start = ones[(int)(rank >>> LOG2_ONES_STEP)];
+	 long residual = rank & (1 << LOG2_ONES_STEP) - 1;
+	 long w = start >>> 6;
+	 long word = BigArrays.get(upperBits, w) & -1L << start;
+	 for (;;) {
+	  final int c = Long.bitCount(word);
+	  if (residual < c) return w << 6 | select(word, (int)residual);
+	  residual -= c;
+	  word = BigArrays.get(upperBits, ++w);
+	 }
+	}
+	/** Returns the position of the zero of given rank in {@link #upperBits}.
+	 *
+	 * @param rank a rank smaller than {@link #buckets}.
+	 * @return the position of the zero of rank {@code rank}.
+	 */
+	private long select0(final long rank) {
+	 final long start = zeros[(int)(rank >>> LOG2_ZEROS_STEP)];
+	 long residual = rank & (1 << LOG2_ZEROS_STEP) - 1;
+	 long w = start >>> 6;
+	 long word = ~BigArrays.get(upperBits, w) & -1L << start;
+	 for (;;) {
+	  final int c = Long.bitCount(word);
+	  if (residual < c) return w << 6 | select(word, (int)residual);
+	  residual -= c;
+	  word = ~BigArrays.get(upperBits, ++w);
+	 }
+	}
+	/** Returns the lower bits of an element.
+	 *
+	 * @param index the index of an element.
+	 * @return the lower bits of the element of given index.
+	 */
+	private long lower(final long index) {
+	 if (l == 0) return 0;
+	 final long b = index * l;
+	 final long w = b >>> 6;
+	 final int offset = (int)(b & 63);
+	 long result = BigArrays.get(lowerBits, w) >>> offset;
+	 if (offset + l > Long.SIZE) result |= BigArrays.get(lowerBits, w + 1) << Long.SIZE - offset;
+	 return result & (1L << l) - 1;
+	}
+	@Override
+	public int getInt(final long index) {
+	 ensureRestrictedIndex(index);
+	 return (int)(base + ((select1(index) - index) << l | lower(index)));
+	}
+	@Override
+	public long size64() {
+	 return n;
+	}
+	/** Returns the index of the first element greater than or equal to a given bound.
+	 *
+	 * <p>This method requires expected constant time for non-adversarial distributions, and can be used to compute successors:
+	 * if the returned index is smaller than the size of this list,
+	 * the element at that index is the smallest element greater than or equal to {@code x}.
+	 *
+	 * @param x a bound.
+	 * @return the index of the first element greater than or equal to {@code x}, or
+	 * the size of this list if no such element exists.
+	 */
+	public long successorIndex(final int x) {
+	 if (n == 0 || x <= base) return 0;
+	 final long d = x - base;
+	 if (d < 0) return n; // Overflow, so x is greater than all elements
+	 final long h = d >>> l;
+	 if (h >= buckets) return n;
+	 long p = h == 0 ? 0 : select0(h - 1) + 1;
+	 long i = p - h;
+	 final long low = d & (1L << l) - 1;
+	 // Scan the bucket of x: the first element that is not in the bucket is greater than x
+	 while (i < n && (BigArrays.get(upperBits, p >>> 6) & 1L << p) != 0) {
+	  if (lower(i) >= low) return i;
+	  i++;
+	  p++;
+	 }
+	 return i;
+	}
+	@Override
+	public long indexOf(final int k) {
+	 final long i = successorIndex(k);
+	 return i < n && getInt(i) == k ? i : -1;
+	}
+	@Override
+	public long lastIndexOf(final int k) {
+	 if (indexOf(k) == -1) return -1;
+	 return (k == Integer.MAX_VALUE ? n : successorIndex((int)(k + 1))) - 1;
+	}
+	@Override
+	public void getElements(final long from, final int[][] a, long offset, long length) {
+	 ensureIndex(from);
+	 BigArrays.ensureOffsetLength(a, offset, length);
+	 if (from + length > n) throw new IndexOutOfBoundsException("End index (" + (from + length) + ") is greater than list size (" + n + ")");
+	 final Decoder d = new Decoder(from);
+	 while (length-- != 0) BigArrays.set(a, offset++, d.decode());
+	}
+	/** Returns the number of bits used by this list.
+	 *
+	 * @return the number of bits used by this list, excluding object headers.
+	 */
+	public long numBits() {
+	 return (BigArrays.length(lowerBits) + BigArrays.length(upperBits) + ones.length + zeros.length) * Long.SIZE;
+	}
+	/** A sequential decoder keeping track of the current word of {@link #upperBits}. */
+	private class Decoder {
+	 /** The index of the next element to be decoded. */
+	 long index;
+	 /** The index of the current word of {@link #upperBits}, or -1 if it must be computed from {@link #index}. */
+	 long w = -1;
+	 /** The current word of {@link #upperBits}, with the bits of elements already decoded cleared. */
+	 long window;
+	 Decoder(final long index) {
+	  this.index = index;
+	 }
+	 /** Moves this decoder to a given index.
+		 *
+		 * @param index the index of the next element to be decoded.
+		 */
+	 void moveTo(final long index) {
+	  this.index = index;
+	  w = -1;
+	 }
+	 /** Decodes the next element.
+		 *
+		 * @return the element of index {@link #index}, which is then incremented.
+		 */
+	 int decode() {
+	  if (w == -1) {
+	   final long p = select1(index);
+	   w = p >>> 6;
+	   window = BigArrays.get(upperBits, w) & -1L << p;
+	  }
+	  while (window == 0) window = BigArrays.get(upperBits, ++w);
+	  final long high = (w << 6 | Long.numberOfTrailingZeros(window)) - index;
+	  window &= window - 1;
+	  return (int)(base + (high << l | lower(index++)));
+	 }
+	}
+	/** A list iterator that decodes elements sequentially.
+	 *
+	 * <p>Moving backwards or skipping elements resynchronizes the decoder at the next
+	 * forward step.
+	 */
+	private final class EliasFanoIterator extends Decoder implements IntBigListIterator {
+	 EliasFanoIterator(final long index) {
+	  super(index);
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return index < n;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return index > 0;
+	 }
+	 @Override
+	 public long nextIndex() {
+	  return index;
+	 }
+	 @Override
+	 public long previousIndex() {
+	  return index - 1;
+	 }
+	 @Override
+	 public int nextInt() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return decode();
+	 }
+	 @Override
+	 public int previousInt() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  moveTo(index - 1);
+	  return getInt(index);
+	 }
+	 @Override
+	 public long skip(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, n - index);
+	  if (skipped != 0) moveTo(index + skipped);
+	  return skipped;
+	 }
+	 @Override
+	 public long back(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, index);
+	  if (skipped != 0) moveTo(index - skipped);
+	  return skipped;
+	 }
+	}
+	/** A spliterator that decodes elements sequentially and splits by index. */
+	private final class EliasFanoSpliterator extends Decoder implements IntSpliterator {
+	 /** The index of the first element not returned by this spliterator. */
+	 private final long max;
+	 /** The characteristics of this spliterator. */
+	 private final int characteristics;
+	 EliasFanoSpliterator(final long index, final long max, final int characteristics) {
+	  super(index);
+	  this.max = max;
+	  this.characteristics = characteristics;
+	 }
+	 @Override
+	 public int characteristics() {
+	  return characteristics;
+	 }
+	 @Override
+	 public long estimateSize() {
+	  return max - index;
+	 }
+	 @Override
+	 public IntComparator getComparator() {
+	  if ((characteristics & Spliterator.SORTED) != 0) return null;
+	  throw new IllegalStateException();
+	 }
+	 @Override
+	 public boolean tryAdvance(final java.util.function.IntConsumer action) {
+	  if (index >= max) return false;
+	  action.accept(decode());
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final java.util.function.IntConsumer action) {
+	  while (index < max) action.accept(decode());
+	 }
+	 @Override
+	 public long skip(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, max - index);
+	  if (skipped != 0) moveTo(index + skipped);
+	  return skipped;
+	 }
+	 @Override
+	 public IntSpliterator trySplit() {
+	  if (max - index < 2) return null;
+	  final long mid = index + (max - index >>> 1);
+	  final EliasFanoSpliterator prefix = new EliasFanoSpliterator(index, mid, characteristics);
+	  moveTo(mid);
+	  return prefix;
+	 }
+	}
+	@Override
+	public IntBigListIterator listIterator(final long index) {
+	 ensureIndex(index);
+	 return new EliasFanoIterator(index);
+	}
+	/** Returns a spliterator over a range of this list.
+	 *
+	 * @param from the index of the first element (inclusive).
+	 * @param to the index of the last element (exclusive).
+	 * @param characteristics the characteristics of the spliterator.
+	 * @return a spliterator over the given range.
+	 */
+	IntSpliterator spliterator(final long from, final long to, final int characteristics) {
+	 return new EliasFanoSpliterator(from, to, characteristics);
+	}
+	@Override
+	public IntSpliterator spliterator() {
+	 return new EliasFanoSpliterator(0, n, SPLITERATOR_CHARACTERISTICS);
+	}
+	private void readObject(final java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 buildSamples();
+	}
+}
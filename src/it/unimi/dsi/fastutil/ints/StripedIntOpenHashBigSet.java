@@ -0,0 +1,325 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.ints;
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.Hash;
+import it.unimi.dsi.fastutil.Size64;
+import java.util.Collection;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.ForkJoinTask;
+import java.util.concurrent.RecursiveAction;
+import java.util.concurrent.locks.ReentrantReadWriteLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock.ReadLock;
+import java.util.concurrent.locks.ReentrantReadWriteLock.WriteLock;
+/** A concurrent type-specific hash big set. The set is made by a number of <em>stripes</em> (instances of {@link OPEN_HASH_BIG_SET})
+	* which are accessed independently using a {@link ReentrantReadWriteLock}. Only one thread can write in a stripe at a time, but different stripes
+	* can be modified independently and read access can happen concurrently on each stripe. Since each stripe has its own
+	* big array, a stripe can be rehashed while other threads keep adding to other stripes.
+	*
+	* <p>Keys are distributed among stripes using high bits of their hash, which are independent from the bits used to place keys
+	* within a stripe. In particular, two striped sets with the same number of stripes distribute keys in the same way,
+	* so they can be {@linkplain #addAll(Collection) merged} stripe by stripe, in parallel, without moving any key across stripes.
+	*
+	* <p>Bulk insertion from a big array can be {@linkplain #parallelAddAll parallelized}: the keys are split
+	* among the threads of a {@link ForkJoinPool}, and each thread groups its keys by stripe so to lock each stripe once per batch.
+	* The static {@code toBigSet()} methods fill a single set concurrently from a parallel stream, so there is no sequential merge phase.
+	*
+	* <p>Iterators are <em>not</em> thread safe: they must not be used while the set is being modified by other threads.
+	* {@link #forEach forEach()}, on the contrary, locks each stripe during its traversal.
+	*
+	* @see OPEN_HASH_BIG_SET
+	*/
+public class StripedIntOpenHashBigSet extends AbstractIntSet implements java.io.Serializable, Size64 {
+	private static final long serialVersionUID = 0L;
+	/** The number of keys per parallel task under which we do not fork. */
+	private static final int PARALLEL_ADD_NO_FORK = 1 << 16;
+	/** The stripes. */
+	private final IntOpenHashBigSet [] set;
+	/** An array of locks parallel to {@link #set}, protecting each stripe. */
+	private final ReentrantReadWriteLock[] lock;
+	/** {@link #set set.length} &minus; 1, cached. */
+	private final int mask;
+	/** Creates a new striped hash big set.
+	 *
+	 * @param expected the expected number of elements in the set.
+	 * @param f the load factor.
+	 * @param concurrencyLevel the number of stripes (it will be {@linkplain Integer#highestOneBit(int) forced to be a power of two}); ideally, as large as the number of threads that will ever access
+	 * this set, but higher values require more space.
+	 */
+
+	public StripedIntOpenHashBigSet(final long expected, final float f, final int concurrencyLevel) {
+	 if (concurrencyLevel <= 0) throw new IllegalArgumentException("The concurrency level must be positive: " + concurrencyLevel);
+	 set = new IntOpenHashBigSet[Integer.highestOneBit(concurrencyLevel)];
+	 lock = new ReentrantReadWriteLock[set.length];
+	 for(int i = set.length; i-- != 0;) {
+	  set[i] = new IntOpenHashBigSet (expected / set.length, f);
+	  lock[i] = new ReentrantReadWriteLock();
+	 }
+	 mask = set.length - 1;
+	}
+	/** Creates a new striped hash big set with {@link Hash#DEFAULT_LOAD_FACTOR} as load factor.
+	 *
+	 * @param expected the expected number of elements in the set.
+	 * @param concurrencyLevel the number of stripes (it will be {@linkplain Integer#highestOneBit(int) forced to be a power of two}).
+	 */
+	public StripedIntOpenHashBigSet(final long expected, final int concurrencyLevel) {
+	 this(expected, Hash.DEFAULT_LOAD_FACTOR, concurrencyLevel);
+	}
+	/** Creates a new striped hash big set with concurrency level equal to four times {@link Runtime#availableProcessors()}.
+	 *
+	 * @param expected the expected number of elements in the set.
+	 */
+	public StripedIntOpenHashBigSet(final long expected) {
+	 this(expected, Hash.DEFAULT_LOAD_FACTOR, 4 * Runtime.getRuntime().availableProcessors());
+	}
+	/** Creates a new striped hash big set with {@link Hash#DEFAULT_INITIAL_SIZE} expected elements
+	 * and concurrency level equal to four times {@link Runtime#availableProcessors()}. */
+	public StripedIntOpenHashBigSet() {
+	 this(Hash.DEFAULT_INITIAL_SIZE);
+	}
+	/** Returns the stripe of a key. */
+	private int stripe(final int k) {
+	 // Stripes use bits that are never used by the position of a key in a stripe with less than 2^40 slots
+	 return (int)(( it.unimi.dsi.fastutil.HashCommon.mix( (long)( (k) ) ) ) >>> 40) & mask;
+	}
+	/** Returns the number of stripes of this set.
+	 *
+	 * @return the number of stripes of this set.
+	 */
+	public int concurrencyLevel() {
+	 return set.length;
+	}
+	@Override
+	public boolean add(final int k) {
+	 final int stripe = stripe(k);
+	 final WriteLock writeLock = lock[stripe].writeLock();
+	 writeLock.lock();
+	 try {
+	  return set[stripe].add(k);
+	 }
+	 finally {
+	  writeLock.unlock();
+	 }
+	}
+	@Override
+	public boolean remove(final int k) {
+	 final int stripe = stripe(k);
+	 final WriteLock writeLock = lock[stripe].writeLock();
+	 writeLock.lock();
+	 try {
+	  return set[stripe].remove(k);
+	 }
+	 finally {
+	  writeLock.unlock();
+	 }
+	}
+	@Override
+	public boolean contains(final int k) {
+	 final int stripe = stripe(k);
+	 final ReadLock readLock = lock[stripe].readLock();
+	 readLock.lock();
+	 try {
+	  return set[stripe].contains(k);
+	 }
+	 finally {
+	  readLock.unlock();
+	 }
+	}
+	/** Adds the elements of a striped set with the same number of stripes, merging stripes in parallel. */
+	private boolean merge(final StripedIntOpenHashBigSet s) {
+	 final boolean[] changed = new boolean[set.length];
+	 java.util.stream.IntStream.range(0, set.length).parallel().forEach(stripe -> {
+	  final WriteLock writeLock = lock[stripe].writeLock();
+	  writeLock.lock();
+	  try {
+	   changed[stripe] = set[stripe].addAll(s.set[stripe]);
+	  }
+	  finally {
+	   writeLock.unlock();
+	  }
+	 });
+	 for (final boolean c : changed) if (c) return true;
+	 return false;
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a striped set with the same number of stripes, the stripes are merged in parallel.
+	 * In any case, the argument must not be modified concurrently.
+	 */
+	@Override
+
+	public boolean addAll(final Collection<? extends Integer> c) {
+	 if (c instanceof StripedIntOpenHashBigSet && ((StripedIntOpenHashBigSet)c).set.length == set.length && c != this) return merge((StripedIntOpenHashBigSet )c);
+	 return super.addAll(c);
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>If the argument is a striped set with the same number of stripes, the stripes are merged in parallel.
+	 * In any case, the argument must not be modified concurrently.
+	 */
+	@Override
+	public boolean addAll(final IntCollection c) {
+	 if (c instanceof StripedIntOpenHashBigSet && ((StripedIntOpenHashBigSet)c).set.length == set.length && c != this) return merge((StripedIntOpenHashBigSet)c);
+	 return super.addAll(c);
+	}
+	/** Adds in parallel the elements of a big array.
+	 *
+	 * <p>The elements are split among the threads of a {@link ForkJoinPool} (the {@linkplain ForkJoinPool#commonPool() common pool},
+	 * unless this method is called from within another pool).
+	 *
+	 * @param a a big array.
+	 */
+	public void parallelAddAll(final int[][] a) {
+	 ForkJoinPool pool = ForkJoinTask.getPool();
+	 if (pool == null) pool = ForkJoinPool.commonPool();
+	 pool.invoke(new ForkJoinAdd (this, a, 0, BigArrays.length(a)));
+	}
+	/** Adds in parallel the elements of an array.
+	 *
+	 * @param a an array.
+	 */
+	public void parallelAddAll(final int[] a) {
+	 parallelAddAll(BigArrays.wrap(a));
+	}
+	/** Adds a batch of keys, locking each stripe once. */
+
+	private void addBatch(final int[][] a, final long from, final long to) {
+	 final int len = (int)(to - from);
+	 final int[] buffer = new int[len];
+	 final int[] stripeOf = new int[len];
+	 final int[] start = new int[set.length + 1];
+	 for (int i = 0; i < len; i++) start[(stripeOf[i] = stripe(BigArrays.get(a, from + i))) + 1]++;
+	 for (int s = 0; s < set.length; s++) start[s + 1] += start[s];
+	 final int[] pos = java.util.Arrays.copyOf(start, set.length);
+	 for (int i = 0; i < len; i++) buffer[pos[stripeOf[i]]++] = BigArrays.get(a, from + i);
+	 for (int stripe = 0; stripe < set.length; stripe++) {
+	  if (start[stripe] == start[stripe + 1]) continue;
+	  final WriteLock writeLock = lock[stripe].writeLock();
+	  writeLock.lock();
+	  try {
+	   for (int i = start[stripe]; i < start[stripe + 1]; i++) set[stripe].add(buffer[i]);
+	  }
+	  finally {
+	   writeLock.unlock();
+	  }
+	 }
+	}
+	private static final class ForkJoinAdd extends RecursiveAction {
+	 private static final long serialVersionUID = 1L;
+	 private final StripedIntOpenHashBigSet s;
+	 private final int[][] a;
+	 private final long from;
+	 private final long to;
+	 public ForkJoinAdd(final StripedIntOpenHashBigSet s, final int[][] a, final long from, final long to) {
+	  this.s = s;
+	  this.a = a;
+	  this.from = from;
+	  this.to = to;
+	 }
+	 @Override
+	 protected void compute() {
+	  if (to - from <= PARALLEL_ADD_NO_FORK) {
+	   if (to > from) s.addBatch(a, from, to);
+	   return;
+	  }
+	  final long mid = (from + to) >>> 1;
+	  invokeAll(new ForkJoinAdd (s, a, from, mid), new ForkJoinAdd (s, a, mid, to));
+	 }
+	}
+	/** Collects the result of a primitive {@code Stream} into a new striped big hash set.
+	 *
+	 * <p>This method performs a terminal operation on the given {@code Stream}. All
+	 * threads of a parallel stream add directly to the returned set, so
+	 * there is no sequential merge phase.
+	 */
+	public static StripedIntOpenHashBigSet toBigSet(final java.util.stream.IntStream stream) {
+	 final StripedIntOpenHashBigSet s = new StripedIntOpenHashBigSet();
+	 stream.forEach(s::add);
+	 return s;
+	}
+	/** Collects the result of a primitive {@code Stream} into a new striped big hash set.
+	 *
+	 * <p>This method performs a terminal operation on the given {@code Stream}. All
+	 * threads of a parallel stream add directly to the returned set, so
+	 * there is no sequential merge phase.
+	 */
+	public static StripedIntOpenHashBigSet toBigSetWithExpectedSize(final java.util.stream.IntStream stream, final long expectedSize) {
+	 final StripedIntOpenHashBigSet s = new StripedIntOpenHashBigSet(expectedSize);
+	 stream.forEach(s::add);
+	 return s;
+	}
+	@Override
+	public void forEach(final java.util.function.IntConsumer action) {
+	 for(int stripe = 0; stripe < set.length; stripe++) {
+	  final ReadLock readLock = lock[stripe].readLock();
+	  readLock.lock();
+	  try {
+	   set[stripe].forEach(action);
+	  }
+	  finally {
+	   readLock.unlock();
+	  }
+	 }
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>The returned iterator must not be used while other threads modify this set.
+	 */
+	@Override
+
+	public IntIterator iterator() {
+	 final IntIterator [] i = new IntIterator[set.length];
+	 for(int stripe = set.length; stripe-- != 0;) i[stripe] = set[stripe].iterator();
+	 return IntIterators.concat(i);
+	}
+	@Override
+	public void clear() {
+	 for(int stripe = set.length; stripe-- != 0;) {
+	  final WriteLock writeLock = lock[stripe].writeLock();
+	  writeLock.lock();
+	  try {
+	   set[stripe].clear();
+	  }
+	  finally {
+	   writeLock.unlock();
+	  }
+	 }
+	}
+	@Override
+	public long size64() {
+	 long size = 0;
+	 for(int stripe = set.length; stripe-- != 0;) {
+	  final ReadLock readLock = lock[stripe].readLock();
+	  readLock.lock();
+	  try {
+	   size += set[stripe].size64();
+	  }
+	  finally {
+	   readLock.unlock();
+	  }
+	 }
+	 return size;
+	}
+	@Deprecated
+	@Override
+	public int size() {
+	 return (int)Math.min(Integer.MAX_VALUE, size64());
+	}
+	@Override
+	public boolean isEmpty() {
+	 return size64() == 0;
+	}
+}
@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET LongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedLongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Long2BooleanOpenDoubleHashMap
 #define ARRAY_SET LongArraySet
 #define ARRAY_MAP Long2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET LongLinkedOpenHashSet
 #define AVL_TREE_SET LongAVLTreeSet
 #define RB_TREE_SET LongRBTreeSet
+#define BTREE_SET LongBTreeSet
+#define PERSISTENT_TREE_SET LongPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET LongConcurrentSkipListSet
+#define SORTED_ARRAY_SET LongSortedArraySet
 #define AVL_TREE_MAP Long2BooleanAVLTreeMap
 #define RB_TREE_MAP Long2BooleanRBTreeMap
+#define BTREE_MAP Long2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Long2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Long2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Long2BooleanSortedArrayMap
+#define CACHE Long2BooleanCache
+#define STATIC_FUNCTION Long2BooleanStaticFunction
+#define BLOOM_FILTER LongBloomFilter
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
 #define MAPPED_BIG_LIST LongMappedBigList
 #define ARRAY_FRONT_CODED_LIST LongArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST LongArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST LongEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET LongEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE LongHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE LongHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE LongHeapIndirectPriorityQueue
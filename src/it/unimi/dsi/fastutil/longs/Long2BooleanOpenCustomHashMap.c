@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2BooleanOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2BooleanOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2BooleanOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2BooleanAVLTreeMap
 #define RB_TREE_MAP Long2BooleanRBTreeMap
+#define CACHE Long2BooleanCache
+#define STATIC_FUNCTION Long2BooleanStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
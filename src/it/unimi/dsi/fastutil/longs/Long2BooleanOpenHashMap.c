@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET LongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2BooleanOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2BooleanAVLTreeMap
 #define RB_TREE_MAP Long2BooleanRBTreeMap
+#define CACHE Long2BooleanCache
+#define STATIC_FUNCTION Long2BooleanStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ByteLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ByteAVLTreeMap
 #define RB_TREE_MAP Long2ByteRBTreeMap
+#define CACHE Long2ByteCache
+#define STATIC_FUNCTION Long2ByteStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
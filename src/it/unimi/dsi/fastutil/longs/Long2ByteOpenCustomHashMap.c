@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2ByteOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ByteOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ByteOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ByteAVLTreeMap
 #define RB_TREE_MAP Long2ByteRBTreeMap
+#define CACHE Long2ByteCache
+#define STATIC_FUNCTION Long2ByteStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
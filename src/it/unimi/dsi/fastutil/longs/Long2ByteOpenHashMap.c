@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ByteOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ByteAVLTreeMap
 #define RB_TREE_MAP Long2ByteRBTreeMap
+#define CACHE Long2ByteCache
+#define STATIC_FUNCTION Long2ByteStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
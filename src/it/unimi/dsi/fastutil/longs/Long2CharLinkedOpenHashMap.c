@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2CharLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2CharAVLTreeMap
 #define RB_TREE_MAP Long2CharRBTreeMap
+#define CACHE Long2CharCache
+#define STATIC_FUNCTION Long2CharStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2CharOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2CharOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2CharOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2CharOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2CharAVLTreeMap
 #define RB_TREE_MAP Long2CharRBTreeMap
+#define CACHE Long2CharCache
+#define STATIC_FUNCTION Long2CharStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -316,22 +316,44 @@
 #define OPEN_HASH_BIG_SET LongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2DoubleOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2DoubleOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2DoubleOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedLongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Long2DoubleOpenDoubleHashMap
 #define ARRAY_SET LongArraySet
 #define ARRAY_MAP Long2DoubleArrayMap
 #define LINKED_OPEN_HASH_SET LongLinkedOpenHashSet
 #define AVL_TREE_SET LongAVLTreeSet
 #define RB_TREE_SET LongRBTreeSet
+#define BTREE_SET LongBTreeSet
+#define PERSISTENT_TREE_SET LongPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET LongConcurrentSkipListSet
+#define SORTED_ARRAY_SET LongSortedArraySet
 #define AVL_TREE_MAP Long2DoubleAVLTreeMap
+#define ARENA_TREE_MAP Long2DoubleArenaTreeMap
 #define RB_TREE_MAP Long2DoubleRBTreeMap
+#define BTREE_MAP Long2DoubleBTreeMap
+#define PERSISTENT_TREE_MAP Long2DoublePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Long2DoubleConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Long2DoubleSortedArrayMap
+#define CACHE Long2DoubleCache
+#define STATIC_FUNCTION Long2DoubleStaticFunction
+#define BLOOM_FILTER LongBloomFilter
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST LongCopyOnWriteArrayList
+#define CHUNKED_LIST LongChunkedList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
 #define MAPPED_BIG_LIST LongMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST LongAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST LongArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST LongArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST LongMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST LongEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET LongEliasFanoSortedSet
+#define PACKED_BIG_LIST LongPackedBigList
 #define HEAP_PRIORITY_QUEUE LongHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE LongHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE LongHeapIndirectPriorityQueue
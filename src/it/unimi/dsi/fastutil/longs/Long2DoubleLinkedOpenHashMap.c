@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2DoubleLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2DoubleAVLTreeMap
 #define RB_TREE_MAP Long2DoubleRBTreeMap
+#define CACHE Long2DoubleCache
+#define STATIC_FUNCTION Long2DoubleStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
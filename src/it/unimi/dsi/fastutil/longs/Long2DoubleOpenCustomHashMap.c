@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2DoubleOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2DoubleAVLTreeMap
 #define RB_TREE_MAP Long2DoubleRBTreeMap
+#define CACHE Long2DoubleCache
+#define STATIC_FUNCTION Long2DoubleStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
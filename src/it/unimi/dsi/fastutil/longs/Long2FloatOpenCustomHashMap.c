@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2FloatOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2FloatAVLTreeMap
 #define RB_TREE_MAP Long2FloatRBTreeMap
+#define CACHE Long2FloatCache
+#define STATIC_FUNCTION Long2FloatStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2IntLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2IntAVLTreeMap
 #define RB_TREE_MAP Long2IntRBTreeMap
+#define CACHE Long2IntCache
+#define STATIC_FUNCTION Long2IntStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2IntOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2IntAVLTreeMap
 #define RB_TREE_MAP Long2IntRBTreeMap
+#define CACHE Long2IntCache
+#define STATIC_FUNCTION Long2IntStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2LongLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2LongAVLTreeMap
 #define RB_TREE_MAP Long2LongRBTreeMap
+#define CACHE Long2LongCache
+#define STATIC_FUNCTION Long2LongStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ObjectLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ObjectAVLTreeMap
 #define RB_TREE_MAP Long2ObjectRBTreeMap
+#define CACHE Long2ObjectCache
+#define STATIC_FUNCTION Long2ObjectStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
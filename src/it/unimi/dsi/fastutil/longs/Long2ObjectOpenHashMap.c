@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET LongOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ObjectOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ObjectAVLTreeMap
 #define RB_TREE_MAP Long2ObjectRBTreeMap
+#define CACHE Long2ObjectCache
+#define STATIC_FUNCTION Long2ObjectStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
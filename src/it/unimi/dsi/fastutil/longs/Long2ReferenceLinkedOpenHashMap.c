@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET LongLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Long2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ReferenceLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ReferenceAVLTreeMap
 #define RB_TREE_MAP Long2ReferenceRBTreeMap
+#define CACHE Long2ReferenceCache
+#define STATIC_FUNCTION Long2ReferenceStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET LongOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET LongOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Long2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Long2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Long2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Long2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedLong2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Long2ReferenceOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET LongRBTreeSet
 #define AVL_TREE_MAP Long2ReferenceAVLTreeMap
 #define RB_TREE_MAP Long2ReferenceRBTreeMap
+#define CACHE Long2ReferenceCache
+#define STATIC_FUNCTION Long2ReferenceStaticFunction
 #define ARRAY_LIST LongArrayList
 #define IMMUTABLE_LIST LongImmutableList
 #define BIG_ARRAY_BIG_LIST LongBigArrayBigList
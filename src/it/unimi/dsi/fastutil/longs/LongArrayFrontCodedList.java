@@ -21,11 +21,21 @@ import static it.unimi.dsi.fastutil.BigArrays.trim;
 import it.unimi.dsi.fastutil.BigArrays;
 import it.unimi.dsi.fastutil.objects.AbstractObjectList;
 import it.unimi.dsi.fastutil.objects.ObjectListIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
+import it.unimi.dsi.fastutil.ints.IntIntPair;
 import java.io.Serializable;
 import java.util.Iterator;
 import java.util.Collection;
+import java.util.List;
 import java.util.NoSuchElementException;
 import java.util.RandomAccess;
+import java.util.Spliterator;
+import java.util.concurrent.ForkJoinPool;
+import java.util.concurrent.RecursiveAction;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.function.Consumer;
+import java.util.function.LongFunction;
 /** Compact storage of lists of arrays using front-coding (also known as prefix-omission) compression.
 	*
 	* <p>This class stores immutably a list of arrays in a single {@linkplain it.unimi.dsi.fastutil.BigArrays big array}
@@ -54,6 +64,17 @@ import java.util.RandomAccess;
 	* still have a data structure storing large list of arrays with a reduced
 	* overhead (just one integer per array, plus the space required for lengths).
 	*
+	* <p>Since blocks of {@link #ratio()} arrays are coded independently, a front-coded list can be
+	* {@linkplain #parallelBuild(List, int) built in parallel} from a random-access list, and its
+	* {@linkplain #spliterator() spliterator} splits at block boundaries, so that parallel streams
+	* decode each block sequentially.
+	*
+	* <p>At construction time, a front-coded list records whether its arrays are
+	* {@linkplain #isSorted() sorted} lexicographically (elements being compared by their natural order).
+	* In that case, {@code indexOf()} and {@code range()} perform a binary search on
+	* the arrays stored entirely, followed by a scan of a single block, and thus require time
+	* <var>O</var>(log <var>n</var> + {@link #ratio()}).
+	*
 	* <p>Note that the typical usage of front-coded lists is under the form of
 	* serialized objects; usually, the data that has to be compacted is processed
 	* offline, and the resulting structure is stored permanently. Since the
@@ -92,6 +113,8 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	protected final long[][] array;
 	/** The pointers to entire arrays in the list. */
 	protected transient long[] p;
+	/** Whether the arrays in the list are sorted lexicographically (recomputed at deserialization). */
+	protected transient boolean sorted;
 	/** Creates a new front-coded list containing the arrays returned by the given iterator.
 	 *
 	 * @param arrays an iterator returning arrays.
@@ -104,10 +127,12 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	 long[][] a = new long[2][];
 	 long curSize = 0;
 	 int n = 0, b = 0, length;
+	 boolean sorted = true;
 	 while(arrays.hasNext()) {
 	  a[b] = arrays.next();
 	  length = a[b].length;
 	  if (n % ratio == 0) {
+	   if (sorted && n != 0 && compare(a[1 - b], a[1 - b].length, a[b], false) > 0) sorted = false;
 	   p = LongArrays.grow(p, n / ratio + 1);
 	   p[n / ratio] = curSize;
 	   array = grow(array, curSize + count(length) + length, curSize);
@@ -119,6 +144,7 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	   final int minLength = Math.min(a[1 - b].length, length);
 	   int common;
 	   for(common = 0; common < minLength; common++) if (a[0][common] != a[1][common]) break;
+	   if (common < a[1 - b].length && (common == length || ( (a[b][common]) < (a[1 - b][common]) ))) sorted = false;
 	   length -= common;
 	   array = grow(array, curSize + count(length) + count(common) + length, curSize);
 	   curSize += writeInt(array, length, curSize);
@@ -133,6 +159,7 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	 this.ratio = ratio;
 	 this.array = trim(array, curSize);
 	 this.p = LongArrays.trim(p, (n + ratio - 1) / ratio);
+	 this.sorted = sorted;
 	}
 	/** Creates a new front-coded list containing the arrays in the given collection.
 	 *
@@ -142,6 +169,129 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	public LongArrayFrontCodedList(final Collection<long[]> c, final int ratio) {
 	 this(c.iterator(), ratio);
 	}
+	private LongArrayFrontCodedList(final int n, final int ratio, final long[][] array, final long[] p, final boolean sorted) {
+	 this.n = n;
+	 this.ratio = ratio;
+	 this.array = array;
+	 this.p = p;
+	 this.sorted = sorted;
+	}
+	/** Creates in parallel a new front-coded list containing the arrays in the given list.
+	 *
+	 * <p>Blocks of {@code ratio} arrays are coded independently using the
+	 * {@linkplain ForkJoinPool#commonPool() common pool}. The list should be {@link RandomAccess}, as
+	 * its arrays are accessed by index, and it must not be modified during the construction.
+	 *
+	 * @param arrays a list of arrays.
+	 * @param ratio the desired ratio.
+	 * @return a front-coded list containing the arrays in {@code arrays}.
+	 */
+	public static LongArrayFrontCodedList parallelBuild(final List<long[]> arrays, final int ratio) {
+	 if (ratio < 1) throw new IllegalArgumentException("Illegal ratio (" + ratio + ")");
+	 final int n = arrays.size();
+	 final long[][] p = LongBigArrays.newBigArray((n + ratio - 1) / ratio);
+	 final AtomicBoolean sorted = new AtomicBoolean(true);
+	 final long[][] array = parallelFrontCode(i -> arrays.get((int)i), n, ratio, p, sorted);
+	 final long[] q = new long[(int)BigArrays.length(p)];
+	 copyFromBig(p, 0, q, 0, q.length);
+	 return new LongArrayFrontCodedList(n, ratio, array, q, sorted.get());
+	}
+	/** The number of arrays below which {@link BlockCoder} does not split further its range of blocks. */
+	private static final int PARALLEL_BUILD_THRESHOLD = 1 << 12;
+	/** Front-codes in parallel a sequence of arrays.
+	 *
+	 * @param arrays a function returning the arrays to code given their index.
+	 * @param n the number of arrays.
+	 * @param ratio the ratio.
+	 * @param p a big array of length <code>&lceil;n / ratio&rceil;</code> that will be filled with the pointers to entire arrays.
+	 * @param sorted if not {@code null}, a flag that will be cleared if the arrays are not sorted lexicographically.
+	 * @return a big array containing the compressed arrays.
+	 */
+	static long[][] parallelFrontCode(final LongFunction<long[]> arrays, final long n, final int ratio, final long[][] p, final AtomicBoolean sorted) {
+	 final long blocks = BigArrays.length(p);
+	 // First pass: compute the length of each block (and check order)
+	 ForkJoinPool.commonPool().invoke(new BlockCoder(arrays, n, ratio, p, null, sorted, 0, blocks));
+	 long size = 0;
+	 for (long b = 0; b < blocks; b++) {
+	  final long length = BigArrays.get(p, b);
+	  BigArrays.set(p, b, size);
+	  size += length;
+	 }
+	 // Second pass: code each block at its position
+	 final long[][] array = LongBigArrays.newBigArray(size);
+	 ForkJoinPool.commonPool().invoke(new BlockCoder(arrays, n, ratio, p, array, null, 0, blocks));
+	 return array;
+	}
+	/** A recursive action coding a range of blocks.
+	 *
+	 * <p>If the array of compressed arrays is {@code null}, the action just stores in the pointer
+	 * big array the length of each block; otherwise, it codes each block at the position
+	 * specified by the pointer big array.
+	 */
+	private static final class BlockCoder extends RecursiveAction {
+	 private static final long serialVersionUID = 1L;
+	 private final LongFunction<long[]> arrays;
+	 private final long n;
+	 private final int ratio;
+	 private final long[][] p;
+	 private final long[][] array;
+	 private final AtomicBoolean sorted;
+	 private final long from;
+	 private final long to;
+	 public BlockCoder(final LongFunction<long[]> arrays, final long n, final int ratio, final long[][] p, final long[][] array, final AtomicBoolean sorted, final long from, final long to) {
+	  this.arrays = arrays;
+	  this.n = n;
+	  this.ratio = ratio;
+	  this.p = p;
+	  this.array = array;
+	  this.sorted = sorted;
+	  this.from = from;
+	  this.to = to;
+	 }
+	 @Override
+	 protected void compute() {
+	  if (to - from > 1 && (to - from) * ratio > PARALLEL_BUILD_THRESHOLD) {
+	   final long mid = (from + to) >>> 1;
+	   invokeAll(new BlockCoder(arrays, n, ratio, p, array, sorted, from, mid), new BlockCoder(arrays, n, ratio, p, array, sorted, mid, to));
+	   return;
+	  }
+	  for (long b = from; b < to; b++) {
+	   final long start = array == null ? 0 : BigArrays.get(p, b);
+	   long pos = start;
+	   long[] prev = null;
+	   if (sorted != null && b != 0 && sorted.get()) {
+	    final long[] last = arrays.apply(b * ratio - 1);
+	    if (compare(last, last.length, arrays.apply(b * ratio), false) > 0) sorted.set(false);
+	   }
+	   for (long i = b * ratio, end = Math.min(n, i + ratio); i < end; i++) {
+	    final long[] a = arrays.apply(i);
+	    int length = a.length;
+	    if (prev == null) {
+	     if (array != null) {
+	      writeInt(array, length, pos);
+	      copyToBig(a, 0, array, pos + count(length), length);
+	     }
+	     pos += count(length) + length;
+	    }
+	    else {
+	     final int minLength = Math.min(prev.length, length);
+	     int common;
+	     for(common = 0; common < minLength; common++) if (prev[common] != a[common]) break;
+	     if (sorted != null && common < prev.length && (common == length || ( (a[common]) < (prev[common]) ))) sorted.set(false);
+	     length -= common;
+	     if (array != null) {
+	      writeInt(array, length, pos);
+	      writeInt(array, common, pos + count(length));
+	      copyToBig(a, common, array, pos + count(length) + count(common), length);
+	     }
+	     pos += count(length) + count(common) + length;
+	    }
+	    prev = a;
+	   }
+	   if (array == null) BigArrays.set(p, b, pos - start);
+	  }
+	 }
+	}
 	/* The following (rather messy) methods implements the encoding of arbitrary integers inside a big array.
 	 * Unfortunately, we have to specify different codes for almost every type. */
 	/** Reads a coded length.
@@ -365,6 +515,164 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	   }
 	  };
 	}
+	/** Returns whether the arrays in this list are sorted lexicographically.
+	 *
+	 * <p>Arrays are compared lexicographically using the natural order of their elements; a proper
+	 * prefix of an array precedes the array. The order is recorded at construction time
+	 * and recomputed at deserialization.
+	 *
+	 * @return whether the arrays in this list are sorted lexicographically.
+	 */
+	public boolean isSorted() {
+	 return sorted;
+	}
+	/** Compares lexicographically an array, possibly truncated, with a key.
+	 *
+	 * @param a an array.
+	 * @param length the number of valid elements of {@code a}.
+	 * @param key a key.
+	 * @param prefix if true, {@code a} will be truncated to the length of {@code key} before the comparison.
+	 * @return a negative integer, zero, or a positive integer as {@code a} is less than, equal to, or greater than {@code key}.
+	 */
+	private static int compare(final long[] a, int length, final long[] key, final boolean prefix) {
+	 if (prefix) length = Math.min(length, key.length);
+	 final int m = Math.min(length, key.length);
+	 for (int i = 0; i < m; i++) if (a[i] != key[i]) return ( (a[i]) < (key[i]) ) ? -1 : 1;
+	 return Integer.compare(length, key.length);
+	}
+	/** Returns the first index whose array is greater than (or equal to) a key.
+	 *
+	 * <p>This method performs a binary search on the entire arrays, and then
+	 * decodes sequentially a single block.
+	 *
+	 * @param key a key.
+	 * @param prefix if true, arrays will be truncated to the length of {@code key} before comparisons.
+	 * @param strict if true, we look for the first array greater than {@code key}; otherwise,
+	 * for the first array greater than or equal to {@code key}.
+	 * @return the first index whose array is greater than (or equal to, if {@code strict} is false) {@code key},
+	 * or the size of this list if no such array exists.
+	 */
+	private int search(final long[] key, final boolean prefix, final boolean strict) {
+	 if (! sorted) throw new IllegalStateException("The arrays in this list are not sorted");
+	 final long[][] array = this.array;
+	 final long[] p = this.p;
+	 final int bound = strict ? 0 : -1; // Arrays comparing at most bound are before the result
+	 long[] s = LongArrays.EMPTY_ARRAY;
+	 int length, common;
+	 long pos;
+	 // Binary search for the last block whose first array is before the result
+	 int lo = 0, hi = p.length - 1, block = -1;
+	 while (lo <= hi) {
+	  final int mid = (lo + hi) >>> 1;
+	  pos = p[mid];
+	  length = readInt(array, pos);
+	  s = LongArrays.ensureCapacity(s, length, 0);
+	  copyFromBig(array, pos + count(length), s, 0, length);
+	  if (compare(s, length, key, prefix) <= bound) {
+	   block = mid;
+	   lo = mid + 1;
+	  }
+	  else hi = mid - 1;
+	 }
+	 if (block == -1) return 0;
+	 // Scan the block
+	 pos = p[block];
+	 length = readInt(array, pos);
+	 s = LongArrays.ensureCapacity(s, length, 0);
+	 copyFromBig(array, pos + count(length), s, 0, length);
+	 pos += count(length) + length;
+	 final int end = (int)Math.min(n, (long)(block + 1) * ratio);
+	 for (int i = block * ratio + 1; i < end; i++) {
+	  length = readInt(array, pos);
+	  common = readInt(array, pos + count(length));
+	  s = LongArrays.ensureCapacity(s, length + common, common);
+	  copyFromBig(array, pos + count(length) + count(common), s, common, length);
+	  pos += count(length) + count(common) + length;
+	  if (compare(s, length + common, key, prefix) > bound) return i;
+	 }
+	 return end;
+	}
+	/** Returns the index of the first occurrence of an array in this list.
+	 *
+	 * <p>If this list is {@linkplain #isSorted() sorted}, this method requires time
+	 * <var>O</var>(log <var>n</var> + {@link #ratio()}); otherwise, it performs a linear scan.
+	 * Note that, as opposed to {@link #indexOf(Object)}, arrays are compared by content.
+	 *
+	 * @param key an array.
+	 * @return the index of the first occurrence of {@code key} in this list, or -1 if {@code key} does not appear in this list.
+	 */
+	public int indexOf(final long[] key) {
+	 if (! sorted) {
+	  final ObjectListIterator<long[]> i = listIterator();
+	  while (i.hasNext()) if (java.util.Arrays.equals(i.next(), key)) return i.previousIndex();
+	  return -1;
+	 }
+	 final int from = search(key, false, false);
+	 return from < n && search(key, false, true) > from ? from : -1;
+	}
+	/** Returns the range of indices of the arrays having a given prefix.
+	 *
+	 * <p>This method requires time <var>O</var>(log <var>n</var> + {@link #ratio()}).
+	 *
+	 * @param prefix a prefix.
+	 * @return a pair of indices, the first inclusive and the second exclusive, delimiting the arrays in this list
+	 * starting with {@code prefix} (the pair will have equal indices if there is no such array).
+	 * @throws IllegalStateException if this list is not {@linkplain #isSorted() sorted}.
+	 */
+	public IntIntPair range(final long[] prefix) {
+	 return IntIntPair.of(search(prefix, true, false), search(prefix, true, true));
+	}
+	/** A spliterator splitting at block boundaries and decoding sequentially its range. */
+	private final class BlockSpliterator implements ObjectSpliterator<long[]> {
+	 private int pos, max;
+	 /** An iterator positioned at {@link #pos}, or {@code null}. */
+	 private ObjectListIterator<long[]> iterator;
+	 private BlockSpliterator(final int pos, final int max) {
+	  this.pos = pos;
+	  this.max = max;
+	 }
+	 @Override
+	 public int characteristics() { return ObjectSpliterators.LIST_SPLITERATOR_CHARACTERISTICS | Spliterator.IMMUTABLE | Spliterator.NONNULL; }
+	 @Override
+	 public long estimateSize() { return max - pos; }
+	 @Override
+	 public boolean tryAdvance(final Consumer<? super long[]> action) {
+	  if (pos >= max) return false;
+	  if (iterator == null) iterator = listIterator(pos);
+	  pos++;
+	  action.accept(iterator.next());
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final Consumer<? super long[]> action) {
+	  if (pos >= max) return;
+	  if (iterator == null) iterator = listIterator(pos);
+	  while (pos < max) {
+	   pos++;
+	   action.accept(iterator.next());
+	  }
+	 }
+	 @Override
+	 public ObjectSpliterator<long[]> trySplit() {
+	  // Split at the block boundary closest to the middle of the range
+	  final int mid = (int)(((long)pos + max) / 2 + ratio / 2) / ratio * ratio;
+	  if (mid <= pos || mid >= max) return null;
+	  final BlockSpliterator prefix = new BlockSpliterator(pos, mid);
+	  prefix.iterator = iterator;
+	  iterator = null;
+	  pos = mid;
+	  return prefix;
+	 }
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>The spliterator returned by this method splits at block boundaries, and decodes its
+	 * range sequentially, so its splits can be traversed independently in parallel.
+	 */
+	@Override
+	public ObjectSpliterator<long[]> spliterator() {
+	 return new BlockSpliterator(0, n);
+	}
 	/** Returns a copy of this list.
 	 *
 	 *  @return a copy of this list.
@@ -385,24 +693,50 @@ public class LongArrayFrontCodedList extends AbstractObjectList<long[]> implemen
 	 return s.toString();
 	}
 	/** Computes the pointer array using the currently set ratio, number of elements and underlying array.
+	 *
+	 * <p>As a side effect, this method recomputes {@link #sorted}.
 	 *
 	 * @return the computed pointer array.
 	 */
 	protected long[] rebuildPointerArray() {
 	 final long[] p = new long[(n + ratio - 1) / ratio];
 	 final long a[][] = array;
-	 int length, count;
+	 int length, count, common;
 	 long pos = 0;
+	 // The last array decoded, needed to check the order; we stop decoding as soon as it is violated
+	 long[] last = LongArrays.EMPTY_ARRAY;
+	 int lastLength = 0;
+	 boolean sorted = true;
 	 for(int i = 0, j = 0, skip = ratio - 1; i < n; i++) {
 	  length = readInt(a, pos);
 	  count = count(length);
 	  if (++skip == ratio) {
 	   skip = 0;
 	   p[j++] = pos;
+	   if (sorted) {
+	    final long[] first = new long[length];
+	    copyFromBig(a, pos + count, first, 0, length);
+	    if (i != 0 && compare(last, lastLength, first, false) > 0) sorted = false;
+	    last = first;
+	    lastLength = length;
+	   }
 	   pos += count + length;
 	  }
-	  else pos += count + count(readInt(a, pos + count)) + length;
+	  else {
+	   common = readInt(a, pos + count);
+	   final long start = pos + count + count(common);
+	   if (sorted) {
+	    if (common < lastLength && (length == 0 || ( (BigArrays.get(a, start)) < (last[common]) ))) sorted = false;
+	    else {
+	     last = LongArrays.ensureCapacity(last, common + length, common);
+	     copyFromBig(a, start, last, common, length);
+	     lastLength = common + length;
+	    }
+	   }
+	   pos += count + count(common) + length;
+	  }
 	 }
+	 this.sorted = sorted;
 	 return p;
 	}
 	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
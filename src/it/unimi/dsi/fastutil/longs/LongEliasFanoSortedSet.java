@@ -0,0 +1,178 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.longs;
+import it.unimi.dsi.fastutil.Size64;
+import java.io.Serializable;
+import java.util.NoSuchElementException;
+import java.util.Spliterator;
+/** An immutable, succinct sorted set based on the Elias&ndash;Fano representation.
+	*
+	* <p>Instances of this class are backed by an Elias&ndash;Fano big list containing
+	* the elements of the set in increasing order: please see the documentation of the list for details
+	* about space usage and time bounds. Membership tests and {@link #successor successor()} require expected constant time
+	* for non-adversarial distributions,
+	* iteration decodes elements sequentially, and subsets are views requiring no additional space.
+	* The backing list is available as a {@linkplain #asBigList() big list}, which makes
+	* it possible to access elements by rank.
+	*
+	* <p>This class implements {@link Size64}, so sets larger than {@link Integer#MAX_VALUE} elements are supported.
+	* The set uses the natural order of its elements, and its {@linkplain #comparator() comparator} is {@code null}.
+	*/
+public class LongEliasFanoSortedSet extends AbstractLongSortedSet implements Serializable, Size64 {
+	private static final long serialVersionUID = 0L;
+	/** The characteristics of spliterators over this set. */
+	private static final int SPLITERATOR_CHARACTERISTICS = LongSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS | Spliterator.SUBSIZED | Spliterator.IMMUTABLE | Spliterator.NONNULL;
+	/** The backing list. */
+	protected final LongEliasFanoBigList list;
+	/** The index in {@link #list} of the first element of this set (inclusive). */
+	protected final long from;
+	/** The index in {@link #list} of the last element of this set (exclusive). */
+	protected final long to;
+	/** Creates a new set containing the elements in a given range of an Elias&ndash;Fano big list.
+	 *
+	 * @param list an increasing Elias&ndash;Fano big list.
+	 * @param from the index in {@code list} of the first element of the set (inclusive).
+	 * @param to the index in {@code list} of the last element of the set (exclusive).
+	 */
+	protected LongEliasFanoSortedSet(final LongEliasFanoBigList list, final long from, final long to) {
+	 this.list = list;
+	 this.from = from;
+	 this.to = to;
+	}
+	/** Creates a new set containing the first elements returned by an iterator.
+	 *
+	 * <p>This is the most memory-efficient constructor, as the elements are never buffered.
+	 *
+	 * @param n the number of elements to read from {@code i}.
+	 * @param lowerBound a lower bound for all elements.
+	 * @param upperBound an upper bound for all elements.
+	 * @param i an iterator returning an increasing sequence of at least {@code n} elements.
+	 */
+	public LongEliasFanoSortedSet(final long n, final long lowerBound, final long upperBound, final LongIterator i) {
+	 this(new LongEliasFanoBigList(n, lowerBound, upperBound, i, true));
+	}
+	/** Creates a new set containing the elements returned by an iterator.
+	 *
+	 * <p>Since bounds and number of elements are unknown, elements are buffered before compression.
+	 *
+	 * @param i an iterator returning an increasing sequence.
+	 */
+	public LongEliasFanoSortedSet(final LongIterator i) {
+	 this(new LongEliasFanoBigList(new LongBigArrayBigList(i), true));
+	}
+	/** Creates a new set containing the elements of an increasing big array.
+	 *
+	 * @param a an increasing big array.
+	 */
+	public LongEliasFanoSortedSet(final long[][] a) {
+	 this(new LongEliasFanoBigList(LongBigArrayBigList.wrap(a), true));
+	}
+	/** Creates a new set containing the elements of an increasing array.
+	 *
+	 * @param a an increasing array.
+	 */
+	public LongEliasFanoSortedSet(final long[] a) {
+	 this(LongBigArrays.wrap(a));
+	}
+	private LongEliasFanoSortedSet(final LongEliasFanoBigList list) {
+	 this(list, 0, list.size64());
+	}
+	/** Returns the index in the backing list of the first element greater than or equal to a given bound, clamped to the range of this set.
+	 *
+	 * @param x a bound.
+	 * @return the index in {@link #list} of the first element of this set greater than or equal to {@code x}, or {@link #to}.
+	 */
+	private long successorIndex(final long x) {
+	 return Math.max(from, Math.min(to, list.successorIndex(x)));
+	}
+	/** Returns the smallest element of this set greater than or equal to a given bound.
+	 *
+	 * @param x a bound.
+	 * @return the smallest element of this set greater than or equal to {@code x}.
+	 * @throws NoSuchElementException if all elements of this set are smaller than {@code x}.
+	 */
+	public long successor(final long x) {
+	 final long i = successorIndex(x);
+	 if (i == to) throw new NoSuchElementException();
+	 return list.getLong(i);
+	}
+	@Override
+	public boolean contains(final long k) {
+	 final long i = list.successorIndex(k);
+	 return i >= from && i < to && list.getLong(i) == k;
+	}
+	@Deprecated
+	@Override
+	public int size() {
+	 return (int)Math.min(Integer.MAX_VALUE, to - from);
+	}
+	@Override
+	public long size64() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public long firstLong() {
+	 if (from == to) throw new NoSuchElementException();
+	 return list.getLong(from);
+	}
+	@Override
+	public long lastLong() {
+	 if (from == to) throw new NoSuchElementException();
+	 return list.getLong(to - 1);
+	}
+	/** Returns the elements of this set as a big list, in increasing order.
+	 *
+	 * @return an immutable big list view of this set.
+	 */
+	public LongBigList asBigList() {
+	 return from == 0 && to == list.size64() ? list : list.subList(from, to);
+	}
+	@Override
+	public LongBidirectionalIterator iterator() {
+	 return asBigList().listIterator();
+	}
+	@Override
+	public LongBidirectionalIterator iterator(final long from) {
+	 long i = successorIndex(from);
+	 if (i < to && list.getLong(i) == from) i++;
+	 return asBigList().listIterator(i - this.from);
+	}
+	@Override
+	public LongSpliterator spliterator() {
+	 return list.spliterator(from, to, SPLITERATOR_CHARACTERISTICS);
+	}
+	@Override
+	public LongComparator comparator() {
+	 return null;
+	}
+	@Override
+	public LongSortedSet headSet(final long to) {
+	 return new LongEliasFanoSortedSet(list, from, successorIndex(to));
+	}
+	@Override
+	public LongSortedSet tailSet(final long from) {
+	 return new LongEliasFanoSortedSet(list, successorIndex(from), to);
+	}
+	@Override
+	public LongSortedSet subSet(final long from, final long to) {
+	 if (from > to) throw new IllegalArgumentException("Start element (" + from + ") is larger than end element (" + to + ")");
+	 return new LongEliasFanoSortedSet(list, successorIndex(from), successorIndex(to));
+	}
+}
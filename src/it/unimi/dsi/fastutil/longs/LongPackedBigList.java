@@ -0,0 +1,376 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.longs;
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.bytes.ByteArrays;
+import java.io.Serializable;
+import java.util.NoSuchElementException;
+import java.util.RandomAccess;
+import java.util.Spliterator;
+/** An immutable, compressed big list based on frame-of-reference bit packing.
+	*
+	* <p>Instances of this class divide a sequence of elements in blocks of {@value #BLOCK_SIZE}
+	* elements, and store each block using just as many bits per element as necessary to represent the difference
+	* between each element and the minimum of the block. Nondecreasing blocks, such as those of sorted lists,
+	* are stored instead as gaps between consecutive elements whenever this requires fewer bits. Lists
+	* of small or clustered values, and in particular sorted lists, typically occupy a fraction of the
+	* space of a big array, with a fixed overhead of about one bit per element. The representation is
+	* immutable, and it is usually built once and then {@linkplain it.unimi.dsi.fastutil.io.BinIO#storeObject(Object, CharSequence) serialized}.
+	*
+	* <p>Random access by {@link #get(long)} requires constant time for blocks stored by frame of reference,
+	* and time proportional to the position in the block for blocks stored as gaps. Iterators,
+	* spliterators and {@link #getElements getElements()} decode a whole block at a time
+	* in a tight loop, which is much faster than repeated random accesses.
+	*
+	* <H2>Implementation Details</H2>
+	*
+	* <p>For each block we record the base (the minimum, or the first element for blocks stored as gaps),
+	* the position of the first bit of the block in a bit array, and the number of bits per element,
+	* whose most significant bit is set for blocks stored as gaps. This makes it possible
+	* to locate any block in constant time.
+	*/
+public class LongPackedBigList extends AbstractLongBigList implements Serializable, RandomAccess {
+	private static final long serialVersionUID = 0L;
+	/** The base-2 logarithm of the number of elements in a block. */
+	private static final int LOG2_BLOCK_SIZE = 7;
+	/** The number of elements in a block. */
+	public static final int BLOCK_SIZE = 1 << LOG2_BLOCK_SIZE;
+	/** A mask extracting the position of an element in its block. */
+	private static final int BLOCK_MASK = BLOCK_SIZE - 1;
+	/** The flag marking, in {@link #width}, blocks stored as gaps. */
+	private static final int GAPS = 0x80;
+	/** The characteristics of spliterators over this list. */
+	private static final int SPLITERATOR_CHARACTERISTICS = LongSpliterators.LIST_SPLITERATOR_CHARACTERISTICS | Spliterator.IMMUTABLE | Spliterator.NONNULL;
+	/** The number of elements in the list. */
+	protected final long n;
+	/** The base of each block, that is, its minimum or, for blocks stored as gaps, its first element. */
+	protected final long[] base;
+	/** The position in {@link #bits} of the first bit of each block. */
+	protected final long[] offset;
+	/** The number of bits per element of each block, possibly with the {@link #GAPS} flag set. */
+	protected final byte[] width;
+	/** The packed elements. */
+	protected final long[][] bits;
+	/** Creates a new packed big list containing the elements returned by an iterator.
+	 *
+	 * <p>This is the most memory-efficient constructor, as at most {@value #BLOCK_SIZE} elements are buffered.
+	 *
+	 * @param i an iterator.
+	 */
+	public LongPackedBigList(final LongIterator i) {
+	 final long[] block = new long[BLOCK_SIZE];
+	 long[] base = LongArrays.EMPTY_ARRAY, offset = LongArrays.EMPTY_ARRAY;
+	 byte[] width = ByteArrays.EMPTY_ARRAY;
+	 long[][] bits = LongBigArrays.EMPTY_BIG_ARRAY;
+	 long n = 0, pos = 0;
+	 int blocks = 0;
+	 while (i.hasNext()) {
+	  int m = 0;
+	  while (m < BLOCK_SIZE && i.hasNext()) block[m++] = i.nextLong();
+	  if (blocks == Integer.MAX_VALUE - 8) throw new IllegalArgumentException("Too many elements");
+	  base = LongArrays.grow(base, blocks + 1);
+	  offset = LongArrays.grow(offset, blocks + 1);
+	  width = ByteArrays.grow(width, blocks + 1);
+	  long min = block[0];
+	  boolean nondecreasing = true;
+	  long gaps = 0;
+	  for (int j = 1; j < m; j++) {
+	   if (block[j] < min) min = block[j];
+	   if (block[j] < block[j - 1]) nondecreasing = false;
+	   gaps |= (long)block[j] - block[j - 1];
+	  }
+	  long values = 0;
+	  for (int j = 0; j < m; j++) values |= (long)block[j] - min;
+	  final int forWidth = Long.SIZE - Long.numberOfLeadingZeros(values);
+	  final int gapWidth = Long.SIZE - Long.numberOfLeadingZeros(gaps);
+	  final boolean useGaps = nondecreasing && gapWidth < forWidth;
+	  final int w = useGaps ? gapWidth : forWidth;
+	  base[blocks] = useGaps ? block[0] : min;
+	  offset[blocks] = pos;
+	  width[blocks] = (byte)(useGaps ? w | GAPS : w);
+	  if (w != 0) {
+	   bits = BigArrays.grow(bits, pos + (long)m * w + Long.SIZE - 1 >>> 6);
+	   if (useGaps) for (int j = 1; j < m; j++, pos += w) write(bits, pos, (long)block[j] - block[j - 1], w);
+	   else for (int j = 0; j < m; j++, pos += w) write(bits, pos, (long)block[j] - min, w);
+	  }
+	  blocks++;
+	  n += m;
+	 }
+	 this.n = n;
+	 this.base = LongArrays.trim(base, blocks);
+	 this.offset = LongArrays.trim(offset, blocks);
+	 this.width = ByteArrays.trim(width, blocks);
+	 this.bits = BigArrays.trim(bits, pos + Long.SIZE - 1 >>> 6);
+	}
+	/** Creates a new packed big list containing the elements of a big list.
+	 *
+	 * @param l a big list.
+	 */
+	public LongPackedBigList(final LongBigList l) {
+	 this(l.iterator());
+	}
+	/** Creates a new packed big list containing the elements of a big array.
+	 *
+	 * @param a a big array.
+	 */
+	public LongPackedBigList(final long[][] a) {
+	 this(LongBigArrayBigList.wrap(a));
+	}
+	/** Creates a new packed big list containing the elements of an array.
+	 *
+	 * @param a an array.
+	 */
+	public LongPackedBigList(final long[] a) {
+	 this(LongBigArrayBigList.wrap(LongBigArrays.wrap(a)));
+	}
+	/** Writes a value in a bit big array.
+	 *
+	 * @param bits a bit big array.
+	 * @param pos the position of the first bit to be written.
+	 * @param v a value smaller than 2<sup>{@code w}</sup>, considered as unsigned.
+	 * @param w a number of bits between 1 and 64.
+	 */
+	private static void write(final long[][] bits, final long pos, final long v, final int w) {
+	 final long word = pos >>> 6;
+	 final int bit = (int)(pos & 63);
+	 BigArrays.set(bits, word, BigArrays.get(bits, word) | v << bit);
+	 if (bit + w > Long.SIZE) BigArrays.set(bits, word + 1, BigArrays.get(bits, word + 1) | v >>> Long.SIZE - bit);
+	}
+	/** Reads a value from {@link #bits}.
+	 *
+	 * @param pos the position of the first bit to be read.
+	 * @param w a number of bits between 0 and 64.
+	 * @return the value of {@code w} bits starting at {@code pos}, considered as unsigned.
+	 */
+	private long read(final long pos, final int w) {
+	 if (w == 0) return 0;
+	 final long word = pos >>> 6;
+	 final int bit = (int)(pos & 63);
+	 long result = BigArrays.get(bits, word) >>> bit;
+	 if (bit + w > Long.SIZE) result |= BigArrays.get(bits, word + 1) << Long.SIZE - bit;
+	 return result & -1L >>> Long.SIZE - w;
+	}
+	/** Returns the number of elements in a block.
+	 *
+	 * @param block a block.
+	 * @return the number of elements in {@code block}.
+	 */
+	private int blockLength(final int block) {
+	 return (int)Math.min(BLOCK_SIZE, n - ((long)block << LOG2_BLOCK_SIZE));
+	}
+	/** Decodes a range of elements of a block into an array.
+	 *
+	 * @param block a block.
+	 * @param from the position in the block of the first element to decode (inclusive).
+	 * @param to the position in the block of the last element to decode (exclusive).
+	 * @param a the destination array.
+	 * @param offset the offset into {@code a} of the first decoded element.
+	 */
+	private void decode(final int block, final int from, final int to, final long[] a, int offset) {
+	 if (from >= to) return;
+	 final int w = width[block] & 0xFF;
+	 final long base = this.base[block];
+	 long pos = this.offset[block];
+	 if ((w & GAPS) == 0) {
+	  pos += (long)from * w;
+	  for (int j = from; j < to; j++, pos += w) a[offset++] = (long)(base + read(pos, w));
+	 } else {
+	  final int g = w & ~GAPS;
+	  long x = base;
+	  for (int j = 0; j < from; j++, pos += g) x += read(pos, g);
+	  a[offset++] = (long)x;
+	  for (int j = from + 1; j < to; j++, pos += g) a[offset++] = (long)(x += read(pos, g));
+	 }
+	}
+	@Override
+	public long getLong(final long index) {
+	 ensureRestrictedIndex(index);
+	 final int block = (int)(index >>> LOG2_BLOCK_SIZE);
+	 final int j = (int)(index & BLOCK_MASK);
+	 final int w = width[block] & 0xFF;
+	 if ((w & GAPS) == 0) return (long)(base[block] + read(offset[block] + (long)j * w, w));
+	 final int g = w & ~GAPS;
+	 long x = base[block], pos = offset[block];
+	 for (int k = 0; k < j; k++, pos += g) x += read(pos, g);
+	 return (long)x;
+	}
+	@Override
+	public long size64() {
+	 return n;
+	}
+	@Override
+	public void getElements(final long from, final long[] a, int offset, int length) {
+	 ensureIndex(from);
+	 LongArrays.ensureOffsetLength(a, offset, length);
+	 if (from + length > n) throw new IndexOutOfBoundsException("End index (" + (from + length) + ") is greater than list size (" + n + ")");
+	 long index = from;
+	 while (length != 0) {
+	  final int block = (int)(index >>> LOG2_BLOCK_SIZE);
+	  final int start = (int)(index & BLOCK_MASK);
+	  final int l = Math.min(length, BLOCK_SIZE - start);
+	  decode(block, start, start + l, a, offset);
+	  index += l;
+	  offset += l;
+	  length -= l;
+	 }
+	}
+	@Override
+	public void getElements(final long from, final long[][] a, long offset, long length) {
+	 ensureIndex(from);
+	 BigArrays.ensureOffsetLength(a, offset, length);
+	 if (from + length > n) throw new IndexOutOfBoundsException("End index (" + (from + length) + ") is greater than list size (" + n + ")");
+	 long index = from;
+	 while (length != 0) {
+	  final long[] t = a[BigArrays.segment(offset)];
+	  final int displacement = BigArrays.displacement(offset);
+	  final int l = (int)Math.min(length, t.length - displacement);
+	  getElements(index, t, displacement, l);
+	  index += l;
+	  offset += l;
+	  length -= l;
+	 }
+	}
+	/** Returns the number of bits used by this list.
+	 *
+	 * @return the number of bits used by this list, excluding object headers.
+	 */
+	public long numBits() {
+	 return BigArrays.length(bits) * Long.SIZE + (long)base.length * (2 * Long.SIZE + Byte.SIZE);
+	}
+	/** A sequential decoder that caches the last decoded block. */
+	private class Decoder {
+	 /** The index of the next element to be returned. */
+	 long index;
+	 /** The block cached in {@link #buffer}, or -1. */
+	 private int block = -1;
+	 /** The elements of {@link #block}. */
+	 private final long[] buffer = new long[BLOCK_SIZE];
+	 Decoder(final long index) {
+	  this.index = index;
+	 }
+	 /** Returns an element, decoding its block if necessary.
+		 *
+		 * @param index the index of an element.
+		 * @return the element of index {@code index}.
+		 */
+	 long get(final long index) {
+	  final int b = (int)(index >>> LOG2_BLOCK_SIZE);
+	  if (b != block) {
+	   decode(b, 0, blockLength(b), buffer, 0);
+	   block = b;
+	  }
+	  return buffer[(int)(index & BLOCK_MASK)];
+	 }
+	}
+	/** A list iterator that decodes a block at a time. */
+	private final class PackedIterator extends Decoder implements LongBigListIterator {
+	 PackedIterator(final long index) {
+	  super(index);
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return index < n;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return index > 0;
+	 }
+	 @Override
+	 public long nextIndex() {
+	  return index;
+	 }
+	 @Override
+	 public long previousIndex() {
+	  return index - 1;
+	 }
+	 @Override
+	 public long nextLong() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return get(index++);
+	 }
+	 @Override
+	 public long previousLong() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  return get(--index);
+	 }
+	 @Override
+	 public long skip(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, n - index);
+	  index += skipped;
+	  return skipped;
+	 }
+	 @Override
+	 public long back(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, index);
+	  index -= skipped;
+	  return skipped;
+	 }
+	}
+	/** A spliterator that decodes a block at a time and splits at block boundaries. */
+	private final class PackedSpliterator extends Decoder implements LongSpliterator {
+	 /** The index of the first element not returned by this spliterator. */
+	 private final long max;
+	 PackedSpliterator(final long index, final long max) {
+	  super(index);
+	  this.max = max;
+	 }
+	 @Override
+	 public int characteristics() {
+	  return SPLITERATOR_CHARACTERISTICS;
+	 }
+	 @Override
+	 public long estimateSize() {
+	  return max - index;
+	 }
+	 @Override
+	 public boolean tryAdvance(final java.util.function.LongConsumer action) {
+	  if (index >= max) return false;
+	  action.accept(get(index++));
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final java.util.function.LongConsumer action) {
+	  while (index < max) action.accept(get(index++));
+	 }
+	 @Override
+	 public long skip(final long k) {
+	  if (k < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + k);
+	  final long skipped = Math.min(k, max - index);
+	  index += skipped;
+	  return skipped;
+	 }
+	 @Override
+	 public LongSpliterator trySplit() {
+	  // Split at a block boundary, so that no block is decoded by both halves
+	  final long mid = index + (max - index >>> 1) & -BLOCK_SIZE;
+	  if (mid <= index || mid >= max) return null;
+	  final PackedSpliterator prefix = new PackedSpliterator(index, mid);
+	  index = mid;
+	  return prefix;
+	 }
+	}
+	@Override
+	public LongBigListIterator listIterator(final long index) {
+	 ensureIndex(index);
+	 return new PackedIterator(index);
+	}
+	@Override
+	public LongSpliterator spliterator() {
+	 return new PackedSpliterator(0, n);
+	}
+}
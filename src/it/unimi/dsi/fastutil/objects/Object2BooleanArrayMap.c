@@ -314,22 +314,38 @@
 #define OPEN_HASH_BIG_SET ObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2BooleanOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Object2BooleanOpenDoubleHashMap
 #define ARRAY_SET ObjectArraySet
 #define ARRAY_MAP Object2BooleanArrayMap
 #define LINKED_OPEN_HASH_SET ObjectLinkedOpenHashSet
 #define AVL_TREE_SET ObjectAVLTreeSet
 #define RB_TREE_SET ObjectRBTreeSet
+#define BTREE_SET ObjectBTreeSet
+#define PERSISTENT_TREE_SET ObjectPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ObjectConcurrentSkipListSet
+#define SORTED_ARRAY_SET ObjectSortedArraySet
 #define AVL_TREE_MAP Object2BooleanAVLTreeMap
 #define RB_TREE_MAP Object2BooleanRBTreeMap
+#define BTREE_MAP Object2BooleanBTreeMap
+#define PERSISTENT_TREE_MAP Object2BooleanPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Object2BooleanConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Object2BooleanSortedArrayMap
+#define CACHE Object2BooleanCache
+#define STATIC_FUNCTION Object2BooleanStaticFunction
+#define BLOOM_FILTER ObjectBloomFilter
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
 #define MAPPED_BIG_LIST ObjectMappedBigList
 #define ARRAY_FRONT_CODED_LIST ObjectArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ObjectArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ObjectEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ObjectEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ObjectHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ObjectHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ObjectHeapIndirectPriorityQueue
@@ -328,6 +328,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2BooleanLinkedOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2BooleanLinkedOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2BooleanOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2BooleanLinkedOpenCustomDoubleHashMap
@@ -338,6 +340,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2BooleanAVLTreeMap
 #define RB_TREE_MAP Object2BooleanRBTreeMap
+#define CACHE Object2BooleanCache
+#define STATIC_FUNCTION Object2BooleanStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -0,0 +1,430 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.objects;
+import it.unimi.dsi.fastutil.booleans.BooleanCollection;
+import it.unimi.dsi.fastutil.booleans.AbstractBooleanCollection;
+import java.util.Comparator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.SortedMap;
+/** An immutable sorted map based on two parallel sorted backing arrays.
+	*
+	* <p>Instances of this class keep their keys sorted in an array, and the corresponding values in
+	* a parallel array, so they use much less memory than a tree-based map, and scan much faster.
+	* Lookups use the same search strategy of sorted-array sets: a branchless binary search, preceded,
+	* for integral keys in their natural order, by a few rounds of interpolation search.
+	* Submaps and key sets are views over a slice of the backing arrays, and they are created in logarithmic
+	* time without copying any entry.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by the views of this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class Object2BooleanSortedArrayMap <K> extends AbstractObject2BooleanSortedMap <K> implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The sorted keys (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient Object[] key;
+	/** The values (parallel to {@link #key}). */
+	protected transient boolean[] value;
+	/** The index of the first entry of this map in {@link #key}. */
+	protected transient int from;
+	/** The index after the last entry of this map in {@link #key}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #key}, or {@code null} for the natural order. */
+	protected Comparator <? super K> comparator;
+	/** Cached set of entries. */
+	protected transient ObjectSortedSet<Object2BooleanMap.Entry <K> > entries;
+	/** Cached set of keys. */
+	protected transient ObjectSortedSet <K> keys;
+	/** Cached collection of values. */
+	protected transient BooleanCollection values;
+	/** Creates a new map backed by a slice of two parallel arrays, the first of which must be sorted and contain distinct keys. */
+	protected Object2BooleanSortedArrayMap(final Object[] key, final boolean[] value, final int from, final int to, final Comparator <? super K> comparator) {
+	 this.key = key;
+	 this.value = value;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new map using the given parallel arrays, after sorting them by key.
+	 *
+	 * @param key an array of distinct keys, which will be modified by this constructor.
+	 * @param value an array of values, which will be modified by this constructor.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether {@code key} is already sorted.
+	 * @throws IllegalArgumentException if {@code key} and {@code value} have different lengths, or {@code key} contains duplicates.
+	 */
+	private Object2BooleanSortedArrayMap(final Object[] key, final boolean[] value, final Comparator <? super K> comparator, final boolean sorted) {
+	 this(key, value, 0, key.length, comparator);
+	 if (key.length != value.length) throw new IllegalArgumentException("Keys and values have different lengths (" + key.length + ", " + value.length + ")");
+	 if (! sorted) sort();
+	}
+	/** Sorts the backing arrays by key.
+	 *
+	 * @throws IllegalArgumentException if the keys contain duplicates.
+	 */
+	private void sort() {
+	 final Object[] key = this.key;
+	 final boolean[] value = this.value;
+	 it.unimi.dsi.fastutil.Arrays.quickSort(from, to, this::compareAt, (i, j) -> {
+	  final Object k = key[i];
+	  key[i] = key[j];
+	  key[j] = k;
+	  final boolean v = value[i];
+	  value[i] = value[j];
+	  value[j] = v;
+	 });
+	 for (int i = from + 1; i < to; i++) if (compareAt(i - 1, i) == 0) throw new IllegalArgumentException("Duplicate key: " + key[i]);
+	}
+	/** Creates a new map using the elements of two parallel arrays and a given comparator.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Object2BooleanSortedArrayMap(final K[] k, final boolean[] v, final Comparator<? super K> c) {
+	 this(k.clone(), v.clone(), asComparator(c), false);
+	}
+	/** Creates a new map using the elements of two parallel arrays.
+	 *
+	 * @param k the array of keys of the new map, which must not contain duplicates.
+	 * @param v the array of corresponding values in the new map.
+	 * @throws IllegalArgumentException if {@code k} and {@code v} have different lengths, or {@code k} contains duplicates.
+	 */
+	public Object2BooleanSortedArrayMap(final K[] k, final boolean[] v) {
+	 this(k, v, null);
+	}
+	/** Creates a new map copying a given type-specific map.
+	 *
+	 * @param m a type-specific map to be copied into the new map.
+	 */
+	public Object2BooleanSortedArrayMap(final Object2BooleanMap <? extends K> m) {
+	 this(new Object[m.size()], new boolean[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given type-specific sorted map (and its comparator).
+	 *
+	 * @param m a type-specific sorted map to be copied into the new map.
+	 */
+	public Object2BooleanSortedArrayMap(final Object2BooleanSortedMap <K> m) {
+	 this(new Object[m.size()], new boolean[m.size()], m.comparator(), true);
+	 int i = 0;
+	 for (final Object2BooleanMap.Entry <K> e : m.object2BooleanEntrySet()) {
+	  key[i] = e.getKey();
+	  value[i++] = e.getBooleanValue();
+	 }
+	}
+	/** Creates a new map copying a given map.
+	 *
+	 * @param m a {@link Map} to be copied into the new map.
+	 */
+	public Object2BooleanSortedArrayMap(final Map<? extends K, ? extends Boolean> m) {
+	 this(new Object[m.size()], new boolean[m.size()], null, true);
+	 copy(m);
+	 sort();
+	}
+	/** Creates a new map copying a given sorted map (and its comparator).
+	 *
+	 * @param m a {@link SortedMap} to be copied into the new map.
+	 */
+	public Object2BooleanSortedArrayMap(final SortedMap<K, Boolean> m) {
+	 this(new Object[m.size()], new boolean[m.size()], asComparator(m.comparator()), true);
+	 int i = 0;
+	 for (final Map.Entry<K, Boolean> e : m.entrySet()) {
+	  key[i] = (e.getKey());
+	  value[i++] = (e.getValue()).booleanValue();
+	 }
+	}
+	/** Fills the backing arrays with the entries of a map. */
+	@SuppressWarnings("unchecked")
+	private void copy(final Map<? extends K, ? extends Boolean> m) {
+	 int i = 0;
+	 if (m instanceof Object2BooleanMap) {
+	  for (final Object2BooleanMap.Entry <? extends K> e : ((Object2BooleanMap <? extends K>)m).object2BooleanEntrySet()) {
+	   key[i] = e.getKey();
+	   value[i++] = e.getBooleanValue();
+	  }
+	 }
+	 else {
+	  for (final Map.Entry<? extends K, ? extends Boolean> e : m.entrySet()) {
+	   key[i] = (e.getKey());
+	   value[i++] = (e.getValue()).booleanValue();
+	  }
+	 }
+	}
+	private static <K> Comparator <? super K> asComparator(final Comparator<? super K> c) {
+	 return c;
+	}
+	/** Compares the keys at two given positions of the backing array. */
+	@SuppressWarnings("unchecked")
+	private int compareAt(final int i, final int j) {
+	 return comparator == null ? ( ((Comparable<K>)((K) key[i])).compareTo((K) key[j]) ) : comparator.compare((K) key[i], (K) key[j]);
+	}
+	@SuppressWarnings("unchecked")
+	private int compare(final K k1, final K k2) {
+	 return comparator == null ? ( ((Comparable<K>)(k1)).compareTo(k2) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first key of this map greater than or equal to a given key, or {@link #to}. */
+	private int lowerBound(final K k) {
+	 return ObjectSortedArraySet.lowerBound(key, from, to, k, comparator);
+	}
+	/** Returns the index of a given key in the backing array, or -1 if the key is not in this map. */
+	@SuppressWarnings("unchecked")
+	private int findKey(final K k) {
+	 final int i = lowerBound(k);
+	 return i < to && compare((K) key[i], k) == 0 ? i : -1;
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public boolean getBoolean(final Object k) {
+	 final int i = findKey((K) k);
+	 return i == -1 ? defRetValue : value[i];
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public boolean containsKey(final Object k) {
+	 return findKey((K) k) != -1;
+	}
+	@Override
+	public boolean containsValue(final boolean v) {
+	 for (int i = from; i < to; i++) if (( (value[i]) == (v) )) return true;
+	 return false;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public K firstKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return (K) key[from];
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public K lastKey() {
+	 if (from == to) throw new NoSuchElementException();
+	 return (K) key[to - 1];
+	}
+	@Override
+	public Comparator <? super K> comparator() {
+	 return comparator;
+	}
+	/** Returns a view on a range of this map sharing its default return value.
+	 *
+	 * @param from the start of the range in the backing arrays (inclusive).
+	 * @param to the end of the range in the backing arrays (exclusive).
+	 * @return a view on the given range.
+	 */
+	private Object2BooleanSortedArrayMap <K> view(final int from, final int to) {
+	 final Object2BooleanSortedArrayMap <K> m = new Object2BooleanSortedArrayMap <>(key, value, from, to, comparator);
+	 m.defRetValue = defRetValue;
+	 return m;
+	}
+	@Override
+	public Object2BooleanSortedMap <K> headMap(final K to) {
+	 return view(from, lowerBound(to));
+	}
+	@Override
+	public Object2BooleanSortedMap <K> tailMap(final K from) {
+	 return view(lowerBound(from), to);
+	}
+	@Override
+	public Object2BooleanSortedMap <K> subMap(final K from, final K to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start key (" + from + ") is larger than end key (" + to + ")");
+	 return view(lowerBound(from), lowerBound(to));
+	}
+	@Override
+	public ObjectSortedSet <K> keySet() {
+	 if (keys == null) keys = new ObjectSortedArraySet <>(key, from, to, comparator);
+	 return keys;
+	}
+	@Override
+	public BooleanCollection values() {
+	 if (values == null) values = new AbstractBooleanCollection () {
+	  @Override
+	  public boolean contains(final boolean v) {
+	   return containsValue(v);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.booleans.BooleanIterator iterator() {
+	   return it.unimi.dsi.fastutil.booleans.BooleanIterators.wrap( value, from, to - from);
+	  }
+	  @Override
+	 
+	  public it.unimi.dsi.fastutil.booleans.BooleanSpliterator spliterator() {
+	   return it.unimi.dsi.fastutil.booleans.BooleanSpliterators.wrap( value, from, to - from, java.util.Spliterator.IMMUTABLE);
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	 };
+	 return values;
+	}
+	/** A bidirectional iterator on the entries of a slice of the backing arrays. */
+	private final class EntryIterator implements ObjectBidirectionalIterator<Object2BooleanMap.Entry <K> > {
+	 /** The index of the next entry to be returned. */
+	 int pos;
+	 EntryIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 public Object2BooleanMap.Entry <K> next() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return new AbstractObject2BooleanMap.BasicEntry <>((K) key[pos], value[pos++]);
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 public Object2BooleanMap.Entry <K> previous() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  --pos;
+	  return new AbstractObject2BooleanMap.BasicEntry <>((K) key[pos], value[pos]);
+	 }
+	}
+	/** A spliterator on the entries of a slice of the backing arrays. */
+	private final class EntrySpliterator extends ObjectSpliterators.EarlyBindingSizeIndexBasedSpliterator<Object2BooleanMap.Entry <K> > implements ObjectSpliterator<Object2BooleanMap.Entry <K> > {
+	 EntrySpliterator(final int pos, final int maxPos) {
+	  super(pos, maxPos);
+	 }
+	 @Override
+	 public int characteristics() {
+	  return ObjectSpliterators.SORTED_SET_SPLITERATOR_CHARACTERISTICS | java.util.Spliterator.SUBSIZED | java.util.Spliterator.IMMUTABLE;
+	 }
+	 @Override
+	 public Comparator<? super Object2BooleanMap.Entry <K> > getComparator() {
+	  return object2BooleanEntrySet().comparator();
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 protected Object2BooleanMap.Entry <K> get(final int location) {
+	  return new AbstractObject2BooleanMap.BasicEntry <>((K) key[location], value[location]);
+	 }
+	 @Override
+	 protected EntrySpliterator makeForSplit(final int pos, final int maxPos) {
+	  return new EntrySpliterator(pos, maxPos);
+	 }
+	}
+	@Override
+	public ObjectSortedSet<Object2BooleanMap.Entry <K> > object2BooleanEntrySet() {
+	 if (entries == null) entries = new AbstractObjectSortedSet<Object2BooleanMap.Entry <K> >() {
+	  final Comparator<? super Object2BooleanMap.Entry <K> > comparator = (x, y) -> Object2BooleanSortedArrayMap.this.compare(x.getKey(), y.getKey());
+	  @Override
+	  public Comparator<? super Object2BooleanMap.Entry <K> > comparator() {
+	   return comparator;
+	  }
+	  @Override
+	  public ObjectBidirectionalIterator<Object2BooleanMap.Entry <K> > iterator() {
+	   return new EntryIterator(from);
+	  }
+	  @Override
+	  @SuppressWarnings("unchecked")
+	  public ObjectBidirectionalIterator<Object2BooleanMap.Entry <K> > iterator(final Object2BooleanMap.Entry <K> from) {
+	   int i = lowerBound(from.getKey());
+	   if (i < to && compare((K) key[i], from.getKey()) == 0) i++;
+	   return new EntryIterator(i);
+	  }
+	  @Override
+	  public ObjectSpliterator<Object2BooleanMap.Entry <K> > spliterator() {
+	   return new EntrySpliterator(from, to);
+	  }
+	  @Override
+	  @SuppressWarnings("unchecked")
+	  public boolean contains(final Object o) {
+	   if (! (o instanceof Map.Entry)) return false;
+	   final Map.Entry<?,?> e = (Map.Entry<?,?>)o;
+	   if (e.getValue() == null || ! (e.getValue() instanceof Boolean)) return false;
+	   final int i = findKey(((K) e.getKey()));
+	   return i != -1 && ( (value[i]) == (((Boolean)(e.getValue())).booleanValue()) );
+	  }
+	  @Override
+	  public int size() {
+	   return to - from;
+	  }
+	  @Override
+	  public void clear() {
+	   throw new UnsupportedOperationException();
+	  }
+	  @Override
+	  public Object2BooleanMap.Entry <K> first() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(from).next();
+	  }
+	  @Override
+	  public Object2BooleanMap.Entry <K> last() {
+	   if (from == to) throw new NoSuchElementException();
+	   return new EntryIterator(to).previous();
+	  }
+	  @Override
+	  public ObjectSortedSet<Object2BooleanMap.Entry <K> > subSet(final Object2BooleanMap.Entry <K> from, final Object2BooleanMap.Entry <K> to) {
+	   return subMap(from.getKey(), to.getKey()).object2BooleanEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Object2BooleanMap.Entry <K> > headSet(final Object2BooleanMap.Entry <K> to) {
+	   return headMap(to.getKey()).object2BooleanEntrySet();
+	  }
+	  @Override
+	  public ObjectSortedSet<Object2BooleanMap.Entry <K> > tailSet(final Object2BooleanMap.Entry <K> from) {
+	   return tailMap(from.getKey()).object2BooleanEntrySet();
+	  }
+	 };
+	 return entries;
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) {
+	  s.writeObject(key[i]);
+	  s.writeBoolean(value[i]);
+	 }
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 key = new Object[to];
+	 value = new boolean[to];
+	 for (int i = 0; i < to; i++) {
+	  key[i] = s.readObject();
+	  value[i] = s.readBoolean();
+	 }
+	}
+}
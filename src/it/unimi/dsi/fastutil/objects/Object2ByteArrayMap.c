@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET ObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ByteOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Object2ByteOpenDoubleHashMap
 #define ARRAY_SET ObjectArraySet
 #define ARRAY_MAP Object2ByteArrayMap
 #define LINKED_OPEN_HASH_SET ObjectLinkedOpenHashSet
 #define AVL_TREE_SET ObjectAVLTreeSet
 #define RB_TREE_SET ObjectRBTreeSet
+#define BTREE_SET ObjectBTreeSet
+#define PERSISTENT_TREE_SET ObjectPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ObjectConcurrentSkipListSet
+#define SORTED_ARRAY_SET ObjectSortedArraySet
 #define AVL_TREE_MAP Object2ByteAVLTreeMap
 #define RB_TREE_MAP Object2ByteRBTreeMap
+#define BTREE_MAP Object2ByteBTreeMap
+#define PERSISTENT_TREE_MAP Object2BytePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Object2ByteConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Object2ByteSortedArrayMap
+#define CACHE Object2ByteCache
+#define STATIC_FUNCTION Object2ByteStaticFunction
+#define BLOOM_FILTER ObjectBloomFilter
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
 #define MAPPED_BIG_LIST ObjectMappedBigList
 #define ARRAY_FRONT_CODED_LIST ObjectArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ObjectArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ObjectEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ObjectEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ObjectHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ObjectHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ObjectHeapIndirectPriorityQueue
@@ -26,6 +26,9 @@ import it.unimi.dsi.fastutil.bytes.ByteConsumer ;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of pairs: just put them into two parallel arrays and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several keys per iteration without short-circuiting, so that there
+	* is a single branch per block of keys.
 	*/
 public class Object2ByteArrayMap <K> extends AbstractObject2ByteMap <K> implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -264,15 +267,15 @@ public class Object2ByteArrayMap <K> extends AbstractObject2ByteMap <K> implemen
 	}
 	private int findKey(final Object k) {
 	 final Object[] key = this.key;
-	 for(int i = size; i-- != 0;) if (java.util.Objects.equals(key[i], k)) return i;
+	 int i = size;
+	 while(i-- != 0) if (java.util.Objects.equals(key[i], k)) return i;
 	 return -1;
 	}
 	@Override
 
 	public byte getByte(final Object k) {
-	 final Object[] key = this.key;
-	 for(int i = size; i-- != 0;) if (java.util.Objects.equals(key[i], k)) return value[i];
-	 return defRetValue;
+	 final int i = findKey(k);
+	 return i == -1 ? defRetValue : value[i];
 	}
 	@Override
 	public int size() { return size; }
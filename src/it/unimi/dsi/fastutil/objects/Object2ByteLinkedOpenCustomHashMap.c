@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2ByteLinkedOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ByteLinkedOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ByteLinkedOpenCustomDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ByteAVLTreeMap
 #define RB_TREE_MAP Object2ByteRBTreeMap
+#define CACHE Object2ByteCache
+#define STATIC_FUNCTION Object2ByteStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
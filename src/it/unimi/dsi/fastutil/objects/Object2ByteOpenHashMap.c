@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ByteOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ByteAVLTreeMap
 #define RB_TREE_MAP Object2ByteRBTreeMap
+#define CACHE Object2ByteCache
+#define STATIC_FUNCTION Object2ByteStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2CharLinkedOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2CharLinkedOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2CharOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2CharLinkedOpenCustomDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2CharAVLTreeMap
 #define RB_TREE_MAP Object2CharRBTreeMap
+#define CACHE Object2CharCache
+#define STATIC_FUNCTION Object2CharStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
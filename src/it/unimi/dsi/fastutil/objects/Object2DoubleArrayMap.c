@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET ObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2DoubleOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2DoubleOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2DoubleOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedObjectOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Object2DoubleOpenDoubleHashMap
 #define ARRAY_SET ObjectArraySet
 #define ARRAY_MAP Object2DoubleArrayMap
 #define LINKED_OPEN_HASH_SET ObjectLinkedOpenHashSet
 #define AVL_TREE_SET ObjectAVLTreeSet
 #define RB_TREE_SET ObjectRBTreeSet
+#define BTREE_SET ObjectBTreeSet
+#define PERSISTENT_TREE_SET ObjectPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ObjectConcurrentSkipListSet
+#define SORTED_ARRAY_SET ObjectSortedArraySet
 #define AVL_TREE_MAP Object2DoubleAVLTreeMap
 #define RB_TREE_MAP Object2DoubleRBTreeMap
+#define BTREE_MAP Object2DoubleBTreeMap
+#define PERSISTENT_TREE_MAP Object2DoublePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Object2DoubleConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Object2DoubleSortedArrayMap
+#define CACHE Object2DoubleCache
+#define STATIC_FUNCTION Object2DoubleStaticFunction
+#define BLOOM_FILTER ObjectBloomFilter
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
 #define MAPPED_BIG_LIST ObjectMappedBigList
 #define ARRAY_FRONT_CODED_LIST ObjectArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ObjectArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ObjectEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ObjectEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ObjectHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ObjectHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ObjectHeapIndirectPriorityQueue
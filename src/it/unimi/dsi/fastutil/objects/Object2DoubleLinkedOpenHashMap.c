@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2DoubleLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2DoubleAVLTreeMap
 #define RB_TREE_MAP Object2DoubleRBTreeMap
+#define CACHE Object2DoubleCache
+#define STATIC_FUNCTION Object2DoubleStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
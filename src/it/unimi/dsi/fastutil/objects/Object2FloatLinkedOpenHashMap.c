@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2FloatLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2FloatAVLTreeMap
 #define RB_TREE_MAP Object2FloatRBTreeMap
+#define CACHE Object2FloatCache
+#define STATIC_FUNCTION Object2FloatStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
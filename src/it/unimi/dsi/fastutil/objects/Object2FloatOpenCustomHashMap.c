@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ObjectOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2FloatOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2FloatAVLTreeMap
 #define RB_TREE_MAP Object2FloatRBTreeMap
+#define CACHE Object2FloatCache
+#define STATIC_FUNCTION Object2FloatStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
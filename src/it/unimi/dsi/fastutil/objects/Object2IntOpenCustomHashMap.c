@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ObjectOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2IntOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2IntAVLTreeMap
 #define RB_TREE_MAP Object2IntRBTreeMap
+#define CACHE Object2IntCache
+#define STATIC_FUNCTION Object2IntStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2LongLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2LongAVLTreeMap
 #define RB_TREE_MAP Object2LongRBTreeMap
+#define CACHE Object2LongCache
+#define STATIC_FUNCTION Object2LongStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -326,6 +326,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ObjectLinkedOpenDoubleHashMap
@@ -336,6 +338,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ObjectAVLTreeMap
 #define RB_TREE_MAP Object2ObjectRBTreeMap
+#define CACHE Object2ObjectCache
+#define STATIC_FUNCTION Object2ObjectStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
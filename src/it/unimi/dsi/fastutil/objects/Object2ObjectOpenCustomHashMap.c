@@ -312,6 +312,8 @@
 #define OPEN_HASH_BIG_SET ObjectOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2ObjectOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ObjectOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ObjectOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ObjectOpenCustomDoubleHashMap
@@ -322,6 +324,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ObjectAVLTreeMap
 #define RB_TREE_MAP Object2ObjectRBTreeMap
+#define CACHE Object2ObjectCache
+#define STATIC_FUNCTION Object2ObjectStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -326,6 +326,8 @@
 #define OPEN_HASH_BIG_SET ObjectLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Object2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ReferenceLinkedOpenDoubleHashMap
@@ -336,6 +338,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ReferenceAVLTreeMap
 #define RB_TREE_MAP Object2ReferenceRBTreeMap
+#define CACHE Object2ReferenceCache
+#define STATIC_FUNCTION Object2ReferenceStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
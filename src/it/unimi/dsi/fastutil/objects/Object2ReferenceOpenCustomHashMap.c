@@ -312,6 +312,8 @@
 #define OPEN_HASH_BIG_SET ObjectOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ObjectOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Object2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Object2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Object2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Object2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedObject2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Object2ReferenceOpenCustomDoubleHashMap
@@ -322,6 +324,8 @@
 #define RB_TREE_SET ObjectRBTreeSet
 #define AVL_TREE_MAP Object2ReferenceAVLTreeMap
 #define RB_TREE_MAP Object2ReferenceRBTreeMap
+#define CACHE Object2ReferenceCache
+#define STATIC_FUNCTION Object2ReferenceStaticFunction
 #define ARRAY_LIST ObjectArrayList
 #define IMMUTABLE_LIST ObjectImmutableList
 #define BIG_ARRAY_BIG_LIST ObjectBigArrayBigList
@@ -23,6 +23,9 @@ import java.util.function.Consumer;
 	* <p>The main purpose of this
 	* implementation is that of wrapping cleanly the brute-force approach to the storage of a very
 	* small number of items: just put them into an array and scan linearly to find an item.
+	*
+	* <p>Scans of primitive keys test several elements per iteration without short-circuiting, so that there
+	* is a single branch per block of elements.
 	*/
 public class ObjectArraySet <K> extends AbstractObjectSet <K> implements java.io.Serializable, Cloneable {
 	private static final long serialVersionUID = 1L;
@@ -156,7 +159,9 @@ public class ObjectArraySet <K> extends AbstractObjectSet <K> implements java.io
 	 return new ObjectArraySet <K>(a);
 	}
 	private int findKey(final Object o) {
-	 for(int i = size; i-- != 0;) if (java.util.Objects.equals(a[i], o)) return i;
+	 final Object[] a = this.a;
+	 int i = size;
+	 while(i-- != 0) if (java.util.Objects.equals(a[i], o)) return i;
 	 return -1;
 	}
 	// TODO Maybe make this return a list-iterator like the LinkedXHashSets do?
@@ -0,0 +1,301 @@
+/*
+	* Copyright (C) 2022 Sebastiano Vigna
+	*
+	* Licensed under the Apache License, Version 2.0 (the "License");
+	* you may not use this file except in compliance with the License.
+	* You may obtain a copy of the License at
+	*
+	*     http://www.apache.org/licenses/LICENSE-2.0
+	*
+	* Unless required by applicable law or agreed to in writing, software
+	* distributed under the License is distributed on an "AS IS" BASIS,
+	* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+	* See the License for the specific language governing permissions and
+	* limitations under the License.
+	*/
+package it.unimi.dsi.fastutil.objects;
+import java.util.Collection;
+import java.util.Comparator;
+import java.util.NoSuchElementException;
+import java.util.SortedSet;
+import java.util.Spliterator;
+/** An immutable sorted set based on a sorted backing array.
+	*
+	* <p>Instances of this class keep their elements sorted in a single array, so they use much less memory
+	* than a tree-based set, and scan much faster. Lookups use a branchless binary search, preceded,
+	* for integral elements in their natural order, by a few rounds of interpolation search.
+	* Subsets are views over a slice of the backing array, and they are created in logarithmic
+	* time without copying any element.
+	*
+	* <p>All mutators throw an {@link UnsupportedOperationException}.
+	*
+	* <p>The iterators provided by this class are type-specific {@linkplain
+	* it.unimi.dsi.fastutil.BidirectionalIterator bidirectional iterators}.
+	*/
+public class ObjectSortedArraySet <K> extends AbstractObjectSortedSet <K> implements java.io.Serializable {
+	private static final long serialVersionUID = 0L;
+	/** The backing array (valid from {@link #from}, inclusive, to {@link #to}, exclusive). */
+	protected transient Object[] a;
+	/** The index of the first element of this set in {@link #a}. */
+	protected transient int from;
+	/** The index after the last element of this set in {@link #a}. */
+	protected transient int to;
+	/** The comparator used to sort {@link #a}, or {@code null} for the natural order. */
+	protected Comparator <? super K> comparator;
+	/** Creates a new set backed by a slice of a sorted array containing distinct elements. */
+	protected ObjectSortedArraySet(final Object[] a, final int from, final int to, final Comparator <? super K> comparator) {
+	 this.a = a;
+	 this.from = from;
+	 this.to = to;
+	 this.comparator = comparator;
+	}
+	/** Creates a new set using the given array, after sorting it and removing duplicates.
+	 *
+	 * @param a an array, which will be modified by this constructor.
+	 * @param size the number of valid elements in {@code a}.
+	 * @param comparator a type-specific comparator, or {@code null} for the natural order.
+	 * @param sorted whether the first {@code size} elements of {@code a} are already sorted and distinct.
+	 */
+	@SuppressWarnings("unchecked")
+	private ObjectSortedArraySet(final Object[] a, int size, final Comparator <? super K> comparator, final boolean sorted) {
+	 this.comparator = comparator;
+	 if (! sorted && size > 1) {
+	  if (comparator == null) ObjectArrays.quickSort(a, 0, size);
+	  else ObjectArrays.quickSort(a, 0, size, (Comparator<Object>)comparator);
+	  int j = 0;
+	  for (int i = 1; i < size; i++) if (compare((K) a[j], (K) a[i]) != 0) a[++j] = a[i];
+	  size = j + 1;
+	 }
+	 this.a = ObjectArrays.trim(a, size);
+	 this.from = 0;
+	 this.to = size;
+	}
+	/** Creates a new set containing the elements of an array, using a given comparator.
+	 *
+	 * @param a an array.
+	 * @param c a {@link Comparator} (even better, a type-specific comparator), or {@code null} for the natural order.
+	 */
+	public ObjectSortedArraySet(final K[] a, final Comparator<? super K> c) {
+	 this(a.clone(), a.length, asComparator(c), false);
+	}
+	/** Creates a new set containing the elements of an array.
+	 *
+	 * @param a an array.
+	 */
+	public ObjectSortedArraySet(final K[] a) {
+	 this(a, null);
+	}
+	/** Creates a new set copying a given type-specific collection.
+	 *
+	 * @param c a type-specific collection.
+	 */
+	public ObjectSortedArraySet(final ObjectCollection <? extends K> c) {
+	 this(c.toArray(), c.size(), null, false);
+	}
+	/** Creates a new set copying a given collection.
+	 *
+	 * @param c a collection.
+	 */
+	public ObjectSortedArraySet(final Collection<? extends K> c) {
+	 this(toKeyArray(c), c.size(), null, false);
+	}
+	/** Creates a new set copying a given type-specific sorted set (and its comparator).
+	 *
+	 * @param s a type-specific sorted set.
+	 */
+	public ObjectSortedArraySet(final ObjectSortedSet <K> s) {
+	 this(s.toArray(), s.size(), s.comparator(), true);
+	}
+	/** Creates a new set copying a given sorted set (and its comparator).
+	 *
+	 * @param s a sorted set.
+	 */
+	public ObjectSortedArraySet(final SortedSet<K> s) {
+	 this(toKeyArray(s), s.size(), asComparator(s.comparator()), true);
+	}
+	private static <K> Comparator <? super K> asComparator(final Comparator<? super K> c) {
+	 return c;
+	}
+	private static <K> Object[] toKeyArray(final Collection<? extends K> c) {
+	 return c.toArray();
+	}
+	@SuppressWarnings("unchecked")
+	final int compare(final K k1, final K k2) {
+	 return comparator == null ? ( ((Comparable<K>)(k1)).compareTo(k2) ) : comparator.compare(k1, k2);
+	}
+	/** Returns the index of the first element of this set greater than or equal to a given key.
+	 *
+	 * @param k a key.
+	 * @return the index in {@link #a} of the first element of this set greater than or equal to {@code k}, or {@link #to}.
+	 */
+	@SuppressWarnings("unchecked")
+	final int lowerBound(final K k) {
+	 return lowerBound(a, from, to, k, comparator);
+	}
+	/** Returns the index of the first element of a sorted array slice greater than or equal to a given key.
+	 *
+	 * <p>The search is branchless. For integral keys in their natural order, a few rounds of
+	 * interpolation search narrow the range first, which for uniformly distributed keys
+	 * brings the range down to a handful of elements.
+	 *
+	 * @param a a sorted array.
+	 * @param from the first index of the slice (inclusive).
+	 * @param to the last index of the slice (exclusive).
+	 * @param k a key.
+	 * @param comparator the comparator used to sort {@code a}, or {@code null} for the natural order.
+	 * @return the index of the first element of the slice greater than or equal to {@code k}, or {@code to}.
+	 */
+	@SuppressWarnings("unchecked")
+	static <K> int lowerBound(final Object[] a, int from, final int to, final K k, final Comparator <? super K> comparator) {
+	 int n = to - from;
+	 if (n == 0) return from;
+	 if (comparator == null) {
+	  while (n > 1) {
+	   final int half = n >>> 1;
+	   from = ( ((Comparable<K>)((K) a[from + half])).compareTo(k) < 0 ) ? from + half : from;
+	   n -= half;
+	  }
+	  return ( ((Comparable<K>)((K) a[from])).compareTo(k) < 0 ) ? from + 1 : from;
+	 }
+	 while (n > 1) {
+	  final int half = n >>> 1;
+	  from = comparator.compare((K) a[from + half], k) < 0 ? from + half : from;
+	  n -= half;
+	 }
+	 return comparator.compare((K) a[from], k) < 0 ? from + 1 : from;
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public boolean contains(final Object k) {
+	 final int i = lowerBound((K) k);
+	 return i < to && compare((K) a[i], (K) k) == 0;
+	}
+	@Override
+	public int size() {
+	 return to - from;
+	}
+	@Override
+	public boolean isEmpty() {
+	 return from == to;
+	}
+	@Override
+	public void clear() {
+	 throw new UnsupportedOperationException();
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public K first() {
+	 if (from == to) throw new NoSuchElementException();
+	 return (K) a[from];
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public K last() {
+	 if (from == to) throw new NoSuchElementException();
+	 return (K) a[to - 1];
+	}
+	@Override
+	public Comparator <? super K> comparator() {
+	 return comparator;
+	}
+	/** An iterator on a slice of the backing array. */
+	private final class SetIterator implements ObjectBidirectionalIterator <K> {
+	 /** The index of the next element to be returned. */
+	 int pos;
+	 SetIterator(final int pos) {
+	  this.pos = pos;
+	 }
+	 @Override
+	 public boolean hasNext() {
+	  return pos < to;
+	 }
+	 @Override
+	 public boolean hasPrevious() {
+	  return pos > from;
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 public K next() {
+	  if (! hasNext()) throw new NoSuchElementException();
+	  return (K) a[pos++];
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 public K previous() {
+	  if (! hasPrevious()) throw new NoSuchElementException();
+	  return (K) a[--pos];
+	 }
+	 @Override
+	 @SuppressWarnings("unchecked")
+	 public void forEachRemaining(final Consumer <? super K> action) {
+	  final Object[] a = ObjectSortedArraySet.this.a;
+	  for (final int max = to; pos < max;) action.accept((K) a[pos++]);
+	 }
+	 @Override
+	 public int skip(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, to - pos);
+	  pos += skipped;
+	  return skipped;
+	 }
+	 @Override
+	 public int back(final int n) {
+	  if (n < 0) throw new IllegalArgumentException("Argument must be nonnegative: " + n);
+	  final int skipped = Math.min(n, pos - from);
+	  pos -= skipped;
+	  return skipped;
+	 }
+	}
+	@Override
+	public ObjectBidirectionalIterator <K> iterator() {
+	 return new SetIterator(from);
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public ObjectBidirectionalIterator <K> iterator(final K from) {
+	 int i = lowerBound(from);
+	 if (i < to && compare((K) a[i], from) == 0) i++;
+	 return new SetIterator(i);
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public ObjectSpliterator <K> spliterator() {
+	 return ObjectSpliterators.wrapPreSorted((K[]) a, from, to - from, Spliterator.DISTINCT | Spliterator.IMMUTABLE, comparator);
+	}
+	@Override
+	@SuppressWarnings("unchecked")
+	public void forEach(final Consumer <? super K> action) {
+	 final Object[] a = this.a;
+	 for (int i = from, max = to; i < max; i++) action.accept((K) a[i]);
+	}
+	@Override
+	public ObjectSortedSet <K> headSet(final K to) {
+	 return new ObjectSortedArraySet <>(a, from, lowerBound(to), comparator);
+	}
+	@Override
+	public ObjectSortedSet <K> tailSet(final K from) {
+	 return new ObjectSortedArraySet <>(a, lowerBound(from), to, comparator);
+	}
+	@Override
+	public ObjectSortedSet <K> subSet(final K from, final K to) {
+	 if (compare(from, to) > 0) throw new IllegalArgumentException("Start element (" + from + ") is larger than end element (" + to + ")");
+	 return new ObjectSortedArraySet <>(a, lowerBound(from), lowerBound(to), comparator);
+	}
+	@Override
+	public Object[] toArray() {
+	 // A subtle part of the spec says the returned array must be Object[] exactly.
+	 return java.util.Arrays.copyOfRange(a, from, to, Object[].class);
+	}
+	private void writeObject(java.io.ObjectOutputStream s) throws java.io.IOException {
+	 s.defaultWriteObject();
+	 s.writeInt(to - from);
+	 for (int i = from; i < to; i++) s.writeObject(a[i]);
+	}
+	private void readObject(java.io.ObjectInputStream s) throws java.io.IOException, ClassNotFoundException {
+	 s.defaultReadObject();
+	 to = s.readInt();
+	 from = 0;
+	 a = new Object[to];
+	 for (int i = 0; i < to; i++) a[i] = s.readObject();
+	}
+}
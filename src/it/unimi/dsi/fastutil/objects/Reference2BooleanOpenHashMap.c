@@ -314,6 +314,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2BooleanOpenDoubleHashMap
@@ -324,6 +326,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2BooleanAVLTreeMap
 #define RB_TREE_MAP Reference2BooleanRBTreeMap
+#define CACHE Reference2BooleanCache
+#define STATIC_FUNCTION Reference2BooleanStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
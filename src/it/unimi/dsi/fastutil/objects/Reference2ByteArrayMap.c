@@ -315,22 +315,38 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ByteOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedReferenceOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Reference2ByteOpenDoubleHashMap
 #define ARRAY_SET ReferenceArraySet
 #define ARRAY_MAP Reference2ByteArrayMap
 #define LINKED_OPEN_HASH_SET ReferenceLinkedOpenHashSet
 #define AVL_TREE_SET ReferenceAVLTreeSet
 #define RB_TREE_SET ReferenceRBTreeSet
+#define BTREE_SET ReferenceBTreeSet
+#define PERSISTENT_TREE_SET ReferencePersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ReferenceConcurrentSkipListSet
+#define SORTED_ARRAY_SET ReferenceSortedArraySet
 #define AVL_TREE_MAP Reference2ByteAVLTreeMap
 #define RB_TREE_MAP Reference2ByteRBTreeMap
+#define BTREE_MAP Reference2ByteBTreeMap
+#define PERSISTENT_TREE_MAP Reference2BytePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Reference2ByteConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Reference2ByteSortedArrayMap
+#define CACHE Reference2ByteCache
+#define STATIC_FUNCTION Reference2ByteStaticFunction
+#define BLOOM_FILTER ReferenceBloomFilter
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
 #define MAPPED_BIG_LIST ReferenceMappedBigList
 #define ARRAY_FRONT_CODED_LIST ReferenceArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ReferenceArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ReferenceEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ReferenceEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ObjectHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ObjectHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ObjectHeapIndirectPriorityQueue
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ByteLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ByteAVLTreeMap
 #define RB_TREE_MAP Reference2ByteRBTreeMap
+#define CACHE Reference2ByteCache
+#define STATIC_FUNCTION Reference2ByteStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2ByteOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ByteOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ByteOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ByteAVLTreeMap
 #define RB_TREE_MAP Reference2ByteRBTreeMap
+#define CACHE Reference2ByteCache
+#define STATIC_FUNCTION Reference2ByteStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
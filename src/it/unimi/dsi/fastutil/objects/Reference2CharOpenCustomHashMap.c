@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2CharOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2CharOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2CharOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2CharOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2CharAVLTreeMap
 #define RB_TREE_MAP Reference2CharRBTreeMap
+#define CACHE Reference2CharCache
+#define STATIC_FUNCTION Reference2CharStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2DoubleLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2DoubleAVLTreeMap
 #define RB_TREE_MAP Reference2DoubleRBTreeMap
+#define CACHE Reference2DoubleCache
+#define STATIC_FUNCTION Reference2DoubleStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
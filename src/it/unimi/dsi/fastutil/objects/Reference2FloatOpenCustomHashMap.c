@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2FloatOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2FloatAVLTreeMap
 #define RB_TREE_MAP Reference2FloatRBTreeMap
+#define CACHE Reference2FloatCache
+#define STATIC_FUNCTION Reference2FloatStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2IntOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2IntAVLTreeMap
 #define RB_TREE_MAP Reference2IntRBTreeMap
+#define CACHE Reference2IntCache
+#define STATIC_FUNCTION Reference2IntStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2LongLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2LongLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2LongOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2LongLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2LongAVLTreeMap
 #define RB_TREE_MAP Reference2LongRBTreeMap
+#define CACHE Reference2LongCache
+#define STATIC_FUNCTION Reference2LongStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2LongOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2LongOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2LongOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2LongOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2LongAVLTreeMap
 #define RB_TREE_MAP Reference2LongRBTreeMap
+#define CACHE Reference2LongCache
+#define STATIC_FUNCTION Reference2LongStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -326,6 +326,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ObjectLinkedOpenDoubleHashMap
@@ -336,6 +338,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ObjectAVLTreeMap
 #define RB_TREE_MAP Reference2ObjectRBTreeMap
+#define CACHE Reference2ObjectCache
+#define STATIC_FUNCTION Reference2ObjectStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -312,6 +312,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2ObjectOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ObjectOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ObjectOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ObjectOpenCustomDoubleHashMap
@@ -322,6 +324,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ObjectAVLTreeMap
 #define RB_TREE_MAP Reference2ObjectRBTreeMap
+#define CACHE Reference2ObjectCache
+#define STATIC_FUNCTION Reference2ObjectStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -326,6 +326,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ReferenceLinkedOpenDoubleHashMap
@@ -336,6 +338,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ReferenceAVLTreeMap
 #define RB_TREE_MAP Reference2ReferenceRBTreeMap
+#define CACHE Reference2ReferenceCache
+#define STATIC_FUNCTION Reference2ReferenceStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
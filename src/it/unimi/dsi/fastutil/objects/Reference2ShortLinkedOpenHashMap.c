@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ReferenceLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Reference2ShortLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ShortCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ShortLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ShortLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ShortOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ShortLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ShortAVLTreeMap
 #define RB_TREE_MAP Reference2ShortRBTreeMap
+#define CACHE Reference2ShortCache
+#define STATIC_FUNCTION Reference2ShortStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ReferenceOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ReferenceOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Reference2ShortOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Reference2ShortCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Reference2ShortLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Reference2ShortOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedReference2ShortOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Reference2ShortOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ReferenceRBTreeSet
 #define AVL_TREE_MAP Reference2ShortAVLTreeMap
 #define RB_TREE_MAP Reference2ShortRBTreeMap
+#define CACHE Reference2ShortCache
+#define STATIC_FUNCTION Reference2ShortStaticFunction
 #define ARRAY_LIST ReferenceArrayList
 #define IMMUTABLE_LIST ReferenceImmutableList
 #define BIG_ARRAY_BIG_LIST ReferenceBigArrayBigList
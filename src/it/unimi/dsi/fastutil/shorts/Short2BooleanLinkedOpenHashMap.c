@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2BooleanLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2BooleanLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2BooleanLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2BooleanAVLTreeMap
 #define RB_TREE_MAP Short2BooleanRBTreeMap
+#define CACHE Short2BooleanCache
+#define STATIC_FUNCTION Short2BooleanStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2BooleanOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2BooleanCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2BooleanLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2BooleanOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2BooleanOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2BooleanOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2BooleanAVLTreeMap
 #define RB_TREE_MAP Short2BooleanRBTreeMap
+#define CACHE Short2BooleanCache
+#define STATIC_FUNCTION Short2BooleanStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ByteLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ByteLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ByteLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ByteAVLTreeMap
 #define RB_TREE_MAP Short2ByteRBTreeMap
+#define CACHE Short2ByteCache
+#define STATIC_FUNCTION Short2ByteStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2ByteOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ByteOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ByteOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ByteOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ByteAVLTreeMap
 #define RB_TREE_MAP Short2ByteRBTreeMap
+#define CACHE Short2ByteCache
+#define STATIC_FUNCTION Short2ByteStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ByteOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ByteCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ByteLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ByteOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ByteOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ByteOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ByteAVLTreeMap
 #define RB_TREE_MAP Short2ByteRBTreeMap
+#define CACHE Short2ByteCache
+#define STATIC_FUNCTION Short2ByteStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2CharOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Short2CharOpenDoubleHashMap
 #define ARRAY_SET ShortArraySet
 #define ARRAY_MAP Short2CharArrayMap
 #define LINKED_OPEN_HASH_SET ShortLinkedOpenHashSet
 #define AVL_TREE_SET ShortAVLTreeSet
 #define RB_TREE_SET ShortRBTreeSet
+#define BTREE_SET ShortBTreeSet
+#define PERSISTENT_TREE_SET ShortPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ShortConcurrentSkipListSet
+#define SORTED_ARRAY_SET ShortSortedArraySet
 #define AVL_TREE_MAP Short2CharAVLTreeMap
 #define RB_TREE_MAP Short2CharRBTreeMap
+#define BTREE_MAP Short2CharBTreeMap
+#define PERSISTENT_TREE_MAP Short2CharPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Short2CharConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Short2CharSortedArrayMap
+#define CACHE Short2CharCache
+#define STATIC_FUNCTION Short2CharStaticFunction
+#define BLOOM_FILTER ShortBloomFilter
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
 #define MAPPED_BIG_LIST ShortMappedBigList
 #define ARRAY_FRONT_CODED_LIST ShortArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ShortArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ShortEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ShortEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ShortHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ShortHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ShortHeapIndirectPriorityQueue
@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2CharLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2CharLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2CharLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2CharAVLTreeMap
 #define RB_TREE_MAP Short2CharRBTreeMap
+#define CACHE Short2CharCache
+#define STATIC_FUNCTION Short2CharStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
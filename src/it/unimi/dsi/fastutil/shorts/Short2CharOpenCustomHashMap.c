@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2CharOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2CharOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2CharOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2CharOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2CharAVLTreeMap
 #define RB_TREE_MAP Short2CharRBTreeMap
+#define CACHE Short2CharCache
+#define STATIC_FUNCTION Short2CharStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2CharOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2CharCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2CharLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2CharOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2CharOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2CharOpenDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2CharAVLTreeMap
 #define RB_TREE_MAP Short2CharRBTreeMap
+#define CACHE Short2CharCache
+#define STATIC_FUNCTION Short2CharStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
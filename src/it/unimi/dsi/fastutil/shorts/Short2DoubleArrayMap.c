@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2DoubleOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2DoubleOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2DoubleOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Short2DoubleOpenDoubleHashMap
 #define ARRAY_SET ShortArraySet
 #define ARRAY_MAP Short2DoubleArrayMap
 #define LINKED_OPEN_HASH_SET ShortLinkedOpenHashSet
 #define AVL_TREE_SET ShortAVLTreeSet
 #define RB_TREE_SET ShortRBTreeSet
+#define BTREE_SET ShortBTreeSet
+#define PERSISTENT_TREE_SET ShortPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ShortConcurrentSkipListSet
+#define SORTED_ARRAY_SET ShortSortedArraySet
 #define AVL_TREE_MAP Short2DoubleAVLTreeMap
 #define RB_TREE_MAP Short2DoubleRBTreeMap
+#define BTREE_MAP Short2DoubleBTreeMap
+#define PERSISTENT_TREE_MAP Short2DoublePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Short2DoubleConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Short2DoubleSortedArrayMap
+#define CACHE Short2DoubleCache
+#define STATIC_FUNCTION Short2DoubleStaticFunction
+#define BLOOM_FILTER ShortBloomFilter
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
 #define MAPPED_BIG_LIST ShortMappedBigList
 #define ARRAY_FRONT_CODED_LIST ShortArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ShortArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ShortEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ShortEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ShortHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ShortHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ShortHeapIndirectPriorityQueue
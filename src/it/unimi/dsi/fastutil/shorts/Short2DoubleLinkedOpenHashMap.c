@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2DoubleLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2DoubleLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2DoubleOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2DoubleLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2DoubleAVLTreeMap
 #define RB_TREE_MAP Short2DoubleRBTreeMap
+#define CACHE Short2DoubleCache
+#define STATIC_FUNCTION Short2DoubleStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2DoubleOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2DoubleCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2DoubleLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2DoubleOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2DoubleOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2DoubleOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2DoubleAVLTreeMap
 #define RB_TREE_MAP Short2DoubleRBTreeMap
+#define CACHE Short2DoubleCache
+#define STATIC_FUNCTION Short2DoubleStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
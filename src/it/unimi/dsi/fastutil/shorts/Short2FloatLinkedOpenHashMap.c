@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2FloatLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2FloatLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2FloatOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2FloatLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2FloatAVLTreeMap
 #define RB_TREE_MAP Short2FloatRBTreeMap
+#define CACHE Short2FloatCache
+#define STATIC_FUNCTION Short2FloatStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
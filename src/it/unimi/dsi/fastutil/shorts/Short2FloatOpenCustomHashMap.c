@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2FloatOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2FloatCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2FloatLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2FloatOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2FloatOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2FloatOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2FloatAVLTreeMap
 #define RB_TREE_MAP Short2FloatRBTreeMap
+#define CACHE Short2FloatCache
+#define STATIC_FUNCTION Short2FloatStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
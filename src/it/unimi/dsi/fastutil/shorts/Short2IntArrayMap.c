@@ -316,22 +316,38 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2IntOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2IntOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2IntOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Short2IntOpenDoubleHashMap
 #define ARRAY_SET ShortArraySet
 #define ARRAY_MAP Short2IntArrayMap
 #define LINKED_OPEN_HASH_SET ShortLinkedOpenHashSet
 #define AVL_TREE_SET ShortAVLTreeSet
 #define RB_TREE_SET ShortRBTreeSet
+#define BTREE_SET ShortBTreeSet
+#define PERSISTENT_TREE_SET ShortPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ShortConcurrentSkipListSet
+#define SORTED_ARRAY_SET ShortSortedArraySet
 #define AVL_TREE_MAP Short2IntAVLTreeMap
 #define RB_TREE_MAP Short2IntRBTreeMap
+#define BTREE_MAP Short2IntBTreeMap
+#define PERSISTENT_TREE_MAP Short2IntPersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Short2IntConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Short2IntSortedArrayMap
+#define CACHE Short2IntCache
+#define STATIC_FUNCTION Short2IntStaticFunction
+#define BLOOM_FILTER ShortBloomFilter
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
 #define MAPPED_BIG_LIST ShortMappedBigList
 #define ARRAY_FRONT_CODED_LIST ShortArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ShortArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ShortEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ShortEliasFanoSortedSet
 #define HEAP_PRIORITY_QUEUE ShortHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ShortHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ShortHeapIndirectPriorityQueue
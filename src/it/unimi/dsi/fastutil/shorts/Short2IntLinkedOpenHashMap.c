@@ -330,6 +330,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2IntLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2IntLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2IntOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2IntLinkedOpenDoubleHashMap
@@ -340,6 +342,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2IntAVLTreeMap
 #define RB_TREE_MAP Short2IntRBTreeMap
+#define CACHE Short2IntCache
+#define STATIC_FUNCTION Short2IntStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2IntOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2IntCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2IntLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2IntOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2IntOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2IntOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2IntAVLTreeMap
 #define RB_TREE_MAP Short2IntRBTreeMap
+#define CACHE Short2IntCache
+#define STATIC_FUNCTION Short2IntStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -316,6 +316,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2LongOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2LongCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2LongLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2LongOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2LongOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2LongOpenCustomDoubleHashMap
@@ -326,6 +328,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2LongAVLTreeMap
 #define RB_TREE_MAP Short2LongRBTreeMap
+#define CACHE Short2LongCache
+#define STATIC_FUNCTION Short2LongStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
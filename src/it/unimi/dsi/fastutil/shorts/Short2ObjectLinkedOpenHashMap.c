@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ObjectLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ObjectLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ObjectLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ObjectAVLTreeMap
 #define RB_TREE_MAP Short2ObjectRBTreeMap
+#define CACHE Short2ObjectCache
+#define STATIC_FUNCTION Short2ObjectStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2ObjectOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ObjectOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ObjectOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ObjectOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ObjectAVLTreeMap
 #define RB_TREE_MAP Short2ObjectRBTreeMap
+#define CACHE Short2ObjectCache
+#define STATIC_FUNCTION Short2ObjectStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ObjectOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ObjectCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ObjectLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ObjectOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ObjectOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ObjectOpenDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ObjectAVLTreeMap
 #define RB_TREE_MAP Short2ObjectRBTreeMap
+#define CACHE Short2ObjectCache
+#define STATIC_FUNCTION Short2ObjectStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -315,22 +315,44 @@
 #define OPEN_HASH_BIG_SET ShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ReferenceOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ReferenceOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ReferenceOpenHashMap
+#define STRIPED_OPEN_HASH_BIG_SET StripedShortOpenHashBigSet
 #define OPEN_DOUBLE_HASH_MAP Short2ReferenceOpenDoubleHashMap
 #define ARRAY_SET ShortArraySet
 #define ARRAY_MAP Short2ReferenceArrayMap
 #define LINKED_OPEN_HASH_SET ShortLinkedOpenHashSet
 #define AVL_TREE_SET ShortAVLTreeSet
 #define RB_TREE_SET ShortRBTreeSet
+#define BTREE_SET ShortBTreeSet
+#define PERSISTENT_TREE_SET ShortPersistentTreeSet
+#define CONCURRENT_SKIP_LIST_SET ShortConcurrentSkipListSet
+#define SORTED_ARRAY_SET ShortSortedArraySet
 #define AVL_TREE_MAP Short2ReferenceAVLTreeMap
+#define ARENA_TREE_MAP Short2ReferenceArenaTreeMap
 #define RB_TREE_MAP Short2ReferenceRBTreeMap
+#define BTREE_MAP Short2ReferenceBTreeMap
+#define PERSISTENT_TREE_MAP Short2ReferencePersistentTreeMap
+#define CONCURRENT_SKIP_LIST_MAP Short2ReferenceConcurrentSkipListMap
+#define SORTED_ARRAY_MAP Short2ReferenceSortedArrayMap
+#define CACHE Short2ReferenceCache
+#define STATIC_FUNCTION Short2ReferenceStaticFunction
+#define BLOOM_FILTER ShortBloomFilter
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
+#define COPY_ON_WRITE_ARRAY_LIST ShortCopyOnWriteArrayList
+#define CHUNKED_LIST ShortChunkedList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
 #define MAPPED_BIG_LIST ShortMappedBigList
+#define APPENDABLE_MAPPED_BIG_LIST ShortAppendableMappedBigList
 #define ARRAY_FRONT_CODED_LIST ShortArrayFrontCodedList
 #define ARRAY_FRONT_CODED_BIG_LIST ShortArrayFrontCodedBigList
+#define MAPPED_ARRAY_FRONT_CODED_BIG_LIST ShortMappedArrayFrontCodedBigList
+#define ELIAS_FANO_BIG_LIST ShortEliasFanoBigList
+#define ELIAS_FANO_SORTED_SET ShortEliasFanoSortedSet
+#define PACKED_BIG_LIST ShortPackedBigList
 #define HEAP_PRIORITY_QUEUE ShortHeapPriorityQueue
 #define HEAP_SEMI_INDIRECT_PRIORITY_QUEUE ShortHeapSemiIndirectPriorityQueue
 #define HEAP_INDIRECT_PRIORITY_QUEUE ShortHeapIndirectPriorityQueue
@@ -329,6 +329,8 @@
 #define OPEN_HASH_BIG_SET ShortLinkedOpenHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortLinkedOpenDoubleHashSet
 #define OPEN_HASH_MAP Short2ReferenceLinkedOpenHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ReferenceLinkedOpenHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ReferenceOpenHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ReferenceLinkedOpenDoubleHashMap
@@ -339,6 +341,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ReferenceAVLTreeMap
 #define RB_TREE_MAP Short2ReferenceRBTreeMap
+#define CACHE Short2ReferenceCache
+#define STATIC_FUNCTION Short2ReferenceStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
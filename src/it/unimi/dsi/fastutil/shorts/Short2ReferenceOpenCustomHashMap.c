@@ -315,6 +315,8 @@
 #define OPEN_HASH_BIG_SET ShortOpenCustomHashBigSet
 #define OPEN_DOUBLE_HASH_SET ShortOpenCustomDoubleHashSet
 #define OPEN_HASH_MAP Short2ReferenceOpenCustomHashMap
+#define COMPACT_OPEN_HASH_MAP Short2ReferenceCompactOpenHashMap
+#define LINKED_OPEN_HASH_MAP Short2ReferenceLinkedOpenHashMap
 #define OPEN_HASH_BIG_MAP Short2ReferenceOpenCustomHashBigMap
 #define STRIPED_OPEN_HASH_MAP StripedShort2ReferenceOpenCustomHashMap
 #define OPEN_DOUBLE_HASH_MAP Short2ReferenceOpenCustomDoubleHashMap
@@ -325,6 +327,8 @@
 #define RB_TREE_SET ShortRBTreeSet
 #define AVL_TREE_MAP Short2ReferenceAVLTreeMap
 #define RB_TREE_MAP Short2ReferenceRBTreeMap
+#define CACHE Short2ReferenceCache
+#define STATIC_FUNCTION Short2ReferenceStaticFunction
 #define ARRAY_LIST ShortArrayList
 #define IMMUTABLE_LIST ShortImmutableList
 #define BIG_ARRAY_BIG_LIST ShortBigArrayBigList
@@ -19,17 +19,23 @@ import static it.unimi.dsi.fastutil.BigArrays.copyToBig;
 import static it.unimi.dsi.fastutil.BigArrays.grow;
 import static it.unimi.dsi.fastutil.BigArrays.trim;
 import static it.unimi.dsi.fastutil.shorts.ShortArrayFrontCodedList.count;
+import static it.unimi.dsi.fastutil.shorts.ShortArrayFrontCodedList.parallelFrontCode;
 import static it.unimi.dsi.fastutil.shorts.ShortArrayFrontCodedList.readInt;
 import static it.unimi.dsi.fastutil.shorts.ShortArrayFrontCodedList.writeInt;
 import it.unimi.dsi.fastutil.BigArrays;
 import it.unimi.dsi.fastutil.objects.AbstractObjectBigList;
+import it.unimi.dsi.fastutil.objects.ObjectBigList;
 import it.unimi.dsi.fastutil.objects.ObjectBigListIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterators;
 import it.unimi.dsi.fastutil.longs.LongBigArrays;
 import java.io.Serializable;
 import java.util.Iterator;
 import java.util.Collection;
 import java.util.NoSuchElementException;
 import java.util.RandomAccess;
+import java.util.Spliterator;
+import java.util.function.Consumer;
 /** Compact storage of big lists of arrays using front-coding (also known as prefix-omission) compression.
 	*
 	* <p>This class stores immutably a big list of arrays in a single {@linkplain it.unimi.dsi.fastutil.BigArrays big array}
@@ -57,6 +63,11 @@ import java.util.RandomAccess;
 	* still have a data structure storing large list of arrays with a reduced
 	* overhead (just one integer per array, plus the space required for lengths).
 	*
+	* <p>Since blocks of {@link #ratio()} arrays are coded independently, a front-coded big list can be
+	* {@linkplain #parallelBuild(ObjectBigList, int) built in parallel} from a big list, and its
+	* {@linkplain #spliterator() spliterator} splits at block boundaries, so that parallel streams
+	* decode each block sequentially.
+	*
 	* <p>Note that the typical usage of front-coded lists is under the form of
 	* serialized objects; usually, the data that has to be compacted is processed
 	* offline, and the resulting structure is stored permanently. Since the
@@ -146,6 +157,28 @@ public class ShortArrayFrontCodedBigList extends AbstractObjectBigList<short[]>
 	public ShortArrayFrontCodedBigList(final Collection<short[]> c, final int ratio) {
 	 this(c.iterator(), ratio);
 	}
+	private ShortArrayFrontCodedBigList(final long n, final int ratio, final short[][] array, final long[][] p) {
+	 this.n = n;
+	 this.ratio = ratio;
+	 this.array = array;
+	 this.p = p;
+	}
+	/** Creates in parallel a new front-coded big list containing the arrays in the given big list.
+	 *
+	 * <p>Blocks of {@code ratio} arrays are coded independently using the
+	 * {@linkplain java.util.concurrent.ForkJoinPool#commonPool() common pool}. The big list should be {@link RandomAccess}, as
+	 * its arrays are accessed by index, and it must not be modified during the construction.
+	 *
+	 * @param arrays a big list of arrays.
+	 * @param ratio the desired ratio.
+	 * @return a front-coded big list containing the arrays in {@code arrays}.
+	 */
+	public static ShortArrayFrontCodedBigList parallelBuild(final ObjectBigList<short[]> arrays, final int ratio) {
+	 if (ratio < 1) throw new IllegalArgumentException("Illegal ratio (" + ratio + ")");
+	 final long n = arrays.size64();
+	 final long[][] p = LongBigArrays.newBigArray((n + ratio - 1) / ratio);
+	 return new ShortArrayFrontCodedBigList(n, ratio, parallelFrontCode(arrays::get, n, ratio, p, null), p);
+	}
 	public int ratio() {
 	 return ratio;
 	}
@@ -337,6 +370,57 @@ public class ShortArrayFrontCodedBigList extends AbstractObjectBigList<short[]>
 	   }
 	  };
 	}
+	/** A spliterator splitting at block boundaries and decoding sequentially its range. */
+	private final class BlockSpliterator implements ObjectSpliterator<short[]> {
+	 private long pos, max;
+	 /** An iterator positioned at {@link #pos}, or {@code null}. */
+	 private ObjectBigListIterator<short[]> iterator;
+	 private BlockSpliterator(final long pos, final long max) {
+	  this.pos = pos;
+	  this.max = max;
+	 }
+	 @Override
+	 public int characteristics() { return ObjectSpliterators.LIST_SPLITERATOR_CHARACTERISTICS | Spliterator.IMMUTABLE | Spliterator.NONNULL; }
+	 @Override
+	 public long estimateSize() { return max - pos; }
+	 @Override
+	 public boolean tryAdvance(final Consumer<? super short[]> action) {
+	  if (pos >= max) return false;
+	  if (iterator == null) iterator = listIterator(pos);
+	  pos++;
+	  action.accept(iterator.next());
+	  return true;
+	 }
+	 @Override
+	 public void forEachRemaining(final Consumer<? super short[]> action) {
+	  if (pos >= max) return;
+	  if (iterator == null) iterator = listIterator(pos);
+	  while (pos < max) {
+	   pos++;
+	   action.accept(iterator.next());
+	  }
+	 }
+	 @Override
+	 public ObjectSpliterator<short[]> trySplit() {
+	  // Split at the block boundary closest to the middle of the range
+	  final long mid = ((pos + max) / 2 + ratio / 2) / ratio * ratio;
+	  if (mid <= pos || mid >= max) return null;
+	  final BlockSpliterator prefix = new BlockSpliterator(pos, mid);
+	  prefix.iterator = iterator;
+	  iterator = null;
+	  pos = mid;
+	  return prefix;
+	 }
+	}
+	/** {@inheritDoc}
+	 *
+	 * <p>The spliterator returned by this method splits at block boundaries, and decodes its
+	 * range sequentially, so its splits can be traversed independently in parallel.
+	 */
+	@Override
+	public ObjectSpliterator<short[]> spliterator() {
+	 return new BlockSpliterator(0, n);
+	}
 	/** Returns a copy of this list.
 	 *
 	 *  @return a copy of this list.
@@ -378,6 +462,14 @@ public class ShortArrayFrontCodedBigList extends AbstractObjectBigList<short[]>
 	 }
 	 return p;
 	}
+	/** Dumps the compressed arrays and the pointers of this list.
+	 *
+	 * <p>The resulting files can be mapped by the corresponding mapped front-coded big list, providing instant
+	 * access to the content of this list without deserialization.
+	 *
+	 * @param array a data output stream where the compressed arrays will be written.
+	 * @param pointers a data output stream where the pointers to entire arrays will be written.
+	 */
 	public void dump(java.io.DataOutputStream array, java.io.DataOutputStream pointers) throws java.io.IOException {
 	 for(short[] s: this.array)
 	  for(short e :s)
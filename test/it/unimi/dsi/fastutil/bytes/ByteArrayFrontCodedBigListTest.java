@@ -17,6 +17,7 @@
 package it.unimi.dsi.fastutil.bytes;
 
 import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertTrue;
 
 import java.io.IOException;
@@ -173,4 +174,24 @@ public class ByteArrayFrontCodedBigListTest {
 			assertArrayEquals(new byte[] { (byte)r.nextLong() }, b);
 		}
 	}
+
+	@Test
+	public void testParallelBuild() {
+		final it.unimi.dsi.fastutil.objects.ObjectBigArrayBigList<byte[]> t = new it.unimi.dsi.fastutil.objects.ObjectBigArrayBigList<>();
+		for (int i = 0; i < 100000; i++) {
+			final byte[] b = new byte[r.nextInt(10) == 0 ? 200 : r.nextInt(20)];
+			for (int j = 0; j < b.length; j++) b[j] = j < 5 ? (byte)'a' : genKey();
+			t.add(b);
+		}
+		for (final int ratio : new int[] { 1, 3, 16 }) {
+			final ByteArrayFrontCodedBigList s = new ByteArrayFrontCodedBigList(t.iterator(), ratio);
+			final ByteArrayFrontCodedBigList m = ByteArrayFrontCodedBigList.parallelBuild(t, ratio);
+			assertEquals(s.size64(), m.size64());
+			for (long i = 0; i < t.size64(); i++) assertArrayEquals(t.get(i), m.get(i));
+			final java.util.List<byte[]> d = java.util.stream.StreamSupport.stream(m.spliterator(), true).collect(java.util.stream.Collectors.toList());
+			assertEquals(t.size64(), d.size());
+			for (int i = 0; i < d.size(); i++) assertArrayEquals(t.get(i), d.get(i));
+		}
+		assertEquals(0, ByteArrayFrontCodedBigList.parallelBuild(new it.unimi.dsi.fastutil.objects.ObjectBigArrayBigList<>(), 4).size64());
+	}
 }
@@ -16,13 +16,21 @@
 
 package it.unimi.dsi.fastutil.bytes;
 
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertTrue;
 
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
 import java.io.IOException;
+import java.util.stream.Collectors;
 
 import org.junit.Test;
 
+import it.unimi.dsi.fastutil.io.BinIO;
+import it.unimi.dsi.fastutil.objects.ObjectArrayList;
 import it.unimi.dsi.fastutil.objects.ObjectListIterator;
+import it.unimi.dsi.fastutil.objects.ObjectSpliterator;
 
 @SuppressWarnings({"rawtypes", "unchecked"})
 public class ByteArrayFrontCodedListTest {
@@ -139,4 +147,103 @@ public class ByteArrayFrontCodedListTest {
 	public void test10000() throws IOException, ClassNotFoundException {
 		test(10000);
 	}
+
+	@Test
+	public void testParallelBuild() throws IOException, ClassNotFoundException {
+		final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+		for (int i = 0; i < 100000; i++) {
+			final byte[] b = new byte[r.nextInt(10) == 0 ? 200 : r.nextInt(20)];
+			for (int j = 0; j < b.length; j++) b[j] = j < 5 ? (byte)'a' : genKey();
+			t.add(b);
+		}
+		for (final int ratio : new int[] { 1, 3, 16 }) {
+			final ByteArrayFrontCodedList m = ByteArrayFrontCodedList.parallelBuild(t, ratio);
+			assertTrue(contentEquals(t, m));
+			assertTrue(contentEquals(t, new ObjectArrayList<>(m.listIterator(0))));
+			assertTrue(contentEquals(t, m.parallelStream().collect(Collectors.toList())));
+			final ObjectSpliterator<byte[]> spliterator = m.spliterator();
+			final ObjectSpliterator<byte[]> prefix = spliterator.trySplit();
+			assertEquals(0, (t.size() - spliterator.estimateSize()) % ratio);
+			assertEquals(t.size(), prefix.estimateSize() + spliterator.estimateSize());
+			assertTrue(contentEquals(t, (ByteArrayFrontCodedList)BinIO.loadObject(new ByteArrayInputStream(serialize(m)))));
+		}
+		assertEquals(0, ByteArrayFrontCodedList.parallelBuild(new ObjectArrayList<>(), 4).size());
+	}
+
+	private static byte[] serialize(final Object o) throws IOException {
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(o, baos);
+		return baos.toByteArray();
+	}
+
+	private static int compare(final byte[] a, final byte[] b) {
+		for (int i = 0; i < Math.min(a.length, b.length); i++) if (a[i] != b[i]) return Byte.compare(a[i], b[i]);
+		return Integer.compare(a.length, b.length);
+	}
+
+	private static boolean startsWith(final byte[] a, final byte[] prefix) {
+		return a.length >= prefix.length && java.util.Arrays.equals(java.util.Arrays.copyOf(a, prefix.length), prefix);
+	}
+
+	private static byte[] randomArray() {
+		final byte[] b = new byte[r.nextInt(6)];
+		for (int j = 0; j < b.length; j++) b[j] = (byte)(r.nextInt(4) - 2);
+		return b;
+	}
+
+	@Test
+	public void testSorted() {
+		final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+		for (int i = 0; i < 5000; i++) t.add(randomArray());
+		t.sort(ByteArrayFrontCodedListTest::compare);
+		for (final int ratio : new int[] { 1, 2, 7, 32 }) {
+			for (final ByteArrayFrontCodedList m : new ByteArrayFrontCodedList[] { new ByteArrayFrontCodedList(t.iterator(), ratio), ByteArrayFrontCodedList.parallelBuild(t, ratio) }) {
+				assertTrue(m.isSorted());
+				for (int i = 0; i < 1000; i++) {
+					final byte[] key = randomArray();
+					int expected = -1;
+					for (int j = 0; j < t.size(); j++) if (java.util.Arrays.equals(t.get(j), key)) { expected = j; break; }
+					assertEquals(expected, m.indexOf(key));
+					int from = 0;
+					while (from < t.size() && compare(t.get(from), key) < 0 && ! startsWith(t.get(from), key)) from++;
+					int to = from;
+					while (to < t.size() && startsWith(t.get(to), key)) to++;
+					assertEquals(from, m.range(key).leftInt());
+					assertEquals(to, m.range(key).rightInt());
+				}
+			}
+		}
+		assertTrue(new ByteArrayFrontCodedList(new ObjectArrayList<byte[]>().iterator(), 3).isSorted());
+		assertEquals(-1, new ByteArrayFrontCodedList(new ObjectArrayList<byte[]>().iterator(), 3).indexOf(new byte[0]));
+
+		t.add(0, new byte[] { 5 });
+		final ByteArrayFrontCodedList m = new ByteArrayFrontCodedList(t.iterator(), 4);
+		assertFalse(m.isSorted());
+		assertFalse(ByteArrayFrontCodedList.parallelBuild(t, 4).isSorted());
+		assertEquals(0, m.indexOf(new byte[] { 5 }));
+		assertEquals(-1, m.indexOf(new byte[] { 6 }));
+	}
+
+	@Test
+	public void testSortedSerialization() throws IOException, ClassNotFoundException {
+		final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+		for (int i = 0; i < 1000; i++) t.add(randomArray());
+		t.sort(ByteArrayFrontCodedListTest::compare);
+		for (final int ratio : new int[] { 1, 3, 8 }) {
+			final ByteArrayFrontCodedList m = (ByteArrayFrontCodedList)BinIO.loadObject(new ByteArrayInputStream(serialize(new ByteArrayFrontCodedList(t.iterator(), ratio))));
+			assertTrue(m.isSorted());
+			int expected = 0;
+			while (! java.util.Arrays.equals(t.get(expected), t.get(500))) expected++;
+			assertEquals(expected, m.indexOf(t.get(500)));
+			// Moving the smallest array to the end breaks the order
+			t.add(t.remove(0));
+			assertFalse(((ByteArrayFrontCodedList)BinIO.loadObject(new ByteArrayInputStream(serialize(new ByteArrayFrontCodedList(t.iterator(), ratio))))).isSorted());
+			t.sort(ByteArrayFrontCodedListTest::compare);
+		}
+	}
+
+	@Test(expected = IllegalStateException.class)
+	public void testRangeUnsorted() {
+		new ByteArrayFrontCodedList(ObjectArrayList.wrap(new byte[][] { { 1 }, { 0 } }).iterator(), 4).range(new byte[0]);
+	}
 }
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.bytes;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.fail;
+
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.nio.channels.FileChannel;
+import java.util.Arrays;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.FastBufferedOutputStream;
+import it.unimi.dsi.fastutil.objects.ObjectArrayList;
+import it.unimi.dsi.fastutil.objects.ObjectBigListIterator;
+
+public class ByteMappedArrayFrontCodedBigListTest {
+
+	private static ByteMappedArrayFrontCodedBigList dumpAndMap(final ByteArrayFrontCodedBigList list, final File array, final File pointers) throws IOException {
+		final DataOutputStream a = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(array)));
+		final DataOutputStream p = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(pointers)));
+		list.dump(a, p);
+		a.close();
+		p.close();
+		return ByteMappedArrayFrontCodedBigList.map(FileChannel.open(array.toPath()), FileChannel.open(pointers.toPath()), list.ratio());
+	}
+
+	@Test
+	public void testMap() throws IOException {
+		final File array = File.createTempFile(this.getClass().getName(), ".array");
+		array.deleteOnExit();
+		final File pointers = File.createTempFile(this.getClass().getName(), ".pointers");
+		pointers.deleteOnExit();
+		final SplittableRandom r = new SplittableRandom(0);
+
+		for (final int n : new int[] { 0, 1, 10, 1000, 10000 }) {
+			final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+			for (int i = 0; i < n; i++) {
+				// Long common prefixes and some long arrays, to exercise multi-byte lengths
+				final byte[] b = new byte[r.nextInt(10) == 0 ? 200 + r.nextInt(300) : r.nextInt(20)];
+				for (int j = 0; j < b.length; j++) b[j] = (byte)(j < 5 ? 'a' : r.nextInt());
+				t.add(b);
+			}
+			for (int ratio = 1; ratio < 6; ratio++) {
+				final ByteArrayFrontCodedBigList f = new ByteArrayFrontCodedBigList(t.iterator(), ratio);
+				final ByteMappedArrayFrontCodedBigList m = dumpAndMap(f, array, pointers);
+				assertEquals(n, m.size64());
+				assertEquals(ratio, m.ratio());
+				for (int i = 0; i < n; i++) {
+					assertArrayEquals(t.get(i), m.get(i));
+					assertEquals(t.get(i).length, m.arrayLength(i));
+				}
+				final ObjectBigListIterator<byte[]> iterator = m.listIterator();
+				for (int i = 0; i < n; i++) assertArrayEquals(t.get(i), iterator.next());
+				assertFalse(iterator.hasNext());
+				if (n != 0) {
+					final int start = r.nextInt(n);
+					final ObjectBigListIterator<byte[]> j = m.copy().listIterator(start);
+					assertArrayEquals(t.get(start), j.next());
+					assertArrayEquals(t.get(start), j.previous());
+					final int k = r.nextInt(n);
+					final byte[] b = new byte[3];
+					final int l = t.get(k).length;
+					assertEquals(l <= 3 ? l : 3 - l, m.get(k, b));
+					assertArrayEquals(Arrays.copyOf(t.get(k), Math.min(3, l)), Arrays.copyOf(b, Math.min(3, l)));
+				}
+			}
+		}
+		array.delete();
+		pointers.delete();
+	}
+
+	@Test
+	public void testLargerWrongRatio() throws IOException {
+		final File array = File.createTempFile(this.getClass().getName(), ".array");
+		array.deleteOnExit();
+		final File pointers = File.createTempFile(this.getClass().getName(), ".pointers");
+		pointers.deleteOnExit();
+		final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+		for (int i = 0; i < 100; i++) t.add(new byte[] { (byte)i, (byte)(i + 1) });
+		final ByteArrayFrontCodedBigList f = new ByteArrayFrontCodedBigList(t.iterator(), 4);
+		assertEquals(100, dumpAndMap(f, array, pointers).size64());
+		for (final int ratio : new int[] { 2, 3, 5, 8 }) {
+			try {
+				ByteMappedArrayFrontCodedBigList.map(FileChannel.open(array.toPath()), FileChannel.open(pointers.toPath()), ratio);
+				fail("Ratio " + ratio + " accepted");
+			} catch (final IllegalArgumentException expected) {}
+		}
+		array.delete();
+		pointers.delete();
+	}
+
+	@Test(expected = IllegalArgumentException.class)
+	public void testWrongRatio() throws IOException {
+		final File array = File.createTempFile(this.getClass().getName(), ".array");
+		array.deleteOnExit();
+		final File pointers = File.createTempFile(this.getClass().getName(), ".pointers");
+		pointers.deleteOnExit();
+		final ObjectArrayList<byte[]> t = new ObjectArrayList<>();
+		for (int i = 0; i < 100; i++) t.add(new byte[] { (byte)i, (byte)(i + 1) });
+		final ByteArrayFrontCodedBigList f = new ByteArrayFrontCodedBigList(t.iterator(), 4);
+		final DataOutputStream a = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(array)));
+		final DataOutputStream p = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(pointers)));
+		f.dump(a, p);
+		a.close();
+		p.close();
+		try {
+			ByteMappedArrayFrontCodedBigList.map(FileChannel.open(array.toPath()), FileChannel.open(pointers.toPath()), 2);
+		} finally {
+			array.delete();
+			pointers.delete();
+		}
+	}
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+import it.unimi.dsi.fastutil.objects.ObjectBidirectionalIterator;
+
+public class Int2IntArenaTreeMapTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final Int2IntArenaTreeMap m = new Int2IntArenaTreeMap();
+		final Int2IntRBTreeMap t = new Int2IntRBTreeMap();
+		for (int i = 0; i < 200000; i++) {
+			final int k = r.nextInt(3000);
+			if (r.nextInt(5) < 3) assertEquals(t.put(k, i), m.put(k, i));
+			else assertEquals(t.remove(k), m.remove(k));
+			assertEquals(t.size(), m.size());
+			if (i % 10000 == 0) {
+				assertEquals(t, m);
+				assertEquals(t.firstIntKey(), m.firstIntKey());
+				assertEquals(t.lastIntKey(), m.lastIntKey());
+				final int x = r.nextInt(2400), y = x + 100 + r.nextInt(500);
+				assertEquals(t.subMap(x, y), m.subMap(x, y));
+				assertEquals(t.headMap(y), m.headMap(y));
+				assertEquals(t.tailMap(x), m.tailMap(x));
+				assertEquals(t.subMap(x, y).firstIntKey(), m.subMap(x, y).firstIntKey());
+				assertEquals(t.tailMap(x).headMap(y).lastIntKey(), m.subMap(x, y).lastIntKey());
+				assertEquals(new IntArrayList(t.keySet().iterator(y)), new IntArrayList(m.keySet().iterator(y)));
+				assertEquals(new IntArrayList(t.subMap(x, y).keySet().iterator(x - 100)), new IntArrayList(m.subMap(x, y).keySet().iterator(x - 100)));
+				assertEquals(new IntArrayList(t.values()), new IntArrayList(m.values()));
+			}
+		}
+		// No further allocation once the map has reached its working size
+		final int capacity = m.key.length;
+		for (int i = 0; i < 100000; i++) {
+			final int k = r.nextInt(3000);
+			if (m.containsKey(k)) m.remove(k);
+			else m.put(k, i);
+		}
+		assertTrue(m.size() <= capacity);
+		assertEquals(capacity, m.key.length);
+	}
+
+	@Test
+	public void testIteratorRemove() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final Int2IntArenaTreeMap m = new Int2IntArenaTreeMap();
+		final Int2IntRBTreeMap t = new Int2IntRBTreeMap();
+		for (int i = 0; i < 10000; i++) {
+			final int k = r.nextInt();
+			m.put(k, k);
+			t.put(k, k);
+		}
+		final ObjectBidirectionalIterator<Int2IntMap.Entry> i = m.int2IntEntrySet().iterator();
+		while (i.hasNext()) {
+			final int k = i.next().getIntKey();
+			if (r.nextInt(3) == 0) {
+				i.remove();
+				t.remove(k);
+			}
+			else if (r.nextInt(10) == 0 && i.hasPrevious()) {
+				assertEquals(k, i.previous().getIntKey());
+				if (r.nextBoolean()) {
+					i.remove();
+					t.remove(k);
+				}
+				else i.next();
+			}
+		}
+		assertEquals(t, m);
+		m.subMap(0, Integer.MAX_VALUE).clear();
+		t.subMap(0, Integer.MAX_VALUE).clear();
+		assertEquals(t, m);
+		assertTrue(m.tailMap(0).isEmpty());
+	}
+
+	@Test
+	public void testEntries() {
+		final Int2IntArenaTreeMap m = new Int2IntArenaTreeMap(new int[] { 3, 1, 2 }, new int[] { 30, 10, 20 });
+		final Int2IntMap.Entry e = m.int2IntEntrySet().first();
+		assertEquals(1, e.getIntKey());
+		e.setValue(11);
+		assertEquals(11, m.get(1));
+		assertTrue(m.int2IntEntrySet().contains(new AbstractInt2IntMap.BasicEntry(2, 20)));
+		assertFalse(m.int2IntEntrySet().contains(new AbstractInt2IntMap.BasicEntry(2, 21)));
+		assertEquals(3, m.int2IntEntrySet().last().getIntKey());
+		assertEquals(new AbstractInt2IntMap.BasicEntry(3, 30), m.int2IntEntrySet().last());
+		assertTrue(m.int2IntEntrySet().remove(new AbstractInt2IntMap.BasicEntry(2, 20)));
+		assertEquals(2, m.size());
+	}
+
+	@Test
+	public void testCloneAndSerialization() throws IOException, ClassNotFoundException {
+		final Int2IntArenaTreeMap m = new Int2IntArenaTreeMap(new int[] { 5, 3, 1, 4, 2 }, new int[] { 50, 30, 10, 40, 20 }, IntComparators.OPPOSITE_COMPARATOR);
+		final Int2IntArenaTreeMap c = m.clone();
+		c.remove(3);
+		assertEquals(5, m.size());
+		assertEquals(4, c.size());
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		final Int2IntArenaTreeMap n = (Int2IntArenaTreeMap)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, n);
+		assertEquals(5, n.firstIntKey());
+		assertEquals(40, n.get(4));
+	}
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.TreeMap;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Int2IntBTreeMapTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final Int2IntBTreeMap m = new Int2IntBTreeMap();
+		m.defaultReturnValue(-1);
+		final TreeMap<Integer, Integer> t = new TreeMap<>();
+		for (int i = 0; i < 200000; i++) {
+			final int k = r.nextInt(10000);
+			if (r.nextInt(3) != 0) {
+				final Integer old = t.put(Integer.valueOf(k), Integer.valueOf(i));
+				assertEquals(old == null ? -1 : old.intValue(), m.put(k, i));
+			}
+			else {
+				final Integer old = t.remove(Integer.valueOf(k));
+				assertEquals(old == null ? -1 : old.intValue(), m.remove(k));
+			}
+		}
+		assertEquals(t, m);
+		assertEquals(t.firstKey().intValue(), m.firstIntKey());
+		assertEquals(t.lastKey().intValue(), m.lastIntKey());
+		for (int k = -1; k <= 10000; k++) assertEquals(t.containsKey(Integer.valueOf(k)), m.containsKey(k));
+	}
+
+	@Test
+	public void testSubmaps() {
+		final Int2IntBTreeMap m = new Int2IntBTreeMap();
+		final TreeMap<Integer, Integer> t = new TreeMap<>();
+		for (int i = 0; i < 10000; i += 3) {
+			m.put(i, -i);
+			t.put(Integer.valueOf(i), Integer.valueOf(-i));
+		}
+		for (int from = -10; from < 10010; from += 997) {
+			assertEquals(t.tailMap(Integer.valueOf(from)), m.tailMap(from));
+			assertEquals(t.headMap(Integer.valueOf(from)), m.headMap(from));
+			for (int to = from; to < 10010; to += 1409) {
+				final Int2IntSortedMap s = m.subMap(from, to);
+				assertEquals(t.subMap(Integer.valueOf(from), Integer.valueOf(to)), s);
+				assertEquals(t.subMap(Integer.valueOf(from), Integer.valueOf(to)).size(), s.size());
+			}
+		}
+		final Int2IntSortedMap s = m.subMap(100, 200);
+		assertEquals(102, s.firstIntKey());
+		assertEquals(198, s.lastIntKey());
+		assertFalse(s.containsKey(99));
+		s.clear();
+		assertTrue(s.isEmpty());
+		assertEquals(t.size() - 33, m.size());
+		assertFalse(m.containsKey(150));
+		assertTrue(m.containsKey(99));
+		assertTrue(m.containsKey(201));
+	}
+
+	@Test
+	public void testIterators() {
+		final Int2IntBTreeMap m = new Int2IntBTreeMap();
+		for (int i = 0; i < 1000; i++) m.put(2 * i, i);
+		final IntBidirectionalIterator i = m.keySet().iterator(500);
+		assertEquals(502, i.nextInt());
+		assertEquals(502, i.previousInt());
+		assertEquals(500, i.previousInt());
+		i.remove();
+		assertFalse(m.containsKey(500));
+		assertEquals(498, i.previousInt());
+		assertEquals(498, i.nextInt());
+		assertEquals(502, i.nextInt());
+
+		final IntBidirectionalIterator j = m.keySet().iterator();
+		int k = 0;
+		while (j.hasNext()) if (j.nextInt() % 4 == 0) j.remove(); else k++;
+		assertEquals(k, m.size());
+		while (j.hasPrevious()) assertTrue(j.previousInt() % 4 != 0);
+
+		for (final Int2IntMap.Entry e : m.int2IntEntrySet()) e.setValue(-e.getIntKey());
+		for (final Int2IntMap.Entry e : m.int2IntEntrySet()) assertEquals(-e.getIntKey(), e.getIntValue());
+	}
+
+	@Test
+	public void testCloneAndSerialization() throws IOException, ClassNotFoundException {
+		final Int2IntBTreeMap m = new Int2IntBTreeMap(IntComparators.OPPOSITE_COMPARATOR);
+		for (int i = 0; i < 100000; i++) m.put(i * 31, i);
+		final Int2IntBTreeMap c = m.clone();
+		assertEquals(m, c);
+		assertEquals(m.firstIntKey(), c.firstIntKey());
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		final Int2IntBTreeMap s = (Int2IntBTreeMap)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, s);
+		assertEquals(m.firstIntKey(), s.firstIntKey());
+		for (int i = 0; i < 100000; i += 2) s.remove(i * 31);
+		assertEquals(50000, s.size());
+		for (int i = 0; i < 100000; i++) assertEquals(i % 2 != 0, s.containsKey(i * 31));
+	}
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.util.Random;
+
+import org.junit.Test;
+
+public class Int2IntCacheTest {
+
+	@Test
+	public void testLRUEvictionOrder() {
+		final Int2IntCache c = new Int2IntCache.LRU(3);
+		final IntArrayList evicted = new IntArrayList();
+		c.evictionListener((k, v) -> {
+			assertEquals(k + 1, v);
+			evicted.add(k);
+		});
+		c.defaultReturnValue(-1);
+		for (int i = 0; i < 3; i++) assertEquals(-1, c.put(i, i + 1));
+		assertEquals(1, c.get(0)); // 0 is now the most recently used
+		c.put(3, 4);
+		assertEquals(IntArrayList.wrap(new int[] { 1 }), evicted);
+		assertFalse(c.containsKey(1));
+		assertEquals(3, c.put(2, 3)); // an update moves 2, too
+		c.put(2, 3);
+		c.put(4, 5);
+		c.put(5, 6);
+		assertEquals(IntArrayList.wrap(new int[] { 1, 0, 3 }), evicted);
+		assertEquals(3, c.size());
+		assertEquals(3, c.evictions());
+	}
+
+	@Test
+	public void testStatistics() {
+		final Int2IntCache c = new Int2IntCache.LRU(2);
+		c.put(0, 0);
+		c.get(0);
+		c.get(0);
+		c.get(1);
+		assertTrue(c.containsKey(0));
+		assertEquals(2, c.hits());
+		assertEquals(1, c.misses());
+		c.resetStatistics();
+		assertEquals(0, c.hits());
+		assertEquals(0, c.misses());
+	}
+
+	@Test
+	public void testRemoveAndClear() {
+		for (final Int2IntCache c : new Int2IntCache[] { new Int2IntCache.LRU(4), new Int2IntCache.SLRU(4), new Int2IntCache.WindowTinyLFU(4) }) {
+			c.defaultReturnValue(-1);
+			c.put(0, 10);
+			c.get(0);
+			c.put(1, 11);
+			assertEquals(10, c.remove(0));
+			assertEquals(-1, c.remove(0));
+			assertEquals(1, c.size());
+			c.clear();
+			assertEquals(0, c.size());
+			assertEquals(-1, c.get(1));
+		}
+	}
+
+	@Test
+	public void testSLRUProtectsReusedEntries() {
+		final Int2IntCache c = new Int2IntCache.SLRU(10);
+		for (int i = 0; i < 5; i++) c.put(i, i);
+		for (int i = 0; i < 5; i++) assertEquals(i, c.get(i));
+		// A scan of keys used once cannot flush out the protected entries
+		for (int i = 100; i < 1000; i++) c.put(i, i);
+		for (int i = 0; i < 5; i++) assertTrue(c.containsKey(i));
+		assertEquals(10, c.size());
+	}
+
+	@Test
+	public void testWindowTinyLFUKeepsFrequentEntries() {
+		final Int2IntCache c = new Int2IntCache.WindowTinyLFU(100);
+		for (int r = 0; r < 10; r++) for (int i = 0; i < 50; i++) if (c.get(i) == 0) c.put(i, i + 1);
+		for (int i = 1000; i < 100000; i++) {
+			c.put(i, i + 1);
+			assertTrue(c.size() <= 100);
+		}
+		int kept = 0;
+		for (int i = 0; i < 50; i++) if (c.containsKey(i)) kept++;
+		assertTrue(Integer.toString(kept), kept >= 45);
+	}
+
+	@Test
+	public void testRandomAgainstCapacity() {
+		final Random r = new Random(0);
+		for (final Int2IntCache c : new Int2IntCache[] { new Int2IntCache.LRU(1), new Int2IntCache.SLRU(1), new Int2IntCache.WindowTinyLFU(1), new Int2IntCache.LRU(17), new Int2IntCache.SLRU(17), new Int2IntCache.WindowTinyLFU(17) }) {
+			final long[] evicted = new long[1];
+			c.evictionListener((k, v) -> {
+				assertEquals(k * 2, v);
+				evicted[0]++;
+			});
+			int inserted = 0;
+			for (int i = 0; i < 10000; i++) {
+				final int k = r.nextInt(64);
+				if (r.nextBoolean()) {
+					if (!c.containsKey(k)) inserted++;
+					c.put(k, k * 2);
+				} else if (c.containsKey(k)) assertEquals(k * 2, c.get(k));
+				assertTrue(c.size() <= c.capacity());
+			}
+			assertEquals(inserted - c.size(), evicted[0]);
+			assertEquals(evicted[0], c.evictions());
+		}
+	}
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.io.IOException;
+import java.util.NoSuchElementException;
+import java.util.Random;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Int2IntCompactOpenHashMapTest {
+
+	@Test
+	public void testInsertionOrder() {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap();
+		for (int i = 100; i-- != 0;) assertEquals(0, m.put(i, i + 1));
+		assertEquals(100, m.put(99, 0));
+		int expected = 99;
+		for (final int k : m.keySet()) assertEquals(expected--, k);
+		assertEquals(99, m.firstIntKey());
+		assertEquals(0, m.lastIntKey());
+	}
+
+	@Test
+	public void testFirstLast() {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap(Int2IntCompactOpenHashMap.DEFAULT_INITIAL_SIZE);
+		for (int i = 1; i < 100; i++) assertEquals(0, m.put(i, i));
+		for (int i = 1; i < 50; i++) assertEquals(i, m.removeFirstInt());
+		for (int i = 99; i >= 50; i--) assertEquals(i, m.removeLastInt());
+		assertTrue(m.isEmpty());
+		m.put(1, 1);
+		assertEquals(1, m.firstIntKey());
+		assertEquals(1, m.lastIntKey());
+	}
+
+	@Test(expected = NoSuchElementException.class)
+	public void testRemoveFirstEmpty() {
+		new Int2IntCompactOpenHashMap().removeFirstInt();
+	}
+
+	@Test
+	public void testMoveToLast() {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap();
+		for (int i = 0; i < 10; i++) m.put(i, i);
+		assertEquals(3, m.getAndMoveToLast(3));
+		assertEquals(0, m.getAndMoveToLast(42));
+		assertEquals(5, m.putAndMoveToLast(5, 50));
+		assertEquals(0, m.putAndMoveToLast(10, 10));
+		assertArrayEquals(new int[] { 0, 1, 2, 4, 6, 7, 8, 9, 3, 5, 10 }, m.keySet().toIntArray());
+		assertEquals(50, m.get(5));
+	}
+
+	@Test
+	public void testLRUChurnAgainstLinked() {
+		// Many moves and removals force repeated compaction and resizing of the entry arrays
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap(4);
+		final Int2IntLinkedOpenHashMap t = new Int2IntLinkedOpenHashMap(4);
+		final Random r = new Random(0);
+		for (int i = 0; i < 200000; i++) {
+			final int k = r.nextInt(1000);
+			switch (r.nextInt(5)) {
+			case 0:
+				assertEquals(t.put(k, i), m.put(k, i));
+				break;
+			case 1:
+				assertEquals(t.remove(k), m.remove(k));
+				break;
+			case 2:
+				assertEquals(t.getAndMoveToLast(k), m.getAndMoveToLast(k));
+				break;
+			case 3:
+				assertEquals(t.putAndMoveToLast(k, i), m.putAndMoveToLast(k, i));
+				break;
+			default:
+				if (! t.isEmpty()) assertEquals(t.removeFirstInt(), m.removeFirstInt());
+			}
+			if (i % 1000 == 0) {
+				assertEquals(t.size(), m.size());
+				assertArrayEquals(t.keySet().toIntArray(), m.keySet().toIntArray());
+				assertArrayEquals(t.values().toIntArray(), m.values().toIntArray());
+			}
+		}
+		assertEquals(t, m);
+		assertEquals(t.hashCode(), m.hashCode());
+	}
+
+	@Test
+	public void testIteratorRemove() {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap();
+		for (int i = 0; i < 100; i++) m.put(i, i);
+		for (final IntIterator i = m.keySet().iterator(); i.hasNext();) if (i.nextInt() % 3 != 0) i.remove();
+		assertEquals(34, m.size());
+		int expected = 0;
+		for (final int k : m.keySet()) {
+			assertEquals(expected, k);
+			expected += 3;
+		}
+		for (int i = 0; i < 100; i++) assertEquals(i % 3 == 0, m.containsKey(i));
+	}
+
+	@Test
+	public void testTrimAndClone() {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap();
+		for (int i = 0; i < 10000; i++) m.put(i, i);
+		for (int i = 0; i < 10000; i++) if (i % 100 != 0) m.remove(i);
+		assertTrue(m.trim());
+		assertEquals(100, m.size());
+		final Int2IntCompactOpenHashMap c = m.clone();
+		assertEquals(m, c);
+		assertArrayEquals(m.keySet().toIntArray(), c.keySet().toIntArray());
+		c.put(-1, -1);
+		assertEquals(100, m.size());
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final Int2IntCompactOpenHashMap m = new Int2IntCompactOpenHashMap();
+		for (int i = 0; i < 1000; i++) m.put(1000 - i, i);
+		for (int i = 0; i < 1000; i += 2) m.remove(1000 - i);
+		final java.io.ByteArrayOutputStream baos = new java.io.ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		final Int2IntCompactOpenHashMap s = (Int2IntCompactOpenHashMap)BinIO.loadObject(new java.io.ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, s);
+		assertArrayEquals(m.keySet().toIntArray(), s.keySet().toIntArray());
+		s.put(0, 0);
+		assertEquals(0, s.lastIntKey());
+	}
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Int2IntSortedArrayMapTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		for (final int range : new int[] { 10, 1000, Integer.MAX_VALUE }) {
+			final Int2IntRBTreeMap t = new Int2IntRBTreeMap();
+			for (int i = 0; i < 10000; i++) t.put(r.nextInt(range) - range / 2, i);
+			final Int2IntSortedArrayMap m = new Int2IntSortedArrayMap(new Int2IntOpenHashMap(t));
+			assertEquals(t, m);
+			assertEquals(t.keySet(), m.keySet());
+			assertEquals(new IntArrayList(t.values()), new IntArrayList(m.values()));
+			for (int i = 0; i < 10000; i++) {
+				final int k = r.nextInt(range) - range / 2;
+				assertEquals(t.containsKey(k), m.containsKey(k));
+				assertEquals(t.get(k), m.get(k));
+			}
+			for (int i = 0; i < 100; i++) {
+				int x = r.nextInt(range) - range / 2, y = r.nextInt(range) - range / 2;
+				if (x > y) { final int z = x; x = y; y = z; }
+				assertEquals(t.subMap(x, y), m.subMap(x, y));
+				assertEquals(t.headMap(y), m.headMap(y));
+				assertEquals(t.tailMap(x), m.tailMap(x));
+				assertEquals(t.subMap(x, y).keySet(), m.subMap(x, y).keySet());
+				assertEquals(t.keySet().tailSet(x).headSet(y), m.keySet().subSet(x, y));
+				assertEquals(new IntArrayList(t.keySet().iterator(x)), new IntArrayList(m.keySet().iterator(x)));
+			}
+		}
+	}
+
+	@Test
+	public void testSet() {
+		final IntSortedArraySet s = new IntSortedArraySet(new int[] { 5, 3, 1, 3, 4, 2, 5 });
+		assertEquals(new IntRBTreeSet(new int[] { 1, 2, 3, 4, 5 }), s);
+		assertEquals(1, s.firstInt());
+		assertEquals(5, s.lastInt());
+		assertEquals(new IntRBTreeSet(new int[] { 2, 3 }), s.subSet(2, 4));
+		assertTrue(s.subSet(6, 10).isEmpty());
+		final IntBidirectionalIterator i = s.iterator(3);
+		assertEquals(4, i.nextInt());
+		assertEquals(4, i.previousInt());
+		assertEquals(3, i.previousInt());
+		final IntSortedArraySet d = new IntSortedArraySet(new int[] { 1, 2, 3 }, (x, y) -> Integer.compare(y, x));
+		assertEquals(3, d.firstInt());
+		assertTrue(d.contains(2));
+		assertFalse(d.contains(4));
+		assertEquals(IntArrayList.wrap(new int[] { 3, 2 }), new IntArrayList(d.headSet(1).iterator()));
+	}
+
+	@Test(expected = IllegalArgumentException.class)
+	public void testDuplicateKeys() {
+		new Int2IntSortedArrayMap(new int[] { 1, 2, 1 }, new int[] { 0, 0, 0 });
+	}
+
+	@Test
+	public void testSubMapDefaultReturnValue() {
+		final Int2IntSortedArrayMap m = new Int2IntSortedArrayMap(new int[] { 3, 1, 2 }, new int[] { 30, 10, 20 });
+		m.defaultReturnValue(-1);
+		assertEquals(-1, m.headMap(3).get(5));
+		assertEquals(-1, m.tailMap(2).get(0));
+		assertEquals(-1, m.subMap(1, 3).get(3));
+		assertEquals(-1, m.subMap(1, 3).headMap(2).get(2));
+		assertEquals(20, m.subMap(1, 3).get(2));
+	}
+
+	@Test
+	public void testEntries() {
+		final Int2IntSortedArrayMap m = new Int2IntSortedArrayMap(new int[] { 3, 1, 2 }, new int[] { 30, 10, 20 });
+		assertEquals(IntArrayList.wrap(new int[] { 10, 20, 30 }), new IntArrayList(m.values()));
+		assertTrue(m.int2IntEntrySet().contains(new AbstractInt2IntMap.BasicEntry(2, 20)));
+		assertFalse(m.int2IntEntrySet().contains(new AbstractInt2IntMap.BasicEntry(2, 30)));
+		assertEquals(3, m.int2IntEntrySet().last().getIntKey());
+		assertEquals(2, m.int2IntEntrySet().iterator(new AbstractInt2IntMap.BasicEntry(1, 0)).next().getIntKey());
+		assertEquals(3, m.int2IntEntrySet().spliterator().estimateSize());
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final Int2IntSortedArrayMap m = (Int2IntSortedArrayMap)new Int2IntSortedArrayMap(new int[] { 5, 3, 1, 4, 2 }, new int[] { 50, 30, 10, 40, 20 }).subMap(2, 5);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		final Int2IntSortedArrayMap n = (Int2IntSortedArrayMap)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, n);
+		assertEquals(3, n.size());
+		assertEquals(40, n.get(4));
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Int2IntStaticFunctionTest {
+
+	@Test
+	public void testSmallSizes() {
+		for (int n = 0; n < 100; n++) {
+			final int[] k = new int[n], v = new int[n];
+			for (int i = 0; i < n; i++) {
+				k[i] = i * 31;
+				v[i] = i;
+			}
+			final Int2IntStaticFunction f = new Int2IntStaticFunction(k, v, 0);
+			assertEquals(n, f.size());
+			final boolean[] seen = new boolean[n];
+			for (int i = 0; i < n; i++) {
+				assertEquals(i, f.get(k[i]));
+				assertFalse(seen[f.index(k[i])]);
+				seen[f.index(k[i])] = true;
+			}
+		}
+	}
+
+	@Test
+	public void testVerification() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntOpenHashSet s = new IntOpenHashSet();
+		while (s.size() < 100000) s.add(r.nextInt());
+		final Int2IntOpenHashMap m = new Int2IntOpenHashMap();
+		for (final int x : s) m.put(x, x ^ 0x55555555);
+		m.defaultReturnValue(-1);
+
+		final Int2IntStaticFunction exact = new Int2IntStaticFunction(m, 64);
+		final Int2IntStaticFunction approximate = new Int2IntStaticFunction(m, 8);
+		assertEquals(-1, exact.defaultReturnValue());
+		for (final int x : s) {
+			assertEquals(x ^ 0x55555555, exact.get(x));
+			assertEquals(x ^ 0x55555555, approximate.get(x));
+			assertTrue(exact.containsKey(x));
+		}
+
+		int falsePositives = 0;
+		for (int i = 0; i < 100000; i++) {
+			final int x = r.nextInt();
+			if (s.contains(x)) continue;
+			assertFalse(exact.containsKey(x));
+			assertEquals(-1, exact.get(x));
+			if (approximate.containsKey(x)) falsePositives++;
+		}
+		assertTrue(Integer.toString(falsePositives), falsePositives < 1000);
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final int[] k = new int[1000], v = new int[1000];
+		for (int i = 0; i < k.length; i++) {
+			k[i] = -i;
+			v[i] = i;
+		}
+		final Int2IntStaticFunction f = new Int2IntStaticFunction(k, v, 13);
+		final Int2IntStaticFunction g = (Int2IntStaticFunction)BinIO.loadObject(new ByteArrayInputStream(serialize(f)));
+		for (int i = 0; i < k.length; i++) assertEquals(i, g.get(-i));
+		assertEquals(f.numBits(), g.numBits());
+	}
+
+	private static byte[] serialize(final Object o) throws IOException {
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(o, baos);
+		return baos.toByteArray();
+	}
+
+	@Test(expected = IllegalArgumentException.class)
+	public void testDuplicates() {
+		new Int2IntStaticFunction(new int[] { 1, 2, 1 }, new int[] { 0, 1, 2 }, 0);
+	}
+}
@@ -20,6 +20,10 @@ import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertFalse;
 import static org.junit.Assert.assertTrue;
 
+import java.util.SplittableRandom;
+import java.util.Spliterator;
+import java.util.TreeSet;
+
 import org.junit.Test;
 
 import it.unimi.dsi.fastutil.MainRunner;
@@ -37,6 +41,119 @@ public class IntAVLTreeSetTest {
 		assertFalse(s.add(i));
 		assertEquals(1, s.size());
 	}
+	@Test
+	public void testMapKeySetMerge() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final Int2IntMap m = new Int2IntOpenHashMap();
+		final IntAVLTreeSet u = new IntAVLTreeSet();
+		for (int i = 0; i < 10000; i++) {
+			final int x = r.nextInt(20000);
+			m.put(x, -x);
+			u.add(r.nextInt(20000));
+		}
+		final Int2IntAVLTreeMap intersection = new Int2IntAVLTreeMap(m), difference = new Int2IntAVLTreeMap(m);
+		final Int2IntOpenHashMap ti = new Int2IntOpenHashMap(m), td = new Int2IntOpenHashMap(m);
+		assertTrue(intersection.keySet().retainAll(u));
+		assertFalse(intersection.keySet().retainAll(u));
+		assertTrue(difference.keySet().removeAll(u));
+		assertFalse(difference.keySet().removeAll(u));
+		ti.keySet().retainAll(u);
+		td.keySet().removeAll(u);
+		assertEquals(ti, intersection);
+		assertEquals(td, difference);
+		// Modify the trees, to check that they are well formed
+		for (int i = 0; i < 20000; i += 7) {
+			intersection.put(i, i);
+			ti.put(i, i);
+			difference.remove(i);
+			td.remove(i);
+		}
+		assertEquals(ti, intersection);
+		assertEquals(td, difference);
+		assertEquals(new IntRBTreeSet(ti.keySet()), intersection.keySet());
+	}
+
+	@Test
+	public void testSortedArrayAndMerge() {
+		for (int n = 0; n < 100; n++) {
+			final int[] a = new int[n];
+			for (int i = 0; i < n; i++) a[i] = 3 * i;
+			final IntAVLTreeSet s = new IntAVLTreeSet(a);
+			assertEquals(n, s.size());
+			for (int i = 0; i < 3 * n; i++) assertEquals(i % 3 == 0, s.contains(i));
+			// Modify the tree, to check that it is well formed
+			for (int i = 0; i < 3 * n; i += 2) s.add(i);
+			for (int i = 0; i < 3 * n; i += 5) s.remove(i);
+			final TreeSet<Integer> t = new TreeSet<>();
+			for (int i = 0; i < 3 * n; i++) if ((i % 3 == 0 || i % 2 == 0) && i % 5 != 0) t.add(Integer.valueOf(i));
+			assertEquals(t, s);
+		}
+
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntAVLTreeSet s = new IntAVLTreeSet(), u = new IntAVLTreeSet();
+		final TreeSet<Integer> t = new TreeSet<>();
+		for (int i = 0; i < 10000; i++) {
+			final int x = r.nextInt(20000), y = r.nextInt(20000);
+			s.add(x);
+			t.add(Integer.valueOf(x));
+			u.add(y);
+		}
+		final IntAVLTreeSet union = new IntAVLTreeSet(s), intersection = new IntAVLTreeSet(s), difference = new IntAVLTreeSet(s);
+		assertEquals(s, union);
+		assertTrue(union.addAll(u));
+		assertFalse(union.addAll(u));
+		assertTrue(intersection.retainAll(u));
+		assertTrue(difference.removeAll(u));
+		final TreeSet<Integer> tu = new TreeSet<>(t), ti = new TreeSet<>(t), td = new TreeSet<>(t);
+		tu.addAll(u);
+		ti.retainAll(u);
+		td.removeAll(u);
+		assertEquals(tu, union);
+		assertEquals(ti, intersection);
+		assertEquals(td, difference);
+		assertEquals(tu.first().intValue(), union.firstInt());
+		assertEquals(tu.last().intValue(), union.lastInt());
+		for (int i = 0; i < 20000; i += 3) {
+			assertEquals(tu.add(Integer.valueOf(i)), union.add(i));
+			assertEquals(ti.remove(Integer.valueOf(i)), intersection.remove(i));
+		}
+		assertEquals(tu, union);
+		assertEquals(ti, intersection);
+	}
+
+	private static void split(final IntSpliterator spliterator, final IntArrayList list) {
+		final IntSpliterator prefix = spliterator.trySplit();
+		if (prefix == null) {
+			spliterator.forEachRemaining(list::add);
+			return;
+		}
+		assertTrue((prefix.characteristics() & Spliterator.SORTED) != 0);
+		split(prefix, list);
+		if (spliterator.tryAdvance(list::add)) split(spliterator, list);
+	}
+
+	@Test
+	public void testSpliterator() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntAVLTreeSet s = new IntAVLTreeSet();
+		final Int2IntAVLTreeMap m = new Int2IntAVLTreeMap();
+		for (int i = 0; i < 10000; i++) {
+			final int x = r.nextInt(100000);
+			s.add(x);
+			m.put(x, -x);
+		}
+		final IntSpliterator spliterator = s.spliterator();
+		assertEquals(s.size(), spliterator.estimateSize());
+		assertTrue(spliterator.hasCharacteristics(Spliterator.SORTED | Spliterator.DISTINCT | Spliterator.SIZED));
+		final IntArrayList list = new IntArrayList();
+		split(spliterator, list);
+		assertEquals(new IntArrayList(s), list);
+		assertEquals(s.intStream().asLongStream().sum(), s.intParallelStream().asLongStream().sum());
+		assertEquals(s.size(), m.keySet().intParallelStream().distinct().count());
+		assertEquals(-s.intStream().asLongStream().sum(), m.values().intParallelStream().asLongStream().sum());
+		assertEquals(s.size(), m.int2IntEntrySet().parallelStream().filter(e -> e.getIntKey() == -e.getIntValue()).count());
+	}
+
 	@Test
 	public void testLegacyMainMethodTests() throws Exception {
 		MainRunner.callMainIfExists(IntAVLTreeSet.class, "test", /*num=*/"20", /*seed=*/"423429");
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.file.StandardOpenOption;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+public class IntAppendableMappedBigListTest {
+
+	private static FileChannel open(final File file) throws IOException {
+		return FileChannel.open(file.toPath(), StandardOpenOption.READ, StandardOpenOption.WRITE);
+	}
+
+	@Test
+	public void testAppend() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		final IntBigArrayBigList t = new IntBigArrayBigList();
+		try (FileChannel channel = open(file)) {
+			final IntAppendableMappedBigList list = new IntAppendableMappedBigList(channel, ByteOrder.nativeOrder());
+			final SplittableRandom r = new SplittableRandom(0);
+			for (int i = 0; i < 300000; i++) {
+				final int x = r.nextInt();
+				list.add(x);
+				t.add(x);
+			}
+			final int[] a = new int[100000];
+			for (int i = 0; i < a.length; i++) a[i] = r.nextInt();
+			list.addElements(list.size64(), a, 10, 50000);
+			t.addElements(t.size64(), new int[][] { a }, 10, 50000);
+			assertEquals(t, list);
+
+			list.set(5, 42);
+			t.set(5, 42);
+			list.size(1000);
+			t.size(1000);
+			list.size(2000);
+			t.size(2000);
+			assertEquals(0, list.getInt(1500));
+			assertEquals(t, list);
+			list.force();
+			list.close();
+		}
+
+		assertEquals(2000 * Integer.BYTES, file.length());
+
+		try (FileChannel channel = open(file)) {
+			assertEquals(t, IntMappedBigList.map(channel, ByteOrder.nativeOrder()));
+		}
+
+		try (FileChannel channel = open(file)) {
+			final IntAppendableMappedBigList list = new IntAppendableMappedBigList(channel, ByteOrder.nativeOrder());
+			assertEquals(t, list);
+			list.add(3);
+			t.add(3);
+			assertEquals(t, list);
+			list.close();
+		}
+		assertEquals(2001 * Integer.BYTES, file.length());
+		file.delete();
+	}
+
+	@Test
+	public void testAcrossChunks() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		final int[] a = new int[1 << 20];
+		final long n = IntMappedBigList.CHUNK_SIZE + 10;
+		try (FileChannel channel = open(file)) {
+			final IntAppendableMappedBigList list = new IntAppendableMappedBigList(channel);
+			final SplittableRandom r = new SplittableRandom(0);
+			while (list.size64() < n) {
+				final int l = (int)Math.min(a.length - 1, n - list.size64());
+				for (int i = 1; i <= l; i++) a[i] = r.nextInt();
+				list.addElements(list.size64(), a, 1, l);
+			}
+			assertEquals(n, list.size64());
+			final int[] b = new int[20];
+			list.getElements(IntMappedBigList.CHUNK_SIZE - 10, b, 0, 20);
+			for (int i = 0; i < 20; i++) assertEquals(list.getInt(IntMappedBigList.CHUNK_SIZE - 10 + i), b[i]);
+			list.close();
+		}
+
+		try (FileChannel channel = open(file)) {
+			final IntMappedBigList list = IntMappedBigList.map(channel);
+			assertEquals(n, list.size64());
+			final SplittableRandom r = new SplittableRandom(0);
+			for (long i = 0; i < n; i++) assertEquals(Long.toString(i), r.nextInt(), list.getInt(i));
+		}
+		file.delete();
+	}
+
+	@Test(expected = UnsupportedOperationException.class)
+	public void testAddInTheMiddle() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		try (FileChannel channel = open(file)) {
+			final IntAppendableMappedBigList list = new IntAppendableMappedBigList(channel);
+			list.add(0);
+			list.add(1);
+			list.add(1, 2);
+		} finally {
+			file.delete();
+		}
+	}
+}
@@ -27,6 +27,7 @@ import java.util.Collections;
 
 import org.junit.Test;
 
+import it.unimi.dsi.fastutil.GrowthPolicy;
 import it.unimi.dsi.fastutil.MainRunner;
 
 @SuppressWarnings("static-method")
@@ -596,6 +597,61 @@ class IntArrayListTest {
 		assertEquals(baseList, recombinedList);
 	}
 
+	@Test
+	public void testGrowthPolicy() {
+		final IntArrayList l = new IntArrayList(10);
+		assertSame(GrowthPolicy.ONE_AND_A_HALF, l.growthPolicy());
+		l.growthPolicy(GrowthPolicy.increment(3));
+		for (int i = 0; i < 11; i++) l.add(i);
+		assertEquals(13, l.elements().length);
+		l.growthPolicy(GrowthPolicy.DOUBLING);
+		for (int i = 11; i < 14; i++) l.add(i);
+		assertEquals(26, l.elements().length);
+		l.growthPolicy(GrowthPolicy.capped(GrowthPolicy.DOUBLING, 4));
+		for (int i = 14; i < 27; i++) l.add(i);
+		assertEquals(30, l.elements().length);
+		// Bulk additions get at least what they need
+		l.addElements(l.size(), new int[100]);
+		assertEquals(127, l.elements().length);
+		assertSame(l.growthPolicy(), l.clone().growthPolicy());
+		for (int i = 0; i < 27; i++) assertEquals(i, l.getInt(i));
+		l.growthPolicy(null);
+		assertSame(GrowthPolicy.ONE_AND_A_HALF, l.growthPolicy());
+	}
+
+	@Test
+	public void testNestedSubList() {
+		final IntArrayList l = new IntArrayList();
+		for (int i = 0; i < 100; i++) l.add(i);
+		final IntList s = l.subList(10, 90);
+		final IntList t = s.subList(10, 70);
+		final IntList u = t.subList(10, 50);
+		assertEquals(40, u.size());
+		for (int i = 0; i < 40; i++) assertEquals(30 + i, u.getInt(i));
+		final int[] a = new int[5];
+		u.getElements(3, a, 0, 5);
+		for (int i = 0; i < 5; i++) assertEquals(33 + i, a[i]);
+		assertEquals(30, u.set(0, -1));
+		assertEquals(-1, l.getInt(30));
+		u.add(0, -2);
+		assertEquals(41, u.size());
+		assertEquals(61, t.size());
+		assertEquals(81, s.size());
+		assertEquals(101, l.size());
+		assertEquals(-2, l.getInt(30));
+		assertEquals(-1, u.getInt(1));
+		u.removeInt(0);
+		u.set(0, 30);
+		assertEquals(l.subList(30, 70), u);
+		assertEquals(0, u.compareTo(l.subList(30, 70)));
+		final IntListIterator i = u.listIterator(20);
+		assertEquals(50, i.nextInt());
+		assertEquals(50, i.previousInt());
+		final int[] sum = new int[1];
+		u.spliterator().forEachRemaining((java.util.function.IntConsumer)x -> sum[0] += x);
+		assertEquals((30 + 69) * 40 / 2, sum[0]);
+	}
+
 	@Test
 	public void testLegacyMainMethodTests() throws Exception {
 		MainRunner.callMainIfExists(IntArrayList.class, "test", /*num=*/"500", /*seed=*/"939384");
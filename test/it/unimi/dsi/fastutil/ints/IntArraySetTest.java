@@ -144,6 +144,55 @@ public class IntArraySetTest {
 		assertEquals(new IntArraySet(new int[] { 42, 44 }), set);
 	}
 
+	@Test
+	public void testLarge() {
+		final java.util.SplittableRandom r = new java.util.SplittableRandom(0);
+		final IntArraySet s = new IntArraySet();
+		final IntLinkedOpenHashSet t = new IntLinkedOpenHashSet();
+		for (int i = 0; i < 100000; i++) {
+			final int k = r.nextInt(64);
+			switch (r.nextInt(4)) {
+			case 0:
+				assertEquals(t.remove(k), s.remove(k));
+				break;
+			case 1:
+				assertEquals(t.contains(k), s.contains(k));
+				break;
+			default:
+				assertEquals(t.add(k), s.add(k));
+			}
+			if (i % 1000 == 0) {
+				for (final IntIterator iterator = s.iterator(); iterator.hasNext();) if (iterator.nextInt() % 3 == 0) iterator.remove();
+				t.removeIf((IntPredicate)x -> x % 3 == 0);
+				assertArrayEquals(t.toIntArray(), s.toIntArray());
+			}
+		}
+		assertEquals(t, s);
+		assertEquals(t, s.clone());
+		s.clear();
+		assertFalse(s.contains(0));
+	}
+
+	@Test
+	public void testConcurrentContains() throws InterruptedException {
+		final IntArraySet s = new IntArraySet();
+		for (int i = 0; i < 64; i++) s.add(2 * i);
+		final Thread[] thread = new Thread[8];
+		final java.util.concurrent.atomic.AtomicInteger errors = new java.util.concurrent.atomic.AtomicInteger();
+		for (int t = 0; t < thread.length; t++) {
+			thread[t] = new Thread(() -> {
+				for (int i = 0; i < 100000; i++) {
+					final int k = i % 130;
+					if (s.contains(k) != (k % 2 == 0 && k < 128)) errors.incrementAndGet();
+				}
+			});
+			thread[t].start();
+		}
+		for (final Thread t : thread) t.join();
+		assertEquals(0, errors.get());
+		assertEquals(64, s.size());
+	}
+
 	@Test
 	public void testOf() {
 		final IntArraySet s = IntArraySet.of(0, 1, 2);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.TreeSet;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class IntBTreeSetTest {
+
+	@Test
+	public void testAddAndGet() {
+		final IntBTreeSet s = new IntBTreeSet();
+		assertTrue(s.isEmpty());
+		assertEquals(0, s.size());
+		assertTrue(s.add(0));
+		assertTrue(s.contains(0));
+		assertFalse(s.add(0));
+		assertEquals(1, s.size());
+		assertTrue(s.remove(0));
+		assertFalse(s.remove(0));
+		assertTrue(s.isEmpty());
+	}
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntBTreeSet s = new IntBTreeSet();
+		final TreeSet<Integer> t = new TreeSet<>();
+		for (int i = 0; i < 200000; i++) {
+			final int k = r.nextInt(10000);
+			if (r.nextBoolean()) assertEquals(t.add(Integer.valueOf(k)), s.add(k));
+			else assertEquals(t.remove(Integer.valueOf(k)), s.remove(k));
+		}
+		assertEquals(t, s);
+		final IntSortedSet sub = s.subSet(1000, 2000);
+		assertEquals(t.subSet(Integer.valueOf(1000), Integer.valueOf(2000)), sub);
+		assertEquals(sub.contains(1500), sub.remove(1500));
+		assertFalse(s.contains(1500));
+		assertTrue(sub.add(1500));
+		assertTrue(s.contains(1500));
+		assertEquals(t.headSet(Integer.valueOf(5000)).size() + (t.contains(Integer.valueOf(1500)) ? 0 : 1), s.headSet(5000).size());
+	}
+
+	@Test
+	public void testRankAndSelect() {
+		final SplittableRandom r = new SplittableRandom(1);
+		final IntBTreeSet s = new IntBTreeSet();
+		for (int i = 0; i < 100000; i++) s.add(r.nextInt(1000000));
+		for (int i = 0; i < 50000; i++) s.remove(r.nextInt(1000000));
+		final int[] a = s.toIntArray();
+		for (int i = 0; i < a.length; i++) {
+			assertEquals(a[i], s.select(i));
+			assertEquals(i, s.rank(a[i]));
+			assertEquals(i + 1, s.rank(a[i] + 1));
+		}
+		assertEquals(0, s.rank(Integer.MIN_VALUE));
+		assertEquals(a.length, s.rank(Integer.MAX_VALUE));
+		for (int i = 0; i < a.length - 1000; i += 997) assertEquals(1000, s.subSet(a[i], a[i + 1000]).size());
+		assertEquals(a.length - 1000, s.tailSet(a[1000]).size());
+		assertEquals(1000, s.headSet(a[1000]).size());
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final IntBTreeSet s = new IntBTreeSet();
+		for (int i = 0; i < 1000; i++) s.add(i * i);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(s, baos);
+		final IntBTreeSet t = (IntBTreeSet)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(s, t);
+		assertTrue(t.add(-1));
+		assertFalse(t.add(4));
+		assertTrue(t.remove(4));
+		final IntBTreeSet c = t.clone();
+		assertEquals(t, c);
+		assertTrue(c.add(4));
+		assertFalse(t.contains(4));
+	}
+}
@@ -31,6 +31,7 @@ import org.junit.Ignore;
 import org.junit.Test;
 
 import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.GrowthPolicy;
 import it.unimi.dsi.fastutil.MainRunner;
 
 @SuppressWarnings({"rawtypes", "static-method"})
@@ -827,6 +828,20 @@ public class IntBigArrayBigListTest {
 		assertEquals(baseList, recombinedList);
 	}
 
+	@Test
+	public void testGrowthPolicy() {
+		final IntBigArrayBigList l = new IntBigArrayBigList(10);
+		assertSame(GrowthPolicy.ONE_AND_A_HALF, l.growthPolicy());
+		l.growthPolicy(GrowthPolicy.increment(5));
+		for (int i = 0; i < 11; i++) l.add(i);
+		assertEquals(15, BigArrays.length(l.elements()));
+		l.growthPolicy(GrowthPolicy.DOUBLING);
+		for (int i = 11; i < 16; i++) l.add(i);
+		assertEquals(30, BigArrays.length(l.elements()));
+		assertSame(l.growthPolicy(), l.clone().growthPolicy());
+		for (int i = 0; i < 16; i++) assertEquals(i, l.getInt(i));
+	}
+
 	@Test
 	public void testLegacyMainMethodTests() throws Exception {
 		MainRunner.callMainIfExists(IntBigArrayBigList.class, "test", /*num=*/"200", /*seed=*/"90293");
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class IntChunkedListTest {
+
+	private static void check(final IntArrayList t, final IntChunkedList l) {
+		assertEquals(t.size(), l.size());
+		assertEquals(t, l);
+		assertArrayEquals(t.toIntArray(), l.toIntArray());
+		final IntArrayList s = new IntArrayList();
+		l.forEach((java.util.function.IntConsumer)s::add);
+		assertEquals(t, s);
+		assertEquals(t.intStream().sum(), l.intStream().parallel().sum());
+		assertEquals(t.size(), l.intStream().parallel().count());
+	}
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntChunkedList l = new IntChunkedList();
+		final IntArrayList t = new IntArrayList();
+		for (int i = 0; i < 100000; i++) {
+			final int k = r.nextInt();
+			final int op = r.nextInt(100);
+			if (op < 40) {
+				final int p = r.nextInt(t.size() + 1);
+				l.add(p, k);
+				t.add(p, k);
+			}
+			else if (op < 45) {
+				l.add(k);
+				t.add(k);
+			}
+			else if (op < 75) {
+				if (! t.isEmpty()) {
+					final int p = r.nextInt(t.size());
+					assertEquals(t.removeInt(p), l.removeInt(p));
+				}
+			}
+			else if (op < 90) {
+				if (! t.isEmpty()) {
+					final int p = r.nextInt(t.size());
+					assertEquals(t.set(p, k), l.set(p, k));
+					assertEquals(t.getInt(p), l.getInt(p));
+				}
+			}
+			else if (op < 95) {
+				final int[] a = new int[r.nextInt(r.nextBoolean() ? 10 : 5000)];
+				for (int j = 0; j < a.length; j++) a[j] = r.nextInt();
+				final int p = r.nextInt(t.size() + 1);
+				l.addElements(p, a);
+				t.addElements(p, a);
+			}
+			else {
+				final int from = r.nextInt(t.size() + 1);
+				final int to = from + r.nextInt(Math.min(t.size() - from, r.nextBoolean() ? 10 : 5000) + 1);
+				l.removeElements(from, to);
+				t.removeElements(from, to);
+			}
+			assertEquals(t.size(), l.size());
+			if (i % 10000 == 0) check(t, l);
+		}
+		check(t, l);
+
+		for (int i = 0; i < 1000; i++) {
+			final int from = r.nextInt(t.size() + 1);
+			final int length = r.nextInt(Math.min(t.size() - from, 5000) + 1);
+			final int[] a = new int[length + 1], b = new int[length + 1];
+			l.getElements(from, a, 1, length);
+			t.getElements(from, b, 1, length);
+			assertArrayEquals(b, a);
+		}
+
+		final int k = t.getInt(t.size() / 2);
+		assertEquals(t.indexOf(k), l.indexOf(k));
+		assertEquals(t.lastIndexOf(k), l.lastIndexOf(k));
+		assertEquals(t.indexOf(Integer.MIN_VALUE), l.indexOf(Integer.MIN_VALUE));
+
+		l.removeElements(0, l.size());
+		t.clear();
+		check(t, l);
+	}
+
+	@Test
+	public void testListIterator() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final int[] a = new int[10000];
+		for (int i = 0; i < a.length; i++) a[i] = r.nextInt();
+		final IntChunkedList l = new IntChunkedList(a);
+		final IntArrayList t = IntArrayList.wrap(a.clone());
+		final IntListIterator i = l.listIterator(5000), j = t.listIterator(5000);
+		for (int k = 0; k < 100000; k++) {
+			switch (r.nextInt(6)) {
+			case 0:
+				assertEquals(j.hasNext(), i.hasNext());
+				if (j.hasNext()) assertEquals(j.nextInt(), i.nextInt());
+				break;
+			case 1:
+				assertEquals(j.hasPrevious(), i.hasPrevious());
+				if (j.hasPrevious()) assertEquals(j.previousInt(), i.previousInt());
+				break;
+			case 2:
+				final int x = r.nextInt();
+				i.add(x);
+				j.add(x);
+				break;
+			case 3:
+				final int n = r.nextInt(100);
+				if (r.nextBoolean()) assertEquals(j.skip(n), i.skip(n));
+				else assertEquals(j.back(n), i.back(n));
+				break;
+			default:
+				if (j.hasNext()) {
+					assertEquals(j.nextInt(), i.nextInt());
+					if (r.nextBoolean()) {
+						i.remove();
+						j.remove();
+					}
+					else {
+						i.set(k);
+						j.set(k);
+					}
+				}
+			}
+			assertEquals(j.nextIndex(), i.nextIndex());
+		}
+		assertEquals(t, l);
+		final IntListIterator e = l.listIterator(l.size() / 3);
+		final IntArrayList rest = new IntArrayList();
+		e.forEachRemaining((java.util.function.IntConsumer)rest::add);
+		assertEquals(t.subList(t.size() / 3, t.size()), rest);
+		assertFalse(e.hasNext());
+	}
+
+	@Test
+	public void testSpliterator() {
+		final int[] a = new int[100000];
+		for (int i = 0; i < a.length; i++) a[i] = i;
+		final IntChunkedList l = new IntChunkedList(a);
+		l.add(50000, -1);
+		final IntSpliterator s = l.spliterator();
+		final IntSpliterator prefix = s.trySplit();
+		// Splits happen at chunk boundaries
+		assertEquals(0, prefix.estimateSize() % IntChunkedList.CHUNK_SIZE);
+		assertEquals(l.size(), prefix.estimateSize() + s.estimateSize());
+		final IntArrayList t = new IntArrayList();
+		prefix.forEachRemaining((java.util.function.IntConsumer)t::add);
+		s.tryAdvance((java.util.function.IntConsumer)t::add);
+		assertEquals(10, s.skip(10));
+		s.forEachRemaining((java.util.function.IntConsumer)t::add);
+		final IntArrayList expected = new IntArrayList(l);
+		expected.removeElements(49153, 49163);
+		assertEquals(expected, t);
+	}
+
+	@Test
+	public void testCloneAndSerialization() throws IOException, ClassNotFoundException {
+		final int[] a = new int[5000];
+		for (int i = 0; i < a.length; i++) a[i] = i;
+		final IntChunkedList l = new IntChunkedList(a);
+		l.removeElements(100, 3000);
+		final IntChunkedList c = l.clone();
+		c.add(0, 1);
+		assertEquals(2100, l.size());
+		assertEquals(2101, c.size());
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(l, baos);
+		final IntChunkedList m = (IntChunkedList)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(l, m);
+		m.add(1000, 4);
+		assertEquals(4, m.getInt(1000));
+	}
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.util.SplittableRandom;
+import java.util.TreeSet;
+import java.util.concurrent.BrokenBarrierException;
+import java.util.concurrent.CyclicBarrier;
+
+import org.junit.Test;
+
+public class IntConcurrentSkipListSetTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntConcurrentSkipListSet s = new IntConcurrentSkipListSet();
+		final TreeSet<Integer> t = new TreeSet<>();
+		for (int i = 0; i < 100000; i++) {
+			final int k = r.nextInt(5000);
+			if (r.nextBoolean()) assertEquals(t.add(Integer.valueOf(k)), s.add(k));
+			else assertEquals(t.remove(Integer.valueOf(k)), s.remove(k));
+		}
+		assertEquals(t, s);
+		assertEquals(t.headSet(Integer.valueOf(1000)), s.headSet(1000));
+		assertEquals(t.subSet(Integer.valueOf(1000), Integer.valueOf(2000)), s.subSet(1000, 2000));
+		assertEquals(t.tailSet(Integer.valueOf(4000)), s.tailSet(4000));
+		assertEquals(t.first().intValue(), s.firstInt());
+		assertEquals(t.last().intValue(), s.lastInt());
+		assertEquals(new IntRBTreeSet(t), new IntConcurrentSkipListSet(s));
+	}
+
+	@Test
+	public void testConcurrentAdd() throws InterruptedException {
+		final IntConcurrentSkipListSet s = new IntConcurrentSkipListSet();
+		final Thread[] thread = new Thread[8];
+		final CyclicBarrier barrier = new CyclicBarrier(thread.length);
+		for (int t = 0; t < thread.length; t++) {
+			final int offset = t;
+			// Threads insert overlapping ranges, and then remove the odd elements of a private range
+			thread[t] = new Thread(() -> {
+				for (int i = offset * 10000; i < offset * 10000 + 20000; i++) s.add(i);
+				try {
+					barrier.await();
+				}
+				catch (InterruptedException | BrokenBarrierException e) {
+					throw new RuntimeException(e);
+				}
+				for (int i = offset * 10000 + 1; i < offset * 10000 + 10000; i += 2) assertTrue(s.remove(i));
+			});
+			thread[t].start();
+		}
+		for (final Thread t : thread) t.join();
+		for (int i = 0; i < 90000; i++) assertEquals(i % 2 == 0 || i >= 80000, s.contains(i));
+		assertEquals(50000, s.size());
+		assertEquals(s.size(), s.intParallelStream().count());
+		assertFalse(s.contains(-1));
+	}
+}
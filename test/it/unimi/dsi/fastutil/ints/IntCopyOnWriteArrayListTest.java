@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class IntCopyOnWriteArrayListTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList();
+		final IntArrayList t = new IntArrayList();
+		for (int i = 0; i < 10000; i++) {
+			final int k = r.nextInt(100);
+			switch (r.nextInt(6)) {
+			case 0:
+				l.add(k);
+				t.add(k);
+				break;
+			case 1:
+				final int p = r.nextInt(t.size() + 1);
+				l.add(p, k);
+				t.add(p, k);
+				break;
+			case 2:
+				assertEquals(t.rem(k), l.rem(k));
+				break;
+			case 3:
+				if (! t.isEmpty()) {
+					final int q = r.nextInt(t.size());
+					assertEquals(t.removeInt(q), l.removeInt(q));
+				}
+				break;
+			case 4:
+				if (! t.isEmpty()) {
+					final int q = r.nextInt(t.size());
+					assertEquals(t.set(q, k), l.set(q, k));
+				}
+				break;
+			default:
+				final int[] a = { k, k + 1, k + 2 };
+				final int s = r.nextInt(t.size() + 1);
+				l.addElements(s, a);
+				t.addElements(s, a);
+			}
+			assertEquals(t.size(), l.size());
+		}
+		assertEquals(t, l);
+		assertEquals(t.indexOf(50), l.indexOf(50));
+		assertEquals(t.lastIndexOf(50), l.lastIndexOf(50));
+
+		l.removeIf((java.util.function.IntPredicate)x -> x % 3 == 0);
+		t.removeIf((java.util.function.IntPredicate)x -> x % 3 == 0);
+		assertEquals(t, l);
+		l.removeAll(IntArrayList.wrap(new int[] { 1, 2 }));
+		t.removeAll(IntArrayList.wrap(new int[] { 1, 2 }));
+		assertEquals(t, l);
+		l.retainAll(IntArrayList.wrap(new int[] { 4, 5, 7, 8 }));
+		t.retainAll(IntArrayList.wrap(new int[] { 4, 5, 7, 8 }));
+		assertEquals(t, l);
+		l.replaceAll((java.util.function.IntUnaryOperator)x -> x * 2);
+		t.replaceAll((java.util.function.IntUnaryOperator)x -> x * 2);
+		assertEquals(t, l);
+		l.sort(null);
+		t.sort(null);
+		assertEquals(t, l);
+		l.removeElements(0, l.size() / 2);
+		t.removeElements(0, t.size() / 2);
+		assertEquals(t, l);
+		l.size(t.size() + 10);
+		t.size(t.size() + 10);
+		assertEquals(t, l);
+		l.clear();
+		assertTrue(l.isEmpty());
+	}
+
+	@Test
+	public void testSnapshot() {
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList(new int[] { 0, 1, 2, 3 });
+		final IntListIterator i = l.iterator();
+		final IntImmutableList s = l.snapshot();
+		final IntSpliterator spliterator = l.spliterator();
+		l.add(4);
+		l.set(0, 10);
+		assertEquals(IntArrayList.wrap(new int[] { 0, 1, 2, 3 }), new IntArrayList(i));
+		assertEquals(IntArrayList.wrap(new int[] { 0, 1, 2, 3 }), s);
+		final IntArrayList t = new IntArrayList();
+		spliterator.forEachRemaining((java.util.function.IntConsumer)t::add);
+		assertEquals(IntArrayList.wrap(new int[] { 0, 1, 2, 3 }), t);
+		assertEquals(IntArrayList.wrap(new int[] { 10, 1, 2, 3, 4 }), l);
+	}
+
+	@Test(expected = UnsupportedOperationException.class)
+	public void testIteratorRemove() {
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList(new int[] { 0, 1 });
+		final IntListIterator i = l.iterator();
+		i.nextInt();
+		i.remove();
+	}
+
+	@Test
+	public void testUpdate() {
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList(new int[] { 3, 1, 2 });
+		final IntImmutableList s = l.snapshot();
+		l.update(t -> {
+			t.add(0);
+			t.removeInt(0);
+			t.unstableSort(null);
+		});
+		assertEquals(IntArrayList.wrap(new int[] { 0, 1, 2 }), l);
+		assertEquals(IntArrayList.wrap(new int[] { 3, 1, 2 }), s);
+	}
+
+	@Test
+	public void testConcurrentReaders() throws InterruptedException {
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList();
+		final AtomicBoolean done = new AtomicBoolean(), failed = new AtomicBoolean();
+		final Thread[] readers = new Thread[4];
+		for (int k = 0; k < readers.length; k++) {
+			readers[k] = new Thread(() -> {
+				while (! done.get()) {
+					// Each snapshot is a prefix of 0, 1, 2, ...
+					final IntListIterator i = l.iterator();
+					for (int j = 0; i.hasNext(); j++) if (i.nextInt() != j) failed.set(true);
+				}
+			});
+			readers[k].start();
+		}
+		for (int i = 0; i < 2000; i++) {
+			if (i % 20 == 0) {
+				final int start = l.size();
+				l.update(t -> { for (int j = 0; j < 10; j++) t.add(start + j); });
+				i += 9;
+			}
+			else l.add(i);
+		}
+		done.set(true);
+		for (final Thread t : readers) t.join();
+		assertFalse(failed.get());
+		assertEquals(2000, l.size());
+	}
+
+	@Test
+	public void testCloneAndSerialization() throws IOException, ClassNotFoundException {
+		final IntCopyOnWriteArrayList l = new IntCopyOnWriteArrayList(new int[] { 5, 3, 1 });
+		final IntCopyOnWriteArrayList c = l.clone();
+		c.add(7);
+		assertEquals(3, l.size());
+		assertEquals(4, c.size());
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(l, baos);
+		final IntCopyOnWriteArrayList m = (IntCopyOnWriteArrayList)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(l, m);
+		m.add(4);
+		assertEquals(4, m.getInt(3));
+	}
+}
@@ -63,6 +63,15 @@ public class IntMappedBigListTest {
 		r = new SplittableRandom(1);
 		for (long i = 0; i < IntMappedBigList.CHUNK_SIZE + 10; i++) assertEquals(Long.toString(i), r.nextInt(), list.getInt(i));
 
+		r = new SplittableRandom(1);
+		long sum = 0;
+		for (long i = 0; i < IntMappedBigList.CHUNK_SIZE + 10; i++) sum += r.nextInt();
+		assertEquals(sum, list.intParallelStream().asLongStream().sum());
+		final IntSpliterator spliterator = list.spliterator();
+		final IntSpliterator prefix = spliterator.trySplit();
+		assertEquals(IntMappedBigList.CHUNK_SIZE, prefix.estimateSize());
+		assertEquals(10, spliterator.estimateSize());
+
 
 		file.delete();
 
@@ -131,4 +140,63 @@ public class IntMappedBigListTest {
 		for (long i = 0; i < 100; i++) assertEquals(Long.toString(i), r.nextInt(), copy.getInt(i));
 		file.delete();
 	}
+
+	@Test
+	public void testPrefetch() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		final int n = 20_000_000;
+		final DataOutputStream dos = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(file)));
+		for (int i = 0; i < n; i++) dos.writeInt(i);
+		dos.close();
+
+		final IntMappedBigList list = IntMappedBigList.map(FileChannel.open(file.toPath()));
+		list.prefetch(1, 1);
+		list.prefetch(1000, 1001);
+		list.prefetch(3, n - 7);
+		list.load();
+		assertEquals(1000, list.getInt(1000));
+		assertEquals(n - 1, list.getInt(n - 1));
+		list.copy().load();
+		file.delete();
+	}
+
+	@Test(expected = IndexOutOfBoundsException.class)
+	public void testPrefetchOutOfBounds() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		final DataOutputStream dos = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(file)));
+		for (int i = 0; i < 10; i++) dos.writeInt(i);
+		dos.close();
+		try {
+			IntMappedBigList.map(FileChannel.open(file.toPath())).prefetch(0, 11);
+		} finally {
+			file.delete();
+		}
+	}
+
+	@Test
+	public void testSpliterator() throws IOException {
+		final File file = File.createTempFile(this.getClass().getName(), ".bin");
+		file.deleteOnExit();
+		final DataOutputStream dos = new DataOutputStream(new FastBufferedOutputStream(new FileOutputStream(file)));
+		for (int i = 0; i < 1000; i++) dos.writeInt(i);
+		dos.close();
+
+		final IntMappedBigList list = IntMappedBigList.map(FileChannel.open(file.toPath()));
+		final IntSpliterator spliterator = list.spliterator();
+		assertEquals(1000, spliterator.estimateSize());
+		final IntSpliterator prefix = spliterator.trySplit();
+		assertEquals(500, prefix.estimateSize());
+		assertEquals(500, spliterator.estimateSize());
+		assertEquals(10, prefix.skip(10));
+		final IntArrayList l = new IntArrayList();
+		prefix.tryAdvance((java.util.function.IntConsumer)l::add);
+		prefix.forEachRemaining((java.util.function.IntConsumer)l::add);
+		spliterator.forEachRemaining((java.util.function.IntConsumer)l::add);
+		assertEquals(990, l.size());
+		for (int i = 0; i < 990; i++) assertEquals(i + 10, l.getInt(i));
+		assertEquals(999L * 1000 / 2, list.intParallelStream().asLongStream().sum());
+		file.delete();
+	}
 }
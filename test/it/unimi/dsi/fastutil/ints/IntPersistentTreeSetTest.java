@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.ints;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.TreeSet;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class IntPersistentTreeSetTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		IntPersistentTreeSet s = new IntPersistentTreeSet();
+		final IntPersistentTreeSet empty = s;
+		final TreeSet<Integer> t = new TreeSet<>();
+		for (int i = 0; i < 50000; i++) {
+			final int k = r.nextInt(5000);
+			if (r.nextInt(3) != 0) {
+				final IntPersistentTreeSet u = s.with(k);
+				assertEquals(t.add(Integer.valueOf(k)), u != s);
+				s = u;
+			}
+			else {
+				final IntPersistentTreeSet u = s.without(k);
+				assertEquals(t.remove(Integer.valueOf(k)), u != s);
+				s = u;
+			}
+		}
+		assertEquals(t, s);
+		assertTrue(empty.isEmpty());
+		assertEquals(t.headSet(Integer.valueOf(1000)), s.headSet(1000));
+		assertEquals(t.subSet(Integer.valueOf(1000), Integer.valueOf(2000)), s.subSet(1000, 2000));
+		assertEquals(new IntRBTreeSet(t), new IntPersistentTreeSet(new IntRBTreeSet(t)));
+	}
+
+	@Test
+	public void testTransient() {
+		final IntPersistentTreeSet s = new IntPersistentTreeSet(new int[] { 3, 1, 2 });
+		final IntPersistentTreeSet.Transient t = s.asTransient();
+		assertFalse(t.add(1));
+		assertTrue(t.add(0));
+		assertTrue(t.remove(3));
+		assertFalse(t.remove(3));
+		assertTrue(t.contains(0));
+		assertEquals(3, t.size());
+		assertEquals(new IntRBTreeSet(new int[] { 0, 1, 2 }), t.persistent());
+		assertEquals(new IntRBTreeSet(new int[] { 1, 2, 3 }), s);
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final IntPersistentTreeSet s = new IntPersistentTreeSet(new int[] { 5, 3, 1, 4, 2 });
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(s, baos);
+		final IntPersistentTreeSet t = (IntPersistentTreeSet)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(s, t);
+		assertSame(t, t.with(3));
+		assertEquals(6, t.with(6).size());
+	}
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertSame;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.SplittableRandom;
+import java.util.TreeMap;
+import java.util.function.LongConsumer;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Long2LongPersistentTreeMapTest {
+
+	@Test
+	public void testVersions() {
+		final SplittableRandom r = new SplittableRandom(0);
+		Long2LongPersistentTreeMap m = new Long2LongPersistentTreeMap();
+		final TreeMap<Long, Long> t = new TreeMap<>();
+		final ArrayList<Long2LongPersistentTreeMap> versions = new ArrayList<>();
+		final ArrayList<TreeMap<Long, Long>> snapshots = new ArrayList<>();
+		for (int i = 0; i < 20000; i++) {
+			final long k = r.nextInt(5000);
+			if (r.nextInt(3) != 0) {
+				m = m.with(k, i);
+				t.put(Long.valueOf(k), Long.valueOf(i));
+			}
+			else {
+				final Long2LongPersistentTreeMap n = m.without(k);
+				if (t.remove(Long.valueOf(k)) == null) assertSame(m, n);
+				m = n;
+			}
+			if (i % 1000 == 0) {
+				versions.add(m);
+				snapshots.add(new TreeMap<>(t));
+			}
+		}
+		assertEquals(t, m);
+		assertEquals(t.firstKey().longValue(), m.firstLongKey());
+		assertEquals(t.lastKey().longValue(), m.lastLongKey());
+		for (int i = 0; i < versions.size(); i++) assertEquals(snapshots.get(i), versions.get(i));
+	}
+
+	@Test
+	public void testTransient() {
+		final SplittableRandom r = new SplittableRandom(1);
+		final Long2LongPersistentTreeMap m = new Long2LongPersistentTreeMap(new long[] { 1, 2, 3 }, new long[] { 1, 2, 3 });
+		m.defaultReturnValue(-1);
+		final Long2LongPersistentTreeMap.Transient t = m.asTransient();
+		final TreeMap<Long, Long> s = new TreeMap<>(m);
+		for (int i = 0; i < 100000; i++) {
+			final long k = r.nextInt(10000);
+			if (r.nextInt(3) != 0) {
+				final Long old = s.put(Long.valueOf(k), Long.valueOf(i));
+				assertEquals(old == null ? -1 : old.longValue(), t.put(k, i));
+			}
+			else {
+				final Long old = s.remove(Long.valueOf(k));
+				assertEquals(old == null ? -1 : old.longValue(), t.remove(k));
+			}
+		}
+		assertEquals(s.size(), t.size());
+		final Long2LongPersistentTreeMap p = t.persistent();
+		assertEquals(s, p);
+		assertEquals(-1, p.get(-1));
+		assertEquals(3, m.size());
+		assertEquals(2, m.get(2));
+		boolean thrown = false;
+		try {
+			t.put(0, 0);
+		}
+		catch(final IllegalStateException e) {
+			thrown = true;
+		}
+		assertTrue(thrown);
+	}
+
+	@Test
+	public void testSubmaps() {
+		Long2LongPersistentTreeMap m = new Long2LongPersistentTreeMap();
+		final TreeMap<Long, Long> t = new TreeMap<>();
+		for (long i = 0; i < 10000; i += 3) {
+			m = m.with(i, -i);
+			t.put(Long.valueOf(i), Long.valueOf(-i));
+		}
+		for (long from = -10; from < 10010; from += 997) {
+			assertEquals(t.tailMap(Long.valueOf(from)), m.tailMap(from));
+			assertEquals(t.headMap(Long.valueOf(from)), m.headMap(from));
+			for (long to = from; to < 10010; to += 1409) assertEquals(t.subMap(Long.valueOf(from), Long.valueOf(to)), m.subMap(from, to));
+		}
+		assertSame(m, m.headMap(10000));
+		final Long2LongPersistentTreeMap s = m.subMap(100, 200);
+		assertEquals(102, s.firstLongKey());
+		assertEquals(198, s.lastLongKey());
+		assertFalse(s.containsKey(99));
+		assertTrue(m.containsKey(99));
+	}
+
+	@Test
+	public void testIterators() {
+		Long2LongPersistentTreeMap m = new Long2LongPersistentTreeMap();
+		for (long i = 0; i < 1000; i++) m = m.with(i * 2, i);
+		final LongBidirectionalIterator i = m.keySet().iterator(99);
+		assertEquals(100, i.nextLong());
+		assertEquals(100, i.previousLong());
+		assertEquals(98, i.previousLong());
+		assertFalse(m.keySet().iterator(1998).hasNext());
+		assertEquals(1998, m.keySet().iterator(1998).previousLong());
+		final LongBidirectionalIterator j = m.keySet().iterator(-1);
+		assertFalse(j.hasPrevious());
+		for (long k = 0; k < 2000; k += 2) assertEquals(k, j.nextLong());
+		assertFalse(j.hasNext());
+		for (long k = 1998; k >= 0; k -= 2) assertEquals(k, j.previousLong());
+	}
+
+	@Test
+	public void testSpliterator() {
+		final Long2LongPersistentTreeMap.Transient t = new Long2LongPersistentTreeMap().asTransient();
+		for (long i = 0; i < 100000; i++) t.put(i, -i);
+		final Long2LongPersistentTreeMap m = t.persistent();
+		assertEquals(100000L * 99999 / 2, m.keySet().longParallelStream().sum());
+		assertEquals(-100000L * 99999 / 2, m.values().longParallelStream().sum());
+		assertEquals(100000, m.long2LongEntrySet().parallelStream().filter(e -> e.getLongKey() == -e.getLongValue()).count());
+		final LongSpliterator s = m.keySet().spliterator();
+		final LongSpliterator prefix = s.trySplit();
+		assertEquals(50000, prefix.estimateSize());
+		assertEquals(50000, s.estimateSize());
+		final long[] first = new long[1];
+		assertTrue(s.tryAdvance((LongConsumer)x -> first[0] = x));
+		assertEquals(50000, first[0]);
+		final LongArrayList l = new LongArrayList();
+		prefix.forEachRemaining((LongConsumer)l::add);
+		assertEquals(LongArrayList.wrap(m.headMap(50000).keySet().toLongArray()), l);
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		Long2LongPersistentTreeMap m = new Long2LongPersistentTreeMap(LongComparators.OPPOSITE_COMPARATOR);
+		for (long i = 0; i < 1000; i++) m = m.with(i * i, i);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		final Long2LongPersistentTreeMap n = (Long2LongPersistentTreeMap)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, n);
+		assertEquals(999 * 999, n.firstLongKey());
+		assertEquals(m, n.with(-1, 0).without(-1));
+	}
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertNull;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.TreeMap;
+import java.util.concurrent.atomic.AtomicBoolean;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class Long2ObjectConcurrentSkipListMapTest {
+
+	@Test
+	public void testRandom() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>();
+		final TreeMap<Long, String> t = new TreeMap<>();
+		for (int i = 0; i < 100000; i++) {
+			final long k = r.nextInt(10000);
+			final String v = Integer.toString(i);
+			switch (r.nextInt(5)) {
+			case 0:
+			case 1:
+				assertEquals(t.put(Long.valueOf(k), v), m.put(k, v));
+				break;
+			case 2:
+				assertEquals(t.putIfAbsent(Long.valueOf(k), v), m.putIfAbsent(k, v));
+				break;
+			case 3:
+				assertEquals(t.remove(Long.valueOf(k)), m.remove(k));
+				break;
+			default:
+				assertEquals(t.get(Long.valueOf(k)), m.get(k));
+			}
+		}
+		assertEquals(t.size(), m.size());
+		assertEquals(t, m);
+		assertEquals(t.firstKey().longValue(), m.firstLongKey());
+		assertEquals(t.lastKey().longValue(), m.lastLongKey());
+		final long k = t.firstKey().longValue();
+		assertFalse(m.replace(k, "", "x"));
+		assertTrue(m.replace(k, t.get(Long.valueOf(k)), "x"));
+		assertEquals("x", m.replace(k, "y"));
+		assertFalse(m.remove(k, "x"));
+		assertTrue(m.remove(k, "y"));
+		assertNull(m.get(k));
+		m.clear();
+		assertTrue(m.isEmpty());
+		assertEquals(0, m.size());
+	}
+
+	@Test
+	public void testSubmaps() {
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>();
+		final TreeMap<Long, String> t = new TreeMap<>();
+		for (long i = 0; i < 1000; i += 3) {
+			m.put(i, Long.toString(i));
+			t.put(Long.valueOf(i), Long.toString(i));
+		}
+		for (long from = -10; from < 1010; from += 97) {
+			assertEquals(t.tailMap(Long.valueOf(from)), m.tailMap(from));
+			assertEquals(t.headMap(Long.valueOf(from)), m.headMap(from));
+			for (long to = from; to < 1010; to += 141) {
+				assertEquals(t.subMap(Long.valueOf(from), Long.valueOf(to)), m.subMap(from, to));
+				assertEquals(t.subMap(Long.valueOf(from), Long.valueOf(to)).keySet(), m.subMap(from, to).keySet());
+			}
+		}
+		final Long2ObjectSortedMap<String> s = m.subMap(100, 200);
+		assertEquals(102, s.firstLongKey());
+		assertEquals(198, s.lastLongKey());
+		assertEquals(33, s.size());
+		s.put(100, "100");
+		assertEquals("100", m.get(100));
+		s.remove(102);
+		assertFalse(m.containsKey(102));
+		assertFalse(s.containsKey(99));
+		boolean thrown = false;
+		try {
+			s.put(200, "200");
+		}
+		catch(final IllegalArgumentException e) {
+			thrown = true;
+		}
+		assertTrue(thrown);
+		s.clear();
+		assertTrue(s.isEmpty());
+		assertEquals(99, m.headMap(200).lastLongKey());
+		assertEquals(201, m.tailMap(100).firstLongKey());
+	}
+
+	@Test
+	public void testIterators() {
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>();
+		for (long i = 0; i < 1000; i++) m.put(i * 2, Long.toString(i));
+		final LongBidirectionalIterator i = m.keySet().iterator(99);
+		assertEquals(100, i.nextLong());
+		assertEquals(100, i.previousLong());
+		assertEquals(98, i.previousLong());
+		assertFalse(m.keySet().iterator(1998).hasNext());
+		assertEquals(1998, m.keySet().iterator(1998).previousLong());
+		final LongBidirectionalIterator j = m.keySet().iterator(-1);
+		assertFalse(j.hasPrevious());
+		for (long k = 0; k < 2000; k += 2) assertEquals(k, j.nextLong());
+		assertFalse(j.hasNext());
+		for (long k = 1998; k >= 0; k -= 2) assertEquals(k, j.previousLong());
+
+		// Removal while going back and forth
+		final LongBidirectionalIterator l = m.keySet().iterator();
+		for (long k = 0; k < 2000; k += 2) {
+			assertEquals(k, l.nextLong());
+			if (k % 4 == 0) l.remove();
+		}
+		assertEquals(500, m.size());
+		for (long k = 1998; k >= 0; k -= 4) {
+			assertEquals(k, l.previousLong());
+			l.remove();
+		}
+		assertTrue(m.isEmpty());
+	}
+
+	@Test
+	public void testWeaklyConsistentIteration() {
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>();
+		for (long i = 0; i < 1000; i++) m.put(i, "");
+		long last = -1;
+		int c = 0;
+		for (final LongIterator i = m.keySet().iterator(); i.hasNext();) {
+			final long k = i.nextLong();
+			assertTrue(k > last);
+			last = k;
+			c++;
+			m.remove(k + 1);
+			if (k < 1000) m.put(k + 2000, "");
+		}
+		assertTrue(c >= 500);
+		assertEquals(1000, m.size());
+	}
+
+	@Test
+	public void testConcurrent() throws InterruptedException {
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>();
+		final Thread[] writer = new Thread[4];
+		final Thread[] reader = new Thread[8];
+		final AtomicBoolean stop = new AtomicBoolean(), failed = new AtomicBoolean();
+		for (int t = 0; t < writer.length; t++) {
+			final int offset = t;
+			// Each writer owns a residue class of keys: the even ones survive
+			writer[t] = new Thread(() -> {
+				for (long i = offset; i < 200000; i += writer.length) {
+					m.put(i, Long.toString(i));
+					if (i % 2 == 1 && !m.remove(i, Long.toString(i))) failed.set(true);
+				}
+			});
+		}
+		for (int t = 0; t < reader.length; t++) {
+			reader[t] = new Thread(() -> {
+				while (!stop.get()) {
+					long last = -1;
+					for (final Long2ObjectMap.Entry<String> e : m.subMap(1000, 100000).long2ObjectEntrySet()) {
+						if (e.getLongKey() <= last || !Long.toString(e.getLongKey()).equals(e.getValue())) failed.set(true);
+						last = e.getLongKey();
+					}
+				}
+			});
+		}
+		for (final Thread t : reader) t.start();
+		for (final Thread t : writer) t.start();
+		for (final Thread t : writer) t.join();
+		stop.set(true);
+		for (final Thread t : reader) t.join();
+		assertFalse(failed.get());
+		assertEquals(100000, m.size());
+		long k = 0;
+		for (final LongIterator i = m.keySet().iterator(); i.hasNext(); k += 2) assertEquals(k, i.nextLong());
+		assertEquals(100000L * 99999, m.keySet().longParallelStream().sum());
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final Long2ObjectConcurrentSkipListMap<String> m = new Long2ObjectConcurrentSkipListMap<>(LongComparators.OPPOSITE_COMPARATOR);
+		for (long i = 0; i < 1000; i++) m.put(i * i, Long.toString(i));
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(m, baos);
+		@SuppressWarnings("unchecked")
+		final Long2ObjectConcurrentSkipListMap<String> n = (Long2ObjectConcurrentSkipListMap<String>)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(m, n);
+		assertEquals(999 * 999, n.firstLongKey());
+		n.put(-1, "");
+		assertEquals(-1, n.lastLongKey());
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class LongBloomFilterTest {
+
+	private static long[] keys(final int n, final long seed) {
+		final SplittableRandom r = new SplittableRandom(seed);
+		final long[] a = new long[n];
+		for (int i = 0; i < n; i++) a[i] = r.nextLong();
+		return a;
+	}
+
+	private static int falsePositives(final LongBloomFilter f, final int n) {
+		int fp = 0;
+		// Keys 0..n-1 are (with overwhelming probability) not among the random keys
+		for (long k = 0; k < n; k++) if (f.mightContain(k)) fp++;
+		return fp;
+	}
+
+	@Test
+	public void testNoFalseNegatives() {
+		final long[] a = keys(100000, 0);
+		final LongBloomFilter f = LongBloomFilter.of(a, .01);
+		for (final long k : a) assertTrue(f.mightContain(k));
+		assertTrue(Integer.toString(falsePositives(f, 100000)), falsePositives(f, 100000) < 2000);
+	}
+
+	@Test
+	public void testAdd() {
+		final LongBloomFilter f = new LongBloomFilter(1000, .001);
+		assertFalse(f.mightContain(42));
+		assertTrue(f.add(42));
+		assertFalse(f.add(42));
+		assertTrue(f.mightContain(42));
+		f.clear();
+		assertFalse(f.mightContain(42));
+	}
+
+	@Test
+	public void testCollection() {
+		final LongOpenHashBigSet s = new LongOpenHashBigSet();
+		for (final long k : keys(10000, 1)) s.add(k);
+		final LongBloomFilter f = LongBloomFilter.of(s, .01);
+		for (final long k : s) assertTrue(f.mightContain(k));
+		assertTrue(falsePositives(f, 10000) < 200);
+	}
+
+	@Test
+	public void testParallelIsSequential() {
+		final long[] a = keys(1000000, 2);
+		assertEquals(LongBloomFilter.of(a, .01), LongBloomFilter.parallelOf(a, .01));
+		final long[][] b = LongBigArrays.wrap(a);
+		assertEquals(LongBloomFilter.of(b, .01), LongBloomFilter.parallelOf(b, .01));
+		assertEquals(LongBloomFilter.of(a, .01), LongBloomFilter.parallelOf(LongArrayList.wrap(a), .01));
+		final LongOpenHashSet s = new LongOpenHashSet(a);
+		assertEquals(LongBloomFilter.of(s, .01), LongBloomFilter.parallelOf(s, .01));
+	}
+
+	@Test
+	public void testMerge() {
+		final long[] a = keys(1000, 3), b = keys(1000, 4);
+		final LongBloomFilter f = new LongBloomFilter(2000), g = new LongBloomFilter(2000);
+		f.addAll(a);
+		g.addAll(b);
+		f.merge(g);
+		for (final long k : a) assertTrue(f.mightContain(k));
+		for (final long k : b) assertTrue(f.mightContain(k));
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final LongBloomFilter f = LongBloomFilter.of(keys(1000, 5), .01);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(f, baos);
+		assertEquals(f, BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray())));
+	}
+}
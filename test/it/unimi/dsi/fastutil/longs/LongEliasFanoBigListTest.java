@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.NoSuchElementException;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class LongEliasFanoBigListTest {
+
+	private static long[] sorted(final int n, final long from, final long spread, final long seed) {
+		final SplittableRandom r = new SplittableRandom(seed);
+		final long[] a = new long[n];
+		for (int i = 0; i < n; i++) a[i] = from + (spread == 0 ? 0 : r.nextLong(spread));
+		Arrays.sort(a);
+		return a;
+	}
+
+	@Test
+	public void testGetAndSuccessor() {
+		for (final long spread : new long[] { 0, 1, 10, 1000, 1L << 40, Long.MAX_VALUE / 2 }) {
+			for (final int n : new int[] { 0, 1, 2, 10, 1000, 10000 }) {
+				final long[] a = sorted(n, -(spread / 4), spread, n + spread);
+				final LongEliasFanoBigList l = new LongEliasFanoBigList(a);
+				assertEquals(n, l.size64());
+				for (int i = 0; i < n; i++) assertEquals(a[i], l.getLong(i));
+				assertEquals(LongBigArrayBigList.wrap(LongBigArrays.wrap(a)), l);
+				assertArrayEquals(a, LongIterators.unwrap(l.iterator()));
+				final SplittableRandom r = new SplittableRandom(n);
+				for (int k = 0; k < 1000; k++) {
+					final long x = n != 0 && r.nextBoolean() ? a[r.nextInt(n)] + r.nextInt(3) - 1 : -(spread / 4) - 10 + (spread == 0 ? r.nextInt(20) : r.nextLong(spread + 20));
+					int expected = Arrays.binarySearch(a, x);
+					if (expected < 0) expected = -expected - 1;
+					else while (expected > 0 && a[expected - 1] == x) expected--;
+					assertEquals(expected, l.successorIndex(x));
+					assertEquals(n != 0 && Arrays.binarySearch(a, x) >= 0, l.contains(x));
+				}
+			}
+		}
+	}
+
+	@Test
+	public void testExtremes() {
+		final long[] a = { Long.MIN_VALUE / 2, -1, 0, Long.MAX_VALUE / 2 };
+		final LongEliasFanoBigList l = new LongEliasFanoBigList(a);
+		for (int i = 0; i < a.length; i++) assertEquals(a[i], l.getLong(i));
+		assertEquals(0, l.successorIndex(Long.MIN_VALUE));
+		assertEquals(4, l.successorIndex(Long.MAX_VALUE));
+		assertEquals(3, l.successorIndex(1));
+		boolean thrown = false;
+		try {
+			new LongEliasFanoBigList(new long[] { Long.MIN_VALUE, Long.MAX_VALUE });
+		} catch (final IllegalArgumentException e) {
+			thrown = true;
+		}
+		assertTrue(thrown);
+		thrown = false;
+		try {
+			new LongEliasFanoBigList(new long[] { 2, 1 });
+		} catch (final IllegalArgumentException e) {
+			thrown = true;
+		}
+		assertTrue(thrown);
+	}
+
+	@Test
+	public void testDuplicates() {
+		final long[] a = { 1, 1, 1, 5, 5, 7, 7, 7, 7 };
+		final LongEliasFanoBigList l = new LongEliasFanoBigList(LongArrayList.wrap(a).iterator());
+		assertEquals(0, l.indexOf(1));
+		assertEquals(2, l.lastIndexOf(1));
+		assertEquals(3, l.indexOf(5));
+		assertEquals(4, l.lastIndexOf(5));
+		assertEquals(8, l.lastIndexOf(7));
+		assertEquals(-1, l.indexOf(6));
+		assertEquals(-1, l.lastIndexOf(0));
+	}
+
+	@Test
+	public void testIteratorsAndSpliterators() {
+		final long[] a = sorted(100000, 0, 1L << 30, 0);
+		final LongEliasFanoBigList l = new LongEliasFanoBigList(a.length, 0, 1L << 30, LongArrayList.wrap(a).iterator());
+		final LongBigListIterator i = l.listIterator(500);
+		assertEquals(a[500], i.nextLong());
+		assertEquals(1000, i.skip(1000));
+		assertEquals(a[1501], i.nextLong());
+		assertEquals(a[1501], i.previousLong());
+		assertEquals(a[1500], i.previousLong());
+		assertEquals(a[1500], i.nextLong());
+		assertEquals(a[1501], i.nextLong());
+		assertEquals(a.length - 1502, i.skip(Long.MAX_VALUE));
+		assertFalse(i.hasNext());
+
+		final long[][] b = LongBigArrays.newBigArray(1000);
+		l.getElements(10000, b, 0, 1000);
+		for (int k = 0; k < 1000; k++) assertEquals(a[10000 + k], BigArrays.get(b, k));
+
+		long sum = 0;
+		for (final long x : a) sum += x;
+		assertEquals(sum, l.longParallelStream().sum());
+		assertArrayEquals(a, l.longParallelStream().toArray());
+		final LongSpliterator s = l.spliterator();
+		final LongSpliterator prefix = s.trySplit();
+		assertEquals(a.length / 2, prefix.estimateSize());
+		assertEquals(a.length - a.length / 2, s.estimateSize());
+		assertEquals(10, s.skip(10));
+		s.tryAdvance((java.util.function.LongConsumer)x -> assertEquals(a[a.length / 2 + 10], x));
+	}
+
+	@Test
+	public void testSortedSet() {
+		final long[] a = sorted(10000, 0, 1L << 20, 1);
+		final LongRBTreeSet t = new LongRBTreeSet(a);
+		final LongEliasFanoSortedSet s = new LongEliasFanoSortedSet(t.iterator());
+		assertEquals(t, s);
+		assertEquals(t.size(), s.size64());
+		assertEquals(t.firstLong(), s.firstLong());
+		assertEquals(t.lastLong(), s.lastLong());
+		final SplittableRandom r = new SplittableRandom(0);
+		for (int k = 0; k < 1000; k++) {
+			final long x = r.nextLong(1L << 20);
+			final long y = x + r.nextInt(100000);
+			assertEquals(t.contains(x), s.contains(x));
+			assertEquals(t.tailSet(x), s.tailSet(x));
+			assertEquals(t.headSet(x), s.headSet(x));
+			assertEquals(t.subSet(x, y), s.subSet(x, y));
+			assertEquals(t.subSet(x, Math.min(x + 10, y)), s.subSet(x, y).headSet(x + 10));
+			final LongSortedSet tail = t.tailSet(x);
+			if (tail.isEmpty()) {
+				boolean thrown = false;
+				try {
+					s.successor(x);
+				} catch (final NoSuchElementException e) {
+					thrown = true;
+				}
+				assertTrue(thrown);
+			} else assertEquals(tail.firstLong(), s.successor(x));
+			final LongBidirectionalIterator i = s.iterator(x), j = t.iterator(x);
+			for (int h = 0; h < 10 && j.hasNext(); h++) assertEquals(j.nextLong(), i.nextLong());
+			for (int h = 0; h < 20 && j.hasPrevious(); h++) assertEquals(j.previousLong(), i.previousLong());
+		}
+		final LongEliasFanoSortedSet sub = (LongEliasFanoSortedSet)s.subSet(1000, 100000);
+		assertEquals(new LongBigArrayBigList(t.subSet(1000, 100000).iterator()), sub.asBigList());
+		assertArrayEquals(t.subSet(1000, 100000).toLongArray(), sub.longParallelStream().toArray());
+		assertArrayEquals(t.toLongArray(), s.longStream().sorted().toArray());
+
+		boolean thrown = false;
+		try {
+			new LongEliasFanoSortedSet(new long[] { 1, 2, 2 });
+		} catch (final IllegalArgumentException e) {
+			thrown = true;
+		}
+		assertTrue(thrown);
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final long[] a = sorted(100000, 1L << 40, 1L << 35, 2);
+		final LongEliasFanoBigList l = new LongEliasFanoBigList(a);
+		assertTrue(l.numBits() < 24L * a.length);
+		ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(l, baos);
+		final LongEliasFanoBigList m = (LongEliasFanoBigList)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(l, m);
+		assertEquals(l.successorIndex(a[5000]), m.successorIndex(a[5000]));
+
+		final LongEliasFanoSortedSet s = (LongEliasFanoSortedSet)new LongEliasFanoSortedSet(new long[] { 1, 3, 5, 7, 9 }).subSet(3, 9);
+		baos = new ByteArrayOutputStream();
+		BinIO.storeObject(s, baos);
+		final LongEliasFanoSortedSet t = (LongEliasFanoSortedSet)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(s, t);
+		assertEquals(3, t.size64());
+		assertEquals(7, t.successor(6));
+	}
+}
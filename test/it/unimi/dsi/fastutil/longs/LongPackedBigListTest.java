@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.Arrays;
+import java.util.SplittableRandom;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.BigArrays;
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class LongPackedBigListTest {
+
+	private static long[] random(final int n, final long spread, final boolean sort, final long seed) {
+		final SplittableRandom r = new SplittableRandom(seed);
+		final long[] a = new long[n];
+		for (int i = 0; i < n; i++) a[i] = spread == 0 ? 42 : r.nextLong() % spread;
+		if (sort) Arrays.sort(a);
+		return a;
+	}
+
+	private static void check(final long[] a) {
+		final LongPackedBigList l = new LongPackedBigList(a);
+		final int n = a.length;
+		assertEquals(n, l.size64());
+		for (int i = 0; i < n; i++) assertEquals(a[i], l.getLong(i));
+		assertEquals(LongBigArrayBigList.wrap(LongBigArrays.wrap(a)), l);
+		assertArrayEquals(a, LongIterators.unwrap(l.iterator()));
+
+		final SplittableRandom r = new SplittableRandom(n);
+		for (int k = 0; k < 100 && n != 0; k++) {
+			final int from = r.nextInt(n), length = r.nextInt(n - from + 1);
+			final long[] b = new long[length + 3];
+			l.getElements(from, b, 3, length);
+			assertArrayEquals(Arrays.copyOfRange(a, from, from + length), Arrays.copyOfRange(b, 3, b.length));
+		}
+
+		final long[][] b = LongBigArrays.newBigArray(n + 5);
+		l.getElements(0, b, 5, n);
+		for (int i = 0; i < n; i++) assertEquals(a[i], BigArrays.get(b, i + 5));
+
+		final LongBigListIterator i = l.listIterator(n / 2);
+		for (int j = n / 2; j-- != 0;) assertEquals(a[j], i.previousLong());
+		assertEquals(n, l.longStream().parallel().count());
+		assertEquals(Arrays.stream(a).sum(), l.longStream().parallel().sum());
+	}
+
+	@Test
+	public void testRandom() {
+		for (final long spread : new long[] { 0, 1, 10, 1000, 1L << 40, Long.MAX_VALUE })
+			for (final int n : new int[] { 0, 1, 2, 127, 128, 129, 1000, 10000 }) {
+				check(random(n, spread, false, n + spread));
+				check(random(n, spread, true, n + spread));
+			}
+	}
+
+	@Test
+	public void testExtremes() {
+		check(new long[] { Long.MIN_VALUE, Long.MAX_VALUE, 0, -1, Long.MIN_VALUE });
+		check(new long[] { Long.MIN_VALUE, -1, 0, Long.MAX_VALUE });
+	}
+
+	@Test
+	public void testCompression() {
+		final long[] a = new long[100000];
+		for (int i = 1; i < a.length; i++) a[i] = a[i - 1] + (i % 3);
+		final LongPackedBigList l = new LongPackedBigList(a);
+		// Gaps require two bits per element
+		assertTrue(l.numBits() < 4L * a.length);
+		for (int i = 0; i < a.length; i++) assertEquals(a[i], l.getLong(i));
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final long[] a = random(1000, 1000, false, 0);
+		final LongPackedBigList l = new LongPackedBigList(a);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(l, baos);
+		assertEquals(l, BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray())));
+	}
+}
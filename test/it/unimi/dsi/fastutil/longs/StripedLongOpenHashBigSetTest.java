@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.longs;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.util.SplittableRandom;
+import java.util.stream.LongStream;
+
+import org.junit.Test;
+
+import it.unimi.dsi.fastutil.io.BinIO;
+
+public class StripedLongOpenHashBigSetTest {
+
+	@Test
+	public void testBasic() {
+		final StripedLongOpenHashBigSet s = new StripedLongOpenHashBigSet(0, 5);
+		assertEquals(4, s.concurrencyLevel());
+		for (long i = 0; i < 1000; i++) assertTrue(s.add(i));
+		for (long i = 0; i < 1000; i++) assertFalse(s.add(i));
+		assertEquals(1000, s.size64());
+		for (long i = 0; i < 1000; i += 2) assertTrue(s.remove(i));
+		assertEquals(500, s.size64());
+		for (long i = 0; i < 1000; i++) assertEquals(i % 2 != 0, s.contains(i));
+		final LongOpenHashSet t = new LongOpenHashSet();
+		s.forEach(t::add);
+		assertEquals(t, s);
+		s.clear();
+		assertTrue(s.isEmpty());
+	}
+
+	@Test
+	public void testConcurrentAdd() throws InterruptedException {
+		final StripedLongOpenHashBigSet s = new StripedLongOpenHashBigSet();
+		final Thread[] thread = new Thread[8];
+		for (int t = 0; t < thread.length; t++) {
+			final int offset = t;
+			// Threads insert overlapping ranges
+			thread[t] = new Thread(() -> {
+				for (long i = offset * 10000L; i < offset * 10000L + 20000; i++) s.add(i);
+			});
+			thread[t].start();
+		}
+		for (final Thread t : thread) t.join();
+		assertEquals(90000, s.size64());
+		for (long i = 0; i < 90000; i++) assertTrue(s.contains(i));
+	}
+
+	@Test
+	public void testParallelAddAll() {
+		final SplittableRandom r = new SplittableRandom(0);
+		final long[][] a = LongBigArrays.newBigArray(1000000);
+		for (long i = 0; i < LongBigArrays.length(a); i++) LongBigArrays.set(a, i, r.nextLong(500000));
+		final StripedLongOpenHashBigSet s = new StripedLongOpenHashBigSet();
+		s.parallelAddAll(a);
+		final LongOpenHashBigSet t = new LongOpenHashBigSet();
+		for (final long[] segment : a) t.addAll(LongArrayList.wrap(segment));
+		assertEquals(t, s);
+	}
+
+	@Test
+	public void testMerge() {
+		final StripedLongOpenHashBigSet s = new StripedLongOpenHashBigSet(0, 8), t = new StripedLongOpenHashBigSet(0, 8);
+		for (long i = 0; i < 1000; i++) s.add(i);
+		for (long i = 500; i < 1500; i++) t.add(i);
+		assertTrue(s.addAll(t));
+		assertFalse(s.addAll(t));
+		assertEquals(1500, s.size64());
+		for (long i = 0; i < 1500; i++) assertTrue(s.contains(i));
+	}
+
+	@Test
+	public void testToBigSet() {
+		final StripedLongOpenHashBigSet s = StripedLongOpenHashBigSet.toBigSet(LongStream.range(0, 100000).parallel().map(x -> x / 2));
+		assertEquals(50000, s.size64());
+		for (long i = 0; i < 50000; i++) assertTrue(s.contains(i));
+	}
+
+	@Test
+	public void testSerialization() throws IOException, ClassNotFoundException {
+		final StripedLongOpenHashBigSet s = new StripedLongOpenHashBigSet();
+		for (long i = 0; i < 1000; i++) s.add(i * i);
+		final ByteArrayOutputStream baos = new ByteArrayOutputStream();
+		BinIO.storeObject(s, baos);
+		final StripedLongOpenHashBigSet t = (StripedLongOpenHashBigSet)BinIO.loadObject(new ByteArrayInputStream(baos.toByteArray()));
+		assertEquals(s, t);
+		assertTrue(t.add(-1));
+	}
+}
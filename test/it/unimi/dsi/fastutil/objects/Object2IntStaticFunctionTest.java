@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2022 Sebastiano Vigna
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package it.unimi.dsi.fastutil.objects;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.Test;
+
+public class Object2IntStaticFunctionTest {
+
+	@Test
+	public void testStrings() {
+		final Object2IntOpenHashMap<String> m = new Object2IntOpenHashMap<>();
+		for (int i = 0; i < 50000; i++) m.put("term" + i, i);
+		m.defaultReturnValue(-1);
+		final Object2IntStaticFunction<String> f = new Object2IntStaticFunction<>(m, 64);
+		assertEquals(m.size(), f.size());
+		for (int i = 0; i < 50000; i++) assertEquals(i, f.getInt("term" + i));
+		for (int i = 50000; i < 60000; i++) {
+			assertFalse(f.containsKey("term" + i));
+			assertEquals(-1, f.getInt("term" + i));
+		}
+		assertTrue(f.numBits() < 50000L * 70);
+	}
+
+	@Test
+	public void testHasher() {
+		final Long[] k = new Long[1000];
+		final int[] v = new int[1000];
+		for (int i = 0; i < k.length; i++) {
+			k[i] = Long.valueOf(i * 1000000007L);
+			v[i] = i;
+		}
+		final Object2IntStaticFunction<Long> f = new Object2IntStaticFunction<>(k, v, 0, x -> x.longValue());
+		for (int i = 0; i < k.length; i++) assertEquals(i, f.getInt(k[i]));
+	}
+}